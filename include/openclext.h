@@ -0,0 +1,283 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// clang-format off
+
+#ifndef OPENCLEXT_H_
+#define OPENCLEXT_H_
+
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+* Statistics
+***************************************************************/
+
+/*
+// Writes all statistics collected by the OpenCL Extension Loader to stream.
+// Which statistics are collected depends on the options the OpenCL Extension
+// Loader was built with.  If the CLEXT_STATS_FILE environment variable is
+// set, statistics are also written to the named file when the process exits.
+*/
+extern CL_API_ENTRY cl_int CL_API_CALL
+clextDumpStats(
+    FILE* stream);
+
+/***************************************************************
+* Extension Function Resolution
+***************************************************************/
+
+/*
+// Writes how each dispatch table initialized by the OpenCL Extension Loader
+// was resolved to stream: for each platform, which extension APIs were found
+// and which were not, and how long each lookup took, followed by information
+// about the ICD loader, if available.  If the CLEXT_DEBUG_RESOLUTION
+// environment variable is set to a value other than 0, this information is
+// also written to stderr as each dispatch table is initialized.
+*/
+extern CL_API_ENTRY cl_int CL_API_CALL
+clextDumpResolution(
+    FILE* stream);
+
+/***************************************************************
+* Extension Function Lookup
+***************************************************************/
+
+/*
+// Returns the address of the extension API func_name for platform, or NULL if
+// the extension API is not supported by the platform or is not known to the
+// OpenCL Extension Loader.  The address is found in the dispatch tables that
+// the OpenCL Extension Loader has already initialized, so after the dispatch
+// tables are initialized this does not call into the ICD loader.
+*/
+extern CL_API_ENTRY void* CL_API_CALL
+clextGetFunctionAddress(
+    cl_platform_id platform,
+    const char* func_name);
+
+/***************************************************************
+* Pooled Unified Shared Memory
+***************************************************************/
+
+#if defined(cl_intel_unified_shared_memory)
+
+/*
+// Allocate and free unified shared memory like the corresponding
+// cl_intel_unified_shared_memory extension APIs, but small allocations are
+// carved from larger allocations that are kept in a pool for each context,
+// device, and type of unified shared memory, so most allocations and frees do
+// not call into the OpenCL implementation.  Allocations with properties are
+// not pooled.  Memory allocated by these functions must be freed by
+// clextMemFreeINTEL, and as for clMemFreeINTEL, it must no longer be in use
+// when it is freed.  clextMemPoolTrimINTEL releases all pooled memory for
+// context that is not currently allocated.
+*/
+extern CL_API_ENTRY void* CL_API_CALL
+clextHostMemAllocINTEL(
+    cl_context context,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret);
+
+extern CL_API_ENTRY void* CL_API_CALL
+clextDeviceMemAllocINTEL(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret);
+
+extern CL_API_ENTRY void* CL_API_CALL
+clextSharedMemAllocINTEL(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret);
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clextMemFreeINTEL(
+    cl_context context,
+    void* ptr);
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clextMemPoolTrimINTEL(
+    cl_context context);
+
+/*
+// Frees ptr, which may have been allocated by any of the above functions or
+// by the cl_intel_unified_shared_memory extension APIs, after all of the
+// events have completed.  This function does not wait for the events:
+// the memory is freed by a background thread.  If an error is returned, ptr
+// is not freed.
+*/
+extern CL_API_ENTRY cl_int CL_API_CALL
+clextMemFreeAfterEvents(
+    cl_context context,
+    void* ptr,
+    cl_uint num_events,
+    const cl_event* events);
+
+/*
+// Enqueue a copy or fill like clEnqueueMemcpyINTEL or clEnqueueMemFillINTEL,
+// but split into chunks that are enqueued to each of the queues, so large
+// transfers may use more copy engines or threads.  The queues must belong to
+// the same context.  Transfers that are too small to split are enqueued to
+// the first queue.  If an event is requested, it is an event on the first
+// queue that completes when all of the chunks complete.  If a chunk cannot be
+// enqueued, the error is returned after the chunks that were enqueued before
+// it complete.
+*/
+extern CL_API_ENTRY cl_int CL_API_CALL
+clextEnqueueMemcpySplit(
+    cl_uint num_queues,
+    const cl_command_queue* queues,
+    cl_bool blocking,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clextEnqueueMemFillSplit(
+    cl_uint num_queues,
+    const cl_command_queue* queues,
+    void* dst_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+
+/*
+// Enqueue migrations of the shared USM allocations that are kernel arguments
+// to the device for the queue, so they are resident before the kernel is
+// enqueued.  Allocations used by more than one argument are migrated once,
+// and pooled allocations are migrated without the rest of the pool.  If
+// advice is not zero, it is applied to each migrated range first.  Kernel arguments are only recorded when the OpenCL
+// Extension Loader is built with OPENCL_EXTENSION_LOADER_ENABLE_USM_PREFETCH,
+// otherwise nothing is migrated.
+*/
+extern CL_API_ENTRY cl_int CL_API_CALL
+clextEnqueuePrefetchKernelArgs(
+    cl_command_queue command_queue,
+    cl_kernel kernel,
+    cl_mem_advice_intel advice,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+
+/*
+// Forget the kernel arguments recorded for clextEnqueuePrefetchKernelArgs.
+// Call this before releasing a kernel whose arguments were set with
+// clSetKernelArgMemPointerINTEL, since the arguments are otherwise kept until
+// they are cleared, and a new kernel with the same handle would use them.
+*/
+extern CL_API_ENTRY cl_int CL_API_CALL
+clextReleaseKernelArgs(
+    cl_kernel kernel);
+
+/*
+// Statistics for the USM of one type allocated for one device in one context.
+// Allocation sizes are counted in buckets that grow by a factor of 16:
+// <= 64B, <= 1KB, <= 16KB, <= 256KB, <= 4MB, <= 64MB, and larger.
+*/
+#define CLEXT_USM_STATS_SIZE_BUCKET_COUNT 7
+
+typedef struct clext_usm_stats {
+    cl_ulong live_bytes;
+    cl_ulong high_water_bytes;
+    cl_ulong live_allocations;
+    cl_ulong total_allocations;
+    cl_ulong total_frees;
+    cl_ulong size_buckets[CLEXT_USM_STATS_SIZE_BUCKET_COUNT];
+} clext_usm_stats;
+
+/*
+// Gets the statistics for the USM of the given type allocated for device in
+// context.  device is NULL for host USM.  The statistics are all zero if no
+// USM of the given type has been allocated for device in context.  Returns
+// CL_INVALID_OPERATION unless the OpenCL Extension Loader is built with
+// OPENCL_EXTENSION_LOADER_ENABLE_USM_STATS.
+*/
+extern CL_API_ENTRY cl_int CL_API_CALL
+clextGetUSMStats(
+    cl_context context,
+    cl_device_id device,
+    cl_unified_shared_memory_type_intel type,
+    clext_usm_stats* stats);
+
+#endif // defined(cl_intel_unified_shared_memory)
+
+/***************************************************************
+* Pooled ARM Shared Virtual Memory
+***************************************************************/
+
+#if defined(cl_arm_shared_virtual_memory)
+
+/*
+// Allocate and free SVM like clSVMAllocARM and clSVMFreeARM, but small
+// allocations are carved from larger allocations that are kept in a pool for
+// each context and set of SVM flags, so most allocations and frees do not
+// call into the OpenCL implementation.  Memory allocated by clextSVMAllocARM
+// must be freed by clextSVMFreeARM or clextEnqueueSVMFreeARM, and as for
+// clSVMFreeARM, it must no longer be in use when it is freed by
+// clextSVMFreeARM.  clextSVMPoolTrimARM releases all pooled memory for context
+// that is not currently allocated.
+*/
+extern CL_API_ENTRY void* CL_API_CALL
+clextSVMAllocARM(
+    cl_context context,
+    cl_svm_mem_flags_arm flags,
+    size_t size,
+    cl_uint alignment);
+
+extern CL_API_ENTRY void CL_API_CALL
+clextSVMFreeARM(
+    cl_context context,
+    void* svm_pointer);
+
+extern CL_API_ENTRY cl_int CL_API_CALL
+clextSVMPoolTrimARM(
+    cl_context context);
+
+/*
+// Enqueue a free like clEnqueueSVMFreeARM.  If pfn_free_func is NULL, the
+// pointers are returned to the pool by clextSVMFreeARM when the free command
+// executes, after the commands it waits for complete.  Otherwise,
+// pfn_free_func is called instead, and must free the pointers with
+// clextSVMFreeARM.
+*/
+extern CL_API_ENTRY cl_int CL_API_CALL
+clextEnqueueSVMFreeARM(
+    cl_command_queue command_queue,
+    cl_uint num_svm_pointers,
+    void* svm_pointers[],
+    void (CL_CALLBACK* pfn_free_func)(cl_command_queue queue, cl_uint num_svm_pointers, void* svm_pointers[], void* user_data),
+    void* user_data,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+
+#endif // defined(cl_arm_shared_virtual_memory)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OPENCLEXT_H_
@@ -0,0 +1,4369 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+/*
+// This file is generated from the Khronos OpenCL XML API Registry.
+*/
+
+// clang-format off
+
+// A header-only C++ API for the OpenCL extension APIs.  Each extension API is
+// a member function of clext::Dispatch<Policy>, and the Policy decides how
+// the dispatch table is found, so each component of an application can make
+// its own tradeoff:
+//
+// clext::SinglePlatform:
+//     Uses one dispatch table, for the platform of the first object that is
+//     used, for all objects.  Finding the dispatch table is a single load.
+// clext::MultiPlatformCached:
+//     Initializes a dispatch table for every platform the first time it is
+//     used, then finds the dispatch table for the platform of each object.
+// clext::ExplicitTable:
+//     Uses a dispatch table that is passed to the constructor, for example:
+//
+//         clext::DispatchTable table(platform);
+//         clext::Dispatch<clext::ExplicitTable> ext(clext::ExplicitTable(&table));
+//         ext.clEnqueueMemcpyINTEL(queue, CL_TRUE, dst, src, size, 0, nullptr, nullptr);
+//
+// The dispatch tables are separate from the dispatch tables in the OpenCL
+// Extension Loader library, and the hooks in the library are not called.
+// Extension APIs that are not per-platform, such as cl_loader_info, are not
+// included.
+//
+// clext::UsmRing<Policy> is a ring of records in unified shared memory that a
+// host thread can stream to kernels without copying.
+
+#ifndef OPENCLEXT_HPP_
+#define OPENCLEXT_HPP_
+
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+#if defined(CLEXT_INCLUDE_GL)
+#include <CL/cl_gl.h>
+// Some versions of the headers to not define cl_khr_gl_event.
+#ifndef cl_khr_gl_event
+#define cl_khr_gl_event 1
+#endif
+#endif
+#if defined(CLEXT_INCLUDE_EGL)
+#include <CL/cl_egl.h>
+#endif
+#if defined(CLEXT_INCLUDE_DX9)
+#include <CL/cl_dx9_media_sharing.h>
+#endif
+// Note: If both D3D10 and D3D11 are supported, the D3D11 header must be
+// included first.
+#if defined(CLEXT_INCLUDE_D3D11)
+#include <CL/cl_d3d11.h>
+#endif
+#if defined(CLEXT_INCLUDE_D3D10)
+#include <CL/cl_d3d10.h>
+#endif
+#if defined(CLEXT_INCLUDE_VA_API)
+#include <CL/cl_va_api_media_sharing_intel.h>
+#endif
+
+#include <stddef.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+
+// Initialization is kept out of line so only finding an initialized dispatch
+// table is inlined into each call.
+#if !defined(CLEXT_NOINLINE)
+#if defined(_MSC_VER)
+#define CLEXT_NOINLINE __declspec(noinline)
+#elif defined(__GNUC__)
+#define CLEXT_NOINLINE __attribute__((noinline))
+#else
+#define CLEXT_NOINLINE
+#endif
+#endif
+
+namespace clext {
+
+/***************************************************************
+* Function Pointer Typedefs
+***************************************************************/
+
+namespace detail {
+
+#if defined(cl_khr_command_buffer)
+typedef cl_command_buffer_khr (CL_API_CALL* clCreateCommandBufferKHR_fn)(
+    cl_uint num_queues,
+    const cl_command_queue* queues,
+    const cl_command_buffer_properties_khr* properties,
+    cl_int* errcode_ret);
+typedef cl_int (CL_API_CALL* clFinalizeCommandBufferKHR_fn)(
+    cl_command_buffer_khr command_buffer);
+typedef cl_int (CL_API_CALL* clRetainCommandBufferKHR_fn)(
+    cl_command_buffer_khr command_buffer);
+typedef cl_int (CL_API_CALL* clReleaseCommandBufferKHR_fn)(
+    cl_command_buffer_khr command_buffer);
+typedef cl_int (CL_API_CALL* clEnqueueCommandBufferKHR_fn)(
+    cl_uint num_queues,
+    cl_command_queue* queues,
+    cl_command_buffer_khr command_buffer,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clCommandBarrierWithWaitListKHR_fn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+typedef cl_int (CL_API_CALL* clCommandCopyBufferKHR_fn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_buffer,
+    cl_mem dst_buffer,
+    size_t src_offset,
+    size_t dst_offset,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+typedef cl_int (CL_API_CALL* clCommandCopyBufferRectKHR_fn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_buffer,
+    cl_mem dst_buffer,
+    const size_t* src_origin,
+    const size_t* dst_origin,
+    const size_t* region,
+    size_t src_row_pitch,
+    size_t src_slice_pitch,
+    size_t dst_row_pitch,
+    size_t dst_slice_pitch,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+typedef cl_int (CL_API_CALL* clCommandCopyBufferToImageKHR_fn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_buffer,
+    cl_mem dst_image,
+    size_t src_offset,
+    const size_t* dst_origin,
+    const size_t* region,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+typedef cl_int (CL_API_CALL* clCommandCopyImageKHR_fn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_image,
+    cl_mem dst_image,
+    const size_t* src_origin,
+    const size_t* dst_origin,
+    const size_t* region,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+typedef cl_int (CL_API_CALL* clCommandCopyImageToBufferKHR_fn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_image,
+    cl_mem dst_buffer,
+    const size_t* src_origin,
+    const size_t* region,
+    size_t dst_offset,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+typedef cl_int (CL_API_CALL* clCommandFillBufferKHR_fn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem buffer,
+    const void* pattern,
+    size_t pattern_size,
+    size_t offset,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+typedef cl_int (CL_API_CALL* clCommandFillImageKHR_fn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem image,
+    const void* fill_color,
+    const size_t* origin,
+    const size_t* region,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+typedef cl_int (CL_API_CALL* clCommandNDRangeKernelKHR_fn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_kernel kernel,
+    cl_uint work_dim,
+    const size_t* global_work_offset,
+    const size_t* global_work_size,
+    const size_t* local_work_size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+typedef cl_int (CL_API_CALL* clGetCommandBufferInfoKHR_fn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_buffer_info_khr param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret);
+typedef cl_int (CL_API_CALL* clCommandSVMMemcpyKHR_fn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+typedef cl_int (CL_API_CALL* clCommandSVMMemFillKHR_fn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    void* svm_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+#endif // defined(cl_khr_command_buffer)
+#if defined(cl_khr_command_buffer_multi_device)
+typedef cl_command_buffer_khr (CL_API_CALL* clRemapCommandBufferKHR_fn)(
+    cl_command_buffer_khr command_buffer,
+    cl_bool automatic,
+    cl_uint num_queues,
+    const cl_command_queue* queues,
+    cl_uint num_handles,
+    const cl_mutable_command_khr* handles,
+    cl_mutable_command_khr* handles_ret,
+    cl_int* errcode_ret);
+#endif // defined(cl_khr_command_buffer_multi_device)
+#if defined(cl_khr_command_buffer_mutable_dispatch)
+typedef cl_int (CL_API_CALL* clUpdateMutableCommandsKHR_fn)(
+    cl_command_buffer_khr command_buffer,
+    cl_uint num_configs,
+    const cl_command_buffer_update_type_khr* config_types,
+    const void** configs);
+typedef cl_int (CL_API_CALL* clGetMutableCommandInfoKHR_fn)(
+    cl_mutable_command_khr command,
+    cl_mutable_command_info_khr param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret);
+#endif // defined(cl_khr_command_buffer_mutable_dispatch)
+#if defined(cl_khr_create_command_queue)
+typedef cl_command_queue (CL_API_CALL* clCreateCommandQueueWithPropertiesKHR_fn)(
+    cl_context context,
+    cl_device_id device,
+    const cl_queue_properties_khr* properties,
+    cl_int* errcode_ret);
+#endif // defined(cl_khr_create_command_queue)
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_khr_d3d10_sharing)
+typedef cl_int (CL_API_CALL* clGetDeviceIDsFromD3D10KHR_fn)(
+    cl_platform_id platform,
+    cl_d3d10_device_source_khr d3d_device_source,
+    void* d3d_object,
+    cl_d3d10_device_set_khr d3d_device_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices);
+typedef cl_mem (CL_API_CALL* clCreateFromD3D10BufferKHR_fn)(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D10Buffer* resource,
+    cl_int* errcode_ret);
+typedef cl_mem (CL_API_CALL* clCreateFromD3D10Texture2DKHR_fn)(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D10Texture2D* resource,
+    UINT subresource,
+    cl_int* errcode_ret);
+typedef cl_mem (CL_API_CALL* clCreateFromD3D10Texture3DKHR_fn)(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D10Texture3D* resource,
+    UINT subresource,
+    cl_int* errcode_ret);
+typedef cl_int (CL_API_CALL* clEnqueueAcquireD3D10ObjectsKHR_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clEnqueueReleaseD3D10ObjectsKHR_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+#endif // defined(cl_khr_d3d10_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_khr_d3d11_sharing)
+typedef cl_int (CL_API_CALL* clGetDeviceIDsFromD3D11KHR_fn)(
+    cl_platform_id platform,
+    cl_d3d11_device_source_khr d3d_device_source,
+    void* d3d_object,
+    cl_d3d11_device_set_khr d3d_device_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices);
+typedef cl_mem (CL_API_CALL* clCreateFromD3D11BufferKHR_fn)(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D11Buffer* resource,
+    cl_int* errcode_ret);
+typedef cl_mem (CL_API_CALL* clCreateFromD3D11Texture2DKHR_fn)(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D11Texture2D* resource,
+    UINT subresource,
+    cl_int* errcode_ret);
+typedef cl_mem (CL_API_CALL* clCreateFromD3D11Texture3DKHR_fn)(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D11Texture3D* resource,
+    UINT subresource,
+    cl_int* errcode_ret);
+typedef cl_int (CL_API_CALL* clEnqueueAcquireD3D11ObjectsKHR_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clEnqueueReleaseD3D11ObjectsKHR_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+#endif // defined(cl_khr_d3d11_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_khr_dx9_media_sharing)
+typedef cl_int (CL_API_CALL* clGetDeviceIDsFromDX9MediaAdapterKHR_fn)(
+    cl_platform_id platform,
+    cl_uint num_media_adapters,
+    cl_dx9_media_adapter_type_khr* media_adapter_type,
+    void* media_adapters,
+    cl_dx9_media_adapter_set_khr media_adapter_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices);
+typedef cl_mem (CL_API_CALL* clCreateFromDX9MediaSurfaceKHR_fn)(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_dx9_media_adapter_type_khr adapter_type,
+    void* surface_info,
+    cl_uint plane,
+    cl_int* errcode_ret);
+typedef cl_int (CL_API_CALL* clEnqueueAcquireDX9MediaSurfacesKHR_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clEnqueueReleaseDX9MediaSurfacesKHR_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+#endif // defined(cl_khr_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_event)
+typedef cl_event (CL_API_CALL* clCreateEventFromEGLSyncKHR_fn)(
+    cl_context context,
+    CLeglSyncKHR sync,
+    CLeglDisplayKHR display,
+    cl_int* errcode_ret);
+#endif // defined(cl_khr_egl_event)
+#endif // defined(CLEXT_INCLUDE_EGL)
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_image)
+typedef cl_mem (CL_API_CALL* clCreateFromEGLImageKHR_fn)(
+    cl_context context,
+    CLeglDisplayKHR egldisplay,
+    CLeglImageKHR eglimage,
+    cl_mem_flags flags,
+    const cl_egl_image_properties_khr* properties,
+    cl_int* errcode_ret);
+typedef cl_int (CL_API_CALL* clEnqueueAcquireEGLObjectsKHR_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clEnqueueReleaseEGLObjectsKHR_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+#endif // defined(cl_khr_egl_image)
+#endif // defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_external_memory)
+typedef cl_int (CL_API_CALL* clEnqueueAcquireExternalMemObjectsKHR_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_mem_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clEnqueueReleaseExternalMemObjectsKHR_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_mem_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+#endif // defined(cl_khr_external_memory)
+#if defined(cl_khr_external_semaphore)
+typedef cl_int (CL_API_CALL* clGetSemaphoreHandleForTypeKHR_fn)(
+    cl_semaphore_khr sema_object,
+    cl_device_id device,
+    cl_external_semaphore_handle_type_khr handle_type,
+    size_t handle_size,
+    void* handle_ptr,
+    size_t* handle_size_ret);
+#endif // defined(cl_khr_external_semaphore)
+#if defined(cl_khr_external_semaphore_sync_fd)
+typedef cl_int (CL_API_CALL* clReImportSemaphoreSyncFdKHR_fn)(
+    cl_semaphore_khr sema_object,
+    cl_semaphore_reimport_properties_khr* reimport_props,
+    int fd);
+#endif // defined(cl_khr_external_semaphore_sync_fd)
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_khr_gl_event)
+typedef cl_event (CL_API_CALL* clCreateEventFromGLsyncKHR_fn)(
+    cl_context context,
+    cl_GLsync sync,
+    cl_int* errcode_ret);
+#endif // defined(cl_khr_gl_event)
+#endif // defined(CLEXT_INCLUDE_GL)
+#if defined(cl_khr_il_program)
+typedef cl_program (CL_API_CALL* clCreateProgramWithILKHR_fn)(
+    cl_context context,
+    const void* il,
+    size_t length,
+    cl_int* errcode_ret);
+#endif // defined(cl_khr_il_program)
+#if defined(cl_khr_semaphore)
+typedef cl_semaphore_khr (CL_API_CALL* clCreateSemaphoreWithPropertiesKHR_fn)(
+    cl_context context,
+    const cl_semaphore_properties_khr* sema_props,
+    cl_int* errcode_ret);
+typedef cl_int (CL_API_CALL* clEnqueueWaitSemaphoresKHR_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_sema_objects,
+    const cl_semaphore_khr* sema_objects,
+    const cl_semaphore_payload_khr* sema_payload_list,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clEnqueueSignalSemaphoresKHR_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_sema_objects,
+    const cl_semaphore_khr* sema_objects,
+    const cl_semaphore_payload_khr* sema_payload_list,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clGetSemaphoreInfoKHR_fn)(
+    cl_semaphore_khr sema_object,
+    cl_semaphore_info_khr param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret);
+typedef cl_int (CL_API_CALL* clReleaseSemaphoreKHR_fn)(
+    cl_semaphore_khr sema_object);
+typedef cl_int (CL_API_CALL* clRetainSemaphoreKHR_fn)(
+    cl_semaphore_khr sema_object);
+#endif // defined(cl_khr_semaphore)
+#if defined(cl_khr_subgroups)
+typedef cl_int (CL_API_CALL* clGetKernelSubGroupInfoKHR_fn)(
+    cl_kernel in_kernel,
+    cl_device_id in_device,
+    cl_kernel_sub_group_info param_name,
+    size_t input_value_size,
+    const void* input_value,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret);
+#endif // defined(cl_khr_subgroups)
+#if defined(cl_khr_suggested_local_work_size)
+typedef cl_int (CL_API_CALL* clGetKernelSuggestedLocalWorkSizeKHR_fn)(
+    cl_command_queue command_queue,
+    cl_kernel kernel,
+    cl_uint work_dim,
+    const size_t* global_work_offset,
+    const size_t* global_work_size,
+    size_t* suggested_local_work_size);
+#endif // defined(cl_khr_suggested_local_work_size)
+#if defined(cl_khr_terminate_context)
+typedef cl_int (CL_API_CALL* clTerminateContextKHR_fn)(
+    cl_context context);
+#endif // defined(cl_khr_terminate_context)
+#if defined(cl_ext_buffer_device_address)
+typedef cl_int (CL_API_CALL* clSetKernelArgDevicePointerEXT_fn)(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    cl_mem_device_address_ext arg_value);
+#endif // defined(cl_ext_buffer_device_address)
+#if defined(cl_ext_device_fission)
+typedef cl_int (CL_API_CALL* clReleaseDeviceEXT_fn)(
+    cl_device_id device);
+typedef cl_int (CL_API_CALL* clRetainDeviceEXT_fn)(
+    cl_device_id device);
+typedef cl_int (CL_API_CALL* clCreateSubDevicesEXT_fn)(
+    cl_device_id in_device,
+    const cl_device_partition_property_ext* properties,
+    cl_uint num_entries,
+    cl_device_id* out_devices,
+    cl_uint* num_devices);
+#endif // defined(cl_ext_device_fission)
+#if defined(cl_ext_image_requirements_info)
+typedef cl_int (CL_API_CALL* clGetImageRequirementsInfoEXT_fn)(
+    cl_context context,
+    const cl_mem_properties* properties,
+    cl_mem_flags flags,
+    const cl_image_format* image_format,
+    const cl_image_desc* image_desc,
+    cl_image_requirements_info_ext param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret);
+#endif // defined(cl_ext_image_requirements_info)
+#if defined(cl_ext_migrate_memobject)
+typedef cl_int (CL_API_CALL* clEnqueueMigrateMemObjectEXT_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_mem_objects,
+    const cl_mem* mem_objects,
+    cl_mem_migration_flags_ext flags,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+#endif // defined(cl_ext_migrate_memobject)
+#if defined(cl_arm_import_memory)
+typedef cl_mem (CL_API_CALL* clImportMemoryARM_fn)(
+    cl_context context,
+    cl_mem_flags flags,
+    const cl_import_properties_arm* properties,
+    void* memory,
+    size_t size,
+    cl_int* errcode_ret);
+#endif // defined(cl_arm_import_memory)
+#if defined(cl_arm_shared_virtual_memory)
+typedef void* (CL_API_CALL* clSVMAllocARM_fn)(
+    cl_context context,
+    cl_svm_mem_flags_arm flags,
+    size_t size,
+    cl_uint alignment);
+typedef void (CL_API_CALL* clSVMFreeARM_fn)(
+    cl_context context,
+    void* svm_pointer);
+typedef cl_int (CL_API_CALL* clEnqueueSVMFreeARM_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_svm_pointers,
+    void* svm_pointers[],
+    void (CL_CALLBACK* pfn_free_func)(cl_command_queue queue, cl_uint num_svm_pointers, void * svm_pointers[], void *user_data),
+    void* user_data,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clEnqueueSVMMemcpyARM_fn)(
+    cl_command_queue command_queue,
+    cl_bool blocking_copy,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clEnqueueSVMMemFillARM_fn)(
+    cl_command_queue command_queue,
+    void* svm_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clEnqueueSVMMapARM_fn)(
+    cl_command_queue command_queue,
+    cl_bool blocking_map,
+    cl_map_flags flags,
+    void* svm_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clEnqueueSVMUnmapARM_fn)(
+    cl_command_queue command_queue,
+    void* svm_ptr,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clSetKernelArgSVMPointerARM_fn)(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    const void* arg_value);
+typedef cl_int (CL_API_CALL* clSetKernelExecInfoARM_fn)(
+    cl_kernel kernel,
+    cl_kernel_exec_info_arm param_name,
+    size_t param_value_size,
+    const void* param_value);
+#endif // defined(cl_arm_shared_virtual_memory)
+#if defined(cl_img_cancel_command)
+typedef cl_int (CL_API_CALL* clCancelCommandsIMG_fn)(
+    const cl_event* event_list,
+    size_t num_events_in_list);
+#endif // defined(cl_img_cancel_command)
+#if defined(cl_img_generate_mipmap)
+typedef cl_int (CL_API_CALL* clEnqueueGenerateMipmapIMG_fn)(
+    cl_command_queue command_queue,
+    cl_mem src_image,
+    cl_mem dst_image,
+    cl_mipmap_filter_mode_img mipmap_filter_mode,
+    const size_t* array_region,
+    const size_t* mip_region,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+#endif // defined(cl_img_generate_mipmap)
+#if defined(cl_img_use_gralloc_ptr)
+typedef cl_int (CL_API_CALL* clEnqueueAcquireGrallocObjectsIMG_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clEnqueueReleaseGrallocObjectsIMG_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+#endif // defined(cl_img_use_gralloc_ptr)
+#if defined(cl_intel_accelerator)
+typedef cl_accelerator_intel (CL_API_CALL* clCreateAcceleratorINTEL_fn)(
+    cl_context context,
+    cl_accelerator_type_intel accelerator_type,
+    size_t descriptor_size,
+    const void* descriptor,
+    cl_int* errcode_ret);
+typedef cl_int (CL_API_CALL* clGetAcceleratorInfoINTEL_fn)(
+    cl_accelerator_intel accelerator,
+    cl_accelerator_info_intel param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret);
+typedef cl_int (CL_API_CALL* clRetainAcceleratorINTEL_fn)(
+    cl_accelerator_intel accelerator);
+typedef cl_int (CL_API_CALL* clReleaseAcceleratorINTEL_fn)(
+    cl_accelerator_intel accelerator);
+#endif // defined(cl_intel_accelerator)
+#if defined(cl_intel_create_buffer_with_properties)
+typedef cl_mem (CL_API_CALL* clCreateBufferWithPropertiesINTEL_fn)(
+    cl_context context,
+    const cl_mem_properties_intel* properties,
+    cl_mem_flags flags,
+    size_t size,
+    void* host_ptr,
+    cl_int* errcode_ret);
+#endif // defined(cl_intel_create_buffer_with_properties)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_dx9_media_sharing)
+typedef cl_int (CL_API_CALL* clGetDeviceIDsFromDX9INTEL_fn)(
+    cl_platform_id platform,
+    cl_dx9_device_source_intel dx9_device_source,
+    void* dx9_object,
+    cl_dx9_device_set_intel dx9_device_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices);
+typedef cl_mem (CL_API_CALL* clCreateFromDX9MediaSurfaceINTEL_fn)(
+    cl_context context,
+    cl_mem_flags flags,
+    IDirect3DSurface9* resource,
+    HANDLE sharedHandle,
+    UINT plane,
+    cl_int* errcode_ret);
+typedef cl_int (CL_API_CALL* clEnqueueAcquireDX9ObjectsINTEL_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clEnqueueReleaseDX9ObjectsINTEL_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+#endif // defined(cl_intel_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_program_scope_host_pipe)
+typedef cl_int (CL_API_CALL* clEnqueueReadHostPipeINTEL_fn)(
+    cl_command_queue command_queue,
+    cl_program program,
+    const char* pipe_symbol,
+    cl_bool blocking_read,
+    void* ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clEnqueueWriteHostPipeINTEL_fn)(
+    cl_command_queue command_queue,
+    cl_program program,
+    const char* pipe_symbol,
+    cl_bool blocking_write,
+    const void* ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+#endif // defined(cl_intel_program_scope_host_pipe)
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_intel_sharing_format_query_d3d10)
+typedef cl_int (CL_API_CALL* clGetSupportedD3D10TextureFormatsINTEL_fn)(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint num_entries,
+    DXGI_FORMAT* d3d10_formats,
+    cl_uint* num_texture_formats);
+#endif // defined(cl_intel_sharing_format_query_d3d10)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_intel_sharing_format_query_d3d11)
+typedef cl_int (CL_API_CALL* clGetSupportedD3D11TextureFormatsINTEL_fn)(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint plane,
+    cl_uint num_entries,
+    DXGI_FORMAT* d3d11_formats,
+    cl_uint* num_texture_formats);
+#endif // defined(cl_intel_sharing_format_query_d3d11)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_sharing_format_query_dx9)
+typedef cl_int (CL_API_CALL* clGetSupportedDX9MediaSurfaceFormatsINTEL_fn)(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint plane,
+    cl_uint num_entries,
+    D3DFORMAT* dx9_formats,
+    cl_uint* num_surface_formats);
+#endif // defined(cl_intel_sharing_format_query_dx9)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_intel_sharing_format_query_gl)
+typedef cl_int (CL_API_CALL* clGetSupportedGLTextureFormatsINTEL_fn)(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint num_entries,
+    cl_GLenum* gl_formats,
+    cl_uint* num_texture_formats);
+#endif // defined(cl_intel_sharing_format_query_gl)
+#endif // defined(CLEXT_INCLUDE_GL)
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_sharing_format_query_va_api)
+typedef cl_int (CL_API_CALL* clGetSupportedVA_APIMediaSurfaceFormatsINTEL_fn)(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint plane,
+    cl_uint num_entries,
+    VAImageFormat* va_api_formats,
+    cl_uint* num_surface_formats);
+#endif // defined(cl_intel_sharing_format_query_va_api)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_unified_shared_memory)
+typedef void* (CL_API_CALL* clHostMemAllocINTEL_fn)(
+    cl_context context,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret);
+typedef void* (CL_API_CALL* clDeviceMemAllocINTEL_fn)(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret);
+typedef void* (CL_API_CALL* clSharedMemAllocINTEL_fn)(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret);
+typedef cl_int (CL_API_CALL* clMemFreeINTEL_fn)(
+    cl_context context,
+    void* ptr);
+typedef cl_int (CL_API_CALL* clMemBlockingFreeINTEL_fn)(
+    cl_context context,
+    void* ptr);
+typedef cl_int (CL_API_CALL* clGetMemAllocInfoINTEL_fn)(
+    cl_context context,
+    const void* ptr,
+    cl_mem_info_intel param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret);
+typedef cl_int (CL_API_CALL* clSetKernelArgMemPointerINTEL_fn)(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    const void* arg_value);
+typedef cl_int (CL_API_CALL* clEnqueueMemFillINTEL_fn)(
+    cl_command_queue command_queue,
+    void* dst_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clEnqueueMemcpyINTEL_fn)(
+    cl_command_queue command_queue,
+    cl_bool blocking,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clEnqueueMemAdviseINTEL_fn)(
+    cl_command_queue command_queue,
+    const void* ptr,
+    size_t size,
+    cl_mem_advice_intel advice,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+#if defined(CL_VERSION_1_2)
+typedef cl_int (CL_API_CALL* clEnqueueMigrateMemINTEL_fn)(
+    cl_command_queue command_queue,
+    const void* ptr,
+    size_t size,
+    cl_mem_migration_flags flags,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+#endif // defined(CL_VERSION_1_2)
+typedef cl_int (CL_API_CALL* clEnqueueMemsetINTEL_fn)(
+    cl_command_queue command_queue,
+    void* dst_ptr,
+    cl_int value,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+#endif // defined(cl_intel_unified_shared_memory)
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_va_api_media_sharing)
+typedef cl_int (CL_API_CALL* clGetDeviceIDsFromVA_APIMediaAdapterINTEL_fn)(
+    cl_platform_id platform,
+    cl_va_api_device_source_intel media_adapter_type,
+    void* media_adapter,
+    cl_va_api_device_set_intel media_adapter_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices);
+typedef cl_mem (CL_API_CALL* clCreateFromVA_APIMediaSurfaceINTEL_fn)(
+    cl_context context,
+    cl_mem_flags flags,
+    VASurfaceID* surface,
+    cl_uint plane,
+    cl_int* errcode_ret);
+typedef cl_int (CL_API_CALL* clEnqueueAcquireVA_APIMediaSurfacesINTEL_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+typedef cl_int (CL_API_CALL* clEnqueueReleaseVA_APIMediaSurfacesINTEL_fn)(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+#endif // defined(cl_intel_va_api_media_sharing)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_pocl_content_size)
+typedef cl_int (CL_API_CALL* clSetContentSizeBufferPoCL_fn)(
+    cl_mem buffer,
+    cl_mem content_size_buffer);
+#endif // defined(cl_pocl_content_size)
+#if defined(cl_qcom_ext_host_ptr)
+typedef cl_int (CL_API_CALL* clGetDeviceImageInfoQCOM_fn)(
+    cl_device_id device,
+    size_t image_width,
+    size_t image_height,
+    const cl_image_format* image_format,
+    cl_image_pitch_info_qcom param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret);
+#endif // defined(cl_qcom_ext_host_ptr)
+
+} // namespace detail
+
+/***************************************************************
+* Dispatch Table
+***************************************************************/
+
+struct DispatchTable {
+    DispatchTable() = default;
+
+    explicit DispatchTable(cl_platform_id platform_) : platform(platform_)
+    {
+#define CLEXT_GET_EXTENSION(_funcname)                                         \
+        _funcname = (detail::_funcname##_fn)                                   \
+            clGetExtensionFunctionAddressForPlatform(platform, #_funcname)
+
+#if defined(cl_khr_command_buffer)
+        CLEXT_GET_EXTENSION(clCreateCommandBufferKHR);
+        CLEXT_GET_EXTENSION(clFinalizeCommandBufferKHR);
+        CLEXT_GET_EXTENSION(clRetainCommandBufferKHR);
+        CLEXT_GET_EXTENSION(clReleaseCommandBufferKHR);
+        CLEXT_GET_EXTENSION(clEnqueueCommandBufferKHR);
+        CLEXT_GET_EXTENSION(clCommandBarrierWithWaitListKHR);
+        CLEXT_GET_EXTENSION(clCommandCopyBufferKHR);
+        CLEXT_GET_EXTENSION(clCommandCopyBufferRectKHR);
+        CLEXT_GET_EXTENSION(clCommandCopyBufferToImageKHR);
+        CLEXT_GET_EXTENSION(clCommandCopyImageKHR);
+        CLEXT_GET_EXTENSION(clCommandCopyImageToBufferKHR);
+        CLEXT_GET_EXTENSION(clCommandFillBufferKHR);
+        CLEXT_GET_EXTENSION(clCommandFillImageKHR);
+        CLEXT_GET_EXTENSION(clCommandNDRangeKernelKHR);
+        CLEXT_GET_EXTENSION(clGetCommandBufferInfoKHR);
+        CLEXT_GET_EXTENSION(clCommandSVMMemcpyKHR);
+        CLEXT_GET_EXTENSION(clCommandSVMMemFillKHR);
+#endif // defined(cl_khr_command_buffer)
+#if defined(cl_khr_command_buffer_multi_device)
+        CLEXT_GET_EXTENSION(clRemapCommandBufferKHR);
+#endif // defined(cl_khr_command_buffer_multi_device)
+#if defined(cl_khr_command_buffer_mutable_dispatch)
+        CLEXT_GET_EXTENSION(clUpdateMutableCommandsKHR);
+        CLEXT_GET_EXTENSION(clGetMutableCommandInfoKHR);
+#endif // defined(cl_khr_command_buffer_mutable_dispatch)
+#if defined(cl_khr_create_command_queue)
+        CLEXT_GET_EXTENSION(clCreateCommandQueueWithPropertiesKHR);
+#endif // defined(cl_khr_create_command_queue)
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_khr_d3d10_sharing)
+        CLEXT_GET_EXTENSION(clGetDeviceIDsFromD3D10KHR);
+        CLEXT_GET_EXTENSION(clCreateFromD3D10BufferKHR);
+        CLEXT_GET_EXTENSION(clCreateFromD3D10Texture2DKHR);
+        CLEXT_GET_EXTENSION(clCreateFromD3D10Texture3DKHR);
+        CLEXT_GET_EXTENSION(clEnqueueAcquireD3D10ObjectsKHR);
+        CLEXT_GET_EXTENSION(clEnqueueReleaseD3D10ObjectsKHR);
+#endif // defined(cl_khr_d3d10_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_khr_d3d11_sharing)
+        CLEXT_GET_EXTENSION(clGetDeviceIDsFromD3D11KHR);
+        CLEXT_GET_EXTENSION(clCreateFromD3D11BufferKHR);
+        CLEXT_GET_EXTENSION(clCreateFromD3D11Texture2DKHR);
+        CLEXT_GET_EXTENSION(clCreateFromD3D11Texture3DKHR);
+        CLEXT_GET_EXTENSION(clEnqueueAcquireD3D11ObjectsKHR);
+        CLEXT_GET_EXTENSION(clEnqueueReleaseD3D11ObjectsKHR);
+#endif // defined(cl_khr_d3d11_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_khr_dx9_media_sharing)
+        CLEXT_GET_EXTENSION(clGetDeviceIDsFromDX9MediaAdapterKHR);
+        CLEXT_GET_EXTENSION(clCreateFromDX9MediaSurfaceKHR);
+        CLEXT_GET_EXTENSION(clEnqueueAcquireDX9MediaSurfacesKHR);
+        CLEXT_GET_EXTENSION(clEnqueueReleaseDX9MediaSurfacesKHR);
+#endif // defined(cl_khr_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_event)
+        CLEXT_GET_EXTENSION(clCreateEventFromEGLSyncKHR);
+#endif // defined(cl_khr_egl_event)
+#endif // defined(CLEXT_INCLUDE_EGL)
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_image)
+        CLEXT_GET_EXTENSION(clCreateFromEGLImageKHR);
+        CLEXT_GET_EXTENSION(clEnqueueAcquireEGLObjectsKHR);
+        CLEXT_GET_EXTENSION(clEnqueueReleaseEGLObjectsKHR);
+#endif // defined(cl_khr_egl_image)
+#endif // defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_external_memory)
+        CLEXT_GET_EXTENSION(clEnqueueAcquireExternalMemObjectsKHR);
+        CLEXT_GET_EXTENSION(clEnqueueReleaseExternalMemObjectsKHR);
+#endif // defined(cl_khr_external_memory)
+#if defined(cl_khr_external_semaphore)
+        CLEXT_GET_EXTENSION(clGetSemaphoreHandleForTypeKHR);
+#endif // defined(cl_khr_external_semaphore)
+#if defined(cl_khr_external_semaphore_sync_fd)
+        CLEXT_GET_EXTENSION(clReImportSemaphoreSyncFdKHR);
+#endif // defined(cl_khr_external_semaphore_sync_fd)
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_khr_gl_event)
+        CLEXT_GET_EXTENSION(clCreateEventFromGLsyncKHR);
+#endif // defined(cl_khr_gl_event)
+#endif // defined(CLEXT_INCLUDE_GL)
+#if defined(cl_khr_il_program)
+        CLEXT_GET_EXTENSION(clCreateProgramWithILKHR);
+#endif // defined(cl_khr_il_program)
+#if defined(cl_khr_semaphore)
+        CLEXT_GET_EXTENSION(clCreateSemaphoreWithPropertiesKHR);
+        CLEXT_GET_EXTENSION(clEnqueueWaitSemaphoresKHR);
+        CLEXT_GET_EXTENSION(clEnqueueSignalSemaphoresKHR);
+        CLEXT_GET_EXTENSION(clGetSemaphoreInfoKHR);
+        CLEXT_GET_EXTENSION(clReleaseSemaphoreKHR);
+        CLEXT_GET_EXTENSION(clRetainSemaphoreKHR);
+#endif // defined(cl_khr_semaphore)
+#if defined(cl_khr_subgroups)
+        CLEXT_GET_EXTENSION(clGetKernelSubGroupInfoKHR);
+#endif // defined(cl_khr_subgroups)
+#if defined(cl_khr_suggested_local_work_size)
+        CLEXT_GET_EXTENSION(clGetKernelSuggestedLocalWorkSizeKHR);
+#endif // defined(cl_khr_suggested_local_work_size)
+#if defined(cl_khr_terminate_context)
+        CLEXT_GET_EXTENSION(clTerminateContextKHR);
+#endif // defined(cl_khr_terminate_context)
+#if defined(cl_ext_buffer_device_address)
+        CLEXT_GET_EXTENSION(clSetKernelArgDevicePointerEXT);
+#endif // defined(cl_ext_buffer_device_address)
+#if defined(cl_ext_device_fission)
+        CLEXT_GET_EXTENSION(clReleaseDeviceEXT);
+        CLEXT_GET_EXTENSION(clRetainDeviceEXT);
+        CLEXT_GET_EXTENSION(clCreateSubDevicesEXT);
+#endif // defined(cl_ext_device_fission)
+#if defined(cl_ext_image_requirements_info)
+        CLEXT_GET_EXTENSION(clGetImageRequirementsInfoEXT);
+#endif // defined(cl_ext_image_requirements_info)
+#if defined(cl_ext_migrate_memobject)
+        CLEXT_GET_EXTENSION(clEnqueueMigrateMemObjectEXT);
+#endif // defined(cl_ext_migrate_memobject)
+#if defined(cl_arm_import_memory)
+        CLEXT_GET_EXTENSION(clImportMemoryARM);
+#endif // defined(cl_arm_import_memory)
+#if defined(cl_arm_shared_virtual_memory)
+        CLEXT_GET_EXTENSION(clSVMAllocARM);
+        CLEXT_GET_EXTENSION(clSVMFreeARM);
+        CLEXT_GET_EXTENSION(clEnqueueSVMFreeARM);
+        CLEXT_GET_EXTENSION(clEnqueueSVMMemcpyARM);
+        CLEXT_GET_EXTENSION(clEnqueueSVMMemFillARM);
+        CLEXT_GET_EXTENSION(clEnqueueSVMMapARM);
+        CLEXT_GET_EXTENSION(clEnqueueSVMUnmapARM);
+        CLEXT_GET_EXTENSION(clSetKernelArgSVMPointerARM);
+        CLEXT_GET_EXTENSION(clSetKernelExecInfoARM);
+#endif // defined(cl_arm_shared_virtual_memory)
+#if defined(cl_img_cancel_command)
+        CLEXT_GET_EXTENSION(clCancelCommandsIMG);
+#endif // defined(cl_img_cancel_command)
+#if defined(cl_img_generate_mipmap)
+        CLEXT_GET_EXTENSION(clEnqueueGenerateMipmapIMG);
+#endif // defined(cl_img_generate_mipmap)
+#if defined(cl_img_use_gralloc_ptr)
+        CLEXT_GET_EXTENSION(clEnqueueAcquireGrallocObjectsIMG);
+        CLEXT_GET_EXTENSION(clEnqueueReleaseGrallocObjectsIMG);
+#endif // defined(cl_img_use_gralloc_ptr)
+#if defined(cl_intel_accelerator)
+        CLEXT_GET_EXTENSION(clCreateAcceleratorINTEL);
+        CLEXT_GET_EXTENSION(clGetAcceleratorInfoINTEL);
+        CLEXT_GET_EXTENSION(clRetainAcceleratorINTEL);
+        CLEXT_GET_EXTENSION(clReleaseAcceleratorINTEL);
+#endif // defined(cl_intel_accelerator)
+#if defined(cl_intel_create_buffer_with_properties)
+        CLEXT_GET_EXTENSION(clCreateBufferWithPropertiesINTEL);
+#endif // defined(cl_intel_create_buffer_with_properties)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_dx9_media_sharing)
+        CLEXT_GET_EXTENSION(clGetDeviceIDsFromDX9INTEL);
+        CLEXT_GET_EXTENSION(clCreateFromDX9MediaSurfaceINTEL);
+        CLEXT_GET_EXTENSION(clEnqueueAcquireDX9ObjectsINTEL);
+        CLEXT_GET_EXTENSION(clEnqueueReleaseDX9ObjectsINTEL);
+#endif // defined(cl_intel_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_program_scope_host_pipe)
+        CLEXT_GET_EXTENSION(clEnqueueReadHostPipeINTEL);
+        CLEXT_GET_EXTENSION(clEnqueueWriteHostPipeINTEL);
+#endif // defined(cl_intel_program_scope_host_pipe)
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_intel_sharing_format_query_d3d10)
+        CLEXT_GET_EXTENSION(clGetSupportedD3D10TextureFormatsINTEL);
+#endif // defined(cl_intel_sharing_format_query_d3d10)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_intel_sharing_format_query_d3d11)
+        CLEXT_GET_EXTENSION(clGetSupportedD3D11TextureFormatsINTEL);
+#endif // defined(cl_intel_sharing_format_query_d3d11)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_sharing_format_query_dx9)
+        CLEXT_GET_EXTENSION(clGetSupportedDX9MediaSurfaceFormatsINTEL);
+#endif // defined(cl_intel_sharing_format_query_dx9)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_intel_sharing_format_query_gl)
+        CLEXT_GET_EXTENSION(clGetSupportedGLTextureFormatsINTEL);
+#endif // defined(cl_intel_sharing_format_query_gl)
+#endif // defined(CLEXT_INCLUDE_GL)
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_sharing_format_query_va_api)
+        CLEXT_GET_EXTENSION(clGetSupportedVA_APIMediaSurfaceFormatsINTEL);
+#endif // defined(cl_intel_sharing_format_query_va_api)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_unified_shared_memory)
+        CLEXT_GET_EXTENSION(clHostMemAllocINTEL);
+        CLEXT_GET_EXTENSION(clDeviceMemAllocINTEL);
+        CLEXT_GET_EXTENSION(clSharedMemAllocINTEL);
+        CLEXT_GET_EXTENSION(clMemFreeINTEL);
+        CLEXT_GET_EXTENSION(clMemBlockingFreeINTEL);
+        CLEXT_GET_EXTENSION(clGetMemAllocInfoINTEL);
+        CLEXT_GET_EXTENSION(clSetKernelArgMemPointerINTEL);
+        CLEXT_GET_EXTENSION(clEnqueueMemFillINTEL);
+        CLEXT_GET_EXTENSION(clEnqueueMemcpyINTEL);
+        CLEXT_GET_EXTENSION(clEnqueueMemAdviseINTEL);
+#if defined(CL_VERSION_1_2)
+        CLEXT_GET_EXTENSION(clEnqueueMigrateMemINTEL);
+#endif // defined(CL_VERSION_1_2)
+        CLEXT_GET_EXTENSION(clEnqueueMemsetINTEL);
+#endif // defined(cl_intel_unified_shared_memory)
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_va_api_media_sharing)
+        CLEXT_GET_EXTENSION(clGetDeviceIDsFromVA_APIMediaAdapterINTEL);
+        CLEXT_GET_EXTENSION(clCreateFromVA_APIMediaSurfaceINTEL);
+        CLEXT_GET_EXTENSION(clEnqueueAcquireVA_APIMediaSurfacesINTEL);
+        CLEXT_GET_EXTENSION(clEnqueueReleaseVA_APIMediaSurfacesINTEL);
+#endif // defined(cl_intel_va_api_media_sharing)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_pocl_content_size)
+        CLEXT_GET_EXTENSION(clSetContentSizeBufferPoCL);
+#endif // defined(cl_pocl_content_size)
+#if defined(cl_qcom_ext_host_ptr)
+        CLEXT_GET_EXTENSION(clGetDeviceImageInfoQCOM);
+#endif // defined(cl_qcom_ext_host_ptr)
+
+#undef CLEXT_GET_EXTENSION
+    }
+
+    cl_platform_id platform = nullptr;
+
+#if defined(cl_khr_command_buffer)
+    detail::clCreateCommandBufferKHR_fn clCreateCommandBufferKHR = nullptr;
+    detail::clFinalizeCommandBufferKHR_fn clFinalizeCommandBufferKHR = nullptr;
+    detail::clRetainCommandBufferKHR_fn clRetainCommandBufferKHR = nullptr;
+    detail::clReleaseCommandBufferKHR_fn clReleaseCommandBufferKHR = nullptr;
+    detail::clEnqueueCommandBufferKHR_fn clEnqueueCommandBufferKHR = nullptr;
+    detail::clCommandBarrierWithWaitListKHR_fn clCommandBarrierWithWaitListKHR = nullptr;
+    detail::clCommandCopyBufferKHR_fn clCommandCopyBufferKHR = nullptr;
+    detail::clCommandCopyBufferRectKHR_fn clCommandCopyBufferRectKHR = nullptr;
+    detail::clCommandCopyBufferToImageKHR_fn clCommandCopyBufferToImageKHR = nullptr;
+    detail::clCommandCopyImageKHR_fn clCommandCopyImageKHR = nullptr;
+    detail::clCommandCopyImageToBufferKHR_fn clCommandCopyImageToBufferKHR = nullptr;
+    detail::clCommandFillBufferKHR_fn clCommandFillBufferKHR = nullptr;
+    detail::clCommandFillImageKHR_fn clCommandFillImageKHR = nullptr;
+    detail::clCommandNDRangeKernelKHR_fn clCommandNDRangeKernelKHR = nullptr;
+    detail::clGetCommandBufferInfoKHR_fn clGetCommandBufferInfoKHR = nullptr;
+    detail::clCommandSVMMemcpyKHR_fn clCommandSVMMemcpyKHR = nullptr;
+    detail::clCommandSVMMemFillKHR_fn clCommandSVMMemFillKHR = nullptr;
+#endif // defined(cl_khr_command_buffer)
+#if defined(cl_khr_command_buffer_multi_device)
+    detail::clRemapCommandBufferKHR_fn clRemapCommandBufferKHR = nullptr;
+#endif // defined(cl_khr_command_buffer_multi_device)
+#if defined(cl_khr_command_buffer_mutable_dispatch)
+    detail::clUpdateMutableCommandsKHR_fn clUpdateMutableCommandsKHR = nullptr;
+    detail::clGetMutableCommandInfoKHR_fn clGetMutableCommandInfoKHR = nullptr;
+#endif // defined(cl_khr_command_buffer_mutable_dispatch)
+#if defined(cl_khr_create_command_queue)
+    detail::clCreateCommandQueueWithPropertiesKHR_fn clCreateCommandQueueWithPropertiesKHR = nullptr;
+#endif // defined(cl_khr_create_command_queue)
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_khr_d3d10_sharing)
+    detail::clGetDeviceIDsFromD3D10KHR_fn clGetDeviceIDsFromD3D10KHR = nullptr;
+    detail::clCreateFromD3D10BufferKHR_fn clCreateFromD3D10BufferKHR = nullptr;
+    detail::clCreateFromD3D10Texture2DKHR_fn clCreateFromD3D10Texture2DKHR = nullptr;
+    detail::clCreateFromD3D10Texture3DKHR_fn clCreateFromD3D10Texture3DKHR = nullptr;
+    detail::clEnqueueAcquireD3D10ObjectsKHR_fn clEnqueueAcquireD3D10ObjectsKHR = nullptr;
+    detail::clEnqueueReleaseD3D10ObjectsKHR_fn clEnqueueReleaseD3D10ObjectsKHR = nullptr;
+#endif // defined(cl_khr_d3d10_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_khr_d3d11_sharing)
+    detail::clGetDeviceIDsFromD3D11KHR_fn clGetDeviceIDsFromD3D11KHR = nullptr;
+    detail::clCreateFromD3D11BufferKHR_fn clCreateFromD3D11BufferKHR = nullptr;
+    detail::clCreateFromD3D11Texture2DKHR_fn clCreateFromD3D11Texture2DKHR = nullptr;
+    detail::clCreateFromD3D11Texture3DKHR_fn clCreateFromD3D11Texture3DKHR = nullptr;
+    detail::clEnqueueAcquireD3D11ObjectsKHR_fn clEnqueueAcquireD3D11ObjectsKHR = nullptr;
+    detail::clEnqueueReleaseD3D11ObjectsKHR_fn clEnqueueReleaseD3D11ObjectsKHR = nullptr;
+#endif // defined(cl_khr_d3d11_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_khr_dx9_media_sharing)
+    detail::clGetDeviceIDsFromDX9MediaAdapterKHR_fn clGetDeviceIDsFromDX9MediaAdapterKHR = nullptr;
+    detail::clCreateFromDX9MediaSurfaceKHR_fn clCreateFromDX9MediaSurfaceKHR = nullptr;
+    detail::clEnqueueAcquireDX9MediaSurfacesKHR_fn clEnqueueAcquireDX9MediaSurfacesKHR = nullptr;
+    detail::clEnqueueReleaseDX9MediaSurfacesKHR_fn clEnqueueReleaseDX9MediaSurfacesKHR = nullptr;
+#endif // defined(cl_khr_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_event)
+    detail::clCreateEventFromEGLSyncKHR_fn clCreateEventFromEGLSyncKHR = nullptr;
+#endif // defined(cl_khr_egl_event)
+#endif // defined(CLEXT_INCLUDE_EGL)
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_image)
+    detail::clCreateFromEGLImageKHR_fn clCreateFromEGLImageKHR = nullptr;
+    detail::clEnqueueAcquireEGLObjectsKHR_fn clEnqueueAcquireEGLObjectsKHR = nullptr;
+    detail::clEnqueueReleaseEGLObjectsKHR_fn clEnqueueReleaseEGLObjectsKHR = nullptr;
+#endif // defined(cl_khr_egl_image)
+#endif // defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_external_memory)
+    detail::clEnqueueAcquireExternalMemObjectsKHR_fn clEnqueueAcquireExternalMemObjectsKHR = nullptr;
+    detail::clEnqueueReleaseExternalMemObjectsKHR_fn clEnqueueReleaseExternalMemObjectsKHR = nullptr;
+#endif // defined(cl_khr_external_memory)
+#if defined(cl_khr_external_semaphore)
+    detail::clGetSemaphoreHandleForTypeKHR_fn clGetSemaphoreHandleForTypeKHR = nullptr;
+#endif // defined(cl_khr_external_semaphore)
+#if defined(cl_khr_external_semaphore_sync_fd)
+    detail::clReImportSemaphoreSyncFdKHR_fn clReImportSemaphoreSyncFdKHR = nullptr;
+#endif // defined(cl_khr_external_semaphore_sync_fd)
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_khr_gl_event)
+    detail::clCreateEventFromGLsyncKHR_fn clCreateEventFromGLsyncKHR = nullptr;
+#endif // defined(cl_khr_gl_event)
+#endif // defined(CLEXT_INCLUDE_GL)
+#if defined(cl_khr_il_program)
+    detail::clCreateProgramWithILKHR_fn clCreateProgramWithILKHR = nullptr;
+#endif // defined(cl_khr_il_program)
+#if defined(cl_khr_semaphore)
+    detail::clCreateSemaphoreWithPropertiesKHR_fn clCreateSemaphoreWithPropertiesKHR = nullptr;
+    detail::clEnqueueWaitSemaphoresKHR_fn clEnqueueWaitSemaphoresKHR = nullptr;
+    detail::clEnqueueSignalSemaphoresKHR_fn clEnqueueSignalSemaphoresKHR = nullptr;
+    detail::clGetSemaphoreInfoKHR_fn clGetSemaphoreInfoKHR = nullptr;
+    detail::clReleaseSemaphoreKHR_fn clReleaseSemaphoreKHR = nullptr;
+    detail::clRetainSemaphoreKHR_fn clRetainSemaphoreKHR = nullptr;
+#endif // defined(cl_khr_semaphore)
+#if defined(cl_khr_subgroups)
+    detail::clGetKernelSubGroupInfoKHR_fn clGetKernelSubGroupInfoKHR = nullptr;
+#endif // defined(cl_khr_subgroups)
+#if defined(cl_khr_suggested_local_work_size)
+    detail::clGetKernelSuggestedLocalWorkSizeKHR_fn clGetKernelSuggestedLocalWorkSizeKHR = nullptr;
+#endif // defined(cl_khr_suggested_local_work_size)
+#if defined(cl_khr_terminate_context)
+    detail::clTerminateContextKHR_fn clTerminateContextKHR = nullptr;
+#endif // defined(cl_khr_terminate_context)
+#if defined(cl_ext_buffer_device_address)
+    detail::clSetKernelArgDevicePointerEXT_fn clSetKernelArgDevicePointerEXT = nullptr;
+#endif // defined(cl_ext_buffer_device_address)
+#if defined(cl_ext_device_fission)
+    detail::clReleaseDeviceEXT_fn clReleaseDeviceEXT = nullptr;
+    detail::clRetainDeviceEXT_fn clRetainDeviceEXT = nullptr;
+    detail::clCreateSubDevicesEXT_fn clCreateSubDevicesEXT = nullptr;
+#endif // defined(cl_ext_device_fission)
+#if defined(cl_ext_image_requirements_info)
+    detail::clGetImageRequirementsInfoEXT_fn clGetImageRequirementsInfoEXT = nullptr;
+#endif // defined(cl_ext_image_requirements_info)
+#if defined(cl_ext_migrate_memobject)
+    detail::clEnqueueMigrateMemObjectEXT_fn clEnqueueMigrateMemObjectEXT = nullptr;
+#endif // defined(cl_ext_migrate_memobject)
+#if defined(cl_arm_import_memory)
+    detail::clImportMemoryARM_fn clImportMemoryARM = nullptr;
+#endif // defined(cl_arm_import_memory)
+#if defined(cl_arm_shared_virtual_memory)
+    detail::clSVMAllocARM_fn clSVMAllocARM = nullptr;
+    detail::clSVMFreeARM_fn clSVMFreeARM = nullptr;
+    detail::clEnqueueSVMFreeARM_fn clEnqueueSVMFreeARM = nullptr;
+    detail::clEnqueueSVMMemcpyARM_fn clEnqueueSVMMemcpyARM = nullptr;
+    detail::clEnqueueSVMMemFillARM_fn clEnqueueSVMMemFillARM = nullptr;
+    detail::clEnqueueSVMMapARM_fn clEnqueueSVMMapARM = nullptr;
+    detail::clEnqueueSVMUnmapARM_fn clEnqueueSVMUnmapARM = nullptr;
+    detail::clSetKernelArgSVMPointerARM_fn clSetKernelArgSVMPointerARM = nullptr;
+    detail::clSetKernelExecInfoARM_fn clSetKernelExecInfoARM = nullptr;
+#endif // defined(cl_arm_shared_virtual_memory)
+#if defined(cl_img_cancel_command)
+    detail::clCancelCommandsIMG_fn clCancelCommandsIMG = nullptr;
+#endif // defined(cl_img_cancel_command)
+#if defined(cl_img_generate_mipmap)
+    detail::clEnqueueGenerateMipmapIMG_fn clEnqueueGenerateMipmapIMG = nullptr;
+#endif // defined(cl_img_generate_mipmap)
+#if defined(cl_img_use_gralloc_ptr)
+    detail::clEnqueueAcquireGrallocObjectsIMG_fn clEnqueueAcquireGrallocObjectsIMG = nullptr;
+    detail::clEnqueueReleaseGrallocObjectsIMG_fn clEnqueueReleaseGrallocObjectsIMG = nullptr;
+#endif // defined(cl_img_use_gralloc_ptr)
+#if defined(cl_intel_accelerator)
+    detail::clCreateAcceleratorINTEL_fn clCreateAcceleratorINTEL = nullptr;
+    detail::clGetAcceleratorInfoINTEL_fn clGetAcceleratorInfoINTEL = nullptr;
+    detail::clRetainAcceleratorINTEL_fn clRetainAcceleratorINTEL = nullptr;
+    detail::clReleaseAcceleratorINTEL_fn clReleaseAcceleratorINTEL = nullptr;
+#endif // defined(cl_intel_accelerator)
+#if defined(cl_intel_create_buffer_with_properties)
+    detail::clCreateBufferWithPropertiesINTEL_fn clCreateBufferWithPropertiesINTEL = nullptr;
+#endif // defined(cl_intel_create_buffer_with_properties)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_dx9_media_sharing)
+    detail::clGetDeviceIDsFromDX9INTEL_fn clGetDeviceIDsFromDX9INTEL = nullptr;
+    detail::clCreateFromDX9MediaSurfaceINTEL_fn clCreateFromDX9MediaSurfaceINTEL = nullptr;
+    detail::clEnqueueAcquireDX9ObjectsINTEL_fn clEnqueueAcquireDX9ObjectsINTEL = nullptr;
+    detail::clEnqueueReleaseDX9ObjectsINTEL_fn clEnqueueReleaseDX9ObjectsINTEL = nullptr;
+#endif // defined(cl_intel_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_program_scope_host_pipe)
+    detail::clEnqueueReadHostPipeINTEL_fn clEnqueueReadHostPipeINTEL = nullptr;
+    detail::clEnqueueWriteHostPipeINTEL_fn clEnqueueWriteHostPipeINTEL = nullptr;
+#endif // defined(cl_intel_program_scope_host_pipe)
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_intel_sharing_format_query_d3d10)
+    detail::clGetSupportedD3D10TextureFormatsINTEL_fn clGetSupportedD3D10TextureFormatsINTEL = nullptr;
+#endif // defined(cl_intel_sharing_format_query_d3d10)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_intel_sharing_format_query_d3d11)
+    detail::clGetSupportedD3D11TextureFormatsINTEL_fn clGetSupportedD3D11TextureFormatsINTEL = nullptr;
+#endif // defined(cl_intel_sharing_format_query_d3d11)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_sharing_format_query_dx9)
+    detail::clGetSupportedDX9MediaSurfaceFormatsINTEL_fn clGetSupportedDX9MediaSurfaceFormatsINTEL = nullptr;
+#endif // defined(cl_intel_sharing_format_query_dx9)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_intel_sharing_format_query_gl)
+    detail::clGetSupportedGLTextureFormatsINTEL_fn clGetSupportedGLTextureFormatsINTEL = nullptr;
+#endif // defined(cl_intel_sharing_format_query_gl)
+#endif // defined(CLEXT_INCLUDE_GL)
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_sharing_format_query_va_api)
+    detail::clGetSupportedVA_APIMediaSurfaceFormatsINTEL_fn clGetSupportedVA_APIMediaSurfaceFormatsINTEL = nullptr;
+#endif // defined(cl_intel_sharing_format_query_va_api)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_unified_shared_memory)
+    detail::clHostMemAllocINTEL_fn clHostMemAllocINTEL = nullptr;
+    detail::clDeviceMemAllocINTEL_fn clDeviceMemAllocINTEL = nullptr;
+    detail::clSharedMemAllocINTEL_fn clSharedMemAllocINTEL = nullptr;
+    detail::clMemFreeINTEL_fn clMemFreeINTEL = nullptr;
+    detail::clMemBlockingFreeINTEL_fn clMemBlockingFreeINTEL = nullptr;
+    detail::clGetMemAllocInfoINTEL_fn clGetMemAllocInfoINTEL = nullptr;
+    detail::clSetKernelArgMemPointerINTEL_fn clSetKernelArgMemPointerINTEL = nullptr;
+    detail::clEnqueueMemFillINTEL_fn clEnqueueMemFillINTEL = nullptr;
+    detail::clEnqueueMemcpyINTEL_fn clEnqueueMemcpyINTEL = nullptr;
+    detail::clEnqueueMemAdviseINTEL_fn clEnqueueMemAdviseINTEL = nullptr;
+#if defined(CL_VERSION_1_2)
+    detail::clEnqueueMigrateMemINTEL_fn clEnqueueMigrateMemINTEL = nullptr;
+#endif // defined(CL_VERSION_1_2)
+    detail::clEnqueueMemsetINTEL_fn clEnqueueMemsetINTEL = nullptr;
+#endif // defined(cl_intel_unified_shared_memory)
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_va_api_media_sharing)
+    detail::clGetDeviceIDsFromVA_APIMediaAdapterINTEL_fn clGetDeviceIDsFromVA_APIMediaAdapterINTEL = nullptr;
+    detail::clCreateFromVA_APIMediaSurfaceINTEL_fn clCreateFromVA_APIMediaSurfaceINTEL = nullptr;
+    detail::clEnqueueAcquireVA_APIMediaSurfacesINTEL_fn clEnqueueAcquireVA_APIMediaSurfacesINTEL = nullptr;
+    detail::clEnqueueReleaseVA_APIMediaSurfacesINTEL_fn clEnqueueReleaseVA_APIMediaSurfacesINTEL = nullptr;
+#endif // defined(cl_intel_va_api_media_sharing)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_pocl_content_size)
+    detail::clSetContentSizeBufferPoCL_fn clSetContentSizeBufferPoCL = nullptr;
+#endif // defined(cl_pocl_content_size)
+#if defined(cl_qcom_ext_host_ptr)
+    detail::clGetDeviceImageInfoQCOM_fn clGetDeviceImageInfoQCOM = nullptr;
+#endif // defined(cl_qcom_ext_host_ptr)
+};
+
+namespace detail {
+
+/***************************************************************
+* Platform Queries
+***************************************************************/
+
+inline cl_platform_id get_platform(cl_platform_id platform)
+{
+    return platform;
+}
+
+inline cl_platform_id get_platform(cl_device_id device)
+{
+    if (device == nullptr) return nullptr;
+
+    cl_platform_id platform = nullptr;
+    clGetDeviceInfo(
+        device,
+        CL_DEVICE_PLATFORM,
+        sizeof(platform),
+        &platform,
+        nullptr);
+    return platform;
+}
+
+inline cl_platform_id get_platform(cl_command_queue command_queue)
+{
+    if (command_queue == nullptr) return nullptr;
+
+    cl_device_id device = nullptr;
+    clGetCommandQueueInfo(
+        command_queue,
+        CL_QUEUE_DEVICE,
+        sizeof(device),
+        &device,
+        nullptr);
+    return get_platform(device);
+}
+
+inline cl_platform_id get_platform(cl_context context)
+{
+    if (context == nullptr) return nullptr;
+
+    cl_uint numDevices = 0;
+    clGetContextInfo(
+        context,
+        CL_CONTEXT_NUM_DEVICES,
+        sizeof(numDevices),
+        &numDevices,
+        nullptr);
+    if (numDevices == 0) return nullptr;
+
+    std::vector<cl_device_id> devices(numDevices);
+    clGetContextInfo(
+        context,
+        CL_CONTEXT_DEVICES,
+        numDevices * sizeof(cl_device_id),
+        devices.data(),
+        nullptr);
+    return get_platform(devices[0]);
+}
+
+inline cl_platform_id get_platform(cl_kernel kernel)
+{
+    if (kernel == nullptr) return nullptr;
+
+    cl_context context = nullptr;
+    clGetKernelInfo(
+        kernel,
+        CL_KERNEL_CONTEXT,
+        sizeof(context),
+        &context,
+        nullptr);
+    return get_platform(context);
+}
+
+inline cl_platform_id get_platform(cl_mem memobj)
+{
+    if (memobj == nullptr) return nullptr;
+
+    cl_context context = nullptr;
+    clGetMemObjectInfo(
+        memobj,
+        CL_MEM_CONTEXT,
+        sizeof(context),
+        &context,
+        nullptr);
+    return get_platform(context);
+}
+
+inline cl_platform_id get_platform(cl_event event)
+{
+    if (event == nullptr) return nullptr;
+
+    cl_context context = nullptr;
+    clGetEventInfo(
+        event,
+        CL_EVENT_CONTEXT,
+        sizeof(context),
+        &context,
+        nullptr);
+    return get_platform(context);
+}
+
+template<typename T>
+inline const DispatchTable* find_table(const DispatchTable* tables, size_t count, T object)
+{
+    cl_platform_id platform = get_platform(object);
+    for (size_t i = 0; i < count; i++) {
+        if (tables[i].platform == platform) {
+            return tables + i;
+        }
+    }
+    return nullptr;
+}
+
+// For some extension objects we cannot query a platform ID, so each dispatch
+// table is asked whether the object belongs to its platform instead.
+
+#if defined(cl_khr_semaphore)
+inline const DispatchTable* find_table(const DispatchTable* tables, size_t count, cl_semaphore_khr object)
+{
+    if (object == nullptr) return nullptr;
+    if (count <= 1) return tables;
+
+    for (size_t i = 0; i < count; i++) {
+        if (tables[i].clGetSemaphoreInfoKHR) {
+            cl_uint value = 0;
+            cl_int errorCode = tables[i].clGetSemaphoreInfoKHR(
+                object,
+                CL_SEMAPHORE_REFERENCE_COUNT_KHR,
+                sizeof(value),
+                &value,
+                nullptr);
+            if (errorCode == CL_SUCCESS) {
+                return tables + i;
+            }
+        }
+    }
+
+    return nullptr;
+}
+#endif // defined(cl_khr_semaphore)
+
+#if defined(cl_khr_command_buffer)
+inline const DispatchTable* find_table(const DispatchTable* tables, size_t count, cl_command_buffer_khr object)
+{
+    if (object == nullptr) return nullptr;
+    if (count <= 1) return tables;
+
+    for (size_t i = 0; i < count; i++) {
+        if (tables[i].clGetCommandBufferInfoKHR) {
+            cl_uint value = 0;
+            cl_int errorCode = tables[i].clGetCommandBufferInfoKHR(
+                object,
+                CL_COMMAND_BUFFER_REFERENCE_COUNT_KHR,
+                sizeof(value),
+                &value,
+                nullptr);
+            if (errorCode == CL_SUCCESS) {
+                return tables + i;
+            }
+        }
+    }
+
+    return nullptr;
+}
+#endif // defined(cl_khr_command_buffer)
+
+#if defined(cl_khr_command_buffer_mutable_dispatch)
+inline const DispatchTable* find_table(const DispatchTable* tables, size_t count, cl_mutable_command_khr object)
+{
+    if (object == nullptr) return nullptr;
+    if (count <= 1) return tables;
+
+    for (size_t i = 0; i < count; i++) {
+        if (tables[i].clGetMutableCommandInfoKHR) {
+            cl_command_buffer_khr value = nullptr;
+            cl_int errorCode = tables[i].clGetMutableCommandInfoKHR(
+                object,
+                CL_MUTABLE_COMMAND_COMMAND_BUFFER_KHR,
+                sizeof(value),
+                &value,
+                nullptr);
+            if (errorCode == CL_SUCCESS) {
+                return tables + i;
+            }
+        }
+    }
+
+    return nullptr;
+}
+#endif // defined(cl_khr_command_buffer_mutable_dispatch)
+
+#if defined(cl_intel_accelerator)
+inline const DispatchTable* find_table(const DispatchTable* tables, size_t count, cl_accelerator_intel object)
+{
+    if (object == nullptr) return nullptr;
+    if (count <= 1) return tables;
+
+    for (size_t i = 0; i < count; i++) {
+        if (tables[i].clGetAcceleratorInfoINTEL) {
+            cl_uint value = 0;
+            cl_int errorCode = tables[i].clGetAcceleratorInfoINTEL(
+                object,
+                CL_ACCELERATOR_REFERENCE_COUNT_INTEL,
+                sizeof(value),
+                &value,
+                nullptr);
+            if (errorCode == CL_SUCCESS) {
+                return tables + i;
+            }
+        }
+    }
+
+    return nullptr;
+}
+#endif // defined(cl_intel_accelerator)
+
+/***************************************************************
+* Dispatch Policy State
+***************************************************************/
+
+// Static members of class templates may be defined in a header, so these
+// are shared by every translation unit that includes this header.  The
+// dispatch tables are intentionally never destroyed, since extension APIs
+// may be called from static destructors.
+
+template<typename Unused = void>
+struct SinglePlatformState {
+    static std::atomic<const DispatchTable*> table;
+    static std::mutex lock;
+};
+
+template<typename Unused>
+std::atomic<const DispatchTable*> SinglePlatformState<Unused>::table(nullptr);
+template<typename Unused>
+std::mutex SinglePlatformState<Unused>::lock;
+
+template<typename Unused = void>
+struct MultiPlatformState {
+    static std::atomic<const std::vector<DispatchTable>*> tables;
+    static std::mutex lock;
+};
+
+template<typename Unused>
+std::atomic<const std::vector<DispatchTable>*> MultiPlatformState<Unused>::tables(nullptr);
+template<typename Unused>
+std::mutex MultiPlatformState<Unused>::lock;
+
+} // namespace detail
+
+/***************************************************************
+* Dispatch Policies
+***************************************************************/
+
+class SinglePlatform {
+public:
+    template<typename T>
+    const DispatchTable* get(T object) const
+    {
+        if (object == nullptr) return nullptr;
+
+        const DispatchTable* table =
+            detail::SinglePlatformState<>::table.load(std::memory_order_acquire);
+        return table ? table : init(object);
+    }
+
+    // For these objects we cannot query a platform ID, so the dispatch table
+    // must already be initialized.
+#if defined(cl_khr_semaphore)
+    const DispatchTable* get(cl_semaphore_khr) const
+    {
+        return detail::SinglePlatformState<>::table.load(std::memory_order_acquire);
+    }
+#endif // defined(cl_khr_semaphore)
+#if defined(cl_khr_command_buffer)
+    const DispatchTable* get(cl_command_buffer_khr) const
+    {
+        return detail::SinglePlatformState<>::table.load(std::memory_order_acquire);
+    }
+#endif // defined(cl_khr_command_buffer)
+#if defined(cl_khr_command_buffer_mutable_dispatch)
+    const DispatchTable* get(cl_mutable_command_khr) const
+    {
+        return detail::SinglePlatformState<>::table.load(std::memory_order_acquire);
+    }
+#endif // defined(cl_khr_command_buffer_mutable_dispatch)
+#if defined(cl_intel_accelerator)
+    const DispatchTable* get(cl_accelerator_intel) const
+    {
+        return detail::SinglePlatformState<>::table.load(std::memory_order_acquire);
+    }
+#endif // defined(cl_intel_accelerator)
+
+private:
+    template<typename T>
+    CLEXT_NOINLINE static const DispatchTable* init(T object)
+    {
+        std::lock_guard<std::mutex> guard(detail::SinglePlatformState<>::lock);
+        const DispatchTable* table =
+            detail::SinglePlatformState<>::table.load(std::memory_order_relaxed);
+        if (table == nullptr) {
+            table = new DispatchTable(detail::get_platform(object));
+            detail::SinglePlatformState<>::table.store(table, std::memory_order_release);
+        }
+        return table;
+    }
+};
+
+class MultiPlatformCached {
+public:
+    template<typename T>
+    const DispatchTable* get(T object) const
+    {
+        const std::vector<DispatchTable>* tables =
+            detail::MultiPlatformState<>::tables.load(std::memory_order_acquire);
+        if (tables == nullptr) {
+            tables = init();
+        }
+        return detail::find_table(tables->data(), tables->size(), object);
+    }
+
+private:
+    CLEXT_NOINLINE static const std::vector<DispatchTable>* init()
+    {
+        std::lock_guard<std::mutex> guard(detail::MultiPlatformState<>::lock);
+        const std::vector<DispatchTable>* tables =
+            detail::MultiPlatformState<>::tables.load(std::memory_order_relaxed);
+        if (tables == nullptr) {
+            cl_uint numPlatforms = 0;
+            clGetPlatformIDs(0, nullptr, &numPlatforms);
+
+            std::vector<cl_platform_id> platforms(numPlatforms);
+            if (numPlatforms != 0) {
+                clGetPlatformIDs(numPlatforms, platforms.data(), nullptr);
+            }
+
+            std::vector<DispatchTable>* newTables = new std::vector<DispatchTable>;
+            for (cl_platform_id platform : platforms) {
+                newTables->push_back(DispatchTable(platform));
+            }
+
+            tables = newTables;
+            detail::MultiPlatformState<>::tables.store(tables, std::memory_order_release);
+        }
+        return tables;
+    }
+};
+
+class ExplicitTable {
+public:
+    explicit ExplicitTable(const DispatchTable* table_) : table(table_) {}
+
+    template<typename T>
+    const DispatchTable* get(T) const
+    {
+        return table;
+    }
+
+private:
+    const DispatchTable* table;
+};
+
+/***************************************************************
+* Extension Functions
+***************************************************************/
+
+template<typename Policy>
+class Dispatch : private Policy {
+public:
+    Dispatch() = default;
+    explicit Dispatch(const Policy& policy) : Policy(policy) {}
+
+#if defined(cl_khr_command_buffer)
+    cl_command_buffer_khr clCreateCommandBufferKHR(
+        cl_uint num_queues,
+        const cl_command_queue* queues,
+        const cl_command_buffer_properties_khr* properties,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(num_queues > 0 && queues ? queues[0] : nullptr);
+        if (table == nullptr || table->clCreateCommandBufferKHR == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clCreateCommandBufferKHR(
+            num_queues,
+            queues,
+            properties,
+            errcode_ret);
+    }
+
+    cl_int clFinalizeCommandBufferKHR(
+        cl_command_buffer_khr command_buffer) const
+    {
+        const DispatchTable* table = this->get(command_buffer);
+        if (table == nullptr || table->clFinalizeCommandBufferKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clFinalizeCommandBufferKHR(
+            command_buffer);
+    }
+
+    cl_int clRetainCommandBufferKHR(
+        cl_command_buffer_khr command_buffer) const
+    {
+        const DispatchTable* table = this->get(command_buffer);
+        if (table == nullptr || table->clRetainCommandBufferKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clRetainCommandBufferKHR(
+            command_buffer);
+    }
+
+    cl_int clReleaseCommandBufferKHR(
+        cl_command_buffer_khr command_buffer) const
+    {
+        const DispatchTable* table = this->get(command_buffer);
+        if (table == nullptr || table->clReleaseCommandBufferKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clReleaseCommandBufferKHR(
+            command_buffer);
+    }
+
+    cl_int clEnqueueCommandBufferKHR(
+        cl_uint num_queues,
+        cl_command_queue* queues,
+        cl_command_buffer_khr command_buffer,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_buffer);
+        if (table == nullptr || table->clEnqueueCommandBufferKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueCommandBufferKHR(
+            num_queues,
+            queues,
+            command_buffer,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clCommandBarrierWithWaitListKHR(
+        cl_command_buffer_khr command_buffer,
+        cl_command_queue command_queue,
+        const cl_command_properties_khr* properties,
+        cl_uint num_sync_points_in_wait_list,
+        const cl_sync_point_khr* sync_point_wait_list,
+        cl_sync_point_khr* sync_point,
+        cl_mutable_command_khr* mutable_handle) const
+    {
+        const DispatchTable* table = this->get(command_buffer);
+        if (table == nullptr || table->clCommandBarrierWithWaitListKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clCommandBarrierWithWaitListKHR(
+            command_buffer,
+            command_queue,
+            properties,
+            num_sync_points_in_wait_list,
+            sync_point_wait_list,
+            sync_point,
+            mutable_handle);
+    }
+
+    cl_int clCommandCopyBufferKHR(
+        cl_command_buffer_khr command_buffer,
+        cl_command_queue command_queue,
+        const cl_command_properties_khr* properties,
+        cl_mem src_buffer,
+        cl_mem dst_buffer,
+        size_t src_offset,
+        size_t dst_offset,
+        size_t size,
+        cl_uint num_sync_points_in_wait_list,
+        const cl_sync_point_khr* sync_point_wait_list,
+        cl_sync_point_khr* sync_point,
+        cl_mutable_command_khr* mutable_handle) const
+    {
+        const DispatchTable* table = this->get(command_buffer);
+        if (table == nullptr || table->clCommandCopyBufferKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clCommandCopyBufferKHR(
+            command_buffer,
+            command_queue,
+            properties,
+            src_buffer,
+            dst_buffer,
+            src_offset,
+            dst_offset,
+            size,
+            num_sync_points_in_wait_list,
+            sync_point_wait_list,
+            sync_point,
+            mutable_handle);
+    }
+
+    cl_int clCommandCopyBufferRectKHR(
+        cl_command_buffer_khr command_buffer,
+        cl_command_queue command_queue,
+        const cl_command_properties_khr* properties,
+        cl_mem src_buffer,
+        cl_mem dst_buffer,
+        const size_t* src_origin,
+        const size_t* dst_origin,
+        const size_t* region,
+        size_t src_row_pitch,
+        size_t src_slice_pitch,
+        size_t dst_row_pitch,
+        size_t dst_slice_pitch,
+        cl_uint num_sync_points_in_wait_list,
+        const cl_sync_point_khr* sync_point_wait_list,
+        cl_sync_point_khr* sync_point,
+        cl_mutable_command_khr* mutable_handle) const
+    {
+        const DispatchTable* table = this->get(command_buffer);
+        if (table == nullptr || table->clCommandCopyBufferRectKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clCommandCopyBufferRectKHR(
+            command_buffer,
+            command_queue,
+            properties,
+            src_buffer,
+            dst_buffer,
+            src_origin,
+            dst_origin,
+            region,
+            src_row_pitch,
+            src_slice_pitch,
+            dst_row_pitch,
+            dst_slice_pitch,
+            num_sync_points_in_wait_list,
+            sync_point_wait_list,
+            sync_point,
+            mutable_handle);
+    }
+
+    cl_int clCommandCopyBufferToImageKHR(
+        cl_command_buffer_khr command_buffer,
+        cl_command_queue command_queue,
+        const cl_command_properties_khr* properties,
+        cl_mem src_buffer,
+        cl_mem dst_image,
+        size_t src_offset,
+        const size_t* dst_origin,
+        const size_t* region,
+        cl_uint num_sync_points_in_wait_list,
+        const cl_sync_point_khr* sync_point_wait_list,
+        cl_sync_point_khr* sync_point,
+        cl_mutable_command_khr* mutable_handle) const
+    {
+        const DispatchTable* table = this->get(command_buffer);
+        if (table == nullptr || table->clCommandCopyBufferToImageKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clCommandCopyBufferToImageKHR(
+            command_buffer,
+            command_queue,
+            properties,
+            src_buffer,
+            dst_image,
+            src_offset,
+            dst_origin,
+            region,
+            num_sync_points_in_wait_list,
+            sync_point_wait_list,
+            sync_point,
+            mutable_handle);
+    }
+
+    cl_int clCommandCopyImageKHR(
+        cl_command_buffer_khr command_buffer,
+        cl_command_queue command_queue,
+        const cl_command_properties_khr* properties,
+        cl_mem src_image,
+        cl_mem dst_image,
+        const size_t* src_origin,
+        const size_t* dst_origin,
+        const size_t* region,
+        cl_uint num_sync_points_in_wait_list,
+        const cl_sync_point_khr* sync_point_wait_list,
+        cl_sync_point_khr* sync_point,
+        cl_mutable_command_khr* mutable_handle) const
+    {
+        const DispatchTable* table = this->get(command_buffer);
+        if (table == nullptr || table->clCommandCopyImageKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clCommandCopyImageKHR(
+            command_buffer,
+            command_queue,
+            properties,
+            src_image,
+            dst_image,
+            src_origin,
+            dst_origin,
+            region,
+            num_sync_points_in_wait_list,
+            sync_point_wait_list,
+            sync_point,
+            mutable_handle);
+    }
+
+    cl_int clCommandCopyImageToBufferKHR(
+        cl_command_buffer_khr command_buffer,
+        cl_command_queue command_queue,
+        const cl_command_properties_khr* properties,
+        cl_mem src_image,
+        cl_mem dst_buffer,
+        const size_t* src_origin,
+        const size_t* region,
+        size_t dst_offset,
+        cl_uint num_sync_points_in_wait_list,
+        const cl_sync_point_khr* sync_point_wait_list,
+        cl_sync_point_khr* sync_point,
+        cl_mutable_command_khr* mutable_handle) const
+    {
+        const DispatchTable* table = this->get(command_buffer);
+        if (table == nullptr || table->clCommandCopyImageToBufferKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clCommandCopyImageToBufferKHR(
+            command_buffer,
+            command_queue,
+            properties,
+            src_image,
+            dst_buffer,
+            src_origin,
+            region,
+            dst_offset,
+            num_sync_points_in_wait_list,
+            sync_point_wait_list,
+            sync_point,
+            mutable_handle);
+    }
+
+    cl_int clCommandFillBufferKHR(
+        cl_command_buffer_khr command_buffer,
+        cl_command_queue command_queue,
+        const cl_command_properties_khr* properties,
+        cl_mem buffer,
+        const void* pattern,
+        size_t pattern_size,
+        size_t offset,
+        size_t size,
+        cl_uint num_sync_points_in_wait_list,
+        const cl_sync_point_khr* sync_point_wait_list,
+        cl_sync_point_khr* sync_point,
+        cl_mutable_command_khr* mutable_handle) const
+    {
+        const DispatchTable* table = this->get(command_buffer);
+        if (table == nullptr || table->clCommandFillBufferKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clCommandFillBufferKHR(
+            command_buffer,
+            command_queue,
+            properties,
+            buffer,
+            pattern,
+            pattern_size,
+            offset,
+            size,
+            num_sync_points_in_wait_list,
+            sync_point_wait_list,
+            sync_point,
+            mutable_handle);
+    }
+
+    cl_int clCommandFillImageKHR(
+        cl_command_buffer_khr command_buffer,
+        cl_command_queue command_queue,
+        const cl_command_properties_khr* properties,
+        cl_mem image,
+        const void* fill_color,
+        const size_t* origin,
+        const size_t* region,
+        cl_uint num_sync_points_in_wait_list,
+        const cl_sync_point_khr* sync_point_wait_list,
+        cl_sync_point_khr* sync_point,
+        cl_mutable_command_khr* mutable_handle) const
+    {
+        const DispatchTable* table = this->get(command_buffer);
+        if (table == nullptr || table->clCommandFillImageKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clCommandFillImageKHR(
+            command_buffer,
+            command_queue,
+            properties,
+            image,
+            fill_color,
+            origin,
+            region,
+            num_sync_points_in_wait_list,
+            sync_point_wait_list,
+            sync_point,
+            mutable_handle);
+    }
+
+    cl_int clCommandNDRangeKernelKHR(
+        cl_command_buffer_khr command_buffer,
+        cl_command_queue command_queue,
+        const cl_command_properties_khr* properties,
+        cl_kernel kernel,
+        cl_uint work_dim,
+        const size_t* global_work_offset,
+        const size_t* global_work_size,
+        const size_t* local_work_size,
+        cl_uint num_sync_points_in_wait_list,
+        const cl_sync_point_khr* sync_point_wait_list,
+        cl_sync_point_khr* sync_point,
+        cl_mutable_command_khr* mutable_handle) const
+    {
+        const DispatchTable* table = this->get(command_buffer);
+        if (table == nullptr || table->clCommandNDRangeKernelKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clCommandNDRangeKernelKHR(
+            command_buffer,
+            command_queue,
+            properties,
+            kernel,
+            work_dim,
+            global_work_offset,
+            global_work_size,
+            local_work_size,
+            num_sync_points_in_wait_list,
+            sync_point_wait_list,
+            sync_point,
+            mutable_handle);
+    }
+
+    cl_int clGetCommandBufferInfoKHR(
+        cl_command_buffer_khr command_buffer,
+        cl_command_buffer_info_khr param_name,
+        size_t param_value_size,
+        void* param_value,
+        size_t* param_value_size_ret) const
+    {
+        const DispatchTable* table = this->get(command_buffer);
+        if (table == nullptr || table->clGetCommandBufferInfoKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetCommandBufferInfoKHR(
+            command_buffer,
+            param_name,
+            param_value_size,
+            param_value,
+            param_value_size_ret);
+    }
+
+    cl_int clCommandSVMMemcpyKHR(
+        cl_command_buffer_khr command_buffer,
+        cl_command_queue command_queue,
+        const cl_command_properties_khr* properties,
+        void* dst_ptr,
+        const void* src_ptr,
+        size_t size,
+        cl_uint num_sync_points_in_wait_list,
+        const cl_sync_point_khr* sync_point_wait_list,
+        cl_sync_point_khr* sync_point,
+        cl_mutable_command_khr* mutable_handle) const
+    {
+        const DispatchTable* table = this->get(command_buffer);
+        if (table == nullptr || table->clCommandSVMMemcpyKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clCommandSVMMemcpyKHR(
+            command_buffer,
+            command_queue,
+            properties,
+            dst_ptr,
+            src_ptr,
+            size,
+            num_sync_points_in_wait_list,
+            sync_point_wait_list,
+            sync_point,
+            mutable_handle);
+    }
+
+    cl_int clCommandSVMMemFillKHR(
+        cl_command_buffer_khr command_buffer,
+        cl_command_queue command_queue,
+        const cl_command_properties_khr* properties,
+        void* svm_ptr,
+        const void* pattern,
+        size_t pattern_size,
+        size_t size,
+        cl_uint num_sync_points_in_wait_list,
+        const cl_sync_point_khr* sync_point_wait_list,
+        cl_sync_point_khr* sync_point,
+        cl_mutable_command_khr* mutable_handle) const
+    {
+        const DispatchTable* table = this->get(command_buffer);
+        if (table == nullptr || table->clCommandSVMMemFillKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clCommandSVMMemFillKHR(
+            command_buffer,
+            command_queue,
+            properties,
+            svm_ptr,
+            pattern,
+            pattern_size,
+            size,
+            num_sync_points_in_wait_list,
+            sync_point_wait_list,
+            sync_point,
+            mutable_handle);
+    }
+
+#endif // defined(cl_khr_command_buffer)
+#if defined(cl_khr_command_buffer_multi_device)
+    cl_command_buffer_khr clRemapCommandBufferKHR(
+        cl_command_buffer_khr command_buffer,
+        cl_bool automatic,
+        cl_uint num_queues,
+        const cl_command_queue* queues,
+        cl_uint num_handles,
+        const cl_mutable_command_khr* handles,
+        cl_mutable_command_khr* handles_ret,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(command_buffer);
+        if (table == nullptr || table->clRemapCommandBufferKHR == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clRemapCommandBufferKHR(
+            command_buffer,
+            automatic,
+            num_queues,
+            queues,
+            num_handles,
+            handles,
+            handles_ret,
+            errcode_ret);
+    }
+
+#endif // defined(cl_khr_command_buffer_multi_device)
+#if defined(cl_khr_command_buffer_mutable_dispatch)
+    cl_int clUpdateMutableCommandsKHR(
+        cl_command_buffer_khr command_buffer,
+        cl_uint num_configs,
+        const cl_command_buffer_update_type_khr* config_types,
+        const void** configs) const
+    {
+        const DispatchTable* table = this->get(command_buffer);
+        if (table == nullptr || table->clUpdateMutableCommandsKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clUpdateMutableCommandsKHR(
+            command_buffer,
+            num_configs,
+            config_types,
+            configs);
+    }
+
+    cl_int clGetMutableCommandInfoKHR(
+        cl_mutable_command_khr command,
+        cl_mutable_command_info_khr param_name,
+        size_t param_value_size,
+        void* param_value,
+        size_t* param_value_size_ret) const
+    {
+        const DispatchTable* table = this->get(command);
+        if (table == nullptr || table->clGetMutableCommandInfoKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetMutableCommandInfoKHR(
+            command,
+            param_name,
+            param_value_size,
+            param_value,
+            param_value_size_ret);
+    }
+
+#endif // defined(cl_khr_command_buffer_mutable_dispatch)
+#if defined(cl_khr_create_command_queue)
+    cl_command_queue clCreateCommandQueueWithPropertiesKHR(
+        cl_context context,
+        cl_device_id device,
+        const cl_queue_properties_khr* properties,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clCreateCommandQueueWithPropertiesKHR == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clCreateCommandQueueWithPropertiesKHR(
+            context,
+            device,
+            properties,
+            errcode_ret);
+    }
+
+#endif // defined(cl_khr_create_command_queue)
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_khr_d3d10_sharing)
+    cl_int clGetDeviceIDsFromD3D10KHR(
+        cl_platform_id platform,
+        cl_d3d10_device_source_khr d3d_device_source,
+        void* d3d_object,
+        cl_d3d10_device_set_khr d3d_device_set,
+        cl_uint num_entries,
+        cl_device_id* devices,
+        cl_uint* num_devices) const
+    {
+        const DispatchTable* table = this->get(platform);
+        if (table == nullptr || table->clGetDeviceIDsFromD3D10KHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetDeviceIDsFromD3D10KHR(
+            platform,
+            d3d_device_source,
+            d3d_object,
+            d3d_device_set,
+            num_entries,
+            devices,
+            num_devices);
+    }
+
+    cl_mem clCreateFromD3D10BufferKHR(
+        cl_context context,
+        cl_mem_flags flags,
+        ID3D10Buffer* resource,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clCreateFromD3D10BufferKHR == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clCreateFromD3D10BufferKHR(
+            context,
+            flags,
+            resource,
+            errcode_ret);
+    }
+
+    cl_mem clCreateFromD3D10Texture2DKHR(
+        cl_context context,
+        cl_mem_flags flags,
+        ID3D10Texture2D* resource,
+        UINT subresource,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clCreateFromD3D10Texture2DKHR == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clCreateFromD3D10Texture2DKHR(
+            context,
+            flags,
+            resource,
+            subresource,
+            errcode_ret);
+    }
+
+    cl_mem clCreateFromD3D10Texture3DKHR(
+        cl_context context,
+        cl_mem_flags flags,
+        ID3D10Texture3D* resource,
+        UINT subresource,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clCreateFromD3D10Texture3DKHR == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clCreateFromD3D10Texture3DKHR(
+            context,
+            flags,
+            resource,
+            subresource,
+            errcode_ret);
+    }
+
+    cl_int clEnqueueAcquireD3D10ObjectsKHR(
+        cl_command_queue command_queue,
+        cl_uint num_objects,
+        const cl_mem* mem_objects,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueAcquireD3D10ObjectsKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueAcquireD3D10ObjectsKHR(
+            command_queue,
+            num_objects,
+            mem_objects,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clEnqueueReleaseD3D10ObjectsKHR(
+        cl_command_queue command_queue,
+        cl_uint num_objects,
+        const cl_mem* mem_objects,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueReleaseD3D10ObjectsKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueReleaseD3D10ObjectsKHR(
+            command_queue,
+            num_objects,
+            mem_objects,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+#endif // defined(cl_khr_d3d10_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_khr_d3d11_sharing)
+    cl_int clGetDeviceIDsFromD3D11KHR(
+        cl_platform_id platform,
+        cl_d3d11_device_source_khr d3d_device_source,
+        void* d3d_object,
+        cl_d3d11_device_set_khr d3d_device_set,
+        cl_uint num_entries,
+        cl_device_id* devices,
+        cl_uint* num_devices) const
+    {
+        const DispatchTable* table = this->get(platform);
+        if (table == nullptr || table->clGetDeviceIDsFromD3D11KHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetDeviceIDsFromD3D11KHR(
+            platform,
+            d3d_device_source,
+            d3d_object,
+            d3d_device_set,
+            num_entries,
+            devices,
+            num_devices);
+    }
+
+    cl_mem clCreateFromD3D11BufferKHR(
+        cl_context context,
+        cl_mem_flags flags,
+        ID3D11Buffer* resource,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clCreateFromD3D11BufferKHR == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clCreateFromD3D11BufferKHR(
+            context,
+            flags,
+            resource,
+            errcode_ret);
+    }
+
+    cl_mem clCreateFromD3D11Texture2DKHR(
+        cl_context context,
+        cl_mem_flags flags,
+        ID3D11Texture2D* resource,
+        UINT subresource,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clCreateFromD3D11Texture2DKHR == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clCreateFromD3D11Texture2DKHR(
+            context,
+            flags,
+            resource,
+            subresource,
+            errcode_ret);
+    }
+
+    cl_mem clCreateFromD3D11Texture3DKHR(
+        cl_context context,
+        cl_mem_flags flags,
+        ID3D11Texture3D* resource,
+        UINT subresource,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clCreateFromD3D11Texture3DKHR == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clCreateFromD3D11Texture3DKHR(
+            context,
+            flags,
+            resource,
+            subresource,
+            errcode_ret);
+    }
+
+    cl_int clEnqueueAcquireD3D11ObjectsKHR(
+        cl_command_queue command_queue,
+        cl_uint num_objects,
+        const cl_mem* mem_objects,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueAcquireD3D11ObjectsKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueAcquireD3D11ObjectsKHR(
+            command_queue,
+            num_objects,
+            mem_objects,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clEnqueueReleaseD3D11ObjectsKHR(
+        cl_command_queue command_queue,
+        cl_uint num_objects,
+        const cl_mem* mem_objects,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueReleaseD3D11ObjectsKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueReleaseD3D11ObjectsKHR(
+            command_queue,
+            num_objects,
+            mem_objects,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+#endif // defined(cl_khr_d3d11_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_khr_dx9_media_sharing)
+    cl_int clGetDeviceIDsFromDX9MediaAdapterKHR(
+        cl_platform_id platform,
+        cl_uint num_media_adapters,
+        cl_dx9_media_adapter_type_khr* media_adapter_type,
+        void* media_adapters,
+        cl_dx9_media_adapter_set_khr media_adapter_set,
+        cl_uint num_entries,
+        cl_device_id* devices,
+        cl_uint* num_devices) const
+    {
+        const DispatchTable* table = this->get(platform);
+        if (table == nullptr || table->clGetDeviceIDsFromDX9MediaAdapterKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetDeviceIDsFromDX9MediaAdapterKHR(
+            platform,
+            num_media_adapters,
+            media_adapter_type,
+            media_adapters,
+            media_adapter_set,
+            num_entries,
+            devices,
+            num_devices);
+    }
+
+    cl_mem clCreateFromDX9MediaSurfaceKHR(
+        cl_context context,
+        cl_mem_flags flags,
+        cl_dx9_media_adapter_type_khr adapter_type,
+        void* surface_info,
+        cl_uint plane,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clCreateFromDX9MediaSurfaceKHR == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clCreateFromDX9MediaSurfaceKHR(
+            context,
+            flags,
+            adapter_type,
+            surface_info,
+            plane,
+            errcode_ret);
+    }
+
+    cl_int clEnqueueAcquireDX9MediaSurfacesKHR(
+        cl_command_queue command_queue,
+        cl_uint num_objects,
+        const cl_mem* mem_objects,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueAcquireDX9MediaSurfacesKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueAcquireDX9MediaSurfacesKHR(
+            command_queue,
+            num_objects,
+            mem_objects,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clEnqueueReleaseDX9MediaSurfacesKHR(
+        cl_command_queue command_queue,
+        cl_uint num_objects,
+        const cl_mem* mem_objects,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueReleaseDX9MediaSurfacesKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueReleaseDX9MediaSurfacesKHR(
+            command_queue,
+            num_objects,
+            mem_objects,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+#endif // defined(cl_khr_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_event)
+    cl_event clCreateEventFromEGLSyncKHR(
+        cl_context context,
+        CLeglSyncKHR sync,
+        CLeglDisplayKHR display,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clCreateEventFromEGLSyncKHR == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clCreateEventFromEGLSyncKHR(
+            context,
+            sync,
+            display,
+            errcode_ret);
+    }
+
+#endif // defined(cl_khr_egl_event)
+#endif // defined(CLEXT_INCLUDE_EGL)
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_image)
+    cl_mem clCreateFromEGLImageKHR(
+        cl_context context,
+        CLeglDisplayKHR egldisplay,
+        CLeglImageKHR eglimage,
+        cl_mem_flags flags,
+        const cl_egl_image_properties_khr* properties,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clCreateFromEGLImageKHR == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clCreateFromEGLImageKHR(
+            context,
+            egldisplay,
+            eglimage,
+            flags,
+            properties,
+            errcode_ret);
+    }
+
+    cl_int clEnqueueAcquireEGLObjectsKHR(
+        cl_command_queue command_queue,
+        cl_uint num_objects,
+        const cl_mem* mem_objects,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueAcquireEGLObjectsKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueAcquireEGLObjectsKHR(
+            command_queue,
+            num_objects,
+            mem_objects,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clEnqueueReleaseEGLObjectsKHR(
+        cl_command_queue command_queue,
+        cl_uint num_objects,
+        const cl_mem* mem_objects,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueReleaseEGLObjectsKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueReleaseEGLObjectsKHR(
+            command_queue,
+            num_objects,
+            mem_objects,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+#endif // defined(cl_khr_egl_image)
+#endif // defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_external_memory)
+    cl_int clEnqueueAcquireExternalMemObjectsKHR(
+        cl_command_queue command_queue,
+        cl_uint num_mem_objects,
+        const cl_mem* mem_objects,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueAcquireExternalMemObjectsKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueAcquireExternalMemObjectsKHR(
+            command_queue,
+            num_mem_objects,
+            mem_objects,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clEnqueueReleaseExternalMemObjectsKHR(
+        cl_command_queue command_queue,
+        cl_uint num_mem_objects,
+        const cl_mem* mem_objects,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueReleaseExternalMemObjectsKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueReleaseExternalMemObjectsKHR(
+            command_queue,
+            num_mem_objects,
+            mem_objects,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+#endif // defined(cl_khr_external_memory)
+#if defined(cl_khr_external_semaphore)
+    cl_int clGetSemaphoreHandleForTypeKHR(
+        cl_semaphore_khr sema_object,
+        cl_device_id device,
+        cl_external_semaphore_handle_type_khr handle_type,
+        size_t handle_size,
+        void* handle_ptr,
+        size_t* handle_size_ret) const
+    {
+        const DispatchTable* table = this->get(sema_object);
+        if (table == nullptr || table->clGetSemaphoreHandleForTypeKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetSemaphoreHandleForTypeKHR(
+            sema_object,
+            device,
+            handle_type,
+            handle_size,
+            handle_ptr,
+            handle_size_ret);
+    }
+
+#endif // defined(cl_khr_external_semaphore)
+#if defined(cl_khr_external_semaphore_sync_fd)
+    cl_int clReImportSemaphoreSyncFdKHR(
+        cl_semaphore_khr sema_object,
+        cl_semaphore_reimport_properties_khr* reimport_props,
+        int fd) const
+    {
+        const DispatchTable* table = this->get(sema_object);
+        if (table == nullptr || table->clReImportSemaphoreSyncFdKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clReImportSemaphoreSyncFdKHR(
+            sema_object,
+            reimport_props,
+            fd);
+    }
+
+#endif // defined(cl_khr_external_semaphore_sync_fd)
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_khr_gl_event)
+    cl_event clCreateEventFromGLsyncKHR(
+        cl_context context,
+        cl_GLsync sync,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clCreateEventFromGLsyncKHR == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clCreateEventFromGLsyncKHR(
+            context,
+            sync,
+            errcode_ret);
+    }
+
+#endif // defined(cl_khr_gl_event)
+#endif // defined(CLEXT_INCLUDE_GL)
+#if defined(cl_khr_il_program)
+    cl_program clCreateProgramWithILKHR(
+        cl_context context,
+        const void* il,
+        size_t length,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clCreateProgramWithILKHR == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clCreateProgramWithILKHR(
+            context,
+            il,
+            length,
+            errcode_ret);
+    }
+
+#endif // defined(cl_khr_il_program)
+#if defined(cl_khr_semaphore)
+    cl_semaphore_khr clCreateSemaphoreWithPropertiesKHR(
+        cl_context context,
+        const cl_semaphore_properties_khr* sema_props,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clCreateSemaphoreWithPropertiesKHR == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clCreateSemaphoreWithPropertiesKHR(
+            context,
+            sema_props,
+            errcode_ret);
+    }
+
+    cl_int clEnqueueWaitSemaphoresKHR(
+        cl_command_queue command_queue,
+        cl_uint num_sema_objects,
+        const cl_semaphore_khr* sema_objects,
+        const cl_semaphore_payload_khr* sema_payload_list,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueWaitSemaphoresKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueWaitSemaphoresKHR(
+            command_queue,
+            num_sema_objects,
+            sema_objects,
+            sema_payload_list,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clEnqueueSignalSemaphoresKHR(
+        cl_command_queue command_queue,
+        cl_uint num_sema_objects,
+        const cl_semaphore_khr* sema_objects,
+        const cl_semaphore_payload_khr* sema_payload_list,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueSignalSemaphoresKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueSignalSemaphoresKHR(
+            command_queue,
+            num_sema_objects,
+            sema_objects,
+            sema_payload_list,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clGetSemaphoreInfoKHR(
+        cl_semaphore_khr sema_object,
+        cl_semaphore_info_khr param_name,
+        size_t param_value_size,
+        void* param_value,
+        size_t* param_value_size_ret) const
+    {
+        const DispatchTable* table = this->get(sema_object);
+        if (table == nullptr || table->clGetSemaphoreInfoKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetSemaphoreInfoKHR(
+            sema_object,
+            param_name,
+            param_value_size,
+            param_value,
+            param_value_size_ret);
+    }
+
+    cl_int clReleaseSemaphoreKHR(
+        cl_semaphore_khr sema_object) const
+    {
+        const DispatchTable* table = this->get(sema_object);
+        if (table == nullptr || table->clReleaseSemaphoreKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clReleaseSemaphoreKHR(
+            sema_object);
+    }
+
+    cl_int clRetainSemaphoreKHR(
+        cl_semaphore_khr sema_object) const
+    {
+        const DispatchTable* table = this->get(sema_object);
+        if (table == nullptr || table->clRetainSemaphoreKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clRetainSemaphoreKHR(
+            sema_object);
+    }
+
+#endif // defined(cl_khr_semaphore)
+#if defined(cl_khr_subgroups)
+    cl_int clGetKernelSubGroupInfoKHR(
+        cl_kernel in_kernel,
+        cl_device_id in_device,
+        cl_kernel_sub_group_info param_name,
+        size_t input_value_size,
+        const void* input_value,
+        size_t param_value_size,
+        void* param_value,
+        size_t* param_value_size_ret) const
+    {
+        const DispatchTable* table = this->get(in_kernel);
+        if (table == nullptr || table->clGetKernelSubGroupInfoKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetKernelSubGroupInfoKHR(
+            in_kernel,
+            in_device,
+            param_name,
+            input_value_size,
+            input_value,
+            param_value_size,
+            param_value,
+            param_value_size_ret);
+    }
+
+#endif // defined(cl_khr_subgroups)
+#if defined(cl_khr_suggested_local_work_size)
+    cl_int clGetKernelSuggestedLocalWorkSizeKHR(
+        cl_command_queue command_queue,
+        cl_kernel kernel,
+        cl_uint work_dim,
+        const size_t* global_work_offset,
+        const size_t* global_work_size,
+        size_t* suggested_local_work_size) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clGetKernelSuggestedLocalWorkSizeKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetKernelSuggestedLocalWorkSizeKHR(
+            command_queue,
+            kernel,
+            work_dim,
+            global_work_offset,
+            global_work_size,
+            suggested_local_work_size);
+    }
+
+#endif // defined(cl_khr_suggested_local_work_size)
+#if defined(cl_khr_terminate_context)
+    cl_int clTerminateContextKHR(
+        cl_context context) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clTerminateContextKHR == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clTerminateContextKHR(
+            context);
+    }
+
+#endif // defined(cl_khr_terminate_context)
+#if defined(cl_ext_buffer_device_address)
+    cl_int clSetKernelArgDevicePointerEXT(
+        cl_kernel kernel,
+        cl_uint arg_index,
+        cl_mem_device_address_ext arg_value) const
+    {
+        const DispatchTable* table = this->get(kernel);
+        if (table == nullptr || table->clSetKernelArgDevicePointerEXT == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clSetKernelArgDevicePointerEXT(
+            kernel,
+            arg_index,
+            arg_value);
+    }
+
+#endif // defined(cl_ext_buffer_device_address)
+#if defined(cl_ext_device_fission)
+    cl_int clReleaseDeviceEXT(
+        cl_device_id device) const
+    {
+        const DispatchTable* table = this->get(device);
+        if (table == nullptr || table->clReleaseDeviceEXT == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clReleaseDeviceEXT(
+            device);
+    }
+
+    cl_int clRetainDeviceEXT(
+        cl_device_id device) const
+    {
+        const DispatchTable* table = this->get(device);
+        if (table == nullptr || table->clRetainDeviceEXT == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clRetainDeviceEXT(
+            device);
+    }
+
+    cl_int clCreateSubDevicesEXT(
+        cl_device_id in_device,
+        const cl_device_partition_property_ext* properties,
+        cl_uint num_entries,
+        cl_device_id* out_devices,
+        cl_uint* num_devices) const
+    {
+        const DispatchTable* table = this->get(in_device);
+        if (table == nullptr || table->clCreateSubDevicesEXT == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clCreateSubDevicesEXT(
+            in_device,
+            properties,
+            num_entries,
+            out_devices,
+            num_devices);
+    }
+
+#endif // defined(cl_ext_device_fission)
+#if defined(cl_ext_image_requirements_info)
+    cl_int clGetImageRequirementsInfoEXT(
+        cl_context context,
+        const cl_mem_properties* properties,
+        cl_mem_flags flags,
+        const cl_image_format* image_format,
+        const cl_image_desc* image_desc,
+        cl_image_requirements_info_ext param_name,
+        size_t param_value_size,
+        void* param_value,
+        size_t* param_value_size_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clGetImageRequirementsInfoEXT == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetImageRequirementsInfoEXT(
+            context,
+            properties,
+            flags,
+            image_format,
+            image_desc,
+            param_name,
+            param_value_size,
+            param_value,
+            param_value_size_ret);
+    }
+
+#endif // defined(cl_ext_image_requirements_info)
+#if defined(cl_ext_migrate_memobject)
+    cl_int clEnqueueMigrateMemObjectEXT(
+        cl_command_queue command_queue,
+        cl_uint num_mem_objects,
+        const cl_mem* mem_objects,
+        cl_mem_migration_flags_ext flags,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueMigrateMemObjectEXT == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueMigrateMemObjectEXT(
+            command_queue,
+            num_mem_objects,
+            mem_objects,
+            flags,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+#endif // defined(cl_ext_migrate_memobject)
+#if defined(cl_arm_import_memory)
+    cl_mem clImportMemoryARM(
+        cl_context context,
+        cl_mem_flags flags,
+        const cl_import_properties_arm* properties,
+        void* memory,
+        size_t size,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clImportMemoryARM == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clImportMemoryARM(
+            context,
+            flags,
+            properties,
+            memory,
+            size,
+            errcode_ret);
+    }
+
+#endif // defined(cl_arm_import_memory)
+#if defined(cl_arm_shared_virtual_memory)
+    void* clSVMAllocARM(
+        cl_context context,
+        cl_svm_mem_flags_arm flags,
+        size_t size,
+        cl_uint alignment) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clSVMAllocARM == nullptr) {
+            return nullptr;
+        }
+        return table->clSVMAllocARM(
+            context,
+            flags,
+            size,
+            alignment);
+    }
+
+    void clSVMFreeARM(
+        cl_context context,
+        void* svm_pointer) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clSVMFreeARM == nullptr) {
+            return;
+        }
+        table->clSVMFreeARM(
+            context,
+            svm_pointer);
+    }
+
+    cl_int clEnqueueSVMFreeARM(
+        cl_command_queue command_queue,
+        cl_uint num_svm_pointers,
+        void* svm_pointers[],
+        void (CL_CALLBACK* pfn_free_func)(cl_command_queue queue, cl_uint num_svm_pointers, void * svm_pointers[], void *user_data),
+        void* user_data,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueSVMFreeARM == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueSVMFreeARM(
+            command_queue,
+            num_svm_pointers,
+            svm_pointers,
+            pfn_free_func,
+            user_data,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clEnqueueSVMMemcpyARM(
+        cl_command_queue command_queue,
+        cl_bool blocking_copy,
+        void* dst_ptr,
+        const void* src_ptr,
+        size_t size,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueSVMMemcpyARM == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueSVMMemcpyARM(
+            command_queue,
+            blocking_copy,
+            dst_ptr,
+            src_ptr,
+            size,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clEnqueueSVMMemFillARM(
+        cl_command_queue command_queue,
+        void* svm_ptr,
+        const void* pattern,
+        size_t pattern_size,
+        size_t size,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueSVMMemFillARM == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueSVMMemFillARM(
+            command_queue,
+            svm_ptr,
+            pattern,
+            pattern_size,
+            size,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clEnqueueSVMMapARM(
+        cl_command_queue command_queue,
+        cl_bool blocking_map,
+        cl_map_flags flags,
+        void* svm_ptr,
+        size_t size,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueSVMMapARM == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueSVMMapARM(
+            command_queue,
+            blocking_map,
+            flags,
+            svm_ptr,
+            size,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clEnqueueSVMUnmapARM(
+        cl_command_queue command_queue,
+        void* svm_ptr,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueSVMUnmapARM == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueSVMUnmapARM(
+            command_queue,
+            svm_ptr,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clSetKernelArgSVMPointerARM(
+        cl_kernel kernel,
+        cl_uint arg_index,
+        const void* arg_value) const
+    {
+        const DispatchTable* table = this->get(kernel);
+        if (table == nullptr || table->clSetKernelArgSVMPointerARM == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clSetKernelArgSVMPointerARM(
+            kernel,
+            arg_index,
+            arg_value);
+    }
+
+    cl_int clSetKernelExecInfoARM(
+        cl_kernel kernel,
+        cl_kernel_exec_info_arm param_name,
+        size_t param_value_size,
+        const void* param_value) const
+    {
+        const DispatchTable* table = this->get(kernel);
+        if (table == nullptr || table->clSetKernelExecInfoARM == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clSetKernelExecInfoARM(
+            kernel,
+            param_name,
+            param_value_size,
+            param_value);
+    }
+
+#endif // defined(cl_arm_shared_virtual_memory)
+#if defined(cl_img_cancel_command)
+    cl_int clCancelCommandsIMG(
+        const cl_event* event_list,
+        size_t num_events_in_list) const
+    {
+        const DispatchTable* table = this->get(num_events_in_list > 0 && event_list ? event_list[0] : nullptr);
+        if (table == nullptr || table->clCancelCommandsIMG == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clCancelCommandsIMG(
+            event_list,
+            num_events_in_list);
+    }
+
+#endif // defined(cl_img_cancel_command)
+#if defined(cl_img_generate_mipmap)
+    cl_int clEnqueueGenerateMipmapIMG(
+        cl_command_queue command_queue,
+        cl_mem src_image,
+        cl_mem dst_image,
+        cl_mipmap_filter_mode_img mipmap_filter_mode,
+        const size_t* array_region,
+        const size_t* mip_region,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueGenerateMipmapIMG == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueGenerateMipmapIMG(
+            command_queue,
+            src_image,
+            dst_image,
+            mipmap_filter_mode,
+            array_region,
+            mip_region,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+#endif // defined(cl_img_generate_mipmap)
+#if defined(cl_img_use_gralloc_ptr)
+    cl_int clEnqueueAcquireGrallocObjectsIMG(
+        cl_command_queue command_queue,
+        cl_uint num_objects,
+        const cl_mem* mem_objects,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueAcquireGrallocObjectsIMG == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueAcquireGrallocObjectsIMG(
+            command_queue,
+            num_objects,
+            mem_objects,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clEnqueueReleaseGrallocObjectsIMG(
+        cl_command_queue command_queue,
+        cl_uint num_objects,
+        const cl_mem* mem_objects,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueReleaseGrallocObjectsIMG == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueReleaseGrallocObjectsIMG(
+            command_queue,
+            num_objects,
+            mem_objects,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+#endif // defined(cl_img_use_gralloc_ptr)
+#if defined(cl_intel_accelerator)
+    cl_accelerator_intel clCreateAcceleratorINTEL(
+        cl_context context,
+        cl_accelerator_type_intel accelerator_type,
+        size_t descriptor_size,
+        const void* descriptor,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clCreateAcceleratorINTEL == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clCreateAcceleratorINTEL(
+            context,
+            accelerator_type,
+            descriptor_size,
+            descriptor,
+            errcode_ret);
+    }
+
+    cl_int clGetAcceleratorInfoINTEL(
+        cl_accelerator_intel accelerator,
+        cl_accelerator_info_intel param_name,
+        size_t param_value_size,
+        void* param_value,
+        size_t* param_value_size_ret) const
+    {
+        const DispatchTable* table = this->get(accelerator);
+        if (table == nullptr || table->clGetAcceleratorInfoINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetAcceleratorInfoINTEL(
+            accelerator,
+            param_name,
+            param_value_size,
+            param_value,
+            param_value_size_ret);
+    }
+
+    cl_int clRetainAcceleratorINTEL(
+        cl_accelerator_intel accelerator) const
+    {
+        const DispatchTable* table = this->get(accelerator);
+        if (table == nullptr || table->clRetainAcceleratorINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clRetainAcceleratorINTEL(
+            accelerator);
+    }
+
+    cl_int clReleaseAcceleratorINTEL(
+        cl_accelerator_intel accelerator) const
+    {
+        const DispatchTable* table = this->get(accelerator);
+        if (table == nullptr || table->clReleaseAcceleratorINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clReleaseAcceleratorINTEL(
+            accelerator);
+    }
+
+#endif // defined(cl_intel_accelerator)
+#if defined(cl_intel_create_buffer_with_properties)
+    cl_mem clCreateBufferWithPropertiesINTEL(
+        cl_context context,
+        const cl_mem_properties_intel* properties,
+        cl_mem_flags flags,
+        size_t size,
+        void* host_ptr,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clCreateBufferWithPropertiesINTEL == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clCreateBufferWithPropertiesINTEL(
+            context,
+            properties,
+            flags,
+            size,
+            host_ptr,
+            errcode_ret);
+    }
+
+#endif // defined(cl_intel_create_buffer_with_properties)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_dx9_media_sharing)
+    cl_int clGetDeviceIDsFromDX9INTEL(
+        cl_platform_id platform,
+        cl_dx9_device_source_intel dx9_device_source,
+        void* dx9_object,
+        cl_dx9_device_set_intel dx9_device_set,
+        cl_uint num_entries,
+        cl_device_id* devices,
+        cl_uint* num_devices) const
+    {
+        const DispatchTable* table = this->get(platform);
+        if (table == nullptr || table->clGetDeviceIDsFromDX9INTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetDeviceIDsFromDX9INTEL(
+            platform,
+            dx9_device_source,
+            dx9_object,
+            dx9_device_set,
+            num_entries,
+            devices,
+            num_devices);
+    }
+
+    cl_mem clCreateFromDX9MediaSurfaceINTEL(
+        cl_context context,
+        cl_mem_flags flags,
+        IDirect3DSurface9* resource,
+        HANDLE sharedHandle,
+        UINT plane,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clCreateFromDX9MediaSurfaceINTEL == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clCreateFromDX9MediaSurfaceINTEL(
+            context,
+            flags,
+            resource,
+            sharedHandle,
+            plane,
+            errcode_ret);
+    }
+
+    cl_int clEnqueueAcquireDX9ObjectsINTEL(
+        cl_command_queue command_queue,
+        cl_uint num_objects,
+        const cl_mem* mem_objects,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueAcquireDX9ObjectsINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueAcquireDX9ObjectsINTEL(
+            command_queue,
+            num_objects,
+            mem_objects,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clEnqueueReleaseDX9ObjectsINTEL(
+        cl_command_queue command_queue,
+        cl_uint num_objects,
+        cl_mem* mem_objects,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueReleaseDX9ObjectsINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueReleaseDX9ObjectsINTEL(
+            command_queue,
+            num_objects,
+            mem_objects,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+#endif // defined(cl_intel_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_program_scope_host_pipe)
+    cl_int clEnqueueReadHostPipeINTEL(
+        cl_command_queue command_queue,
+        cl_program program,
+        const char* pipe_symbol,
+        cl_bool blocking_read,
+        void* ptr,
+        size_t size,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueReadHostPipeINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueReadHostPipeINTEL(
+            command_queue,
+            program,
+            pipe_symbol,
+            blocking_read,
+            ptr,
+            size,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clEnqueueWriteHostPipeINTEL(
+        cl_command_queue command_queue,
+        cl_program program,
+        const char* pipe_symbol,
+        cl_bool blocking_write,
+        const void* ptr,
+        size_t size,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueWriteHostPipeINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueWriteHostPipeINTEL(
+            command_queue,
+            program,
+            pipe_symbol,
+            blocking_write,
+            ptr,
+            size,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+#endif // defined(cl_intel_program_scope_host_pipe)
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_intel_sharing_format_query_d3d10)
+    cl_int clGetSupportedD3D10TextureFormatsINTEL(
+        cl_context context,
+        cl_mem_flags flags,
+        cl_mem_object_type image_type,
+        cl_uint num_entries,
+        DXGI_FORMAT* d3d10_formats,
+        cl_uint* num_texture_formats) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clGetSupportedD3D10TextureFormatsINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetSupportedD3D10TextureFormatsINTEL(
+            context,
+            flags,
+            image_type,
+            num_entries,
+            d3d10_formats,
+            num_texture_formats);
+    }
+
+#endif // defined(cl_intel_sharing_format_query_d3d10)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_intel_sharing_format_query_d3d11)
+    cl_int clGetSupportedD3D11TextureFormatsINTEL(
+        cl_context context,
+        cl_mem_flags flags,
+        cl_mem_object_type image_type,
+        cl_uint plane,
+        cl_uint num_entries,
+        DXGI_FORMAT* d3d11_formats,
+        cl_uint* num_texture_formats) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clGetSupportedD3D11TextureFormatsINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetSupportedD3D11TextureFormatsINTEL(
+            context,
+            flags,
+            image_type,
+            plane,
+            num_entries,
+            d3d11_formats,
+            num_texture_formats);
+    }
+
+#endif // defined(cl_intel_sharing_format_query_d3d11)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_sharing_format_query_dx9)
+    cl_int clGetSupportedDX9MediaSurfaceFormatsINTEL(
+        cl_context context,
+        cl_mem_flags flags,
+        cl_mem_object_type image_type,
+        cl_uint plane,
+        cl_uint num_entries,
+        D3DFORMAT* dx9_formats,
+        cl_uint* num_surface_formats) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clGetSupportedDX9MediaSurfaceFormatsINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetSupportedDX9MediaSurfaceFormatsINTEL(
+            context,
+            flags,
+            image_type,
+            plane,
+            num_entries,
+            dx9_formats,
+            num_surface_formats);
+    }
+
+#endif // defined(cl_intel_sharing_format_query_dx9)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_intel_sharing_format_query_gl)
+    cl_int clGetSupportedGLTextureFormatsINTEL(
+        cl_context context,
+        cl_mem_flags flags,
+        cl_mem_object_type image_type,
+        cl_uint num_entries,
+        cl_GLenum* gl_formats,
+        cl_uint* num_texture_formats) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clGetSupportedGLTextureFormatsINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetSupportedGLTextureFormatsINTEL(
+            context,
+            flags,
+            image_type,
+            num_entries,
+            gl_formats,
+            num_texture_formats);
+    }
+
+#endif // defined(cl_intel_sharing_format_query_gl)
+#endif // defined(CLEXT_INCLUDE_GL)
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_sharing_format_query_va_api)
+    cl_int clGetSupportedVA_APIMediaSurfaceFormatsINTEL(
+        cl_context context,
+        cl_mem_flags flags,
+        cl_mem_object_type image_type,
+        cl_uint plane,
+        cl_uint num_entries,
+        VAImageFormat* va_api_formats,
+        cl_uint* num_surface_formats) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clGetSupportedVA_APIMediaSurfaceFormatsINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetSupportedVA_APIMediaSurfaceFormatsINTEL(
+            context,
+            flags,
+            image_type,
+            plane,
+            num_entries,
+            va_api_formats,
+            num_surface_formats);
+    }
+
+#endif // defined(cl_intel_sharing_format_query_va_api)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_unified_shared_memory)
+    void* clHostMemAllocINTEL(
+        cl_context context,
+        const cl_mem_properties_intel* properties,
+        size_t size,
+        cl_uint alignment,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clHostMemAllocINTEL == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clHostMemAllocINTEL(
+            context,
+            properties,
+            size,
+            alignment,
+            errcode_ret);
+    }
+
+    void* clDeviceMemAllocINTEL(
+        cl_context context,
+        cl_device_id device,
+        const cl_mem_properties_intel* properties,
+        size_t size,
+        cl_uint alignment,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clDeviceMemAllocINTEL == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clDeviceMemAllocINTEL(
+            context,
+            device,
+            properties,
+            size,
+            alignment,
+            errcode_ret);
+    }
+
+    void* clSharedMemAllocINTEL(
+        cl_context context,
+        cl_device_id device,
+        const cl_mem_properties_intel* properties,
+        size_t size,
+        cl_uint alignment,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clSharedMemAllocINTEL == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clSharedMemAllocINTEL(
+            context,
+            device,
+            properties,
+            size,
+            alignment,
+            errcode_ret);
+    }
+
+    cl_int clMemFreeINTEL(
+        cl_context context,
+        void* ptr) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clMemFreeINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clMemFreeINTEL(
+            context,
+            ptr);
+    }
+
+    cl_int clMemBlockingFreeINTEL(
+        cl_context context,
+        void* ptr) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clMemBlockingFreeINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clMemBlockingFreeINTEL(
+            context,
+            ptr);
+    }
+
+    cl_int clGetMemAllocInfoINTEL(
+        cl_context context,
+        const void* ptr,
+        cl_mem_info_intel param_name,
+        size_t param_value_size,
+        void* param_value,
+        size_t* param_value_size_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clGetMemAllocInfoINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetMemAllocInfoINTEL(
+            context,
+            ptr,
+            param_name,
+            param_value_size,
+            param_value,
+            param_value_size_ret);
+    }
+
+    cl_int clSetKernelArgMemPointerINTEL(
+        cl_kernel kernel,
+        cl_uint arg_index,
+        const void* arg_value) const
+    {
+        const DispatchTable* table = this->get(kernel);
+        if (table == nullptr || table->clSetKernelArgMemPointerINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clSetKernelArgMemPointerINTEL(
+            kernel,
+            arg_index,
+            arg_value);
+    }
+
+    cl_int clEnqueueMemFillINTEL(
+        cl_command_queue command_queue,
+        void* dst_ptr,
+        const void* pattern,
+        size_t pattern_size,
+        size_t size,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueMemFillINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueMemFillINTEL(
+            command_queue,
+            dst_ptr,
+            pattern,
+            pattern_size,
+            size,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clEnqueueMemcpyINTEL(
+        cl_command_queue command_queue,
+        cl_bool blocking,
+        void* dst_ptr,
+        const void* src_ptr,
+        size_t size,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueMemcpyINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueMemcpyINTEL(
+            command_queue,
+            blocking,
+            dst_ptr,
+            src_ptr,
+            size,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clEnqueueMemAdviseINTEL(
+        cl_command_queue command_queue,
+        const void* ptr,
+        size_t size,
+        cl_mem_advice_intel advice,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueMemAdviseINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueMemAdviseINTEL(
+            command_queue,
+            ptr,
+            size,
+            advice,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+#if defined(CL_VERSION_1_2)
+    cl_int clEnqueueMigrateMemINTEL(
+        cl_command_queue command_queue,
+        const void* ptr,
+        size_t size,
+        cl_mem_migration_flags flags,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueMigrateMemINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueMigrateMemINTEL(
+            command_queue,
+            ptr,
+            size,
+            flags,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+#endif // defined(CL_VERSION_1_2)
+    cl_int clEnqueueMemsetINTEL(
+        cl_command_queue command_queue,
+        void* dst_ptr,
+        cl_int value,
+        size_t size,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueMemsetINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueMemsetINTEL(
+            command_queue,
+            dst_ptr,
+            value,
+            size,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+#endif // defined(cl_intel_unified_shared_memory)
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_va_api_media_sharing)
+    cl_int clGetDeviceIDsFromVA_APIMediaAdapterINTEL(
+        cl_platform_id platform,
+        cl_va_api_device_source_intel media_adapter_type,
+        void* media_adapter,
+        cl_va_api_device_set_intel media_adapter_set,
+        cl_uint num_entries,
+        cl_device_id* devices,
+        cl_uint* num_devices) const
+    {
+        const DispatchTable* table = this->get(platform);
+        if (table == nullptr || table->clGetDeviceIDsFromVA_APIMediaAdapterINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetDeviceIDsFromVA_APIMediaAdapterINTEL(
+            platform,
+            media_adapter_type,
+            media_adapter,
+            media_adapter_set,
+            num_entries,
+            devices,
+            num_devices);
+    }
+
+    cl_mem clCreateFromVA_APIMediaSurfaceINTEL(
+        cl_context context,
+        cl_mem_flags flags,
+        VASurfaceID* surface,
+        cl_uint plane,
+        cl_int* errcode_ret) const
+    {
+        const DispatchTable* table = this->get(context);
+        if (table == nullptr || table->clCreateFromVA_APIMediaSurfaceINTEL == nullptr) {
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+        }
+        return table->clCreateFromVA_APIMediaSurfaceINTEL(
+            context,
+            flags,
+            surface,
+            plane,
+            errcode_ret);
+    }
+
+    cl_int clEnqueueAcquireVA_APIMediaSurfacesINTEL(
+        cl_command_queue command_queue,
+        cl_uint num_objects,
+        const cl_mem* mem_objects,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueAcquireVA_APIMediaSurfacesINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueAcquireVA_APIMediaSurfacesINTEL(
+            command_queue,
+            num_objects,
+            mem_objects,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+    cl_int clEnqueueReleaseVA_APIMediaSurfacesINTEL(
+        cl_command_queue command_queue,
+        cl_uint num_objects,
+        const cl_mem* mem_objects,
+        cl_uint num_events_in_wait_list,
+        const cl_event* event_wait_list,
+        cl_event* event) const
+    {
+        const DispatchTable* table = this->get(command_queue);
+        if (table == nullptr || table->clEnqueueReleaseVA_APIMediaSurfacesINTEL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clEnqueueReleaseVA_APIMediaSurfacesINTEL(
+            command_queue,
+            num_objects,
+            mem_objects,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+
+#endif // defined(cl_intel_va_api_media_sharing)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_pocl_content_size)
+    cl_int clSetContentSizeBufferPoCL(
+        cl_mem buffer,
+        cl_mem content_size_buffer) const
+    {
+        const DispatchTable* table = this->get(buffer);
+        if (table == nullptr || table->clSetContentSizeBufferPoCL == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clSetContentSizeBufferPoCL(
+            buffer,
+            content_size_buffer);
+    }
+
+#endif // defined(cl_pocl_content_size)
+#if defined(cl_qcom_ext_host_ptr)
+    cl_int clGetDeviceImageInfoQCOM(
+        cl_device_id device,
+        size_t image_width,
+        size_t image_height,
+        const cl_image_format* image_format,
+        cl_image_pitch_info_qcom param_name,
+        size_t param_value_size,
+        void* param_value,
+        size_t* param_value_size_ret) const
+    {
+        const DispatchTable* table = this->get(device);
+        if (table == nullptr || table->clGetDeviceImageInfoQCOM == nullptr) {
+            return CL_INVALID_OPERATION;
+        }
+        return table->clGetDeviceImageInfoQCOM(
+            device,
+            image_width,
+            image_height,
+            image_format,
+            param_name,
+            param_value_size,
+            param_value,
+            param_value_size_ret);
+    }
+
+#endif // defined(cl_qcom_ext_host_ptr)
+};
+
+#if defined(cl_intel_unified_shared_memory)
+
+/***************************************************************
+* Unified Shared Memory Ring
+***************************************************************/
+
+// A single-producer, single-consumer ring of fixed-size records in one shared
+// or host USM allocation, so a host thread can stream records to kernels
+// without copying them.  The producer pushes records, and the consumer peeks
+// at a batch of records, enqueues kernels that read the records directly from
+// the USM allocation, then releases the records after the kernels complete.
+//
+// The head and tail indices are stored in the USM allocation, at HeadOffset
+// and TailOffset, and the records start at RecordOffset:
+//
+//     (char*)ring.get() + RecordOffset + (index & (capacity - 1)) * recordSize
+//
+// The indices increase monotonically and wrap around, and the capacity is a
+// power of two, so the number of records in the ring is always head - tail.
+// Kernels that read records while the producer is pushing more records, rather
+// than in batches that were pushed before the kernels were enqueued, need a
+// device that supports concurrent access to the USM allocation.
+
+template<typename Policy = MultiPlatformCached>
+class UsmRing {
+public:
+    enum : size_t {
+        HeadOffset = 0,
+        TailOffset = 64,
+        RecordOffset = 128,
+    };
+
+    // Allocates a ring with room for capacity records of recordSize bytes, as
+    // shared USM for the device, or as host USM if the device is nullptr.
+    // The capacity must be a power of two.
+    UsmRing(
+        cl_context context_,
+        cl_device_id device,
+        size_t recordSize_,
+        cl_uint capacity_,
+        cl_int* errcode_ret = nullptr,
+        const Policy& policy = Policy()) :
+        ext(policy), context(context_), recordSize(recordSize_), capacity(capacity_)
+    {
+        cl_int errorCode = CL_SUCCESS;
+        if (recordSize == 0 || capacity == 0 || (capacity & (capacity - 1)) != 0 ||
+            recordSize > ((size_t)-1 - RecordOffset) / capacity) {
+            errorCode = CL_INVALID_VALUE;
+        } else {
+            size_t size = RecordOffset + recordSize * capacity;
+            ptr = device ?
+                ext.clSharedMemAllocINTEL(context, device, nullptr, size, RecordOffset, &errorCode) :
+                ext.clHostMemAllocINTEL(context, nullptr, size, RecordOffset, &errorCode);
+        }
+        if (ptr) {
+            new (head()) std::atomic<cl_uint>(0);
+            new (tail()) std::atomic<cl_uint>(0);
+        }
+        if (errcode_ret) *errcode_ret = errorCode;
+    }
+
+    // Waits for any kernels that are still using the ring before freeing it.
+    // If the memory cannot be freed while blocking, e.g. because USM is
+    // emulated with SVM, it is not freed, since kernels may still use it.
+    ~UsmRing()
+    {
+        if (ptr) {
+            ext.clMemBlockingFreeINTEL(context, ptr);
+        }
+    }
+
+    UsmRing(const UsmRing&) = delete;
+    UsmRing& operator=(const UsmRing&) = delete;
+
+    void* get() const { return ptr; }
+    size_t getRecordSize() const { return recordSize; }
+    cl_uint getCapacity() const { return capacity; }
+
+    void* getRecord(cl_uint index) const
+    {
+        return (char*)ptr + RecordOffset + (index & (capacity - 1)) * recordSize;
+    }
+
+    // Sets a kernel argument to the USM allocation for the ring.
+    cl_int setKernelArg(cl_kernel kernel, cl_uint arg_index) const
+    {
+        return ext.clSetKernelArgMemPointerINTEL(kernel, arg_index, ptr);
+    }
+
+    // Called by the producer.  Copies up to count records into the ring and
+    // returns the number of records that were pushed, which is less than
+    // count if the ring is full.
+    cl_uint push(const void* records, cl_uint count)
+    {
+        cl_uint headIndex = head()->load(std::memory_order_relaxed);
+        cl_uint tailIndex = tail()->load(std::memory_order_acquire);
+        cl_uint pushed = std::min(count, capacity - (headIndex - tailIndex));
+
+        // Each contiguous run of records is copied at once.
+        const char* src = (const char*)records;
+        for (cl_uint i = 0; i < pushed; ) {
+            cl_uint slot = (headIndex + i) & (capacity - 1);
+            cl_uint run = std::min(pushed - i, capacity - slot);
+            memcpy(getRecord(slot), src + i * recordSize, run * recordSize);
+            i += run;
+        }
+
+        head()->store(headIndex + pushed, std::memory_order_release);
+        return pushed;
+    }
+
+    // Called by the consumer.  Returns the number of records in the ring, up
+    // to maxCount, and the index of the first record.  The records are not
+    // released, so the same records are returned until they are released.
+    cl_uint peek(cl_uint maxCount, cl_uint* first) const
+    {
+        cl_uint tailIndex = tail()->load(std::memory_order_relaxed);
+        cl_uint headIndex = head()->load(std::memory_order_acquire);
+        if (first) *first = tailIndex;
+        return std::min(maxCount, headIndex - tailIndex);
+    }
+
+    // Called by the consumer.  Releases the first count records, so the
+    // producer can reuse their space.  This should only be called after the
+    // kernels that read the records complete.
+    void release(cl_uint count)
+    {
+        cl_uint tailIndex = tail()->load(std::memory_order_relaxed);
+        tail()->store(tailIndex + count, std::memory_order_release);
+    }
+
+private:
+    static_assert(sizeof(std::atomic<cl_uint>) == sizeof(cl_uint),
+        "the ring indices must have the same layout on the host and device");
+
+    std::atomic<cl_uint>* head() const
+    {
+        return (std::atomic<cl_uint>*)((char*)ptr + HeadOffset);
+    }
+    std::atomic<cl_uint>* tail() const
+    {
+        return (std::atomic<cl_uint>*)((char*)ptr + TailOffset);
+    }
+
+    Dispatch<Policy> ext;
+    cl_context context;
+    size_t recordSize;
+    cl_uint capacity;
+    void* ptr = nullptr;
+};
+
+#endif // defined(cl_intel_unified_shared_memory)
+
+} // namespace clext
+
+#endif // OPENCLEXT_HPP_
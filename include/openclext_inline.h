@@ -0,0 +1,2184 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+/*
+// This file is generated from the Khronos OpenCL XML API Registry.
+*/
+
+// clang-format off
+
+// Inline extension APIs.  After this header is included, calls to extension
+// APIs call inline functions that use the header-only C++ API in
+// openclext.hpp, rather than the out-of-line functions in the OpenCL
+// Extension Loader library, so the compiler can inline finding the dispatch
+// table into each call site.  Each extension API name is defined as a macro
+// that names its inline function, so the OpenCL headers must be included
+// before this header, or not at all.
+//
+// The dispatch tables are shared by every translation unit that includes
+// this header.  If CLEXT_SINGLE_PLATFORM_ONLY is defined, the dispatch table
+// for the first platform that is used is used for all objects; otherwise, a
+// dispatch table is initialized for every platform.
+//
+// Extension APIs that are not per-platform, such as cl_loader_info, are not
+// included, and are still called in the OpenCL Extension Loader library.
+
+#ifndef OPENCLEXT_INLINE_H_
+#define OPENCLEXT_INLINE_H_
+
+#include "openclext.hpp"
+
+namespace clext {
+#if defined(CLEXT_SINGLE_PLATFORM_ONLY)
+typedef SinglePlatform InlinePolicy;
+#else
+typedef MultiPlatformCached InlinePolicy;
+#endif
+} // namespace clext
+
+#if defined(cl_khr_command_buffer)
+
+inline cl_command_buffer_khr clext_inline_clCreateCommandBufferKHR(
+    cl_uint num_queues,
+    const cl_command_queue* queues,
+    const cl_command_buffer_properties_khr* properties,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateCommandBufferKHR(
+        num_queues,
+        queues,
+        properties,
+        errcode_ret);
+}
+#define clCreateCommandBufferKHR clext_inline_clCreateCommandBufferKHR
+
+inline cl_int clext_inline_clFinalizeCommandBufferKHR(
+    cl_command_buffer_khr command_buffer)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clFinalizeCommandBufferKHR(
+        command_buffer);
+}
+#define clFinalizeCommandBufferKHR clext_inline_clFinalizeCommandBufferKHR
+
+inline cl_int clext_inline_clRetainCommandBufferKHR(
+    cl_command_buffer_khr command_buffer)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clRetainCommandBufferKHR(
+        command_buffer);
+}
+#define clRetainCommandBufferKHR clext_inline_clRetainCommandBufferKHR
+
+inline cl_int clext_inline_clReleaseCommandBufferKHR(
+    cl_command_buffer_khr command_buffer)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clReleaseCommandBufferKHR(
+        command_buffer);
+}
+#define clReleaseCommandBufferKHR clext_inline_clReleaseCommandBufferKHR
+
+inline cl_int clext_inline_clEnqueueCommandBufferKHR(
+    cl_uint num_queues,
+    cl_command_queue* queues,
+    cl_command_buffer_khr command_buffer,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueCommandBufferKHR(
+        num_queues,
+        queues,
+        command_buffer,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueCommandBufferKHR clext_inline_clEnqueueCommandBufferKHR
+
+inline cl_int clext_inline_clCommandBarrierWithWaitListKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCommandBarrierWithWaitListKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+}
+#define clCommandBarrierWithWaitListKHR clext_inline_clCommandBarrierWithWaitListKHR
+
+inline cl_int clext_inline_clCommandCopyBufferKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_buffer,
+    cl_mem dst_buffer,
+    size_t src_offset,
+    size_t dst_offset,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCommandCopyBufferKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        src_buffer,
+        dst_buffer,
+        src_offset,
+        dst_offset,
+        size,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+}
+#define clCommandCopyBufferKHR clext_inline_clCommandCopyBufferKHR
+
+inline cl_int clext_inline_clCommandCopyBufferRectKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_buffer,
+    cl_mem dst_buffer,
+    const size_t* src_origin,
+    const size_t* dst_origin,
+    const size_t* region,
+    size_t src_row_pitch,
+    size_t src_slice_pitch,
+    size_t dst_row_pitch,
+    size_t dst_slice_pitch,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCommandCopyBufferRectKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        src_buffer,
+        dst_buffer,
+        src_origin,
+        dst_origin,
+        region,
+        src_row_pitch,
+        src_slice_pitch,
+        dst_row_pitch,
+        dst_slice_pitch,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+}
+#define clCommandCopyBufferRectKHR clext_inline_clCommandCopyBufferRectKHR
+
+inline cl_int clext_inline_clCommandCopyBufferToImageKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_buffer,
+    cl_mem dst_image,
+    size_t src_offset,
+    const size_t* dst_origin,
+    const size_t* region,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCommandCopyBufferToImageKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        src_buffer,
+        dst_image,
+        src_offset,
+        dst_origin,
+        region,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+}
+#define clCommandCopyBufferToImageKHR clext_inline_clCommandCopyBufferToImageKHR
+
+inline cl_int clext_inline_clCommandCopyImageKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_image,
+    cl_mem dst_image,
+    const size_t* src_origin,
+    const size_t* dst_origin,
+    const size_t* region,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCommandCopyImageKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        src_image,
+        dst_image,
+        src_origin,
+        dst_origin,
+        region,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+}
+#define clCommandCopyImageKHR clext_inline_clCommandCopyImageKHR
+
+inline cl_int clext_inline_clCommandCopyImageToBufferKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_image,
+    cl_mem dst_buffer,
+    const size_t* src_origin,
+    const size_t* region,
+    size_t dst_offset,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCommandCopyImageToBufferKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        src_image,
+        dst_buffer,
+        src_origin,
+        region,
+        dst_offset,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+}
+#define clCommandCopyImageToBufferKHR clext_inline_clCommandCopyImageToBufferKHR
+
+inline cl_int clext_inline_clCommandFillBufferKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem buffer,
+    const void* pattern,
+    size_t pattern_size,
+    size_t offset,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCommandFillBufferKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        buffer,
+        pattern,
+        pattern_size,
+        offset,
+        size,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+}
+#define clCommandFillBufferKHR clext_inline_clCommandFillBufferKHR
+
+inline cl_int clext_inline_clCommandFillImageKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem image,
+    const void* fill_color,
+    const size_t* origin,
+    const size_t* region,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCommandFillImageKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        image,
+        fill_color,
+        origin,
+        region,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+}
+#define clCommandFillImageKHR clext_inline_clCommandFillImageKHR
+
+inline cl_int clext_inline_clCommandNDRangeKernelKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_kernel kernel,
+    cl_uint work_dim,
+    const size_t* global_work_offset,
+    const size_t* global_work_size,
+    const size_t* local_work_size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCommandNDRangeKernelKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        kernel,
+        work_dim,
+        global_work_offset,
+        global_work_size,
+        local_work_size,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+}
+#define clCommandNDRangeKernelKHR clext_inline_clCommandNDRangeKernelKHR
+
+inline cl_int clext_inline_clGetCommandBufferInfoKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_buffer_info_khr param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetCommandBufferInfoKHR(
+        command_buffer,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+}
+#define clGetCommandBufferInfoKHR clext_inline_clGetCommandBufferInfoKHR
+
+inline cl_int clext_inline_clCommandSVMMemcpyKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCommandSVMMemcpyKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        dst_ptr,
+        src_ptr,
+        size,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+}
+#define clCommandSVMMemcpyKHR clext_inline_clCommandSVMMemcpyKHR
+
+inline cl_int clext_inline_clCommandSVMMemFillKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    void* svm_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCommandSVMMemFillKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        svm_ptr,
+        pattern,
+        pattern_size,
+        size,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+}
+#define clCommandSVMMemFillKHR clext_inline_clCommandSVMMemFillKHR
+
+#endif // defined(cl_khr_command_buffer)
+
+#if defined(cl_khr_command_buffer_multi_device)
+
+inline cl_command_buffer_khr clext_inline_clRemapCommandBufferKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_bool automatic,
+    cl_uint num_queues,
+    const cl_command_queue* queues,
+    cl_uint num_handles,
+    const cl_mutable_command_khr* handles,
+    cl_mutable_command_khr* handles_ret,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clRemapCommandBufferKHR(
+        command_buffer,
+        automatic,
+        num_queues,
+        queues,
+        num_handles,
+        handles,
+        handles_ret,
+        errcode_ret);
+}
+#define clRemapCommandBufferKHR clext_inline_clRemapCommandBufferKHR
+
+#endif // defined(cl_khr_command_buffer_multi_device)
+
+#if defined(cl_khr_command_buffer_mutable_dispatch)
+
+inline cl_int clext_inline_clUpdateMutableCommandsKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_uint num_configs,
+    const cl_command_buffer_update_type_khr* config_types,
+    const void** configs)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clUpdateMutableCommandsKHR(
+        command_buffer,
+        num_configs,
+        config_types,
+        configs);
+}
+#define clUpdateMutableCommandsKHR clext_inline_clUpdateMutableCommandsKHR
+
+inline cl_int clext_inline_clGetMutableCommandInfoKHR(
+    cl_mutable_command_khr command,
+    cl_mutable_command_info_khr param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetMutableCommandInfoKHR(
+        command,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+}
+#define clGetMutableCommandInfoKHR clext_inline_clGetMutableCommandInfoKHR
+
+#endif // defined(cl_khr_command_buffer_mutable_dispatch)
+
+#if defined(cl_khr_create_command_queue)
+
+inline cl_command_queue clext_inline_clCreateCommandQueueWithPropertiesKHR(
+    cl_context context,
+    cl_device_id device,
+    const cl_queue_properties_khr* properties,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateCommandQueueWithPropertiesKHR(
+        context,
+        device,
+        properties,
+        errcode_ret);
+}
+#define clCreateCommandQueueWithPropertiesKHR clext_inline_clCreateCommandQueueWithPropertiesKHR
+
+#endif // defined(cl_khr_create_command_queue)
+
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_khr_d3d10_sharing)
+
+inline cl_int clext_inline_clGetDeviceIDsFromD3D10KHR(
+    cl_platform_id platform,
+    cl_d3d10_device_source_khr d3d_device_source,
+    void* d3d_object,
+    cl_d3d10_device_set_khr d3d_device_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetDeviceIDsFromD3D10KHR(
+        platform,
+        d3d_device_source,
+        d3d_object,
+        d3d_device_set,
+        num_entries,
+        devices,
+        num_devices);
+}
+#define clGetDeviceIDsFromD3D10KHR clext_inline_clGetDeviceIDsFromD3D10KHR
+
+inline cl_mem clext_inline_clCreateFromD3D10BufferKHR(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D10Buffer* resource,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateFromD3D10BufferKHR(
+        context,
+        flags,
+        resource,
+        errcode_ret);
+}
+#define clCreateFromD3D10BufferKHR clext_inline_clCreateFromD3D10BufferKHR
+
+inline cl_mem clext_inline_clCreateFromD3D10Texture2DKHR(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D10Texture2D* resource,
+    UINT subresource,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateFromD3D10Texture2DKHR(
+        context,
+        flags,
+        resource,
+        subresource,
+        errcode_ret);
+}
+#define clCreateFromD3D10Texture2DKHR clext_inline_clCreateFromD3D10Texture2DKHR
+
+inline cl_mem clext_inline_clCreateFromD3D10Texture3DKHR(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D10Texture3D* resource,
+    UINT subresource,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateFromD3D10Texture3DKHR(
+        context,
+        flags,
+        resource,
+        subresource,
+        errcode_ret);
+}
+#define clCreateFromD3D10Texture3DKHR clext_inline_clCreateFromD3D10Texture3DKHR
+
+inline cl_int clext_inline_clEnqueueAcquireD3D10ObjectsKHR(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueAcquireD3D10ObjectsKHR(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueAcquireD3D10ObjectsKHR clext_inline_clEnqueueAcquireD3D10ObjectsKHR
+
+inline cl_int clext_inline_clEnqueueReleaseD3D10ObjectsKHR(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueReleaseD3D10ObjectsKHR(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueReleaseD3D10ObjectsKHR clext_inline_clEnqueueReleaseD3D10ObjectsKHR
+
+#endif // defined(cl_khr_d3d10_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_khr_d3d11_sharing)
+
+inline cl_int clext_inline_clGetDeviceIDsFromD3D11KHR(
+    cl_platform_id platform,
+    cl_d3d11_device_source_khr d3d_device_source,
+    void* d3d_object,
+    cl_d3d11_device_set_khr d3d_device_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetDeviceIDsFromD3D11KHR(
+        platform,
+        d3d_device_source,
+        d3d_object,
+        d3d_device_set,
+        num_entries,
+        devices,
+        num_devices);
+}
+#define clGetDeviceIDsFromD3D11KHR clext_inline_clGetDeviceIDsFromD3D11KHR
+
+inline cl_mem clext_inline_clCreateFromD3D11BufferKHR(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D11Buffer* resource,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateFromD3D11BufferKHR(
+        context,
+        flags,
+        resource,
+        errcode_ret);
+}
+#define clCreateFromD3D11BufferKHR clext_inline_clCreateFromD3D11BufferKHR
+
+inline cl_mem clext_inline_clCreateFromD3D11Texture2DKHR(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D11Texture2D* resource,
+    UINT subresource,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateFromD3D11Texture2DKHR(
+        context,
+        flags,
+        resource,
+        subresource,
+        errcode_ret);
+}
+#define clCreateFromD3D11Texture2DKHR clext_inline_clCreateFromD3D11Texture2DKHR
+
+inline cl_mem clext_inline_clCreateFromD3D11Texture3DKHR(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D11Texture3D* resource,
+    UINT subresource,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateFromD3D11Texture3DKHR(
+        context,
+        flags,
+        resource,
+        subresource,
+        errcode_ret);
+}
+#define clCreateFromD3D11Texture3DKHR clext_inline_clCreateFromD3D11Texture3DKHR
+
+inline cl_int clext_inline_clEnqueueAcquireD3D11ObjectsKHR(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueAcquireD3D11ObjectsKHR(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueAcquireD3D11ObjectsKHR clext_inline_clEnqueueAcquireD3D11ObjectsKHR
+
+inline cl_int clext_inline_clEnqueueReleaseD3D11ObjectsKHR(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueReleaseD3D11ObjectsKHR(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueReleaseD3D11ObjectsKHR clext_inline_clEnqueueReleaseD3D11ObjectsKHR
+
+#endif // defined(cl_khr_d3d11_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_khr_dx9_media_sharing)
+
+inline cl_int clext_inline_clGetDeviceIDsFromDX9MediaAdapterKHR(
+    cl_platform_id platform,
+    cl_uint num_media_adapters,
+    cl_dx9_media_adapter_type_khr* media_adapter_type,
+    void* media_adapters,
+    cl_dx9_media_adapter_set_khr media_adapter_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetDeviceIDsFromDX9MediaAdapterKHR(
+        platform,
+        num_media_adapters,
+        media_adapter_type,
+        media_adapters,
+        media_adapter_set,
+        num_entries,
+        devices,
+        num_devices);
+}
+#define clGetDeviceIDsFromDX9MediaAdapterKHR clext_inline_clGetDeviceIDsFromDX9MediaAdapterKHR
+
+inline cl_mem clext_inline_clCreateFromDX9MediaSurfaceKHR(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_dx9_media_adapter_type_khr adapter_type,
+    void* surface_info,
+    cl_uint plane,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateFromDX9MediaSurfaceKHR(
+        context,
+        flags,
+        adapter_type,
+        surface_info,
+        plane,
+        errcode_ret);
+}
+#define clCreateFromDX9MediaSurfaceKHR clext_inline_clCreateFromDX9MediaSurfaceKHR
+
+inline cl_int clext_inline_clEnqueueAcquireDX9MediaSurfacesKHR(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueAcquireDX9MediaSurfacesKHR(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueAcquireDX9MediaSurfacesKHR clext_inline_clEnqueueAcquireDX9MediaSurfacesKHR
+
+inline cl_int clext_inline_clEnqueueReleaseDX9MediaSurfacesKHR(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueReleaseDX9MediaSurfacesKHR(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueReleaseDX9MediaSurfacesKHR clext_inline_clEnqueueReleaseDX9MediaSurfacesKHR
+
+#endif // defined(cl_khr_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_event)
+
+inline cl_event clext_inline_clCreateEventFromEGLSyncKHR(
+    cl_context context,
+    CLeglSyncKHR sync,
+    CLeglDisplayKHR display,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateEventFromEGLSyncKHR(
+        context,
+        sync,
+        display,
+        errcode_ret);
+}
+#define clCreateEventFromEGLSyncKHR clext_inline_clCreateEventFromEGLSyncKHR
+
+#endif // defined(cl_khr_egl_event)
+#endif // defined(CLEXT_INCLUDE_EGL)
+
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_image)
+
+inline cl_mem clext_inline_clCreateFromEGLImageKHR(
+    cl_context context,
+    CLeglDisplayKHR egldisplay,
+    CLeglImageKHR eglimage,
+    cl_mem_flags flags,
+    const cl_egl_image_properties_khr* properties,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateFromEGLImageKHR(
+        context,
+        egldisplay,
+        eglimage,
+        flags,
+        properties,
+        errcode_ret);
+}
+#define clCreateFromEGLImageKHR clext_inline_clCreateFromEGLImageKHR
+
+inline cl_int clext_inline_clEnqueueAcquireEGLObjectsKHR(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueAcquireEGLObjectsKHR(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueAcquireEGLObjectsKHR clext_inline_clEnqueueAcquireEGLObjectsKHR
+
+inline cl_int clext_inline_clEnqueueReleaseEGLObjectsKHR(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueReleaseEGLObjectsKHR(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueReleaseEGLObjectsKHR clext_inline_clEnqueueReleaseEGLObjectsKHR
+
+#endif // defined(cl_khr_egl_image)
+#endif // defined(CLEXT_INCLUDE_EGL)
+
+#if defined(cl_khr_external_memory)
+
+inline cl_int clext_inline_clEnqueueAcquireExternalMemObjectsKHR(
+    cl_command_queue command_queue,
+    cl_uint num_mem_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueAcquireExternalMemObjectsKHR(
+        command_queue,
+        num_mem_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueAcquireExternalMemObjectsKHR clext_inline_clEnqueueAcquireExternalMemObjectsKHR
+
+inline cl_int clext_inline_clEnqueueReleaseExternalMemObjectsKHR(
+    cl_command_queue command_queue,
+    cl_uint num_mem_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueReleaseExternalMemObjectsKHR(
+        command_queue,
+        num_mem_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueReleaseExternalMemObjectsKHR clext_inline_clEnqueueReleaseExternalMemObjectsKHR
+
+#endif // defined(cl_khr_external_memory)
+
+#if defined(cl_khr_external_semaphore)
+
+inline cl_int clext_inline_clGetSemaphoreHandleForTypeKHR(
+    cl_semaphore_khr sema_object,
+    cl_device_id device,
+    cl_external_semaphore_handle_type_khr handle_type,
+    size_t handle_size,
+    void* handle_ptr,
+    size_t* handle_size_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetSemaphoreHandleForTypeKHR(
+        sema_object,
+        device,
+        handle_type,
+        handle_size,
+        handle_ptr,
+        handle_size_ret);
+}
+#define clGetSemaphoreHandleForTypeKHR clext_inline_clGetSemaphoreHandleForTypeKHR
+
+#endif // defined(cl_khr_external_semaphore)
+
+#if defined(cl_khr_external_semaphore_sync_fd)
+
+inline cl_int clext_inline_clReImportSemaphoreSyncFdKHR(
+    cl_semaphore_khr sema_object,
+    cl_semaphore_reimport_properties_khr* reimport_props,
+    int fd)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clReImportSemaphoreSyncFdKHR(
+        sema_object,
+        reimport_props,
+        fd);
+}
+#define clReImportSemaphoreSyncFdKHR clext_inline_clReImportSemaphoreSyncFdKHR
+
+#endif // defined(cl_khr_external_semaphore_sync_fd)
+
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_khr_gl_event)
+
+inline cl_event clext_inline_clCreateEventFromGLsyncKHR(
+    cl_context context,
+    cl_GLsync sync,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateEventFromGLsyncKHR(
+        context,
+        sync,
+        errcode_ret);
+}
+#define clCreateEventFromGLsyncKHR clext_inline_clCreateEventFromGLsyncKHR
+
+#endif // defined(cl_khr_gl_event)
+#endif // defined(CLEXT_INCLUDE_GL)
+
+#if defined(cl_khr_il_program)
+
+inline cl_program clext_inline_clCreateProgramWithILKHR(
+    cl_context context,
+    const void* il,
+    size_t length,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateProgramWithILKHR(
+        context,
+        il,
+        length,
+        errcode_ret);
+}
+#define clCreateProgramWithILKHR clext_inline_clCreateProgramWithILKHR
+
+#endif // defined(cl_khr_il_program)
+
+#if defined(cl_khr_semaphore)
+
+inline cl_semaphore_khr clext_inline_clCreateSemaphoreWithPropertiesKHR(
+    cl_context context,
+    const cl_semaphore_properties_khr* sema_props,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateSemaphoreWithPropertiesKHR(
+        context,
+        sema_props,
+        errcode_ret);
+}
+#define clCreateSemaphoreWithPropertiesKHR clext_inline_clCreateSemaphoreWithPropertiesKHR
+
+inline cl_int clext_inline_clEnqueueWaitSemaphoresKHR(
+    cl_command_queue command_queue,
+    cl_uint num_sema_objects,
+    const cl_semaphore_khr* sema_objects,
+    const cl_semaphore_payload_khr* sema_payload_list,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueWaitSemaphoresKHR(
+        command_queue,
+        num_sema_objects,
+        sema_objects,
+        sema_payload_list,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueWaitSemaphoresKHR clext_inline_clEnqueueWaitSemaphoresKHR
+
+inline cl_int clext_inline_clEnqueueSignalSemaphoresKHR(
+    cl_command_queue command_queue,
+    cl_uint num_sema_objects,
+    const cl_semaphore_khr* sema_objects,
+    const cl_semaphore_payload_khr* sema_payload_list,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueSignalSemaphoresKHR(
+        command_queue,
+        num_sema_objects,
+        sema_objects,
+        sema_payload_list,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueSignalSemaphoresKHR clext_inline_clEnqueueSignalSemaphoresKHR
+
+inline cl_int clext_inline_clGetSemaphoreInfoKHR(
+    cl_semaphore_khr sema_object,
+    cl_semaphore_info_khr param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetSemaphoreInfoKHR(
+        sema_object,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+}
+#define clGetSemaphoreInfoKHR clext_inline_clGetSemaphoreInfoKHR
+
+inline cl_int clext_inline_clReleaseSemaphoreKHR(
+    cl_semaphore_khr sema_object)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clReleaseSemaphoreKHR(
+        sema_object);
+}
+#define clReleaseSemaphoreKHR clext_inline_clReleaseSemaphoreKHR
+
+inline cl_int clext_inline_clRetainSemaphoreKHR(
+    cl_semaphore_khr sema_object)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clRetainSemaphoreKHR(
+        sema_object);
+}
+#define clRetainSemaphoreKHR clext_inline_clRetainSemaphoreKHR
+
+#endif // defined(cl_khr_semaphore)
+
+#if defined(cl_khr_subgroups)
+
+inline cl_int clext_inline_clGetKernelSubGroupInfoKHR(
+    cl_kernel in_kernel,
+    cl_device_id in_device,
+    cl_kernel_sub_group_info param_name,
+    size_t input_value_size,
+    const void* input_value,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetKernelSubGroupInfoKHR(
+        in_kernel,
+        in_device,
+        param_name,
+        input_value_size,
+        input_value,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+}
+#define clGetKernelSubGroupInfoKHR clext_inline_clGetKernelSubGroupInfoKHR
+
+#endif // defined(cl_khr_subgroups)
+
+#if defined(cl_khr_suggested_local_work_size)
+
+inline cl_int clext_inline_clGetKernelSuggestedLocalWorkSizeKHR(
+    cl_command_queue command_queue,
+    cl_kernel kernel,
+    cl_uint work_dim,
+    const size_t* global_work_offset,
+    const size_t* global_work_size,
+    size_t* suggested_local_work_size)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetKernelSuggestedLocalWorkSizeKHR(
+        command_queue,
+        kernel,
+        work_dim,
+        global_work_offset,
+        global_work_size,
+        suggested_local_work_size);
+}
+#define clGetKernelSuggestedLocalWorkSizeKHR clext_inline_clGetKernelSuggestedLocalWorkSizeKHR
+
+#endif // defined(cl_khr_suggested_local_work_size)
+
+#if defined(cl_khr_terminate_context)
+
+inline cl_int clext_inline_clTerminateContextKHR(
+    cl_context context)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clTerminateContextKHR(
+        context);
+}
+#define clTerminateContextKHR clext_inline_clTerminateContextKHR
+
+#endif // defined(cl_khr_terminate_context)
+
+#if defined(cl_ext_buffer_device_address)
+
+inline cl_int clext_inline_clSetKernelArgDevicePointerEXT(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    cl_mem_device_address_ext arg_value)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clSetKernelArgDevicePointerEXT(
+        kernel,
+        arg_index,
+        arg_value);
+}
+#define clSetKernelArgDevicePointerEXT clext_inline_clSetKernelArgDevicePointerEXT
+
+#endif // defined(cl_ext_buffer_device_address)
+
+#if defined(cl_ext_device_fission)
+
+inline cl_int clext_inline_clReleaseDeviceEXT(
+    cl_device_id device)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clReleaseDeviceEXT(
+        device);
+}
+#define clReleaseDeviceEXT clext_inline_clReleaseDeviceEXT
+
+inline cl_int clext_inline_clRetainDeviceEXT(
+    cl_device_id device)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clRetainDeviceEXT(
+        device);
+}
+#define clRetainDeviceEXT clext_inline_clRetainDeviceEXT
+
+inline cl_int clext_inline_clCreateSubDevicesEXT(
+    cl_device_id in_device,
+    const cl_device_partition_property_ext* properties,
+    cl_uint num_entries,
+    cl_device_id* out_devices,
+    cl_uint* num_devices)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateSubDevicesEXT(
+        in_device,
+        properties,
+        num_entries,
+        out_devices,
+        num_devices);
+}
+#define clCreateSubDevicesEXT clext_inline_clCreateSubDevicesEXT
+
+#endif // defined(cl_ext_device_fission)
+
+#if defined(cl_ext_image_requirements_info)
+
+inline cl_int clext_inline_clGetImageRequirementsInfoEXT(
+    cl_context context,
+    const cl_mem_properties* properties,
+    cl_mem_flags flags,
+    const cl_image_format* image_format,
+    const cl_image_desc* image_desc,
+    cl_image_requirements_info_ext param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetImageRequirementsInfoEXT(
+        context,
+        properties,
+        flags,
+        image_format,
+        image_desc,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+}
+#define clGetImageRequirementsInfoEXT clext_inline_clGetImageRequirementsInfoEXT
+
+#endif // defined(cl_ext_image_requirements_info)
+
+#if defined(cl_ext_migrate_memobject)
+
+inline cl_int clext_inline_clEnqueueMigrateMemObjectEXT(
+    cl_command_queue command_queue,
+    cl_uint num_mem_objects,
+    const cl_mem* mem_objects,
+    cl_mem_migration_flags_ext flags,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueMigrateMemObjectEXT(
+        command_queue,
+        num_mem_objects,
+        mem_objects,
+        flags,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueMigrateMemObjectEXT clext_inline_clEnqueueMigrateMemObjectEXT
+
+#endif // defined(cl_ext_migrate_memobject)
+
+#if defined(cl_arm_import_memory)
+
+inline cl_mem clext_inline_clImportMemoryARM(
+    cl_context context,
+    cl_mem_flags flags,
+    const cl_import_properties_arm* properties,
+    void* memory,
+    size_t size,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clImportMemoryARM(
+        context,
+        flags,
+        properties,
+        memory,
+        size,
+        errcode_ret);
+}
+#define clImportMemoryARM clext_inline_clImportMemoryARM
+
+#endif // defined(cl_arm_import_memory)
+
+#if defined(cl_arm_shared_virtual_memory)
+
+inline void* clext_inline_clSVMAllocARM(
+    cl_context context,
+    cl_svm_mem_flags_arm flags,
+    size_t size,
+    cl_uint alignment)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clSVMAllocARM(
+        context,
+        flags,
+        size,
+        alignment);
+}
+#define clSVMAllocARM clext_inline_clSVMAllocARM
+
+inline void clext_inline_clSVMFreeARM(
+    cl_context context,
+    void* svm_pointer)
+{
+    clext::Dispatch<clext::InlinePolicy>().clSVMFreeARM(
+        context,
+        svm_pointer);
+}
+#define clSVMFreeARM clext_inline_clSVMFreeARM
+
+inline cl_int clext_inline_clEnqueueSVMFreeARM(
+    cl_command_queue command_queue,
+    cl_uint num_svm_pointers,
+    void* svm_pointers[],
+    void (CL_CALLBACK* pfn_free_func)(cl_command_queue queue, cl_uint num_svm_pointers, void * svm_pointers[], void *user_data),
+    void* user_data,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueSVMFreeARM(
+        command_queue,
+        num_svm_pointers,
+        svm_pointers,
+        pfn_free_func,
+        user_data,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueSVMFreeARM clext_inline_clEnqueueSVMFreeARM
+
+inline cl_int clext_inline_clEnqueueSVMMemcpyARM(
+    cl_command_queue command_queue,
+    cl_bool blocking_copy,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueSVMMemcpyARM(
+        command_queue,
+        blocking_copy,
+        dst_ptr,
+        src_ptr,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueSVMMemcpyARM clext_inline_clEnqueueSVMMemcpyARM
+
+inline cl_int clext_inline_clEnqueueSVMMemFillARM(
+    cl_command_queue command_queue,
+    void* svm_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueSVMMemFillARM(
+        command_queue,
+        svm_ptr,
+        pattern,
+        pattern_size,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueSVMMemFillARM clext_inline_clEnqueueSVMMemFillARM
+
+inline cl_int clext_inline_clEnqueueSVMMapARM(
+    cl_command_queue command_queue,
+    cl_bool blocking_map,
+    cl_map_flags flags,
+    void* svm_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueSVMMapARM(
+        command_queue,
+        blocking_map,
+        flags,
+        svm_ptr,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueSVMMapARM clext_inline_clEnqueueSVMMapARM
+
+inline cl_int clext_inline_clEnqueueSVMUnmapARM(
+    cl_command_queue command_queue,
+    void* svm_ptr,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueSVMUnmapARM(
+        command_queue,
+        svm_ptr,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueSVMUnmapARM clext_inline_clEnqueueSVMUnmapARM
+
+inline cl_int clext_inline_clSetKernelArgSVMPointerARM(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    const void* arg_value)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clSetKernelArgSVMPointerARM(
+        kernel,
+        arg_index,
+        arg_value);
+}
+#define clSetKernelArgSVMPointerARM clext_inline_clSetKernelArgSVMPointerARM
+
+inline cl_int clext_inline_clSetKernelExecInfoARM(
+    cl_kernel kernel,
+    cl_kernel_exec_info_arm param_name,
+    size_t param_value_size,
+    const void* param_value)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clSetKernelExecInfoARM(
+        kernel,
+        param_name,
+        param_value_size,
+        param_value);
+}
+#define clSetKernelExecInfoARM clext_inline_clSetKernelExecInfoARM
+
+#endif // defined(cl_arm_shared_virtual_memory)
+
+#if defined(cl_img_cancel_command)
+
+inline cl_int clext_inline_clCancelCommandsIMG(
+    const cl_event* event_list,
+    size_t num_events_in_list)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCancelCommandsIMG(
+        event_list,
+        num_events_in_list);
+}
+#define clCancelCommandsIMG clext_inline_clCancelCommandsIMG
+
+#endif // defined(cl_img_cancel_command)
+
+#if defined(cl_img_generate_mipmap)
+
+inline cl_int clext_inline_clEnqueueGenerateMipmapIMG(
+    cl_command_queue command_queue,
+    cl_mem src_image,
+    cl_mem dst_image,
+    cl_mipmap_filter_mode_img mipmap_filter_mode,
+    const size_t* array_region,
+    const size_t* mip_region,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueGenerateMipmapIMG(
+        command_queue,
+        src_image,
+        dst_image,
+        mipmap_filter_mode,
+        array_region,
+        mip_region,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueGenerateMipmapIMG clext_inline_clEnqueueGenerateMipmapIMG
+
+#endif // defined(cl_img_generate_mipmap)
+
+#if defined(cl_img_use_gralloc_ptr)
+
+inline cl_int clext_inline_clEnqueueAcquireGrallocObjectsIMG(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueAcquireGrallocObjectsIMG(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueAcquireGrallocObjectsIMG clext_inline_clEnqueueAcquireGrallocObjectsIMG
+
+inline cl_int clext_inline_clEnqueueReleaseGrallocObjectsIMG(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueReleaseGrallocObjectsIMG(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueReleaseGrallocObjectsIMG clext_inline_clEnqueueReleaseGrallocObjectsIMG
+
+#endif // defined(cl_img_use_gralloc_ptr)
+
+#if defined(cl_intel_accelerator)
+
+inline cl_accelerator_intel clext_inline_clCreateAcceleratorINTEL(
+    cl_context context,
+    cl_accelerator_type_intel accelerator_type,
+    size_t descriptor_size,
+    const void* descriptor,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateAcceleratorINTEL(
+        context,
+        accelerator_type,
+        descriptor_size,
+        descriptor,
+        errcode_ret);
+}
+#define clCreateAcceleratorINTEL clext_inline_clCreateAcceleratorINTEL
+
+inline cl_int clext_inline_clGetAcceleratorInfoINTEL(
+    cl_accelerator_intel accelerator,
+    cl_accelerator_info_intel param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetAcceleratorInfoINTEL(
+        accelerator,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+}
+#define clGetAcceleratorInfoINTEL clext_inline_clGetAcceleratorInfoINTEL
+
+inline cl_int clext_inline_clRetainAcceleratorINTEL(
+    cl_accelerator_intel accelerator)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clRetainAcceleratorINTEL(
+        accelerator);
+}
+#define clRetainAcceleratorINTEL clext_inline_clRetainAcceleratorINTEL
+
+inline cl_int clext_inline_clReleaseAcceleratorINTEL(
+    cl_accelerator_intel accelerator)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clReleaseAcceleratorINTEL(
+        accelerator);
+}
+#define clReleaseAcceleratorINTEL clext_inline_clReleaseAcceleratorINTEL
+
+#endif // defined(cl_intel_accelerator)
+
+#if defined(cl_intel_create_buffer_with_properties)
+
+inline cl_mem clext_inline_clCreateBufferWithPropertiesINTEL(
+    cl_context context,
+    const cl_mem_properties_intel* properties,
+    cl_mem_flags flags,
+    size_t size,
+    void* host_ptr,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateBufferWithPropertiesINTEL(
+        context,
+        properties,
+        flags,
+        size,
+        host_ptr,
+        errcode_ret);
+}
+#define clCreateBufferWithPropertiesINTEL clext_inline_clCreateBufferWithPropertiesINTEL
+
+#endif // defined(cl_intel_create_buffer_with_properties)
+
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_dx9_media_sharing)
+
+inline cl_int clext_inline_clGetDeviceIDsFromDX9INTEL(
+    cl_platform_id platform,
+    cl_dx9_device_source_intel dx9_device_source,
+    void* dx9_object,
+    cl_dx9_device_set_intel dx9_device_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetDeviceIDsFromDX9INTEL(
+        platform,
+        dx9_device_source,
+        dx9_object,
+        dx9_device_set,
+        num_entries,
+        devices,
+        num_devices);
+}
+#define clGetDeviceIDsFromDX9INTEL clext_inline_clGetDeviceIDsFromDX9INTEL
+
+inline cl_mem clext_inline_clCreateFromDX9MediaSurfaceINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    IDirect3DSurface9* resource,
+    HANDLE sharedHandle,
+    UINT plane,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateFromDX9MediaSurfaceINTEL(
+        context,
+        flags,
+        resource,
+        sharedHandle,
+        plane,
+        errcode_ret);
+}
+#define clCreateFromDX9MediaSurfaceINTEL clext_inline_clCreateFromDX9MediaSurfaceINTEL
+
+inline cl_int clext_inline_clEnqueueAcquireDX9ObjectsINTEL(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueAcquireDX9ObjectsINTEL(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueAcquireDX9ObjectsINTEL clext_inline_clEnqueueAcquireDX9ObjectsINTEL
+
+inline cl_int clext_inline_clEnqueueReleaseDX9ObjectsINTEL(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueReleaseDX9ObjectsINTEL(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueReleaseDX9ObjectsINTEL clext_inline_clEnqueueReleaseDX9ObjectsINTEL
+
+#endif // defined(cl_intel_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+
+#if defined(cl_intel_program_scope_host_pipe)
+
+inline cl_int clext_inline_clEnqueueReadHostPipeINTEL(
+    cl_command_queue command_queue,
+    cl_program program,
+    const char* pipe_symbol,
+    cl_bool blocking_read,
+    void* ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueReadHostPipeINTEL(
+        command_queue,
+        program,
+        pipe_symbol,
+        blocking_read,
+        ptr,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueReadHostPipeINTEL clext_inline_clEnqueueReadHostPipeINTEL
+
+inline cl_int clext_inline_clEnqueueWriteHostPipeINTEL(
+    cl_command_queue command_queue,
+    cl_program program,
+    const char* pipe_symbol,
+    cl_bool blocking_write,
+    const void* ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueWriteHostPipeINTEL(
+        command_queue,
+        program,
+        pipe_symbol,
+        blocking_write,
+        ptr,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueWriteHostPipeINTEL clext_inline_clEnqueueWriteHostPipeINTEL
+
+#endif // defined(cl_intel_program_scope_host_pipe)
+
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_intel_sharing_format_query_d3d10)
+
+inline cl_int clext_inline_clGetSupportedD3D10TextureFormatsINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint num_entries,
+    DXGI_FORMAT* d3d10_formats,
+    cl_uint* num_texture_formats)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetSupportedD3D10TextureFormatsINTEL(
+        context,
+        flags,
+        image_type,
+        num_entries,
+        d3d10_formats,
+        num_texture_formats);
+}
+#define clGetSupportedD3D10TextureFormatsINTEL clext_inline_clGetSupportedD3D10TextureFormatsINTEL
+
+#endif // defined(cl_intel_sharing_format_query_d3d10)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_intel_sharing_format_query_d3d11)
+
+inline cl_int clext_inline_clGetSupportedD3D11TextureFormatsINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint plane,
+    cl_uint num_entries,
+    DXGI_FORMAT* d3d11_formats,
+    cl_uint* num_texture_formats)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetSupportedD3D11TextureFormatsINTEL(
+        context,
+        flags,
+        image_type,
+        plane,
+        num_entries,
+        d3d11_formats,
+        num_texture_formats);
+}
+#define clGetSupportedD3D11TextureFormatsINTEL clext_inline_clGetSupportedD3D11TextureFormatsINTEL
+
+#endif // defined(cl_intel_sharing_format_query_d3d11)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_sharing_format_query_dx9)
+
+inline cl_int clext_inline_clGetSupportedDX9MediaSurfaceFormatsINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint plane,
+    cl_uint num_entries,
+    D3DFORMAT* dx9_formats,
+    cl_uint* num_surface_formats)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetSupportedDX9MediaSurfaceFormatsINTEL(
+        context,
+        flags,
+        image_type,
+        plane,
+        num_entries,
+        dx9_formats,
+        num_surface_formats);
+}
+#define clGetSupportedDX9MediaSurfaceFormatsINTEL clext_inline_clGetSupportedDX9MediaSurfaceFormatsINTEL
+
+#endif // defined(cl_intel_sharing_format_query_dx9)
+#endif // defined(CLEXT_INCLUDE_DX9)
+
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_intel_sharing_format_query_gl)
+
+inline cl_int clext_inline_clGetSupportedGLTextureFormatsINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint num_entries,
+    cl_GLenum* gl_formats,
+    cl_uint* num_texture_formats)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetSupportedGLTextureFormatsINTEL(
+        context,
+        flags,
+        image_type,
+        num_entries,
+        gl_formats,
+        num_texture_formats);
+}
+#define clGetSupportedGLTextureFormatsINTEL clext_inline_clGetSupportedGLTextureFormatsINTEL
+
+#endif // defined(cl_intel_sharing_format_query_gl)
+#endif // defined(CLEXT_INCLUDE_GL)
+
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_sharing_format_query_va_api)
+
+inline cl_int clext_inline_clGetSupportedVA_APIMediaSurfaceFormatsINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint plane,
+    cl_uint num_entries,
+    VAImageFormat* va_api_formats,
+    cl_uint* num_surface_formats)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetSupportedVA_APIMediaSurfaceFormatsINTEL(
+        context,
+        flags,
+        image_type,
+        plane,
+        num_entries,
+        va_api_formats,
+        num_surface_formats);
+}
+#define clGetSupportedVA_APIMediaSurfaceFormatsINTEL clext_inline_clGetSupportedVA_APIMediaSurfaceFormatsINTEL
+
+#endif // defined(cl_intel_sharing_format_query_va_api)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+
+#if defined(cl_intel_unified_shared_memory)
+
+inline void* clext_inline_clHostMemAllocINTEL(
+    cl_context context,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clHostMemAllocINTEL(
+        context,
+        properties,
+        size,
+        alignment,
+        errcode_ret);
+}
+#define clHostMemAllocINTEL clext_inline_clHostMemAllocINTEL
+
+inline void* clext_inline_clDeviceMemAllocINTEL(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clDeviceMemAllocINTEL(
+        context,
+        device,
+        properties,
+        size,
+        alignment,
+        errcode_ret);
+}
+#define clDeviceMemAllocINTEL clext_inline_clDeviceMemAllocINTEL
+
+inline void* clext_inline_clSharedMemAllocINTEL(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clSharedMemAllocINTEL(
+        context,
+        device,
+        properties,
+        size,
+        alignment,
+        errcode_ret);
+}
+#define clSharedMemAllocINTEL clext_inline_clSharedMemAllocINTEL
+
+inline cl_int clext_inline_clMemFreeINTEL(
+    cl_context context,
+    void* ptr)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clMemFreeINTEL(
+        context,
+        ptr);
+}
+#define clMemFreeINTEL clext_inline_clMemFreeINTEL
+
+inline cl_int clext_inline_clMemBlockingFreeINTEL(
+    cl_context context,
+    void* ptr)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clMemBlockingFreeINTEL(
+        context,
+        ptr);
+}
+#define clMemBlockingFreeINTEL clext_inline_clMemBlockingFreeINTEL
+
+inline cl_int clext_inline_clGetMemAllocInfoINTEL(
+    cl_context context,
+    const void* ptr,
+    cl_mem_info_intel param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetMemAllocInfoINTEL(
+        context,
+        ptr,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+}
+#define clGetMemAllocInfoINTEL clext_inline_clGetMemAllocInfoINTEL
+
+inline cl_int clext_inline_clSetKernelArgMemPointerINTEL(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    const void* arg_value)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clSetKernelArgMemPointerINTEL(
+        kernel,
+        arg_index,
+        arg_value);
+}
+#define clSetKernelArgMemPointerINTEL clext_inline_clSetKernelArgMemPointerINTEL
+
+inline cl_int clext_inline_clEnqueueMemFillINTEL(
+    cl_command_queue command_queue,
+    void* dst_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueMemFillINTEL(
+        command_queue,
+        dst_ptr,
+        pattern,
+        pattern_size,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueMemFillINTEL clext_inline_clEnqueueMemFillINTEL
+
+inline cl_int clext_inline_clEnqueueMemcpyINTEL(
+    cl_command_queue command_queue,
+    cl_bool blocking,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueMemcpyINTEL(
+        command_queue,
+        blocking,
+        dst_ptr,
+        src_ptr,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueMemcpyINTEL clext_inline_clEnqueueMemcpyINTEL
+
+inline cl_int clext_inline_clEnqueueMemAdviseINTEL(
+    cl_command_queue command_queue,
+    const void* ptr,
+    size_t size,
+    cl_mem_advice_intel advice,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueMemAdviseINTEL(
+        command_queue,
+        ptr,
+        size,
+        advice,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueMemAdviseINTEL clext_inline_clEnqueueMemAdviseINTEL
+#if defined(CL_VERSION_1_2)
+
+inline cl_int clext_inline_clEnqueueMigrateMemINTEL(
+    cl_command_queue command_queue,
+    const void* ptr,
+    size_t size,
+    cl_mem_migration_flags flags,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueMigrateMemINTEL(
+        command_queue,
+        ptr,
+        size,
+        flags,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueMigrateMemINTEL clext_inline_clEnqueueMigrateMemINTEL
+#endif // defined(CL_VERSION_1_2)
+
+inline cl_int clext_inline_clEnqueueMemsetINTEL(
+    cl_command_queue command_queue,
+    void* dst_ptr,
+    cl_int value,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueMemsetINTEL(
+        command_queue,
+        dst_ptr,
+        value,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueMemsetINTEL clext_inline_clEnqueueMemsetINTEL
+
+#endif // defined(cl_intel_unified_shared_memory)
+
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_va_api_media_sharing)
+
+inline cl_int clext_inline_clGetDeviceIDsFromVA_APIMediaAdapterINTEL(
+    cl_platform_id platform,
+    cl_va_api_device_source_intel media_adapter_type,
+    void* media_adapter,
+    cl_va_api_device_set_intel media_adapter_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetDeviceIDsFromVA_APIMediaAdapterINTEL(
+        platform,
+        media_adapter_type,
+        media_adapter,
+        media_adapter_set,
+        num_entries,
+        devices,
+        num_devices);
+}
+#define clGetDeviceIDsFromVA_APIMediaAdapterINTEL clext_inline_clGetDeviceIDsFromVA_APIMediaAdapterINTEL
+
+inline cl_mem clext_inline_clCreateFromVA_APIMediaSurfaceINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    VASurfaceID* surface,
+    cl_uint plane,
+    cl_int* errcode_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clCreateFromVA_APIMediaSurfaceINTEL(
+        context,
+        flags,
+        surface,
+        plane,
+        errcode_ret);
+}
+#define clCreateFromVA_APIMediaSurfaceINTEL clext_inline_clCreateFromVA_APIMediaSurfaceINTEL
+
+inline cl_int clext_inline_clEnqueueAcquireVA_APIMediaSurfacesINTEL(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueAcquireVA_APIMediaSurfacesINTEL(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueAcquireVA_APIMediaSurfacesINTEL clext_inline_clEnqueueAcquireVA_APIMediaSurfacesINTEL
+
+inline cl_int clext_inline_clEnqueueReleaseVA_APIMediaSurfacesINTEL(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clEnqueueReleaseVA_APIMediaSurfacesINTEL(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#define clEnqueueReleaseVA_APIMediaSurfacesINTEL clext_inline_clEnqueueReleaseVA_APIMediaSurfacesINTEL
+
+#endif // defined(cl_intel_va_api_media_sharing)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+
+#if defined(cl_pocl_content_size)
+
+inline cl_int clext_inline_clSetContentSizeBufferPoCL(
+    cl_mem buffer,
+    cl_mem content_size_buffer)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clSetContentSizeBufferPoCL(
+        buffer,
+        content_size_buffer);
+}
+#define clSetContentSizeBufferPoCL clext_inline_clSetContentSizeBufferPoCL
+
+#endif // defined(cl_pocl_content_size)
+
+#if defined(cl_qcom_ext_host_ptr)
+
+inline cl_int clext_inline_clGetDeviceImageInfoQCOM(
+    cl_device_id device,
+    size_t image_width,
+    size_t image_height,
+    const cl_image_format* image_format,
+    cl_image_pitch_info_qcom param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    return clext::Dispatch<clext::InlinePolicy>().clGetDeviceImageInfoQCOM(
+        device,
+        image_width,
+        image_height,
+        image_format,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+}
+#define clGetDeviceImageInfoQCOM clext_inline_clGetDeviceImageInfoQCOM
+
+#endif // defined(cl_qcom_ext_host_ptr)
+
+#endif // OPENCLEXT_INLINE_H_
@@ -1,20 +1,6 @@
-<%
-skipExtensions = {
-    # cl_khr_gl_sharing is a special case because it is implemented in the ICD
-    # loader and is called into via the ICD dispatch table.
-    'cl_khr_gl_sharing',
-    # cl_khr_icd is used by the ICD loader only.
-    'cl_khr_icd',
-    # cl_loader_layers is used by the ICD loader only.
-    'cl_loader_layers',
-    # cl_APPLE_ContextLoggingFunctions is not passed a dispatchable object so
-    # we cannot generate functions for it.
-    'cl_APPLE_ContextLoggingFunctions',
-    # cl_APPLE_SetMemObjectDestructor could work but there is a discrepancy
-    # in the headers for the pfn_notify function.
-    'cl_APPLE_SetMemObjectDestructor',
-    }
-
+<%!
+from gen import shouldGenerate, shouldEmit, getExtensionSortKey
+%><%
 defaultValueForType = {
     # Handle Types
     'cl_accelerator_intel'              : 'NULL',
@@ -80,30 +66,6 @@ defaultValueForType = {
     'UINT'                              : '0',
     }
 
-# Extensions to include in this file:
-def shouldGenerate(extension):
-    if extension in genExtensions:
-        return True
-    elif not genExtensions and not extension in skipExtensions:
-        return True
-    return False
-
-# XML blocks with funcitons to include:
-def shouldEmit(block):
-    for func in block.findall('command'):
-        return True
-    return False
-
-# Order the extensions should be emitted in the headers.
-# KHR -> EXT -> Vendor Extensions
-def getExtensionSortKey(item):
-    name = item.get('name')
-    if name.startswith('cl_khr'):
-        return 0, name
-    if name.startswith('cl_ext'):
-        return 1, name
-    return 99, name
-
 # Gets C function parameter strings for the specified API params:
 def getCallArgs(params):
     callstr = ""
@@ -170,7 +132,7 @@ def getCallArgs(params):
 void call_all(void)
 {
 %for extension in sorted(spec.findall('extensions/extension'), key=getExtensionSortKey):
-%  if shouldGenerate(extension.get('name')):
+%  if shouldGenerate(extension.get('name'), genExtensions):
 %for block in extension.findall('require'):
 %  if shouldEmit(block):
 #ifdef ${extension.get('name')}
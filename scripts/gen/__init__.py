@@ -46,6 +46,9 @@ def parse_args():
     parser.add_argument('-o', action='store', dest='directory',
                         default='.',
                         help='Create target and related files in specified directory')
+    parser.add_argument('-extensions', action='store',
+                        default='',
+                        help='Comma-separated list of extensions to generate (default: all)')
 
     args = parser.parse_args()
     return args
@@ -208,3 +211,159 @@ def get_extapis(spec, apisigs):
 
 def get_apis(spec, apisigs):
     return (get_coreapis(spec, apisigs), get_extapis(spec, apisigs))
+
+# hash_name - 32-bit FNV-1a hash of a name with a seed.  This must match
+# _hash_name in the generated extension loader.
+def hash_name(seed, name):
+    hash = (2166136261 ^ seed) & 0xffffffff
+    for c in name.encode('utf-8'):
+        hash = ((hash ^ c) * 16777619) & 0xffffffff
+    return hash
+
+# get_perfect_hash - Returns a minimal perfect hash for a list of names, as a
+# list of seeds and a list of names in hash order.  A name is found by using
+# hash_name(0, name) to choose a seed, then hash_name(seed, name) to choose a
+# slot.  The names are placed by "hash, displace, and compress": the buckets
+# with the most names are placed first, trying seeds until a seed is found
+# that puts every name in the bucket into an empty slot.
+def get_perfect_hash(names):
+    size = max(len(names), 1)
+    buckets = [[] for i in range(size)]
+    for name in names:
+        buckets[hash_name(0, name) % size].append(name)
+
+    seeds = [0] * size
+    slots = [None] * size
+    for index, bucket in sorted(enumerate(buckets), key=lambda b: -len(b[1])):
+        if not bucket:
+            break
+        seed = 1
+        while True:
+            positions = [hash_name(seed, name) % size for name in bucket]
+            if len(set(positions)) == len(positions) and \
+                    all(slots[p] is None for p in positions):
+                break
+            seed += 1
+        seeds[index] = seed
+        for position, name in zip(positions, bucket):
+            slots[position] = name
+    return seeds, slots
+
+# Helpers shared by the templates for every generated file.
+
+skipExtensions = {
+    # cl_khr_gl_sharing is a special case because it is implemented in the ICD
+    # loader and is called into via the ICD dispatch table.
+    'cl_khr_gl_sharing',
+    # cl_khr_icd is used by the ICD loader only.
+    'cl_khr_icd',
+    # cl_loader_layers is used by the ICD loader only.
+    'cl_loader_layers',
+    # cl_APPLE_ContextLoggingFunctions is not passed a dispatchable object so
+    # we cannot generate functions for it.
+    'cl_APPLE_ContextLoggingFunctions',
+    # cl_APPLE_SetMemObjectDestructor could work but there is a discrepancy
+    # in the headers for the pfn_notify function.
+    'cl_APPLE_SetMemObjectDestructor',
+    }
+
+GL_Extensions = {
+    'cl_khr_gl_depth_images',
+    'cl_khr_gl_event',
+    'cl_khr_gl_msaa_sharing',
+    'cl_khr_gl_sharing',
+    'cl_intel_sharing_format_query_gl',
+    }
+
+EGL_Extensions = {
+    'cl_khr_egl_event',
+    'cl_khr_egl_image',
+    }
+
+DX9_Extensions = {
+    'cl_khr_dx9_media_sharing',
+    'cl_intel_dx9_media_sharing',
+    'cl_intel_sharing_format_query_dx9',
+    }
+
+D3D10_Extensions = {
+    'cl_khr_d3d10_sharing',
+    'cl_intel_sharing_format_query_d3d10',
+    }
+
+D3D11_Extensions = {
+    'cl_khr_d3d11_sharing',
+    'cl_intel_sharing_format_query_d3d11',
+    }
+
+VA_API_Extensions = {
+    'cl_intel_va_api_media_sharing',
+    'cl_intel_sharing_format_query_va_api',
+    }
+
+commonExtensions = {
+    'cl_loader_info',
+    }
+
+# Extensions to include in a generated file, given the extensions that were
+# selected, or an empty set to include all extensions that are not skipped:
+def shouldGenerate(name, genExtensions):
+    if name in genExtensions:
+        return True
+    elif not genExtensions and not name in skipExtensions:
+        return True
+    return False
+
+# Common Extensions (not per-platform):
+def isCommonExtension(name):
+    return name in commonExtensions
+
+# ifdef condition for an extension:
+def getIfdefCondition(name):
+    if name in GL_Extensions:
+        return 'CLEXT_INCLUDE_GL'
+    elif name in EGL_Extensions:
+        return 'CLEXT_INCLUDE_EGL'
+    elif name in DX9_Extensions:
+        return 'CLEXT_INCLUDE_DX9'
+    elif name in D3D10_Extensions:
+        return 'CLEXT_INCLUDE_D3D10'
+    elif name in D3D11_Extensions:
+        return 'CLEXT_INCLUDE_D3D11'
+    elif name in VA_API_Extensions:
+        return 'CLEXT_INCLUDE_VA_API'
+    return None
+
+# XML blocks with functions to include:
+def shouldEmit(block):
+    for func in block.findall('command'):
+        return True
+    return False
+
+# Extensions with functions to include:
+def hasFunctions(extension):
+    for block in extension.findall('require'):
+        if shouldEmit(block):
+            return True
+    return False
+
+# Order the extensions should be emitted in the headers.
+# KHR -> EXT -> Vendor Extensions
+def getExtensionSortKey(item):
+    name = item.get('name')
+    if name.startswith('cl_khr'):
+        return 0, name
+    if name.startswith('cl_ext'):
+        return 1, name
+    return 99, name
+
+# Gets C function parameter strings for the specified API params:
+def getCParameterStrings(params):
+    strings = []
+    if len(params) == 0:
+        strings.append("void")
+    else:
+        for param in params:
+            paramstr = param.Type + ' ' + param.Name + param.TypeEnd
+            strings.append(paramstr)
+    return strings
@@ -7,12 +7,14 @@
 import gen
 
 from mako.template import Template
+from mako.lookup import TemplateLookup
 from mako.exceptions import RichTraceback
 
 from collections import OrderedDict
 from collections import namedtuple
 
 import argparse
+import os
 import sys
 import urllib
 import xml.etree.ElementTree as etree
@@ -39,26 +41,107 @@ if __name__ == "__main__":
 
     extapis = gen.get_extapis(spec, apisigs)
 
+    # An empty set generates all extensions that are not skipped.
+    genExtensions = set()
+    if args.extensions:
+        genExtensions = set([e.strip() for e in args.extensions.split(',') if e.strip()])
+        extensions = dict([(e.get('name'), e) for e in spec.findall('extensions/extension')])
+        for name in sorted(genExtensions):
+            if not name in extensions:
+                print('Error: unknown extension: ' + name)
+                sys.exit(1)
+            if not extensions[name].findall('require/command'):
+                print('Error: extension has no functions: ' + name)
+                sys.exit(1)
+
+        # Objects of these types can only be mapped to a dispatch table using
+        # a function from the extension that defines the type.
+        handleExtensions = {
+            'cl_accelerator_intel': 'cl_intel_accelerator',
+            'cl_command_buffer_khr': 'cl_khr_command_buffer',
+            'cl_mutable_command_khr': 'cl_khr_command_buffer_mutable_dispatch',
+            'cl_semaphore_khr': 'cl_khr_semaphore',
+            }
+        for name in sorted(genExtensions):
+            for command in extensions[name].findall('require/command'):
+                for param in apisigs[command.get('name')].Params:
+                    type = param.Type.replace('const ', '').strip()
+                    if type in handleExtensions and not handleExtensions[type] in genExtensions:
+                        print('Error: extension ' + name + ' also requires ' + handleExtensions[type])
+                        sys.exit(1)
+
     try:
-        loader_template = Template(filename='openclext.cpp.mako')
+        lookup = TemplateLookup(directories=['.'])
+
+        loader_template = lookup.get_template('openclext.cpp.mako')
 
         print('Generating openclext.cpp...')
         gen = open(args.directory + '/openclext.cpp', 'wb')
         gen.write(
           loader_template.render_unicode(
-              genExtensions={},
+              genExtensions=genExtensions,
+              spec=spec,
+              apisigs=apisigs,
+              extapis=extapis).
+          encode('utf-8', 'replace'))
+
+        header_template = lookup.get_template('openclext.hpp.mako')
+
+        print('Generating openclext.hpp...')
+        gen = open(args.directory + '/openclext.hpp', 'wb')
+        gen.write(
+          header_template.render_unicode(
+              genExtensions=genExtensions,
               spec=spec,
               apisigs=apisigs,
               extapis=extapis).
           encode('utf-8', 'replace'))
 
-        test_template = Template(filename='call_all.c.mako')
+        inline_template = lookup.get_template('openclext_inline.h.mako')
+
+        print('Generating openclext_inline.h...')
+        gen = open(args.directory + '/openclext_inline.h', 'wb')
+        gen.write(
+          inline_template.render_unicode(
+              genExtensions=genExtensions,
+              spec=spec,
+              apisigs=apisigs,
+              extapis=extapis).
+          encode('utf-8', 'replace'))
+
+        split_template = lookup.get_template('openclext_split.cpp.mako')
+
+        print('Generating split openclext sources...')
+        os.makedirs(args.directory + '/split', exist_ok=True)
+        split_files = []
+        for extension in spec.findall('extensions/extension'):
+            source = split_template.render_unicode(
+                genExtensions=genExtensions,
+                spec=spec,
+                apisigs=apisigs,
+                extapis=extapis,
+                extension=extension)
+            # Nothing is rendered for extensions that are not generated.
+            if source:
+                filename = 'openclext_' + extension.get('name') + '.cpp'
+                gen = open(args.directory + '/split/' + filename, 'wb')
+                gen.write(source.encode('utf-8', 'replace'))
+                split_files.append(filename)
+
+        gen = open(args.directory + '/split/sources.cmake', 'w')
+        gen.write('# This file is generated from the Khronos OpenCL XML API Registry.\n\n')
+        gen.write('set(OpenCLExtensionLoader_SPLIT_SOURCE_FILES\n')
+        for filename in sorted(split_files):
+            gen.write('    src/split/' + filename + '\n')
+        gen.write(')\n')
+
+        test_template = lookup.get_template('call_all.c.mako')
 
         print('Generating call_all.c test function...')
         gen = open(args.directory + '/call_all.c', 'wb')
         gen.write(
           test_template.render_unicode(
-              genExtensions={},
+              genExtensions=genExtensions,
               spec=spec,
               apisigs=apisigs,
               extapis=extapis).
@@ -70,3 +153,4 @@ if __name__ == "__main__":
             print('%s(%s) : error in %s' % (filename, lineno, function))
             print('    ', line)
         print('%s: %s' % (str(traceback.error.__class__.__name__), traceback.error))
+        sys.exit(1)
@@ -1,121 +1,8 @@
-<%
-skipExtensions = {
-    # cl_khr_gl_sharing is a special case because it is implemented in the ICD
-    # loader and is called into via the ICD dispatch table.
-    'cl_khr_gl_sharing',
-    # cl_khr_icd is used by the ICD loader only.
-    'cl_khr_icd',
-    # cl_loader_layers is used by the ICD loader only.
-    'cl_loader_layers',
-    # cl_APPLE_ContextLoggingFunctions is not passed a dispatchable object so
-    # we cannot generate functions for it.
-    'cl_APPLE_ContextLoggingFunctions',
-    # cl_APPLE_SetMemObjectDestructor could work but there is a discrepancy
-    # in the headers for the pfn_notify function.
-    'cl_APPLE_SetMemObjectDestructor',
-    }
-
-GL_Extensions = {
-    'cl_khr_gl_depth_images',
-    'cl_khr_gl_event',
-    'cl_khr_gl_msaa_sharing',
-    'cl_khr_gl_sharing',
-    'cl_intel_sharing_format_query_gl',
-    }
-
-EGL_Extensions = {
-    'cl_khr_egl_event',
-    'cl_khr_egl_image',
-    }
-
-DX9_Extensions = {
-    'cl_khr_dx9_media_sharing',
-    'cl_intel_dx9_media_sharing',
-    'cl_intel_sharing_format_query_dx9',
-    }
-
-D3D10_Extensions = {
-    'cl_khr_d3d10_sharing',
-    'cl_intel_sharing_format_query_d3d10',
-    }
-
-D3D11_Extensions = {
-    'cl_khr_d3d11_sharing',
-    'cl_intel_sharing_format_query_d3d11',
-    }
-
-VA_API_Extensions = {
-    'cl_intel_va_api_media_sharing',
-    'cl_intel_sharing_format_query_va_api',
-    }
-
-commonExtensions = {
-    'cl_loader_info',
-    }
-
-# Extensions to include in this file:
-def shouldGenerate(name):
-    if name in genExtensions:
-        return True
-    elif not genExtensions and not name in skipExtensions:
-        return True
-    return False
-
-# Common Extensions (not per-platform):
-def isCommonExtension(name):
-    return name in commonExtensions
-
-# ifdef condition for an extension:
-def getIfdefCondition(name):
-    if name in GL_Extensions:
-        return 'CLEXT_INCLUDE_GL'
-    elif name in EGL_Extensions:
-        return 'CLEXT_INCLUDE_EGL'
-    elif name in DX9_Extensions:
-        return 'CLEXT_INCLUDE_DX9'
-    elif name in D3D10_Extensions:
-        return 'CLEXT_INCLUDE_D3D10'
-    elif name in D3D11_Extensions:
-        return 'CLEXT_INCLUDE_D3D11'
-    elif name in VA_API_Extensions:
-        return 'CLEXT_INCLUDE_VA_API'
-    return None
-
-# XML blocks for extensions with functions to include:
-def shouldEmit(block):
-    for func in block.findall('command'):
-        return True
-    return False
-
-# Extensions with functions to include:
-def hasFunctions(extension):
-    for block in extension.findall('require'):
-        if shouldEmit(block):
-            return True
-    return False
-
-# Order the extensions should be emitted in the headers.
-# KHR -> EXT -> Vendor Extensions
-def getExtensionSortKey(item):
-    name = item.get('name')
-    if name.startswith('cl_khr'):
-        return 0, name
-    if name.startswith('cl_ext'):
-        return 1, name
-    return 99, name
-
-# Gets C function parameter strings for the specified API params:
-def getCParameterStrings(params):
-    strings = []
-    if len(params) == 0:
-        strings.append("void")
-    else:
-        for param in params:
-            paramstr = param.Type + ' ' + param.Name + param.TypeEnd
-            strings.append(paramstr)
-    return strings
-
-%>/*******************************************************************************
+<%!
+import gen
+from gen import (shouldGenerate, isCommonExtension, getIfdefCondition,
+    shouldEmit, hasFunctions, getExtensionSortKey, getCParameterStrings)
+%><%namespace name="functions" file="openclext_function.mako"/>/*******************************************************************************
 // Copyright (c) 2021-2026 Ben Ashbaugh
 //
 // SPDX-License-Identifier: MIT or Apache-2.0
@@ -177,125 +64,28 @@ def getCParameterStrings(params):
 #include <CL/cl_va_api_media_sharing_intel.h>
 #endif
 
+#include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <vector>
 
-static inline cl_platform_id _get_platform(cl_platform_id platform)
-{
-    return platform;
-}
-
-static inline cl_platform_id _get_platform(cl_device_id device)
-{
-    if (device == nullptr) return nullptr;
-
-    cl_platform_id platform = nullptr;
-    clGetDeviceInfo(
-        device,
-        CL_DEVICE_PLATFORM,
-        sizeof(platform),
-        &platform,
-        nullptr);
-    return platform;
-}
-
-static inline cl_platform_id _get_platform(cl_command_queue command_queue)
-{
-    if (command_queue == nullptr) return nullptr;
-
-    cl_device_id device = nullptr;
-    clGetCommandQueueInfo(
-        command_queue,
-        CL_QUEUE_DEVICE,
-        sizeof(device),
-        &device,
-        nullptr);
-    return _get_platform(device);
-}
-
-static inline cl_platform_id _get_platform(cl_context context)
-{
-    if (context == nullptr) return nullptr;
-
-    cl_uint numDevices = 0;
-    clGetContextInfo(
-        context,
-        CL_CONTEXT_NUM_DEVICES,
-        sizeof(numDevices),
-        &numDevices,
-        nullptr );
-
-    if (numDevices == 1) {  // fast path, no dynamic allocation
-        cl_device_id    device = nullptr;
-        clGetContextInfo(
-            context,
-            CL_CONTEXT_DEVICES,
-            sizeof(cl_device_id),
-            &device,
-            nullptr );
-        return _get_platform(device);
-    }
-
-    // slower path, dynamic allocation
-    std::vector<cl_device_id> devices(numDevices);
-    clGetContextInfo(
-        context,
-        CL_CONTEXT_DEVICES,
-        numDevices * sizeof(cl_device_id),
-        devices.data(),
-        nullptr );
-    return _get_platform(devices[0]);
-}
-
-static inline cl_platform_id _get_platform(cl_kernel kernel)
-{
-    if (kernel == nullptr) return nullptr;
-
-    cl_context context = nullptr;
-    clGetKernelInfo(
-        kernel,
-        CL_KERNEL_CONTEXT,
-        sizeof(context),
-        &context,
-        nullptr);
-    return _get_platform(context);
-}
-
-static inline cl_platform_id _get_platform(cl_mem memobj)
-{
-    if (memobj == nullptr) return nullptr;
-
-    cl_context context = nullptr;
-    clGetMemObjectInfo(
-        memobj,
-        CL_MEM_CONTEXT,
-        sizeof(context),
-        &context,
-        nullptr);
-    return _get_platform(context);
-}
+#include "openclext.h"
+#include "openclext_hooks.h"
+#include "openclext_platform.h"
+#include "openclext_resolution.h"
 
-static inline cl_platform_id _get_platform(cl_event event)
-{
-    if (event == nullptr) return nullptr;
-
-    cl_context context = nullptr;
-    clGetEventInfo(
-        event,
-        CL_EVENT_CONTEXT,
-        sizeof(context),
-        &context,
-        nullptr);
-    return _get_platform(context);
-}
+#if defined(CLEXT_INTERPOSER)
+#include "openclext_interposer.h"
+#endif
 
 /***************************************************************
 * Function Pointer Typedefs
 ***************************************************************/
 
 %for extension in sorted(spec.findall('extensions/extension'), key=getExtensionSortKey):
-%  if shouldGenerate(extension.get('name')) and hasFunctions(extension):
+%  if shouldGenerate(extension.get('name'), genExtensions) and hasFunctions(extension):
 %    if getIfdefCondition(extension.get('name')):
 #if defined(${getIfdefCondition(extension.get('name'))})
 %    endif
@@ -344,7 +134,7 @@ struct openclext_dispatch_table {
     cl_platform_id platform;
 
 %for extension in sorted(spec.findall('extensions/extension'), key=getExtensionSortKey):
-%  if shouldGenerate(extension.get('name')) and hasFunctions(extension) and not isCommonExtension(extension.get('name')):
+%  if shouldGenerate(extension.get('name'), genExtensions) and hasFunctions(extension) and not isCommonExtension(extension.get('name')):
 %    if getIfdefCondition(extension.get('name')):
 #if defined(${getIfdefCondition(extension.get('name'))})
 %    endif
@@ -375,7 +165,7 @@ struct openclext_dispatch_table {
 
 struct openclext_dispatch_table_common {
 %for extension in sorted(spec.findall('extensions/extension'), key=getExtensionSortKey):
-%  if shouldGenerate(extension.get('name')) and hasFunctions(extension) and isCommonExtension(extension.get('name')):
+%  if shouldGenerate(extension.get('name'), genExtensions) and hasFunctions(extension) and isCommonExtension(extension.get('name')):
 %    if getIfdefCondition(extension.get('name')):
 #if defined(${getIfdefCondition(extension.get('name'))})
 %    endif
@@ -412,13 +202,21 @@ static void _init(cl_platform_id platform, openclext_dispatch_table* dispatch_pt
 {
     dispatch_ptr->platform = platform;
 
+    openclext_resolution* resolution = openclext_resolution_begin(platform);
+
 #define CLEXT_GET_EXTENSION(_funcname)                                         ${"\\"}
-    dispatch_ptr->_funcname =                                                  ${"\\"}
-        (_funcname##_clextfn)clGetExtensionFunctionAddressForPlatform(         ${"\\"}
-            platform, #_funcname);
+    {                                                                          ${"\\"}
+        uint64_t start_ns = openclext_now_ns();                                ${"\\"}
+        CLEXT_COUNT_ICD_CALL();                                                ${"\\"}
+        dispatch_ptr->_funcname =                                              ${"\\"}
+            (_funcname##_clextfn)clGetExtensionFunctionAddressForPlatform(     ${"\\"}
+                platform, #_funcname);                                         ${"\\"}
+        openclext_resolution_record(                                           ${"\\"}
+            resolution, #_funcname, (void*)dispatch_ptr->_funcname, start_ns); ${"\\"}
+    }
 
 %for extension in sorted(spec.findall('extensions/extension'), key=getExtensionSortKey):
-%  if shouldGenerate(extension.get('name')) and hasFunctions(extension) and not isCommonExtension(extension.get('name')):
+%  if shouldGenerate(extension.get('name'), genExtensions) and hasFunctions(extension) and not isCommonExtension(extension.get('name')):
 %    if getIfdefCondition(extension.get('name')):
 #if defined(${getIfdefCondition(extension.get('name'))})
 %    endif
@@ -446,16 +244,34 @@ static void _init(cl_platform_id platform, openclext_dispatch_table* dispatch_pt
 %  endif
 %endfor
 #undef CLEXT_GET_EXTENSION
+
+%for extension in spec.findall('extensions/extension'):
+%  if extension.get('name') == 'cl_intel_unified_shared_memory' and shouldGenerate(extension.get('name'), genExtensions):
+#if defined(cl_intel_unified_shared_memory)
+${functions.usmEmulation(extension)}\
+#endif // defined(cl_intel_unified_shared_memory)
+
+%  endif
+%endfor
+    openclext_resolution_end(resolution);
 }
 
 static void _init_common(openclext_dispatch_table_common* dispatch_ptr)
 {
+    openclext_resolution* resolution = openclext_resolution_begin(nullptr);
+
 #define CLEXT_GET_EXTENSION(_funcname)                                         ${"\\"}
-    dispatch_ptr->_funcname =                                                  ${"\\"}
-        (_funcname##_clextfn)clGetExtensionFunctionAddress(#_funcname);
+    {                                                                          ${"\\"}
+        uint64_t start_ns = openclext_now_ns();                                ${"\\"}
+        CLEXT_COUNT_ICD_CALL();                                                ${"\\"}
+        dispatch_ptr->_funcname =                                              ${"\\"}
+            (_funcname##_clextfn)clGetExtensionFunctionAddress(#_funcname);    ${"\\"}
+        openclext_resolution_record(                                           ${"\\"}
+            resolution, #_funcname, (void*)dispatch_ptr->_funcname, start_ns); ${"\\"}
+    }
 
 %for extension in sorted(spec.findall('extensions/extension'), key=getExtensionSortKey):
-%  if shouldGenerate(extension.get('name')) and hasFunctions(extension) and isCommonExtension(extension.get('name')):
+%  if shouldGenerate(extension.get('name'), genExtensions) and hasFunctions(extension) and isCommonExtension(extension.get('name')):
 %    if getIfdefCondition(extension.get('name')):
 #if defined(${getIfdefCondition(extension.get('name'))})
 %    endif
@@ -483,6 +299,8 @@ static void _init_common(openclext_dispatch_table_common* dispatch_ptr)
 %  endif
 %endfor
 #undef CLEXT_GET_EXTENSION
+
+    openclext_resolution_end(resolution);
 }
 
 #if defined(CLEXT_SINGLE_PLATFORM_ONLY)
@@ -550,6 +368,7 @@ static inline openclext_dispatch_table* _get_dispatch(T object)
 {
     if (_num_platforms == 0 && _dispatch_array == nullptr) {
         cl_uint numPlatforms = 0;
+        CLEXT_COUNT_ICD_CALL();
         clGetPlatformIDs(0, nullptr, &numPlatforms);
         if (numPlatforms == 0) {
             return nullptr;
@@ -563,6 +382,7 @@ static inline openclext_dispatch_table* _get_dispatch(T object)
         }
 
         std::vector<cl_platform_id> platforms(numPlatforms);
+        CLEXT_COUNT_ICD_CALL();
         clGetPlatformIDs(numPlatforms, platforms.data(), nullptr);
 
         for (size_t i = 0; i < numPlatforms; i++) {
@@ -590,6 +410,7 @@ static inline openclext_dispatch_table* _get_dispatch(T object)
 // table if it is not already initialized, and we need to use other methods
 // to find the right dispatch table.
 
+%if shouldGenerate('cl_khr_semaphore', genExtensions):
 #if defined(cl_khr_semaphore)
 template<>
 inline openclext_dispatch_table* _get_dispatch<cl_semaphore_khr>(cl_semaphore_khr semaphore)
@@ -602,6 +423,7 @@ inline openclext_dispatch_table* _get_dispatch<cl_semaphore_khr>(cl_semaphore_kh
             _dispatch_array + i;
         if (dispatch_ptr->clGetSemaphoreInfoKHR) {
             cl_uint refCount = 0;
+            CLEXT_COUNT_ICD_CALL();
             cl_int errorCode = dispatch_ptr->clGetSemaphoreInfoKHR(
                 semaphore,
                 CL_SEMAPHORE_REFERENCE_COUNT_KHR,
@@ -617,7 +439,9 @@ inline openclext_dispatch_table* _get_dispatch<cl_semaphore_khr>(cl_semaphore_kh
     return nullptr;
 }
 #endif // defined(cl_khr_semaphore)
+%endif
 
+%if shouldGenerate('cl_khr_command_buffer', genExtensions):
 #if defined(cl_khr_command_buffer)
 template<>
 inline openclext_dispatch_table* _get_dispatch<cl_command_buffer_khr>(cl_command_buffer_khr cmdbuf)
@@ -630,6 +454,7 @@ inline openclext_dispatch_table* _get_dispatch<cl_command_buffer_khr>(cl_command
             _dispatch_array + i;
         if (dispatch_ptr->clGetCommandBufferInfoKHR) {
             cl_uint refCount = 0;
+            CLEXT_COUNT_ICD_CALL();
             cl_int errorCode = dispatch_ptr->clGetCommandBufferInfoKHR(
                 cmdbuf,
                 CL_COMMAND_BUFFER_REFERENCE_COUNT_KHR,
@@ -645,7 +470,9 @@ inline openclext_dispatch_table* _get_dispatch<cl_command_buffer_khr>(cl_command
     return nullptr;
 }
 #endif // defined(cl_khr_command_buffer)
+%endif
 
+%if shouldGenerate('cl_khr_command_buffer_mutable_dispatch', genExtensions):
 #if defined(cl_khr_command_buffer_mutable_dispatch)
 template<>
 inline openclext_dispatch_table* _get_dispatch<cl_mutable_command_khr>(cl_mutable_command_khr command)
@@ -660,6 +487,7 @@ inline openclext_dispatch_table* _get_dispatch<cl_mutable_command_khr>(cl_mutabl
             // Alternatively, this could query the command queue from the
             // command, then get the dispatch table from the command queue.
             cl_command_buffer_khr cmdbuf = nullptr;
+            CLEXT_COUNT_ICD_CALL();
             cl_int errorCode = dispatch_ptr->clGetMutableCommandInfoKHR(
                 command,
                 CL_MUTABLE_COMMAND_COMMAND_BUFFER_KHR,
@@ -675,7 +503,9 @@ inline openclext_dispatch_table* _get_dispatch<cl_mutable_command_khr>(cl_mutabl
     return nullptr;
 }
 #endif // defined(cl_khr_command_buffer_mutable_dispatch)
+%endif
 
+%if shouldGenerate('cl_intel_accelerator', genExtensions):
 #if defined(cl_intel_accelerator)
 template<>
 inline openclext_dispatch_table* _get_dispatch<cl_accelerator_intel>(cl_accelerator_intel accelerator)
@@ -688,6 +518,7 @@ inline openclext_dispatch_table* _get_dispatch<cl_accelerator_intel>(cl_accelera
             _dispatch_array + i;
         if (dispatch_ptr->clGetAcceleratorInfoINTEL) {
             cl_uint refCount = 0;
+            CLEXT_COUNT_ICD_CALL();
             cl_int errorCode = dispatch_ptr->clGetAcceleratorInfoINTEL(
                 accelerator,
                 CL_ACCELERATOR_REFERENCE_COUNT_INTEL,
@@ -703,6 +534,7 @@ inline openclext_dispatch_table* _get_dispatch<cl_accelerator_intel>(cl_accelera
     return nullptr;
 }
 #endif // defined(cl_intel_accelerator)
+%endif
 
 #endif // defined(CLEXT_SINGLE_PLATFORM_ONLY)
 
@@ -719,6 +551,195 @@ static inline openclext_dispatch_table_common* _get_dispatch(void)
     return _dispatch_ptr_common;
 }
 
+static inline cl_platform_id _get_dispatch_platform(const openclext_dispatch_table* dispatch_ptr)
+{
+    return dispatch_ptr ? dispatch_ptr->platform : nullptr;
+}
+
+static inline cl_platform_id _get_dispatch_platform(const openclext_dispatch_table_common*)
+{
+    return nullptr;
+}
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+
+/***************************************************************
+* Compact Dispatch
+***************************************************************/
+
+// With compact dispatch, each extension function is a small stub that passes
+// its index in the function information table and its dispatch handle to a
+// shared resolver, rather than finding the dispatch table itself.
+
+enum openclext_function_index {
+%for extension in sorted(spec.findall('extensions/extension'), key=getExtensionSortKey):
+%  if shouldGenerate(extension.get('name'), genExtensions) and hasFunctions(extension):
+%    if getIfdefCondition(extension.get('name')):
+#if defined(${getIfdefCondition(extension.get('name'))})
+%    endif
+#if defined(${extension.get('name')})
+%for block in extension.findall('require'):
+%  if shouldEmit(block):
+%    if block.get('condition'):
+#if ${block.get('condition')}
+%    endif
+%    for func in block.findall('command'):
+<%
+    api = apisigs[func.get('name')]
+%>    CLEXT_FUNCTION_${api.Name},
+%    endfor
+%    if block.get('condition'):
+#endif // ${block.get('condition')}
+%    endif
+%  endif
+%endfor
+#endif // defined(${extension.get('name')})
+%    if getIfdefCondition(extension.get('name')):
+#endif // defined(${getIfdefCondition(extension.get('name'))})
+%    endif
+%  endif
+%endfor
+    CLEXT_FUNCTION_COUNT
+};
+
+// How to find the dispatch table from the dispatch handle.
+enum openclext_handle_kind : uint8_t {
+    CLEXT_HANDLE_COMMON,
+    CLEXT_HANDLE_PLATFORM,
+    CLEXT_HANDLE_DEVICE,
+    CLEXT_HANDLE_CONTEXT,
+    CLEXT_HANDLE_COMMAND_QUEUE,
+    CLEXT_HANDLE_MEM,
+    CLEXT_HANDLE_KERNEL,
+    CLEXT_HANDLE_EVENT,
+    CLEXT_HANDLE_SEMAPHORE,
+    CLEXT_HANDLE_COMMAND_BUFFER,
+    CLEXT_HANDLE_MUTABLE_COMMAND,
+    CLEXT_HANDLE_ACCELERATOR,
+};
+
+// How an unsupported extension function returns an error.
+enum openclext_error_kind : uint8_t {
+    CLEXT_ERROR_STATUS,     // returns CL_INVALID_OPERATION
+    CLEXT_ERROR_ERRCODE,    // sets errcode_ret and returns nullptr
+    CLEXT_ERROR_NULL,       // returns nullptr
+    CLEXT_ERROR_VOID,       // returns nothing
+};
+
+struct openclext_function_info {
+    uint16_t offset;        // offset of the function in the dispatch table
+    openclext_handle_kind handle;
+    openclext_error_kind error;
+};
+
+static const openclext_function_info _function_info[] = {
+%for extension in sorted(spec.findall('extensions/extension'), key=getExtensionSortKey):
+%  if shouldGenerate(extension.get('name'), genExtensions) and hasFunctions(extension):
+%    if getIfdefCondition(extension.get('name')):
+#if defined(${getIfdefCondition(extension.get('name'))})
+%    endif
+#if defined(${extension.get('name')})
+%for block in extension.findall('require'):
+%  if shouldEmit(block):
+%    if block.get('condition'):
+#if ${block.get('condition')}
+%    endif
+%    for func in block.findall('command'):
+<%
+    api = apisigs[func.get('name')]
+%>${functions.info(api, isCommonExtension(extension.get('name')))}\
+%    endfor
+%    if block.get('condition'):
+#endif // ${block.get('condition')}
+%    endif
+%  endif
+%endfor
+#endif // defined(${extension.get('name')})
+%    if getIfdefCondition(extension.get('name')):
+#endif // defined(${getIfdefCondition(extension.get('name'))})
+%    endif
+%  endif
+%endfor
+    { 0, CLEXT_HANDLE_COMMON, CLEXT_ERROR_VOID }    // CLEXT_FUNCTION_COUNT
+};
+
+static void* _resolve(
+    openclext_function_index index,
+    const void* handle,
+    cl_int* errcode_ret)
+{
+    const openclext_function_info& info = _function_info[index];
+
+    const void* dispatch_ptr = nullptr;
+    switch (info.handle) {
+    case CLEXT_HANDLE_COMMON:
+        dispatch_ptr = _get_dispatch();
+        break;
+    case CLEXT_HANDLE_PLATFORM:
+        dispatch_ptr = _get_dispatch((cl_platform_id)handle);
+        break;
+    case CLEXT_HANDLE_DEVICE:
+        dispatch_ptr = _get_dispatch((cl_device_id)handle);
+        break;
+    case CLEXT_HANDLE_CONTEXT:
+        dispatch_ptr = _get_dispatch((cl_context)handle);
+        break;
+    case CLEXT_HANDLE_COMMAND_QUEUE:
+        dispatch_ptr = _get_dispatch((cl_command_queue)handle);
+        break;
+    case CLEXT_HANDLE_MEM:
+        dispatch_ptr = _get_dispatch((cl_mem)handle);
+        break;
+    case CLEXT_HANDLE_KERNEL:
+        dispatch_ptr = _get_dispatch((cl_kernel)handle);
+        break;
+    case CLEXT_HANDLE_EVENT:
+        dispatch_ptr = _get_dispatch((cl_event)handle);
+        break;
+%if shouldGenerate('cl_khr_semaphore', genExtensions):
+#if defined(cl_khr_semaphore)
+    case CLEXT_HANDLE_SEMAPHORE:
+        dispatch_ptr = _get_dispatch((cl_semaphore_khr)handle);
+        break;
+#endif // defined(cl_khr_semaphore)
+%endif
+%if shouldGenerate('cl_khr_command_buffer', genExtensions):
+#if defined(cl_khr_command_buffer)
+    case CLEXT_HANDLE_COMMAND_BUFFER:
+        dispatch_ptr = _get_dispatch((cl_command_buffer_khr)handle);
+        break;
+#endif // defined(cl_khr_command_buffer)
+%endif
+%if shouldGenerate('cl_khr_command_buffer_mutable_dispatch', genExtensions):
+#if defined(cl_khr_command_buffer_mutable_dispatch)
+    case CLEXT_HANDLE_MUTABLE_COMMAND:
+        dispatch_ptr = _get_dispatch((cl_mutable_command_khr)handle);
+        break;
+#endif // defined(cl_khr_command_buffer_mutable_dispatch)
+%endif
+%if shouldGenerate('cl_intel_accelerator', genExtensions):
+#if defined(cl_intel_accelerator)
+    case CLEXT_HANDLE_ACCELERATOR:
+        dispatch_ptr = _get_dispatch((cl_accelerator_intel)handle);
+        break;
+#endif // defined(cl_intel_accelerator)
+%endif
+    default:
+        break;
+    }
+
+    void* function = nullptr;
+    if (dispatch_ptr) {
+        memcpy(&function, (const char*)dispatch_ptr + info.offset, sizeof(function));
+    }
+    if (function == nullptr && info.error == CLEXT_ERROR_ERRCODE && errcode_ret) {
+        *errcode_ret = CL_INVALID_OPERATION;
+    }
+    return function;
+}
+
+#endif // defined(CLEXT_COMPACT_DISPATCH)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -728,7 +749,7 @@ extern "C" {
 ***************************************************************/
 
 %for extension in sorted(spec.findall('extensions/extension'), key=getExtensionSortKey):
-%  if shouldGenerate(extension.get('name')) and hasFunctions(extension):
+%  if shouldGenerate(extension.get('name'), genExtensions) and hasFunctions(extension):
 %    if getIfdefCondition(extension.get('name')):
 #if defined(${getIfdefCondition(extension.get('name'))})
 %    endif
@@ -743,53 +764,11 @@ extern "C" {
 <%
     api = apisigs[func.get('name')]
 %>
-${api.RetType} CL_API_CALL ${api.Name}(
-%      for i, paramStr in enumerate(getCParameterStrings(api.Params)):
-%        if i < len(api.Params)-1:
-    ${paramStr},
-%        else:
-    ${paramStr})
-%        endif
-%      endfor
-{
-%      if isCommonExtension(extension.get('name')) and hasFunctions(extension):
-    struct openclext_dispatch_table_common* dispatch_ptr = _get_dispatch();
-%      elif api.Name == "clCreateCommandBufferKHR":
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(${api.Params[0].Name} > 0 && ${api.Params[1].Name} ? ${api.Params[1].Name}[0] : nullptr);
-%      elif api.Name == "clEnqueueCommandBufferKHR":
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(${api.Params[2].Name});
-%      elif api.Name == "clCancelCommandsIMG":
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(${api.Params[1].Name} > 0 && ${api.Params[0].Name} ? ${api.Params[0].Name}[0] : nullptr);
-%      else:
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(${api.Params[0].Name});
-%      endif
-    if (dispatch_ptr == nullptr || dispatch_ptr->${api.Name} == nullptr) {
-%      if api.RetType == "cl_int":
-        return CL_INVALID_OPERATION;
-%      elif api.Params[len(api.Params)-1].Name == "errcode_ret":
-        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
-        return nullptr;
-%      elif api.RetType == "void*":
-        return nullptr;
-%      elif api.RetType == "void":
-        return;
-%      else:
-        // not sure how to return an error in this case!
-%      endif
-    }
-%      if api.RetType == "void":
-    dispatch_ptr->${api.Name}(
-%      else:
-    return dispatch_ptr->${api.Name}(
-%      endif
-%      for i, arg in enumerate(api.Params):
-%        if i < len(api.Params)-1:
-        ${arg.Name},
-%        else:
-        ${arg.Name});
-%        endif
-%      endfor
-}
+#if defined(CLEXT_COMPACT_DISPATCH)
+${functions.stub(api, isCommonExtension(extension.get('name')))}\
+#else
+${functions.function(api, isCommonExtension(extension.get('name')))}\
+#endif
 %    endfor
 %    if block.get('condition'):
 
@@ -809,3 +788,190 @@ ${api.RetType} CL_API_CALL ${api.Name}(
 #ifdef __cplusplus
 }
 #endif
+
+/***************************************************************
+* Function Name Lookup
+***************************************************************/
+
+<%
+functionNames = {}
+for extension in sorted(spec.findall('extensions/extension'), key=getExtensionSortKey):
+    if shouldGenerate(extension.get('name'), genExtensions) and hasFunctions(extension):
+        conditions = []
+        if getIfdefCondition(extension.get('name')):
+            conditions.append('defined(' + getIfdefCondition(extension.get('name')) + ')')
+        conditions.append('defined(' + extension.get('name') + ')')
+        for block in extension.findall('require'):
+            blockConditions = list(conditions)
+            if block.get('condition'):
+                blockConditions.append('(' + block.get('condition') + ')')
+            for func in block.findall('command'):
+                functionNames[func.get('name')] = (' && '.join(blockConditions), isCommonExtension(extension.get('name')))
+nameSeeds, nameSlots = gen.get_perfect_hash(sorted(functionNames.keys()))
+%>\
+// Extension functions are found by name using a minimal perfect hash that is
+// computed when this file is generated.  The first hash of the name chooses a
+// seed, and the hash of the name with the seed chooses a slot.  Slots for
+// extension functions that are not supported by the headers are empty.
+
+struct openclext_function_name {
+    const char* name;
+    uint16_t offset;        // offset of the function in the dispatch table
+    bool common;            // the function is in the common dispatch table
+};
+
+static const uint32_t _function_name_seeds[${len(nameSeeds)}] = {
+%for i in range(0, len(nameSeeds), 8):
+    ${', '.join([str(seed) for seed in nameSeeds[i:i+8]])},
+%endfor
+};
+
+static const openclext_function_name _function_names[${len(nameSlots)}] = {
+%for name in nameSlots:
+%  if name is None:
+    { nullptr, 0, false },
+%  else:
+#if ${functionNames[name][0]}
+    { "${name}", offsetof(${'openclext_dispatch_table_common' if functionNames[name][1] else 'openclext_dispatch_table'}, ${name}), ${'true' if functionNames[name][1] else 'false'} },
+#else
+    { nullptr, 0, false },
+#endif
+%  endif
+%endfor
+};
+
+static inline uint32_t _hash_name(uint32_t seed, const char* name)
+{
+    uint32_t hash = 2166136261u ^ seed;
+    for (; *name; name++) {
+        hash = (hash ^ (uint8_t)*name) * 16777619u;
+    }
+    return hash;
+}
+
+void* CL_API_CALL clextGetFunctionAddress(
+    cl_platform_id platform,
+    const char* func_name)
+{
+    if (func_name == nullptr) {
+        return nullptr;
+    }
+
+    const size_t count = ${len(nameSlots)};
+    uint32_t seed = _function_name_seeds[_hash_name(0, func_name) % count];
+    const openclext_function_name& entry =
+        _function_names[_hash_name(seed, func_name) % count];
+    if (entry.name == nullptr || strcmp(entry.name, func_name) != 0) {
+        return nullptr;
+    }
+
+    const void* dispatch_ptr = nullptr;
+    if (entry.common) {
+        dispatch_ptr = _get_dispatch();
+    } else if (platform != nullptr) {
+        // With a single platform, the one dispatch table may be for a
+        // different platform.
+        openclext_dispatch_table* platform_dispatch_ptr = _get_dispatch(platform);
+        if (_get_dispatch_platform(platform_dispatch_ptr) == platform) {
+            dispatch_ptr = platform_dispatch_ptr;
+        }
+    }
+
+    void* function = nullptr;
+    if (dispatch_ptr) {
+        memcpy(&function, (const char*)dispatch_ptr + entry.offset, sizeof(function));
+    }
+    return function;
+}
+
+#if defined(CLEXT_ENABLE_CAPTURE)
+
+/***************************************************************
+* Replay Function Table
+***************************************************************/
+
+#include "openclext_replay.h"
+
+#define CLEXT_REPLAY_FUNCTION(_funcname)                                       ${"\\"}
+    { #_funcname,                                                              ${"\\"}
+      openclext_replay_invoker<decltype(&_funcname), &_funcname>::invoke,      ${"\\"}
+      (void*)openclext_null_function<decltype(&_funcname)>::call },
+
+const openclext_replay_function openclext_replay_functions[] = {
+%for extension in sorted(spec.findall('extensions/extension'), key=getExtensionSortKey):
+%  if shouldGenerate(extension.get('name'), genExtensions) and hasFunctions(extension):
+%    if getIfdefCondition(extension.get('name')):
+#if defined(${getIfdefCondition(extension.get('name'))})
+%    endif
+#if defined(${extension.get('name')})
+%for block in extension.findall('require'):
+%  if shouldEmit(block):
+%    if block.get('condition'):
+#if ${block.get('condition')}
+%    endif
+%    for func in block.findall('command'):
+<%
+    api = apisigs[func.get('name')]
+%>    CLEXT_REPLAY_FUNCTION(${api.Name})
+%    endfor
+%    if block.get('condition'):
+#endif // ${block.get('condition')}
+%    endif
+%  endif
+%endfor
+#endif // defined(${extension.get('name')})
+%    if getIfdefCondition(extension.get('name')):
+#endif // defined(${getIfdefCondition(extension.get('name'))})
+%    endif
+%  endif
+%endfor
+    { nullptr, nullptr, nullptr }
+};
+
+#undef CLEXT_REPLAY_FUNCTION
+
+#endif // defined(CLEXT_ENABLE_CAPTURE)
+
+#if defined(CLEXT_INTERPOSER)
+
+/***************************************************************
+* Interposer Function Table
+***************************************************************/
+
+#define CLEXT_INTERPOSER_FUNCTION(_funcname)                                   ${"\\"}
+    { #_funcname, (void*)&_funcname },
+
+const openclext_interposer_function openclext_interposer_functions[] = {
+%for extension in sorted(spec.findall('extensions/extension'), key=getExtensionSortKey):
+%  if shouldGenerate(extension.get('name'), genExtensions) and hasFunctions(extension):
+%    if getIfdefCondition(extension.get('name')):
+#if defined(${getIfdefCondition(extension.get('name'))})
+%    endif
+#if defined(${extension.get('name')})
+%for block in extension.findall('require'):
+%  if shouldEmit(block):
+%    if block.get('condition'):
+#if ${block.get('condition')}
+%    endif
+%    for func in block.findall('command'):
+<%
+    api = apisigs[func.get('name')]
+%>    CLEXT_INTERPOSER_FUNCTION(${api.Name})
+%    endfor
+%    if block.get('condition'):
+#endif // ${block.get('condition')}
+%    endif
+%  endif
+%endfor
+#endif // defined(${extension.get('name')})
+%    if getIfdefCondition(extension.get('name')):
+#endif // defined(${getIfdefCondition(extension.get('name'))})
+%    endif
+%  endif
+%endfor
+    { nullptr, nullptr }
+};
+
+#undef CLEXT_INTERPOSER_FUNCTION
+
+#endif // defined(CLEXT_INTERPOSER)
@@ -0,0 +1,789 @@
+<%!
+from gen import (shouldGenerate, isCommonExtension, getIfdefCondition,
+    shouldEmit, hasFunctions, getExtensionSortKey, getCParameterStrings)
+%><%namespace name="functions" file="openclext_function.mako"/>/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+/*
+// This file is generated from the Khronos OpenCL XML API Registry.
+*/
+
+// clang-format off
+
+// A header-only C++ API for the OpenCL extension APIs.  Each extension API is
+// a member function of clext::Dispatch<Policy>, and the Policy decides how
+// the dispatch table is found, so each component of an application can make
+// its own tradeoff:
+//
+// clext::SinglePlatform:
+//     Uses one dispatch table, for the platform of the first object that is
+//     used, for all objects.  Finding the dispatch table is a single load.
+// clext::MultiPlatformCached:
+//     Initializes a dispatch table for every platform the first time it is
+//     used, then finds the dispatch table for the platform of each object.
+// clext::ExplicitTable:
+//     Uses a dispatch table that is passed to the constructor, for example:
+//
+//         clext::DispatchTable table(platform);
+//         clext::Dispatch<clext::ExplicitTable> ext(clext::ExplicitTable(&table));
+//         ext.clEnqueueMemcpyINTEL(queue, CL_TRUE, dst, src, size, 0, nullptr, nullptr);
+//
+// The dispatch tables are separate from the dispatch tables in the OpenCL
+// Extension Loader library, and the hooks in the library are not called.
+// Extension APIs that are not per-platform, such as cl_loader_info, are not
+// included.
+//
+// clext::UsmRing<Policy> is a ring of records in unified shared memory that a
+// host thread can stream to kernels without copying.
+
+#ifndef OPENCLEXT_HPP_
+#define OPENCLEXT_HPP_
+
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+#if defined(CLEXT_INCLUDE_GL)
+#include <CL/cl_gl.h>
+// Some versions of the headers to not define cl_khr_gl_event.
+#ifndef cl_khr_gl_event
+#define cl_khr_gl_event 1
+#endif
+#endif
+#if defined(CLEXT_INCLUDE_EGL)
+#include <CL/cl_egl.h>
+#endif
+#if defined(CLEXT_INCLUDE_DX9)
+#include <CL/cl_dx9_media_sharing.h>
+#endif
+// Note: If both D3D10 and D3D11 are supported, the D3D11 header must be
+// included first.
+#if defined(CLEXT_INCLUDE_D3D11)
+#include <CL/cl_d3d11.h>
+#endif
+#if defined(CLEXT_INCLUDE_D3D10)
+#include <CL/cl_d3d10.h>
+#endif
+#if defined(CLEXT_INCLUDE_VA_API)
+#include <CL/cl_va_api_media_sharing_intel.h>
+#endif
+
+#include <stddef.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+
+// Initialization is kept out of line so only finding an initialized dispatch
+// table is inlined into each call.
+#if !defined(CLEXT_NOINLINE)
+#if defined(_MSC_VER)
+#define CLEXT_NOINLINE __declspec(noinline)
+#elif defined(__GNUC__)
+#define CLEXT_NOINLINE __attribute__((noinline))
+#else
+#define CLEXT_NOINLINE
+#endif
+#endif
+
+namespace clext {
+
+/***************************************************************
+* Function Pointer Typedefs
+***************************************************************/
+
+namespace detail {
+
+%for extension in sorted(spec.findall('extensions/extension'), key=getExtensionSortKey):
+%  if shouldGenerate(extension.get('name'), genExtensions) and hasFunctions(extension) and not isCommonExtension(extension.get('name')):
+%    if getIfdefCondition(extension.get('name')):
+#if defined(${getIfdefCondition(extension.get('name'))})
+%    endif
+#if defined(${extension.get('name')})
+%for block in extension.findall('require'):
+%  if shouldEmit(block):
+%    if block.get('condition'):
+#if ${block.get('condition')}
+%    endif
+%    for func in block.findall('command'):
+<%
+    api = apisigs[func.get('name')]
+%>typedef ${api.RetType} (CL_API_CALL* ${api.Name}_fn)(
+%      for i, paramStr in enumerate(getCParameterStrings(api.Params)):
+%        if i < len(api.Params)-1:
+    ${paramStr},
+%        else:
+    ${paramStr});
+%        endif
+%      endfor
+%    endfor
+%    if block.get('condition'):
+#endif // ${block.get('condition')}
+%    endif
+%  endif
+%endfor
+#endif // defined(${extension.get('name')})
+%    if getIfdefCondition(extension.get('name')):
+#endif // defined(${getIfdefCondition(extension.get('name'))})
+%    endif
+%  endif
+%endfor
+
+} // namespace detail
+
+/***************************************************************
+* Dispatch Table
+***************************************************************/
+
+struct DispatchTable {
+    DispatchTable() = default;
+
+    explicit DispatchTable(cl_platform_id platform_) : platform(platform_)
+    {
+#define CLEXT_GET_EXTENSION(_funcname)                                         ${"\\"}
+        _funcname = (detail::_funcname##_fn)                                   ${"\\"}
+            clGetExtensionFunctionAddressForPlatform(platform, #_funcname)
+
+%for extension in sorted(spec.findall('extensions/extension'), key=getExtensionSortKey):
+%  if shouldGenerate(extension.get('name'), genExtensions) and hasFunctions(extension) and not isCommonExtension(extension.get('name')):
+%    if getIfdefCondition(extension.get('name')):
+#if defined(${getIfdefCondition(extension.get('name'))})
+%    endif
+#if defined(${extension.get('name')})
+%for block in extension.findall('require'):
+%  if shouldEmit(block):
+%    if block.get('condition'):
+#if ${block.get('condition')}
+%    endif
+%    for func in block.findall('command'):
+<%
+    api = apisigs[func.get('name')]
+%>        CLEXT_GET_EXTENSION(${api.Name});
+%    endfor
+%    if block.get('condition'):
+#endif // ${block.get('condition')}
+%    endif
+%  endif
+%endfor
+#endif // defined(${extension.get('name')})
+%    if getIfdefCondition(extension.get('name')):
+#endif // defined(${getIfdefCondition(extension.get('name'))})
+%    endif
+%  endif
+%endfor
+
+#undef CLEXT_GET_EXTENSION
+    }
+
+    cl_platform_id platform = nullptr;
+
+%for extension in sorted(spec.findall('extensions/extension'), key=getExtensionSortKey):
+%  if shouldGenerate(extension.get('name'), genExtensions) and hasFunctions(extension) and not isCommonExtension(extension.get('name')):
+%    if getIfdefCondition(extension.get('name')):
+#if defined(${getIfdefCondition(extension.get('name'))})
+%    endif
+#if defined(${extension.get('name')})
+%for block in extension.findall('require'):
+%  if shouldEmit(block):
+%    if block.get('condition'):
+#if ${block.get('condition')}
+%    endif
+%    for func in block.findall('command'):
+<%
+    api = apisigs[func.get('name')]
+%>    detail::${api.Name}_fn ${api.Name} = nullptr;
+%    endfor
+%    if block.get('condition'):
+#endif // ${block.get('condition')}
+%    endif
+%  endif
+%endfor
+#endif // defined(${extension.get('name')})
+%    if getIfdefCondition(extension.get('name')):
+#endif // defined(${getIfdefCondition(extension.get('name'))})
+%    endif
+%  endif
+%endfor
+};
+
+namespace detail {
+
+/***************************************************************
+* Platform Queries
+***************************************************************/
+
+inline cl_platform_id get_platform(cl_platform_id platform)
+{
+    return platform;
+}
+
+inline cl_platform_id get_platform(cl_device_id device)
+{
+    if (device == nullptr) return nullptr;
+
+    cl_platform_id platform = nullptr;
+    clGetDeviceInfo(
+        device,
+        CL_DEVICE_PLATFORM,
+        sizeof(platform),
+        &platform,
+        nullptr);
+    return platform;
+}
+
+inline cl_platform_id get_platform(cl_command_queue command_queue)
+{
+    if (command_queue == nullptr) return nullptr;
+
+    cl_device_id device = nullptr;
+    clGetCommandQueueInfo(
+        command_queue,
+        CL_QUEUE_DEVICE,
+        sizeof(device),
+        &device,
+        nullptr);
+    return get_platform(device);
+}
+
+inline cl_platform_id get_platform(cl_context context)
+{
+    if (context == nullptr) return nullptr;
+
+    cl_uint numDevices = 0;
+    clGetContextInfo(
+        context,
+        CL_CONTEXT_NUM_DEVICES,
+        sizeof(numDevices),
+        &numDevices,
+        nullptr);
+    if (numDevices == 0) return nullptr;
+
+    std::vector<cl_device_id> devices(numDevices);
+    clGetContextInfo(
+        context,
+        CL_CONTEXT_DEVICES,
+        numDevices * sizeof(cl_device_id),
+        devices.data(),
+        nullptr);
+    return get_platform(devices[0]);
+}
+
+inline cl_platform_id get_platform(cl_kernel kernel)
+{
+    if (kernel == nullptr) return nullptr;
+
+    cl_context context = nullptr;
+    clGetKernelInfo(
+        kernel,
+        CL_KERNEL_CONTEXT,
+        sizeof(context),
+        &context,
+        nullptr);
+    return get_platform(context);
+}
+
+inline cl_platform_id get_platform(cl_mem memobj)
+{
+    if (memobj == nullptr) return nullptr;
+
+    cl_context context = nullptr;
+    clGetMemObjectInfo(
+        memobj,
+        CL_MEM_CONTEXT,
+        sizeof(context),
+        &context,
+        nullptr);
+    return get_platform(context);
+}
+
+inline cl_platform_id get_platform(cl_event event)
+{
+    if (event == nullptr) return nullptr;
+
+    cl_context context = nullptr;
+    clGetEventInfo(
+        event,
+        CL_EVENT_CONTEXT,
+        sizeof(context),
+        &context,
+        nullptr);
+    return get_platform(context);
+}
+
+template<typename T>
+inline const DispatchTable* find_table(const DispatchTable* tables, size_t count, T object)
+{
+    cl_platform_id platform = get_platform(object);
+    for (size_t i = 0; i < count; i++) {
+        if (tables[i].platform == platform) {
+            return tables + i;
+        }
+    }
+    return nullptr;
+}
+
+// For some extension objects we cannot query a platform ID, so each dispatch
+// table is asked whether the object belongs to its platform instead.
+
+%if shouldGenerate('cl_khr_semaphore', genExtensions):
+#if defined(cl_khr_semaphore)
+inline const DispatchTable* find_table(const DispatchTable* tables, size_t count, cl_semaphore_khr object)
+{
+    if (object == nullptr) return nullptr;
+    if (count <= 1) return tables;
+
+    for (size_t i = 0; i < count; i++) {
+        if (tables[i].clGetSemaphoreInfoKHR) {
+            cl_uint value = 0;
+            cl_int errorCode = tables[i].clGetSemaphoreInfoKHR(
+                object,
+                CL_SEMAPHORE_REFERENCE_COUNT_KHR,
+                sizeof(value),
+                &value,
+                nullptr);
+            if (errorCode == CL_SUCCESS) {
+                return tables + i;
+            }
+        }
+    }
+
+    return nullptr;
+}
+#endif // defined(cl_khr_semaphore)
+%endif
+
+%if shouldGenerate('cl_khr_command_buffer', genExtensions):
+#if defined(cl_khr_command_buffer)
+inline const DispatchTable* find_table(const DispatchTable* tables, size_t count, cl_command_buffer_khr object)
+{
+    if (object == nullptr) return nullptr;
+    if (count <= 1) return tables;
+
+    for (size_t i = 0; i < count; i++) {
+        if (tables[i].clGetCommandBufferInfoKHR) {
+            cl_uint value = 0;
+            cl_int errorCode = tables[i].clGetCommandBufferInfoKHR(
+                object,
+                CL_COMMAND_BUFFER_REFERENCE_COUNT_KHR,
+                sizeof(value),
+                &value,
+                nullptr);
+            if (errorCode == CL_SUCCESS) {
+                return tables + i;
+            }
+        }
+    }
+
+    return nullptr;
+}
+#endif // defined(cl_khr_command_buffer)
+%endif
+
+%if shouldGenerate('cl_khr_command_buffer_mutable_dispatch', genExtensions):
+#if defined(cl_khr_command_buffer_mutable_dispatch)
+inline const DispatchTable* find_table(const DispatchTable* tables, size_t count, cl_mutable_command_khr object)
+{
+    if (object == nullptr) return nullptr;
+    if (count <= 1) return tables;
+
+    for (size_t i = 0; i < count; i++) {
+        if (tables[i].clGetMutableCommandInfoKHR) {
+            cl_command_buffer_khr value = nullptr;
+            cl_int errorCode = tables[i].clGetMutableCommandInfoKHR(
+                object,
+                CL_MUTABLE_COMMAND_COMMAND_BUFFER_KHR,
+                sizeof(value),
+                &value,
+                nullptr);
+            if (errorCode == CL_SUCCESS) {
+                return tables + i;
+            }
+        }
+    }
+
+    return nullptr;
+}
+#endif // defined(cl_khr_command_buffer_mutable_dispatch)
+%endif
+
+%if shouldGenerate('cl_intel_accelerator', genExtensions):
+#if defined(cl_intel_accelerator)
+inline const DispatchTable* find_table(const DispatchTable* tables, size_t count, cl_accelerator_intel object)
+{
+    if (object == nullptr) return nullptr;
+    if (count <= 1) return tables;
+
+    for (size_t i = 0; i < count; i++) {
+        if (tables[i].clGetAcceleratorInfoINTEL) {
+            cl_uint value = 0;
+            cl_int errorCode = tables[i].clGetAcceleratorInfoINTEL(
+                object,
+                CL_ACCELERATOR_REFERENCE_COUNT_INTEL,
+                sizeof(value),
+                &value,
+                nullptr);
+            if (errorCode == CL_SUCCESS) {
+                return tables + i;
+            }
+        }
+    }
+
+    return nullptr;
+}
+#endif // defined(cl_intel_accelerator)
+%endif
+
+/***************************************************************
+* Dispatch Policy State
+***************************************************************/
+
+// Static members of class templates may be defined in a header, so these
+// are shared by every translation unit that includes this header.  The
+// dispatch tables are intentionally never destroyed, since extension APIs
+// may be called from static destructors.
+
+template<typename Unused = void>
+struct SinglePlatformState {
+    static std::atomic<const DispatchTable*> table;
+    static std::mutex lock;
+};
+
+template<typename Unused>
+std::atomic<const DispatchTable*> SinglePlatformState<Unused>::table(nullptr);
+template<typename Unused>
+std::mutex SinglePlatformState<Unused>::lock;
+
+template<typename Unused = void>
+struct MultiPlatformState {
+    static std::atomic<const std::vector<DispatchTable>*> tables;
+    static std::mutex lock;
+};
+
+template<typename Unused>
+std::atomic<const std::vector<DispatchTable>*> MultiPlatformState<Unused>::tables(nullptr);
+template<typename Unused>
+std::mutex MultiPlatformState<Unused>::lock;
+
+} // namespace detail
+
+/***************************************************************
+* Dispatch Policies
+***************************************************************/
+
+class SinglePlatform {
+public:
+    template<typename T>
+    const DispatchTable* get(T object) const
+    {
+        if (object == nullptr) return nullptr;
+
+        const DispatchTable* table =
+            detail::SinglePlatformState<>::table.load(std::memory_order_acquire);
+        return table ? table : init(object);
+    }
+
+    // For these objects we cannot query a platform ID, so the dispatch table
+    // must already be initialized.
+%if shouldGenerate('cl_khr_semaphore', genExtensions):
+#if defined(cl_khr_semaphore)
+    const DispatchTable* get(cl_semaphore_khr) const
+    {
+        return detail::SinglePlatformState<>::table.load(std::memory_order_acquire);
+    }
+#endif // defined(cl_khr_semaphore)
+%endif
+%if shouldGenerate('cl_khr_command_buffer', genExtensions):
+#if defined(cl_khr_command_buffer)
+    const DispatchTable* get(cl_command_buffer_khr) const
+    {
+        return detail::SinglePlatformState<>::table.load(std::memory_order_acquire);
+    }
+#endif // defined(cl_khr_command_buffer)
+%endif
+%if shouldGenerate('cl_khr_command_buffer_mutable_dispatch', genExtensions):
+#if defined(cl_khr_command_buffer_mutable_dispatch)
+    const DispatchTable* get(cl_mutable_command_khr) const
+    {
+        return detail::SinglePlatformState<>::table.load(std::memory_order_acquire);
+    }
+#endif // defined(cl_khr_command_buffer_mutable_dispatch)
+%endif
+%if shouldGenerate('cl_intel_accelerator', genExtensions):
+#if defined(cl_intel_accelerator)
+    const DispatchTable* get(cl_accelerator_intel) const
+    {
+        return detail::SinglePlatformState<>::table.load(std::memory_order_acquire);
+    }
+#endif // defined(cl_intel_accelerator)
+%endif
+
+private:
+    template<typename T>
+    CLEXT_NOINLINE static const DispatchTable* init(T object)
+    {
+        std::lock_guard<std::mutex> guard(detail::SinglePlatformState<>::lock);
+        const DispatchTable* table =
+            detail::SinglePlatformState<>::table.load(std::memory_order_relaxed);
+        if (table == nullptr) {
+            table = new DispatchTable(detail::get_platform(object));
+            detail::SinglePlatformState<>::table.store(table, std::memory_order_release);
+        }
+        return table;
+    }
+};
+
+class MultiPlatformCached {
+public:
+    template<typename T>
+    const DispatchTable* get(T object) const
+    {
+        const std::vector<DispatchTable>* tables =
+            detail::MultiPlatformState<>::tables.load(std::memory_order_acquire);
+        if (tables == nullptr) {
+            tables = init();
+        }
+        return detail::find_table(tables->data(), tables->size(), object);
+    }
+
+private:
+    CLEXT_NOINLINE static const std::vector<DispatchTable>* init()
+    {
+        std::lock_guard<std::mutex> guard(detail::MultiPlatformState<>::lock);
+        const std::vector<DispatchTable>* tables =
+            detail::MultiPlatformState<>::tables.load(std::memory_order_relaxed);
+        if (tables == nullptr) {
+            cl_uint numPlatforms = 0;
+            clGetPlatformIDs(0, nullptr, &numPlatforms);
+
+            std::vector<cl_platform_id> platforms(numPlatforms);
+            if (numPlatforms != 0) {
+                clGetPlatformIDs(numPlatforms, platforms.data(), nullptr);
+            }
+
+            std::vector<DispatchTable>* newTables = new std::vector<DispatchTable>;
+            for (cl_platform_id platform : platforms) {
+                newTables->push_back(DispatchTable(platform));
+            }
+
+            tables = newTables;
+            detail::MultiPlatformState<>::tables.store(tables, std::memory_order_release);
+        }
+        return tables;
+    }
+};
+
+class ExplicitTable {
+public:
+    explicit ExplicitTable(const DispatchTable* table_) : table(table_) {}
+
+    template<typename T>
+    const DispatchTable* get(T) const
+    {
+        return table;
+    }
+
+private:
+    const DispatchTable* table;
+};
+
+/***************************************************************
+* Extension Functions
+***************************************************************/
+
+template<typename Policy>
+class Dispatch : private Policy {
+public:
+    Dispatch() = default;
+    explicit Dispatch(const Policy& policy) : Policy(policy) {}
+
+%for extension in sorted(spec.findall('extensions/extension'), key=getExtensionSortKey):
+%  if shouldGenerate(extension.get('name'), genExtensions) and hasFunctions(extension) and not isCommonExtension(extension.get('name')):
+%    if getIfdefCondition(extension.get('name')):
+#if defined(${getIfdefCondition(extension.get('name'))})
+%    endif
+#if defined(${extension.get('name')})
+%for block in extension.findall('require'):
+%  if shouldEmit(block):
+%    if block.get('condition'):
+#if ${block.get('condition')}
+%    endif
+%    for func in block.findall('command'):
+<%
+    api = apisigs[func.get('name')]
+%>${functions.method(api)}
+%    endfor
+%    if block.get('condition'):
+#endif // ${block.get('condition')}
+%    endif
+%  endif
+%endfor
+#endif // defined(${extension.get('name')})
+%    if getIfdefCondition(extension.get('name')):
+#endif // defined(${getIfdefCondition(extension.get('name'))})
+%    endif
+%  endif
+%endfor
+};
+
+%if shouldGenerate('cl_intel_unified_shared_memory', genExtensions):
+#if defined(cl_intel_unified_shared_memory)
+
+/***************************************************************
+* Unified Shared Memory Ring
+***************************************************************/
+
+// A single-producer, single-consumer ring of fixed-size records in one shared
+// or host USM allocation, so a host thread can stream records to kernels
+// without copying them.  The producer pushes records, and the consumer peeks
+// at a batch of records, enqueues kernels that read the records directly from
+// the USM allocation, then releases the records after the kernels complete.
+//
+// The head and tail indices are stored in the USM allocation, at HeadOffset
+// and TailOffset, and the records start at RecordOffset:
+//
+//     (char*)ring.get() + RecordOffset + (index & (capacity - 1)) * recordSize
+//
+// The indices increase monotonically and wrap around, and the capacity is a
+// power of two, so the number of records in the ring is always head - tail.
+// Kernels that read records while the producer is pushing more records, rather
+// than in batches that were pushed before the kernels were enqueued, need a
+// device that supports concurrent access to the USM allocation.
+
+template<typename Policy = MultiPlatformCached>
+class UsmRing {
+public:
+    enum : size_t {
+        HeadOffset = 0,
+        TailOffset = 64,
+        RecordOffset = 128,
+    };
+
+    // Allocates a ring with room for capacity records of recordSize bytes, as
+    // shared USM for the device, or as host USM if the device is nullptr.
+    // The capacity must be a power of two.
+    UsmRing(
+        cl_context context_,
+        cl_device_id device,
+        size_t recordSize_,
+        cl_uint capacity_,
+        cl_int* errcode_ret = nullptr,
+        const Policy& policy = Policy()) :
+        ext(policy), context(context_), recordSize(recordSize_), capacity(capacity_)
+    {
+        cl_int errorCode = CL_SUCCESS;
+        if (recordSize == 0 || capacity == 0 || (capacity & (capacity - 1)) != 0 ||
+            recordSize > ((size_t)-1 - RecordOffset) / capacity) {
+            errorCode = CL_INVALID_VALUE;
+        } else {
+            size_t size = RecordOffset + recordSize * capacity;
+            ptr = device ?
+                ext.clSharedMemAllocINTEL(context, device, nullptr, size, RecordOffset, &errorCode) :
+                ext.clHostMemAllocINTEL(context, nullptr, size, RecordOffset, &errorCode);
+        }
+        if (ptr) {
+            new (head()) std::atomic<cl_uint>(0);
+            new (tail()) std::atomic<cl_uint>(0);
+        }
+        if (errcode_ret) *errcode_ret = errorCode;
+    }
+
+    // Waits for any kernels that are still using the ring before freeing it.
+    // If the memory cannot be freed while blocking, e.g. because USM is
+    // emulated with SVM, it is not freed, since kernels may still use it.
+    ~UsmRing()
+    {
+        if (ptr) {
+            ext.clMemBlockingFreeINTEL(context, ptr);
+        }
+    }
+
+    UsmRing(const UsmRing&) = delete;
+    UsmRing& operator=(const UsmRing&) = delete;
+
+    void* get() const { return ptr; }
+    size_t getRecordSize() const { return recordSize; }
+    cl_uint getCapacity() const { return capacity; }
+
+    void* getRecord(cl_uint index) const
+    {
+        return (char*)ptr + RecordOffset + (index & (capacity - 1)) * recordSize;
+    }
+
+    // Sets a kernel argument to the USM allocation for the ring.
+    cl_int setKernelArg(cl_kernel kernel, cl_uint arg_index) const
+    {
+        return ext.clSetKernelArgMemPointerINTEL(kernel, arg_index, ptr);
+    }
+
+    // Called by the producer.  Copies up to count records into the ring and
+    // returns the number of records that were pushed, which is less than
+    // count if the ring is full.
+    cl_uint push(const void* records, cl_uint count)
+    {
+        cl_uint headIndex = head()->load(std::memory_order_relaxed);
+        cl_uint tailIndex = tail()->load(std::memory_order_acquire);
+        cl_uint pushed = std::min(count, capacity - (headIndex - tailIndex));
+
+        // Each contiguous run of records is copied at once.
+        const char* src = (const char*)records;
+        for (cl_uint i = 0; i < pushed; ) {
+            cl_uint slot = (headIndex + i) & (capacity - 1);
+            cl_uint run = std::min(pushed - i, capacity - slot);
+            memcpy(getRecord(slot), src + i * recordSize, run * recordSize);
+            i += run;
+        }
+
+        head()->store(headIndex + pushed, std::memory_order_release);
+        return pushed;
+    }
+
+    // Called by the consumer.  Returns the number of records in the ring, up
+    // to maxCount, and the index of the first record.  The records are not
+    // released, so the same records are returned until they are released.
+    cl_uint peek(cl_uint maxCount, cl_uint* first) const
+    {
+        cl_uint tailIndex = tail()->load(std::memory_order_relaxed);
+        cl_uint headIndex = head()->load(std::memory_order_acquire);
+        if (first) *first = tailIndex;
+        return std::min(maxCount, headIndex - tailIndex);
+    }
+
+    // Called by the consumer.  Releases the first count records, so the
+    // producer can reuse their space.  This should only be called after the
+    // kernels that read the records complete.
+    void release(cl_uint count)
+    {
+        cl_uint tailIndex = tail()->load(std::memory_order_relaxed);
+        tail()->store(tailIndex + count, std::memory_order_release);
+    }
+
+private:
+    static_assert(sizeof(std::atomic<cl_uint>) == sizeof(cl_uint),
+        "the ring indices must have the same layout on the host and device");
+
+    std::atomic<cl_uint>* head() const
+    {
+        return (std::atomic<cl_uint>*)((char*)ptr + HeadOffset);
+    }
+    std::atomic<cl_uint>* tail() const
+    {
+        return (std::atomic<cl_uint>*)((char*)ptr + TailOffset);
+    }
+
+    Dispatch<Policy> ext;
+    cl_context context;
+    size_t recordSize;
+    cl_uint capacity;
+    void* ptr = nullptr;
+};
+
+#endif // defined(cl_intel_unified_shared_memory)
+%endif
+
+} // namespace clext
+
+#endif // OPENCLEXT_HPP_
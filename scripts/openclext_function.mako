@@ -0,0 +1,321 @@
+<%!
+# Extension functions, shared by all generated files that define extension
+# functions: the wrapper functions, the stubs and function information used
+# instead of the wrapper functions with compact dispatch, and the member
+# functions of the header-only C++ API and the inline functions that call
+# them.
+
+from gen import getCParameterStrings
+
+# Functions that move data, with the parameter that is the number of bytes
+# moved.  These functions call the CLEXT_CALL_TRANSFER hook.
+transferFunctions = {
+    'clCommandCopyBufferKHR': 'size',
+    'clEnqueueMemFillINTEL': 'size',
+    'clEnqueueMemcpyINTEL': 'size',
+    'clEnqueueMigrateMemINTEL': 'size',
+    'clEnqueueReadHostPipeINTEL': 'size',
+    'clEnqueueSVMMemcpyARM': 'size',
+    'clEnqueueWriteHostPipeINTEL': 'size',
+    }
+
+# Functions that allocate unified shared memory, with the type of memory they
+# allocate, and functions that free unified shared memory.  These functions
+# call the CLEXT_CALL_USM_ALLOC, or CLEXT_CALL_USM_FREE and
+# CLEXT_CALL_USM_FREE_END hooks.
+usmAllocFunctions = {
+    'clDeviceMemAllocINTEL': 'CL_MEM_TYPE_DEVICE_INTEL',
+    'clHostMemAllocINTEL': 'CL_MEM_TYPE_HOST_INTEL',
+    'clSharedMemAllocINTEL': 'CL_MEM_TYPE_SHARED_INTEL',
+    }
+usmFreeFunctions = [
+    'clMemBlockingFreeINTEL',
+    'clMemFreeINTEL',
+    ]
+
+# Gets the argument used to find the dispatch table for the specified API:
+def getDispatchArg(api):
+    if api.Name == "clCreateCommandBufferKHR":
+        return '%s > 0 && %s ? %s[0] : nullptr' % (api.Params[0].Name, api.Params[1].Name, api.Params[1].Name)
+    elif api.Name == "clEnqueueCommandBufferKHR":
+        return api.Params[2].Name
+    elif api.Name == "clCancelCommandsIMG":
+        return '%s > 0 && %s ? %s[0] : nullptr' % (api.Params[1].Name, api.Params[0].Name, api.Params[0].Name)
+    return api.Params[0].Name
+
+# Returns true if the specified API returns an error via errcode_ret:
+def hasErrcodeRet(api):
+    return api.Params[len(api.Params)-1].Name == "errcode_ret"
+
+# Gets the most bytes the specified API may access through each of its
+# pointer arguments, or 0 if it is not known:
+def getPointerSizeExpr(api):
+    names = [p.Name for p in api.Params]
+    if 'size' in names:
+        return 'size'
+    elif 'param_value_size' in names:
+        return 'param_value_size'
+    return '0'
+
+# Gets the status reported to the hooks after calling the specified API:
+def getStatusExpr(api):
+    if api.RetType == "cl_int":
+        return 'retVal'
+    elif hasErrcodeRet(api):
+        return '*errcode_ret'
+    elif api.RetType == "void*":
+        return 'retVal ? CL_SUCCESS : CL_OUT_OF_RESOURCES'
+    return 'CL_SUCCESS'
+
+# Gets the compact dispatch handle kind for the specified API, from the type
+# of the argument used to find the dispatch table:
+handleKinds = {
+    'cl_platform_id': 'CLEXT_HANDLE_PLATFORM',
+    'cl_device_id': 'CLEXT_HANDLE_DEVICE',
+    'cl_context': 'CLEXT_HANDLE_CONTEXT',
+    'cl_command_queue': 'CLEXT_HANDLE_COMMAND_QUEUE',
+    'cl_mem': 'CLEXT_HANDLE_MEM',
+    'cl_kernel': 'CLEXT_HANDLE_KERNEL',
+    'cl_event': 'CLEXT_HANDLE_EVENT',
+    'cl_semaphore_khr': 'CLEXT_HANDLE_SEMAPHORE',
+    'cl_command_buffer_khr': 'CLEXT_HANDLE_COMMAND_BUFFER',
+    'cl_mutable_command_khr': 'CLEXT_HANDLE_MUTABLE_COMMAND',
+    'cl_accelerator_intel': 'CLEXT_HANDLE_ACCELERATOR',
+    }
+
+def getHandleKind(api, common):
+    if common:
+        return 'CLEXT_HANDLE_COMMON'
+    name = getDispatchArg(api)
+    for param in api.Params:
+        if name == param.Name or name.endswith(' ' + param.Name + '[0] : nullptr'):
+            return handleKinds[param.Type.replace('const ', '').replace('*', '').strip()]
+    raise Exception('no dispatch handle for ' + api.Name)
+
+# Gets the compact dispatch error kind for the specified API, which
+# describes how the API returns an error when it is not supported:
+def getErrorKind(api):
+    if api.RetType == "cl_int":
+        return 'CLEXT_ERROR_STATUS'
+    elif hasErrcodeRet(api):
+        return 'CLEXT_ERROR_ERRCODE'
+    elif api.RetType == "void":
+        return 'CLEXT_ERROR_VOID'
+    return 'CLEXT_ERROR_NULL'
+
+%><%def name="function(api, common)">\
+CL_API_ENTRY ${api.RetType} CL_API_CALL ${api.Name}(
+%      for i, paramStr in enumerate(getCParameterStrings(api.Params)):
+%        if i < len(api.Params)-1:
+    ${paramStr},
+%        else:
+    ${paramStr})
+%        endif
+%      endfor
+{
+%      if common:
+    CLEXT_CALL_BEGIN(${api.Name}, nullptr);
+    struct openclext_dispatch_table_common* dispatch_ptr = _get_dispatch();
+%      else:
+    CLEXT_CALL_BEGIN(${api.Name}, ${getDispatchArg(api)});
+%        if api.Name == "clGetMemAllocInfoINTEL":
+    // Queries answered by the USM allocation registry skip finding the
+    // dispatch table, but still reach the end-of-call hooks.
+    cl_int retVal = CL_SUCCESS;
+    struct openclext_dispatch_table* dispatch_ptr = nullptr;
+    if (CLEXT_CALL_USM_INFO(${', '.join([p.Name for p in api.Params])}, &retVal)) goto call_end;
+    dispatch_ptr = _get_dispatch(${getDispatchArg(api)});
+%        else:
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(${getDispatchArg(api)});
+%        endif
+%      endif
+%      if hasErrcodeRet(api):
+    CLEXT_CALL_ERRCODE(errcode_ret);
+%      endif
+    CLEXT_CALL_DISPATCH(${api.Name}, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->${api.Name} == nullptr) {
+        CLEXT_CALL_MISSING(${api.Name}, dispatch_ptr);
+%      if api.RetType == "cl_int":
+        return CL_INVALID_OPERATION;
+%      elif hasErrcodeRet(api):
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
+%      elif api.RetType == "void*":
+        return nullptr;
+%      elif api.RetType == "void":
+        return;
+%      else:
+        // not sure how to return an error in this case!
+%      endif
+    }
+%      if api.Name in usmFreeFunctions:
+    CLEXT_CALL_USM_FREE(context, ptr);
+%      endif
+%      if api.Name == "clEnqueueMemcpyINTEL":
+    cl_int retVal = CL_SUCCESS;
+    if (!CLEXT_CALL_USM_STAGE(dispatch_ptr->${api.Name}, ${', '.join([p.Name for p in api.Params])}, &retVal)) {
+        retVal = dispatch_ptr->${api.Name}(
+%        for i, arg in enumerate(api.Params):
+%          if i < len(api.Params)-1:
+            ${arg.Name},
+%          else:
+            ${arg.Name});
+%          endif
+%        endfor
+    }
+%      else:
+%        if api.Name == "clGetMemAllocInfoINTEL":
+    retVal = dispatch_ptr->${api.Name}(
+%        elif api.RetType == "void":
+    dispatch_ptr->${api.Name}(
+%        else:
+    ${api.RetType} retVal = dispatch_ptr->${api.Name}(
+%        endif
+%        for i, arg in enumerate(api.Params):
+%          if i < len(api.Params)-1:
+        ${arg.Name},
+%          else:
+        ${arg.Name});
+%          endif
+%        endfor
+%      endif
+%      if api.Name == "clGetMemAllocInfoINTEL":
+call_end:
+%      endif
+    CLEXT_CALL_ARGS(${api.Name}, ${getStatusExpr(api)}, ${getPointerSizeExpr(api)}, ${', '.join([p.Name for p in api.Params])});
+%      if api.Name in transferFunctions:
+    CLEXT_CALL_TRANSFER(${api.Name}, ${getDispatchArg(api)}, dispatch_ptr, ${transferFunctions[api.Name]}, retVal);
+%      endif
+%      if api.Name in usmFreeFunctions:
+    CLEXT_CALL_USM_FREE_END(context, ptr, retVal);
+%      endif
+%      if api.Name in usmAllocFunctions:
+    CLEXT_CALL_USM_ALLOC(context, ${'device' if 'device' in [p.Name for p in api.Params] else 'nullptr'}, ${usmAllocFunctions[api.Name]}, retVal, size);
+%      endif
+%      if api.Name == "clSetKernelArgMemPointerINTEL":
+    CLEXT_CALL_USM_KERNEL_ARG(kernel, arg_index, arg_value, retVal);
+%      endif
+    CLEXT_CALL_END(${api.Name}, ${getStatusExpr(api)});
+%      if api.RetType != "void":
+    return retVal;
+%      endif
+}
+</%def>
+<%def name="usmEmulation(extension)">\
+#if defined(CLEXT_ENABLE_USM_EMULATION)
+    // If the platform does not support unified shared memory, emulate it with
+    // SVM.  Either all of the functions are emulated or none of them are,
+    // except clMemBlockingFreeINTEL, which cannot wait for the commands that
+    // use SVM, so it is never emulated.
+    if (dispatch_ptr->clDeviceMemAllocINTEL == nullptr &&
+        openclext_usm_emulation_is_supported(platform)) {
+%for block in extension.findall('require'):
+%  if block.findall('command'):
+%    if block.get('condition'):
+#if ${block.get('condition')}
+%    endif
+%    for func in block.findall('command'):
+%      if func.get('name') != 'clMemBlockingFreeINTEL':
+        dispatch_ptr->${func.get('name')} = openclext_usm_emulation_${func.get('name')};
+%      endif
+%    endfor
+%    if block.get('condition'):
+#endif // ${block.get('condition')}
+%    endif
+%  endif
+%endfor
+    }
+#endif // defined(CLEXT_ENABLE_USM_EMULATION)
+</%def>
+<%def name="info(api, common)">\
+    { offsetof(${'openclext_dispatch_table_common' if common else 'openclext_dispatch_table'}, ${api.Name}), ${getHandleKind(api, common)}, ${getErrorKind(api)} },
+</%def>
+<%def name="stub(api, common)">\
+CL_API_ENTRY ${api.RetType} CL_API_CALL ${api.Name}(
+%      for i, paramStr in enumerate(getCParameterStrings(api.Params)):
+%        if i < len(api.Params)-1:
+    ${paramStr},
+%        else:
+    ${paramStr})
+%        endif
+%      endfor
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_${api.Name},
+%      if common:
+        nullptr,
+%      else:
+        (const void*)(${getDispatchArg(api)}),
+%      endif
+        ${'errcode_ret' if hasErrcodeRet(api) else 'nullptr'});
+%      if api.RetType == "cl_int":
+    if (function == nullptr) return CL_INVALID_OPERATION;
+%      elif api.RetType == "void":
+    if (function == nullptr) return;
+%      else:
+    if (function == nullptr) return nullptr;
+%      endif
+    ${'' if api.RetType == "void" else 'return '}((${api.Name}_clextfn)function)(
+%      for i, arg in enumerate(api.Params):
+%        if i < len(api.Params)-1:
+        ${arg.Name},
+%        else:
+        ${arg.Name});
+%        endif
+%      endfor
+}
+</%def>
+<%def name="method(api)">\
+    ${api.RetType} ${api.Name}(
+%      for i, paramStr in enumerate(getCParameterStrings(api.Params)):
+%        if i < len(api.Params)-1:
+        ${paramStr},
+%        else:
+        ${paramStr}) const
+%        endif
+%      endfor
+    {
+        const DispatchTable* table = this->get(${getDispatchArg(api)});
+        if (table == nullptr || table->${api.Name} == nullptr) {
+%      if api.RetType == "cl_int":
+            return CL_INVALID_OPERATION;
+%      elif hasErrcodeRet(api):
+            if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+            return nullptr;
+%      elif api.RetType == "void":
+            return;
+%      else:
+            return nullptr;
+%      endif
+        }
+        ${'' if api.RetType == "void" else 'return '}table->${api.Name}(
+%      for i, arg in enumerate(api.Params):
+%        if i < len(api.Params)-1:
+            ${arg.Name},
+%        else:
+            ${arg.Name});
+%        endif
+%      endfor
+    }
+</%def>
+<%def name="inline_function(api)">\
+inline ${api.RetType} clext_inline_${api.Name}(
+%      for i, paramStr in enumerate(getCParameterStrings(api.Params)):
+%        if i < len(api.Params)-1:
+    ${paramStr},
+%        else:
+    ${paramStr})
+%        endif
+%      endfor
+{
+    ${'' if api.RetType == "void" else 'return '}clext::Dispatch<clext::InlinePolicy>().${api.Name}(
+%      for i, arg in enumerate(api.Params):
+%        if i < len(api.Params)-1:
+        ${arg.Name},
+%        else:
+        ${arg.Name});
+%        endif
+%      endfor
+}
+#define ${api.Name} clext_inline_${api.Name}
+</%def>
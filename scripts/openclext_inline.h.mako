@@ -0,0 +1,75 @@
+<%!
+from gen import (shouldGenerate, isCommonExtension, getIfdefCondition,
+    shouldEmit, hasFunctions, getExtensionSortKey, getCParameterStrings)
+%><%namespace name="functions" file="openclext_function.mako"/>/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+/*
+// This file is generated from the Khronos OpenCL XML API Registry.
+*/
+
+// clang-format off
+
+// Inline extension APIs.  After this header is included, calls to extension
+// APIs call inline functions that use the header-only C++ API in
+// openclext.hpp, rather than the out-of-line functions in the OpenCL
+// Extension Loader library, so the compiler can inline finding the dispatch
+// table into each call site.  Each extension API name is defined as a macro
+// that names its inline function, so the OpenCL headers must be included
+// before this header, or not at all.
+//
+// The dispatch tables are shared by every translation unit that includes
+// this header.  If CLEXT_SINGLE_PLATFORM_ONLY is defined, the dispatch table
+// for the first platform that is used is used for all objects; otherwise, a
+// dispatch table is initialized for every platform.
+//
+// Extension APIs that are not per-platform, such as cl_loader_info, are not
+// included, and are still called in the OpenCL Extension Loader library.
+
+#ifndef OPENCLEXT_INLINE_H_
+#define OPENCLEXT_INLINE_H_
+
+#include "openclext.hpp"
+
+namespace clext {
+#if defined(CLEXT_SINGLE_PLATFORM_ONLY)
+typedef SinglePlatform InlinePolicy;
+#else
+typedef MultiPlatformCached InlinePolicy;
+#endif
+} // namespace clext
+
+%for extension in sorted(spec.findall('extensions/extension'), key=getExtensionSortKey):
+%  if shouldGenerate(extension.get('name'), genExtensions) and hasFunctions(extension) and not isCommonExtension(extension.get('name')):
+%    if getIfdefCondition(extension.get('name')):
+#if defined(${getIfdefCondition(extension.get('name'))})
+%    endif
+#if defined(${extension.get('name')})
+%for block in extension.findall('require'):
+%  if shouldEmit(block):
+%    if block.get('condition'):
+#if ${block.get('condition')}
+%    endif
+%    for func in block.findall('command'):
+<%
+    api = apisigs[func.get('name')]
+%>
+${functions.inline_function(api)}\
+%    endfor
+%    if block.get('condition'):
+#endif // ${block.get('condition')}
+%    endif
+%  endif
+%endfor
+
+#endif // defined(${extension.get('name')})
+%    if getIfdefCondition(extension.get('name')):
+#endif // defined(${getIfdefCondition(extension.get('name'))})
+%    endif
+
+%  endif
+%endfor
+#endif // OPENCLEXT_INLINE_H_
@@ -0,0 +1,496 @@
+<%!
+from gen import (shouldGenerate, isCommonExtension, getIfdefCondition,
+    shouldEmit, hasFunctions, getExtensionSortKey, getCParameterStrings)
+%><%
+# Handle types that cannot be used to find a platform without infinitely
+# recursing, with the extension and function used to find the dispatch table
+# for an object of this type:
+probeFunctions = {
+    'cl_accelerator_intel': ('cl_intel_accelerator', 'clGetAcceleratorInfoINTEL'),
+    'cl_command_buffer_khr': ('cl_khr_command_buffer', 'clGetCommandBufferInfoKHR'),
+    'cl_mutable_command_khr': ('cl_khr_command_buffer_mutable_dispatch', 'clGetMutableCommandInfoKHR'),
+    'cl_semaphore_khr': ('cl_khr_semaphore', 'clGetSemaphoreInfoKHR'),
+    }
+
+# Reference count queries used to find the dispatch table for an object:
+probeQueries = {
+    'cl_accelerator_intel': 'CL_ACCELERATOR_REFERENCE_COUNT_INTEL',
+    'cl_command_buffer_khr': 'CL_COMMAND_BUFFER_REFERENCE_COUNT_KHR',
+    'cl_semaphore_khr': 'CL_SEMAPHORE_REFERENCE_COUNT_KHR',
+    }
+
+# Gets the type of the object used to find the dispatch table for the
+# specified API:
+def getDispatchType(api):
+    if api.Name == "clCreateCommandBufferKHR":
+        param = api.Params[1]
+    elif api.Name == "clEnqueueCommandBufferKHR":
+        param = api.Params[2]
+    elif api.Name == "clCancelCommandsIMG":
+        param = api.Params[0]
+    else:
+        param = api.Params[0]
+    return param.Type.replace('const ', '').replace('*', '').strip()
+
+# All functions in the extension:
+def getFunctions(extension):
+    functions = []
+    for block in extension.findall('require'):
+        if shouldEmit(block):
+            for func in block.findall('command'):
+                functions.append(func.get('name'))
+    return functions
+
+# Functions from other extensions needed to find the dispatch table for the
+# objects passed to this extension's functions:
+def getProbeFunctions(extension):
+    functions = getFunctions(extension)
+    probes = []
+    for name in functions:
+        type = getDispatchType(apisigs[name])
+        if type in probeFunctions and not probeFunctions[type] in probes:
+            probes.append(probeFunctions[type])
+    return sorted(probes, key=lambda probe: probe[1])
+
+name = extension.get('name')
+common = isCommonExtension(name)
+probes = getProbeFunctions(extension)
+
+%><%namespace name="functions" file="openclext_function.mako"/>\
+%if shouldGenerate(name, genExtensions) and hasFunctions(extension):
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+/*
+// This file is generated from the Khronos OpenCL XML API Registry.
+//
+// It contains the ${name} extension functions, for builds that split the
+// OpenCL Extension Loader into one translation unit per extension.
+*/
+
+// clang-format off
+
+
+#if defined _WIN32 || defined __CYGWIN__
+    #ifdef __GNUC__
+        #define CL_API_ENTRY __attribute__((dllexport))
+    #else
+        #define CL_API_ENTRY __declspec(dllexport)
+    #endif
+#else
+    #if __GNUC__ >= 4
+        #define CL_API_ENTRY __attribute__((visibility("default")))
+    #else
+        #define CL_API_ENTRY
+    #endif
+#endif
+
+#define CL_USE_DEPRECATED_OPENCL_1_0_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_1_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_2_0_APIS
+#define CL_USE_DEPRECATED_OPENCL_2_1_APIS
+#define CL_USE_DEPRECATED_OPENCL_2_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_3_0_APIS
+
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+#if defined(CLEXT_INCLUDE_GL)
+#include <CL/cl_gl.h>
+// Some versions of the headers to not define cl_khr_gl_event.
+#ifndef cl_khr_gl_event
+#define cl_khr_gl_event 1
+#endif
+#endif
+#if defined(CLEXT_INCLUDE_EGL)
+#include <CL/cl_egl.h>
+#endif
+#if defined(CLEXT_INCLUDE_DX9)
+#include <CL/cl_dx9_media_sharing.h>
+#endif
+// Note: If both D3D10 and D3D11 are supported, the D3D11 header must be
+// included first.
+#if defined(CLEXT_INCLUDE_D3D11)
+#include <CL/cl_d3d11.h>
+#endif
+#if defined(CLEXT_INCLUDE_D3D10)
+#include <CL/cl_d3d10.h>
+#endif
+#if defined(CLEXT_INCLUDE_VA_API)
+#include <CL/cl_va_api_media_sharing_intel.h>
+#endif
+
+#include <stdlib.h>
+
+#include <vector>
+
+#include "openclext_hooks.h"
+#include "openclext_platform.h"
+#include "openclext_resolution.h"
+#include "openclext_split.h"
+
+%if getIfdefCondition(name):
+#if defined(${getIfdefCondition(name)})
+%endif
+#if defined(${name})
+
+/***************************************************************
+* Function Pointer Typedefs
+***************************************************************/
+%for block in extension.findall('require'):
+%  if shouldEmit(block):
+%    if block.get('condition'):
+
+#if ${block.get('condition')}
+%    endif
+%    for func in block.findall('command'):
+<%
+    api = apisigs[func.get('name')]
+%>
+typedef ${api.RetType} (CL_API_CALL* ${api.Name}_clextfn)(
+%      for i, paramStr in enumerate(getCParameterStrings(api.Params)):
+%        if i < len(api.Params)-1:
+    ${paramStr},
+%        else:
+    ${paramStr});
+%        endif
+%      endfor
+%    endfor
+%    if block.get('condition'):
+
+#endif // ${block.get('condition')}
+%    endif
+%  endif
+%endfor
+%for probeExtension, probeFunction in probes:
+%  if not probeFunction in getFunctions(extension):
+<%
+    api = apisigs[probeFunction]
+%>
+#if defined(${probeExtension})
+typedef ${api.RetType} (CL_API_CALL* ${api.Name}_clextfn)(
+%      for i, paramStr in enumerate(getCParameterStrings(api.Params)):
+%        if i < len(api.Params)-1:
+    ${paramStr},
+%        else:
+    ${paramStr});
+%        endif
+%      endfor
+#endif // defined(${probeExtension})
+%  endif
+%endfor
+
+/***************************************************************
+* Extension Function Pointer Dispatch Table
+***************************************************************/
+
+// Each translation unit has its own dispatch table type.
+namespace {
+
+%if common:
+struct openclext_dispatch_table_common {
+%else:
+struct openclext_dispatch_table {
+    cl_platform_id platform;
+
+%endif
+%for block in extension.findall('require'):
+%  if shouldEmit(block):
+%    if block.get('condition'):
+#if ${block.get('condition')}
+%    endif
+%    for func in block.findall('command'):
+    ${func.get('name')}_clextfn ${func.get('name')};
+%    endfor
+%    if block.get('condition'):
+#endif // ${block.get('condition')}
+%    endif
+%  endif
+%endfor
+%for probeExtension, probeFunction in probes:
+%  if not probeFunction in getFunctions(extension):
+
+    // Used to find the dispatch table.
+#if defined(${probeExtension})
+    ${probeFunction}_clextfn ${probeFunction};
+#endif // defined(${probeExtension})
+%  endif
+%endfor
+};
+
+} // anonymous namespace
+
+/***************************************************************
+* Dispatch Table Initialization
+***************************************************************/
+
+%if common:
+static void _init_common(openclext_dispatch_table_common* dispatch_ptr)
+{
+    openclext_resolution* resolution = openclext_resolution_begin(nullptr);
+
+#define CLEXT_GET_EXTENSION(_funcname)                                         ${"\\"}
+    {                                                                          ${"\\"}
+        uint64_t start_ns = openclext_now_ns();                                ${"\\"}
+        CLEXT_COUNT_ICD_CALL();                                                ${"\\"}
+        dispatch_ptr->_funcname =                                              ${"\\"}
+            (_funcname##_clextfn)clGetExtensionFunctionAddress(#_funcname);    ${"\\"}
+        openclext_resolution_record(                                           ${"\\"}
+            resolution, #_funcname, (void*)dispatch_ptr->_funcname, start_ns); ${"\\"}
+    }
+%else:
+static void _init(cl_platform_id platform, openclext_dispatch_table* dispatch_ptr)
+{
+    dispatch_ptr->platform = platform;
+
+    openclext_resolution* resolution = openclext_resolution_begin(platform);
+
+#define CLEXT_GET_EXTENSION(_funcname)                                         ${"\\"}
+    {                                                                          ${"\\"}
+        uint64_t start_ns = openclext_now_ns();                                ${"\\"}
+        CLEXT_COUNT_ICD_CALL();                                                ${"\\"}
+        dispatch_ptr->_funcname =                                              ${"\\"}
+            (_funcname##_clextfn)clGetExtensionFunctionAddressForPlatform(     ${"\\"}
+                platform, #_funcname);                                         ${"\\"}
+        openclext_resolution_record(                                           ${"\\"}
+            resolution, #_funcname, (void*)dispatch_ptr->_funcname, start_ns); ${"\\"}
+    }
+%endif
+
+%for block in extension.findall('require'):
+%  if shouldEmit(block):
+%    if block.get('condition'):
+#if ${block.get('condition')}
+%    endif
+%    for func in block.findall('command'):
+    CLEXT_GET_EXTENSION(${func.get('name')});
+%    endfor
+%    if block.get('condition'):
+#endif // ${block.get('condition')}
+%    endif
+%  endif
+%endfor
+%for probeExtension, probeFunction in probes:
+%  if not probeFunction in getFunctions(extension):
+#if defined(${probeExtension})
+    CLEXT_GET_EXTENSION(${probeFunction});
+#endif // defined(${probeExtension})
+%  endif
+%endfor
+
+#undef CLEXT_GET_EXTENSION
+
+%if name == 'cl_intel_unified_shared_memory':
+${functions.usmEmulation(extension)}
+%endif
+    openclext_resolution_end(resolution);
+}
+
+%if common:
+static openclext_dispatch_table_common _dispatch_common = {};
+static openclext_dispatch_table_common* _dispatch_ptr_common = nullptr;
+
+static inline openclext_dispatch_table_common* _get_dispatch(void)
+{
+    if (_dispatch_ptr_common == nullptr) {
+        _init_common(&_dispatch_common);
+        _dispatch_ptr_common = &_dispatch_common;
+    }
+
+    return _dispatch_ptr_common;
+}
+
+static inline cl_platform_id _get_dispatch_platform(const openclext_dispatch_table_common*)
+{
+    return nullptr;
+}
+%else:
+#if defined(CLEXT_SINGLE_PLATFORM_ONLY)
+
+static openclext_dispatch_table _dispatch = {};
+static openclext_dispatch_table* _dispatch_ptr = nullptr;
+
+// The platform is shared by all translation units, so the dispatch table may
+// be initialized even if the platform cannot be found from the object.
+static inline openclext_dispatch_table* _init_dispatch(cl_platform_id platform)
+{
+    if (_dispatch_ptr == nullptr) {
+        platform = openclext_split_get_single_platform(platform);
+        if (platform == nullptr) {
+            return nullptr;
+        }
+        _init(platform, &_dispatch);
+        _dispatch_ptr = &_dispatch;
+    }
+
+    return _dispatch_ptr;
+}
+
+template<typename T>
+static inline openclext_dispatch_table* _get_dispatch(T object)
+{
+    if (object == nullptr) return nullptr;
+
+    if (_dispatch_ptr == nullptr) {
+        return _init_dispatch(_get_platform(object));
+    }
+
+    return _dispatch_ptr;
+}
+%for probeExtension, probeFunction in probes:
+<%
+    type = [t for t in probeFunctions if probeFunctions[t][1] == probeFunction][0]
+%>
+#if defined(${probeExtension})
+template<>
+inline openclext_dispatch_table* _get_dispatch<${type}>(${type} object)
+{
+    if (object == nullptr) return nullptr;
+
+    return _init_dispatch(nullptr);
+}
+#endif // defined(${probeExtension})
+%endfor
+
+#else // defined(CLEXT_SINGLE_PLATFORM_ONLY)
+
+static size_t _num_platforms = 0;
+static openclext_dispatch_table* _dispatch_array = nullptr;
+
+// The platforms are shared by all translation units, so the dispatch tables
+// may be initialized without an object.
+static inline void _init_dispatch(void)
+{
+    if (_num_platforms == 0 && _dispatch_array == nullptr) {
+        size_t numPlatforms = 0;
+        const cl_platform_id* platforms =
+            openclext_split_get_platforms(&numPlatforms);
+        if (numPlatforms == 0) {
+            return;
+        }
+
+        openclext_dispatch_table* dispatch =
+            (openclext_dispatch_table*)malloc(
+                numPlatforms * sizeof(openclext_dispatch_table));
+        if (dispatch == nullptr) {
+            return;
+        }
+
+        for (size_t i = 0; i < numPlatforms; i++) {
+            _init(platforms[i], dispatch + i);
+        }
+
+        _num_platforms = numPlatforms;
+        _dispatch_array = dispatch;
+    }
+}
+
+template<typename T>
+static inline openclext_dispatch_table* _get_dispatch(T object)
+{
+    _init_dispatch();
+
+    cl_platform_id platform = _get_platform(object);
+    for (size_t i = 0; i < _num_platforms; i++) {
+        openclext_dispatch_table* dispatch_ptr =
+            _dispatch_array + i;
+        if (dispatch_ptr->platform == platform) {
+            return dispatch_ptr;
+        }
+    }
+
+    return nullptr;
+}
+%for probeExtension, probeFunction in probes:
+<%
+    type = [t for t in probeFunctions if probeFunctions[t][1] == probeFunction][0]
+%>
+#if defined(${probeExtension})
+template<>
+inline openclext_dispatch_table* _get_dispatch<${type}>(${type} object)
+{
+    if (object == nullptr) return nullptr;
+
+    _init_dispatch();
+    if (_num_platforms <= 1) return _dispatch_array;
+
+    for (size_t i = 0; i < _num_platforms; i++) {
+        openclext_dispatch_table* dispatch_ptr =
+            _dispatch_array + i;
+        if (dispatch_ptr->${probeFunction}) {
+%  if type == 'cl_mutable_command_khr':
+            cl_command_buffer_khr cmdbuf = nullptr;
+            CLEXT_COUNT_ICD_CALL();
+            cl_int errorCode = dispatch_ptr->${probeFunction}(
+                object,
+                CL_MUTABLE_COMMAND_COMMAND_BUFFER_KHR,
+                sizeof(cmdbuf),
+                &cmdbuf,
+                nullptr);
+%  else:
+            cl_uint refCount = 0;
+            CLEXT_COUNT_ICD_CALL();
+            cl_int errorCode = dispatch_ptr->${probeFunction}(
+                object,
+                ${probeQueries[type]},
+                sizeof(refCount),
+                &refCount,
+                nullptr);
+%  endif
+            if (errorCode == CL_SUCCESS) {
+                return dispatch_ptr;
+            }
+        }
+    }
+
+    return nullptr;
+}
+#endif // defined(${probeExtension})
+%endfor
+
+#endif // defined(CLEXT_SINGLE_PLATFORM_ONLY)
+
+static inline cl_platform_id _get_dispatch_platform(const openclext_dispatch_table* dispatch_ptr)
+{
+    return dispatch_ptr ? dispatch_ptr->platform : nullptr;
+}
+%endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+* Extension Functions
+***************************************************************/
+%for block in extension.findall('require'):
+%  if shouldEmit(block):
+%    if block.get('condition'):
+
+#if ${block.get('condition')}
+%    endif
+%    for func in block.findall('command'):
+
+${functions.function(apisigs[func.get('name')], common)}\
+%    endfor
+%    if block.get('condition'):
+
+#endif // ${block.get('condition')}
+%    endif
+%  endif
+%endfor
+
+#ifdef __cplusplus
+}
+#endif
+
+#else
+#pragma message("Define for ${name} was not found!  Please update your headers.")
+#endif // defined(${name})
+%if getIfdefCondition(name):
+#endif // defined(${getIfdefCondition(name)})
+%endif
+%endif
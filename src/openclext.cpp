@@ -60,118 +60,21 @@
 #include <CL/cl_va_api_media_sharing_intel.h>
 #endif
 
+#include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <vector>
 
-static inline cl_platform_id _get_platform(cl_platform_id platform)
-{
-    return platform;
-}
-
-static inline cl_platform_id _get_platform(cl_device_id device)
-{
-    if (device == nullptr) return nullptr;
-
-    cl_platform_id platform = nullptr;
-    clGetDeviceInfo(
-        device,
-        CL_DEVICE_PLATFORM,
-        sizeof(platform),
-        &platform,
-        nullptr);
-    return platform;
-}
-
-static inline cl_platform_id _get_platform(cl_command_queue command_queue)
-{
-    if (command_queue == nullptr) return nullptr;
-
-    cl_device_id device = nullptr;
-    clGetCommandQueueInfo(
-        command_queue,
-        CL_QUEUE_DEVICE,
-        sizeof(device),
-        &device,
-        nullptr);
-    return _get_platform(device);
-}
-
-static inline cl_platform_id _get_platform(cl_context context)
-{
-    if (context == nullptr) return nullptr;
-
-    cl_uint numDevices = 0;
-    clGetContextInfo(
-        context,
-        CL_CONTEXT_NUM_DEVICES,
-        sizeof(numDevices),
-        &numDevices,
-        nullptr );
-
-    if (numDevices == 1) {  // fast path, no dynamic allocation
-        cl_device_id    device = nullptr;
-        clGetContextInfo(
-            context,
-            CL_CONTEXT_DEVICES,
-            sizeof(cl_device_id),
-            &device,
-            nullptr );
-        return _get_platform(device);
-    }
-
-    // slower path, dynamic allocation
-    std::vector<cl_device_id> devices(numDevices);
-    clGetContextInfo(
-        context,
-        CL_CONTEXT_DEVICES,
-        numDevices * sizeof(cl_device_id),
-        devices.data(),
-        nullptr );
-    return _get_platform(devices[0]);
-}
-
-static inline cl_platform_id _get_platform(cl_kernel kernel)
-{
-    if (kernel == nullptr) return nullptr;
-
-    cl_context context = nullptr;
-    clGetKernelInfo(
-        kernel,
-        CL_KERNEL_CONTEXT,
-        sizeof(context),
-        &context,
-        nullptr);
-    return _get_platform(context);
-}
-
-static inline cl_platform_id _get_platform(cl_mem memobj)
-{
-    if (memobj == nullptr) return nullptr;
-
-    cl_context context = nullptr;
-    clGetMemObjectInfo(
-        memobj,
-        CL_MEM_CONTEXT,
-        sizeof(context),
-        &context,
-        nullptr);
-    return _get_platform(context);
-}
-
-static inline cl_platform_id _get_platform(cl_event event)
-{
-    if (event == nullptr) return nullptr;
+#include "openclext.h"
+#include "openclext_hooks.h"
+#include "openclext_platform.h"
+#include "openclext_resolution.h"
 
-    cl_context context = nullptr;
-    clGetEventInfo(
-        event,
-        CL_EVENT_CONTEXT,
-        sizeof(context),
-        &context,
-        nullptr);
-    return _get_platform(context);
-}
+#if defined(CLEXT_INTERPOSER)
+#include "openclext_interposer.h"
+#endif
 
 /***************************************************************
 * Function Pointer Typedefs
@@ -1609,10 +1512,18 @@ static void _init(cl_platform_id platform, openclext_dispatch_table* dispatch_pt
 {
     dispatch_ptr->platform = platform;
 
+    openclext_resolution* resolution = openclext_resolution_begin(platform);
+
 #define CLEXT_GET_EXTENSION(_funcname)                                         \
-    dispatch_ptr->_funcname =                                                  \
-        (_funcname##_clextfn)clGetExtensionFunctionAddressForPlatform(         \
-            platform, #_funcname);
+    {                                                                          \
+        uint64_t start_ns = openclext_now_ns();                                \
+        CLEXT_COUNT_ICD_CALL();                                                \
+        dispatch_ptr->_funcname =                                              \
+            (_funcname##_clextfn)clGetExtensionFunctionAddressForPlatform(     \
+                platform, #_funcname);                                         \
+        openclext_resolution_record(                                           \
+            resolution, #_funcname, (void*)dispatch_ptr->_funcname, start_ns); \
+    }
 
 #if defined(cl_khr_command_buffer)
     CLEXT_GET_EXTENSION(clCreateCommandBufferKHR);
@@ -1873,19 +1784,56 @@ static void _init(cl_platform_id platform, openclext_dispatch_table* dispatch_pt
 #endif // defined(cl_qcom_ext_host_ptr)
 
 #undef CLEXT_GET_EXTENSION
+
+#if defined(cl_intel_unified_shared_memory)
+#if defined(CLEXT_ENABLE_USM_EMULATION)
+    // If the platform does not support unified shared memory, emulate it with
+    // SVM.  Either all of the functions are emulated or none of them are,
+    // except clMemBlockingFreeINTEL, which cannot wait for the commands that
+    // use SVM, so it is never emulated.
+    if (dispatch_ptr->clDeviceMemAllocINTEL == nullptr &&
+        openclext_usm_emulation_is_supported(platform)) {
+        dispatch_ptr->clHostMemAllocINTEL = openclext_usm_emulation_clHostMemAllocINTEL;
+        dispatch_ptr->clDeviceMemAllocINTEL = openclext_usm_emulation_clDeviceMemAllocINTEL;
+        dispatch_ptr->clSharedMemAllocINTEL = openclext_usm_emulation_clSharedMemAllocINTEL;
+        dispatch_ptr->clMemFreeINTEL = openclext_usm_emulation_clMemFreeINTEL;
+        dispatch_ptr->clGetMemAllocInfoINTEL = openclext_usm_emulation_clGetMemAllocInfoINTEL;
+        dispatch_ptr->clSetKernelArgMemPointerINTEL = openclext_usm_emulation_clSetKernelArgMemPointerINTEL;
+        dispatch_ptr->clEnqueueMemFillINTEL = openclext_usm_emulation_clEnqueueMemFillINTEL;
+        dispatch_ptr->clEnqueueMemcpyINTEL = openclext_usm_emulation_clEnqueueMemcpyINTEL;
+        dispatch_ptr->clEnqueueMemAdviseINTEL = openclext_usm_emulation_clEnqueueMemAdviseINTEL;
+#if defined(CL_VERSION_1_2)
+        dispatch_ptr->clEnqueueMigrateMemINTEL = openclext_usm_emulation_clEnqueueMigrateMemINTEL;
+#endif // defined(CL_VERSION_1_2)
+        dispatch_ptr->clEnqueueMemsetINTEL = openclext_usm_emulation_clEnqueueMemsetINTEL;
+    }
+#endif // defined(CLEXT_ENABLE_USM_EMULATION)
+#endif // defined(cl_intel_unified_shared_memory)
+
+    openclext_resolution_end(resolution);
 }
 
 static void _init_common(openclext_dispatch_table_common* dispatch_ptr)
 {
+    openclext_resolution* resolution = openclext_resolution_begin(nullptr);
+
 #define CLEXT_GET_EXTENSION(_funcname)                                         \
-    dispatch_ptr->_funcname =                                                  \
-        (_funcname##_clextfn)clGetExtensionFunctionAddress(#_funcname);
+    {                                                                          \
+        uint64_t start_ns = openclext_now_ns();                                \
+        CLEXT_COUNT_ICD_CALL();                                                \
+        dispatch_ptr->_funcname =                                              \
+            (_funcname##_clextfn)clGetExtensionFunctionAddress(#_funcname);    \
+        openclext_resolution_record(                                           \
+            resolution, #_funcname, (void*)dispatch_ptr->_funcname, start_ns); \
+    }
 
 #if defined(cl_loader_info)
     CLEXT_GET_EXTENSION(clGetICDLoaderInfoOCLICD);
 #endif // defined(cl_loader_info)
 
 #undef CLEXT_GET_EXTENSION
+
+    openclext_resolution_end(resolution);
 }
 
 #if defined(CLEXT_SINGLE_PLATFORM_ONLY)
@@ -1953,6 +1901,7 @@ static inline openclext_dispatch_table* _get_dispatch(T object)
 {
     if (_num_platforms == 0 && _dispatch_array == nullptr) {
         cl_uint numPlatforms = 0;
+        CLEXT_COUNT_ICD_CALL();
         clGetPlatformIDs(0, nullptr, &numPlatforms);
         if (numPlatforms == 0) {
             return nullptr;
@@ -1966,6 +1915,7 @@ static inline openclext_dispatch_table* _get_dispatch(T object)
         }
 
         std::vector<cl_platform_id> platforms(numPlatforms);
+        CLEXT_COUNT_ICD_CALL();
         clGetPlatformIDs(numPlatforms, platforms.data(), nullptr);
 
         for (size_t i = 0; i < numPlatforms; i++) {
@@ -2005,6 +1955,7 @@ inline openclext_dispatch_table* _get_dispatch<cl_semaphore_khr>(cl_semaphore_kh
             _dispatch_array + i;
         if (dispatch_ptr->clGetSemaphoreInfoKHR) {
             cl_uint refCount = 0;
+            CLEXT_COUNT_ICD_CALL();
             cl_int errorCode = dispatch_ptr->clGetSemaphoreInfoKHR(
                 semaphore,
                 CL_SEMAPHORE_REFERENCE_COUNT_KHR,
@@ -2033,6 +1984,7 @@ inline openclext_dispatch_table* _get_dispatch<cl_command_buffer_khr>(cl_command
             _dispatch_array + i;
         if (dispatch_ptr->clGetCommandBufferInfoKHR) {
             cl_uint refCount = 0;
+            CLEXT_COUNT_ICD_CALL();
             cl_int errorCode = dispatch_ptr->clGetCommandBufferInfoKHR(
                 cmdbuf,
                 CL_COMMAND_BUFFER_REFERENCE_COUNT_KHR,
@@ -2063,6 +2015,7 @@ inline openclext_dispatch_table* _get_dispatch<cl_mutable_command_khr>(cl_mutabl
             // Alternatively, this could query the command queue from the
             // command, then get the dispatch table from the command queue.
             cl_command_buffer_khr cmdbuf = nullptr;
+            CLEXT_COUNT_ICD_CALL();
             cl_int errorCode = dispatch_ptr->clGetMutableCommandInfoKHR(
                 command,
                 CL_MUTABLE_COMMAND_COMMAND_BUFFER_KHR,
@@ -2091,6 +2044,7 @@ inline openclext_dispatch_table* _get_dispatch<cl_accelerator_intel>(cl_accelera
             _dispatch_array + i;
         if (dispatch_ptr->clGetAcceleratorInfoINTEL) {
             cl_uint refCount = 0;
+            CLEXT_COUNT_ICD_CALL();
             cl_int errorCode = dispatch_ptr->clGetAcceleratorInfoINTEL(
                 accelerator,
                 CL_ACCELERATOR_REFERENCE_COUNT_INTEL,
@@ -2122,961 +2076,2040 @@ static inline openclext_dispatch_table_common* _get_dispatch(void)
     return _dispatch_ptr_common;
 }
 
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/***************************************************************
-* Extension Functions
-***************************************************************/
-
-#if defined(cl_khr_command_buffer)
-
-cl_command_buffer_khr CL_API_CALL clCreateCommandBufferKHR(
-    cl_uint num_queues,
-    const cl_command_queue* queues,
-    const cl_command_buffer_properties_khr* properties,
-    cl_int* errcode_ret)
+static inline cl_platform_id _get_dispatch_platform(const openclext_dispatch_table* dispatch_ptr)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(num_queues > 0 && queues ? queues[0] : nullptr);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateCommandBufferKHR == nullptr) {
-        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
-        return nullptr;
-    }
-    return dispatch_ptr->clCreateCommandBufferKHR(
-        num_queues,
-        queues,
-        properties,
-        errcode_ret);
+    return dispatch_ptr ? dispatch_ptr->platform : nullptr;
 }
 
-cl_int CL_API_CALL clFinalizeCommandBufferKHR(
-    cl_command_buffer_khr command_buffer)
+static inline cl_platform_id _get_dispatch_platform(const openclext_dispatch_table_common*)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clFinalizeCommandBufferKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clFinalizeCommandBufferKHR(
-        command_buffer);
+    return nullptr;
 }
 
-cl_int CL_API_CALL clRetainCommandBufferKHR(
-    cl_command_buffer_khr command_buffer)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clRetainCommandBufferKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clRetainCommandBufferKHR(
-        command_buffer);
-}
+#if defined(CLEXT_COMPACT_DISPATCH)
 
-cl_int CL_API_CALL clReleaseCommandBufferKHR(
-    cl_command_buffer_khr command_buffer)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clReleaseCommandBufferKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clReleaseCommandBufferKHR(
-        command_buffer);
-}
+/***************************************************************
+* Compact Dispatch
+***************************************************************/
 
-cl_int CL_API_CALL clEnqueueCommandBufferKHR(
-    cl_uint num_queues,
-    cl_command_queue* queues,
-    cl_command_buffer_khr command_buffer,
-    cl_uint num_events_in_wait_list,
-    const cl_event* event_wait_list,
-    cl_event* event)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueCommandBufferKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clEnqueueCommandBufferKHR(
-        num_queues,
-        queues,
-        command_buffer,
-        num_events_in_wait_list,
-        event_wait_list,
-        event);
-}
+// With compact dispatch, each extension function is a small stub that passes
+// its index in the function information table and its dispatch handle to a
+// shared resolver, rather than finding the dispatch table itself.
 
-cl_int CL_API_CALL clCommandBarrierWithWaitListKHR(
-    cl_command_buffer_khr command_buffer,
-    cl_command_queue command_queue,
-    const cl_command_properties_khr* properties,
-    cl_uint num_sync_points_in_wait_list,
-    const cl_sync_point_khr* sync_point_wait_list,
-    cl_sync_point_khr* sync_point,
-    cl_mutable_command_khr* mutable_handle)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandBarrierWithWaitListKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clCommandBarrierWithWaitListKHR(
-        command_buffer,
-        command_queue,
-        properties,
-        num_sync_points_in_wait_list,
-        sync_point_wait_list,
-        sync_point,
-        mutable_handle);
-}
+enum openclext_function_index {
+#if defined(cl_khr_command_buffer)
+    CLEXT_FUNCTION_clCreateCommandBufferKHR,
+    CLEXT_FUNCTION_clFinalizeCommandBufferKHR,
+    CLEXT_FUNCTION_clRetainCommandBufferKHR,
+    CLEXT_FUNCTION_clReleaseCommandBufferKHR,
+    CLEXT_FUNCTION_clEnqueueCommandBufferKHR,
+    CLEXT_FUNCTION_clCommandBarrierWithWaitListKHR,
+    CLEXT_FUNCTION_clCommandCopyBufferKHR,
+    CLEXT_FUNCTION_clCommandCopyBufferRectKHR,
+    CLEXT_FUNCTION_clCommandCopyBufferToImageKHR,
+    CLEXT_FUNCTION_clCommandCopyImageKHR,
+    CLEXT_FUNCTION_clCommandCopyImageToBufferKHR,
+    CLEXT_FUNCTION_clCommandFillBufferKHR,
+    CLEXT_FUNCTION_clCommandFillImageKHR,
+    CLEXT_FUNCTION_clCommandNDRangeKernelKHR,
+    CLEXT_FUNCTION_clGetCommandBufferInfoKHR,
+    CLEXT_FUNCTION_clCommandSVMMemcpyKHR,
+    CLEXT_FUNCTION_clCommandSVMMemFillKHR,
+#endif // defined(cl_khr_command_buffer)
+#if defined(cl_khr_command_buffer_multi_device)
+    CLEXT_FUNCTION_clRemapCommandBufferKHR,
+#endif // defined(cl_khr_command_buffer_multi_device)
+#if defined(cl_khr_command_buffer_mutable_dispatch)
+    CLEXT_FUNCTION_clUpdateMutableCommandsKHR,
+    CLEXT_FUNCTION_clGetMutableCommandInfoKHR,
+#endif // defined(cl_khr_command_buffer_mutable_dispatch)
+#if defined(cl_khr_create_command_queue)
+    CLEXT_FUNCTION_clCreateCommandQueueWithPropertiesKHR,
+#endif // defined(cl_khr_create_command_queue)
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_khr_d3d10_sharing)
+    CLEXT_FUNCTION_clGetDeviceIDsFromD3D10KHR,
+    CLEXT_FUNCTION_clCreateFromD3D10BufferKHR,
+    CLEXT_FUNCTION_clCreateFromD3D10Texture2DKHR,
+    CLEXT_FUNCTION_clCreateFromD3D10Texture3DKHR,
+    CLEXT_FUNCTION_clEnqueueAcquireD3D10ObjectsKHR,
+    CLEXT_FUNCTION_clEnqueueReleaseD3D10ObjectsKHR,
+#endif // defined(cl_khr_d3d10_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_khr_d3d11_sharing)
+    CLEXT_FUNCTION_clGetDeviceIDsFromD3D11KHR,
+    CLEXT_FUNCTION_clCreateFromD3D11BufferKHR,
+    CLEXT_FUNCTION_clCreateFromD3D11Texture2DKHR,
+    CLEXT_FUNCTION_clCreateFromD3D11Texture3DKHR,
+    CLEXT_FUNCTION_clEnqueueAcquireD3D11ObjectsKHR,
+    CLEXT_FUNCTION_clEnqueueReleaseD3D11ObjectsKHR,
+#endif // defined(cl_khr_d3d11_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_khr_dx9_media_sharing)
+    CLEXT_FUNCTION_clGetDeviceIDsFromDX9MediaAdapterKHR,
+    CLEXT_FUNCTION_clCreateFromDX9MediaSurfaceKHR,
+    CLEXT_FUNCTION_clEnqueueAcquireDX9MediaSurfacesKHR,
+    CLEXT_FUNCTION_clEnqueueReleaseDX9MediaSurfacesKHR,
+#endif // defined(cl_khr_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_event)
+    CLEXT_FUNCTION_clCreateEventFromEGLSyncKHR,
+#endif // defined(cl_khr_egl_event)
+#endif // defined(CLEXT_INCLUDE_EGL)
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_image)
+    CLEXT_FUNCTION_clCreateFromEGLImageKHR,
+    CLEXT_FUNCTION_clEnqueueAcquireEGLObjectsKHR,
+    CLEXT_FUNCTION_clEnqueueReleaseEGLObjectsKHR,
+#endif // defined(cl_khr_egl_image)
+#endif // defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_external_memory)
+    CLEXT_FUNCTION_clEnqueueAcquireExternalMemObjectsKHR,
+    CLEXT_FUNCTION_clEnqueueReleaseExternalMemObjectsKHR,
+#endif // defined(cl_khr_external_memory)
+#if defined(cl_khr_external_semaphore)
+    CLEXT_FUNCTION_clGetSemaphoreHandleForTypeKHR,
+#endif // defined(cl_khr_external_semaphore)
+#if defined(cl_khr_external_semaphore_sync_fd)
+    CLEXT_FUNCTION_clReImportSemaphoreSyncFdKHR,
+#endif // defined(cl_khr_external_semaphore_sync_fd)
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_khr_gl_event)
+    CLEXT_FUNCTION_clCreateEventFromGLsyncKHR,
+#endif // defined(cl_khr_gl_event)
+#endif // defined(CLEXT_INCLUDE_GL)
+#if defined(cl_khr_il_program)
+    CLEXT_FUNCTION_clCreateProgramWithILKHR,
+#endif // defined(cl_khr_il_program)
+#if defined(cl_khr_semaphore)
+    CLEXT_FUNCTION_clCreateSemaphoreWithPropertiesKHR,
+    CLEXT_FUNCTION_clEnqueueWaitSemaphoresKHR,
+    CLEXT_FUNCTION_clEnqueueSignalSemaphoresKHR,
+    CLEXT_FUNCTION_clGetSemaphoreInfoKHR,
+    CLEXT_FUNCTION_clReleaseSemaphoreKHR,
+    CLEXT_FUNCTION_clRetainSemaphoreKHR,
+#endif // defined(cl_khr_semaphore)
+#if defined(cl_khr_subgroups)
+    CLEXT_FUNCTION_clGetKernelSubGroupInfoKHR,
+#endif // defined(cl_khr_subgroups)
+#if defined(cl_khr_suggested_local_work_size)
+    CLEXT_FUNCTION_clGetKernelSuggestedLocalWorkSizeKHR,
+#endif // defined(cl_khr_suggested_local_work_size)
+#if defined(cl_khr_terminate_context)
+    CLEXT_FUNCTION_clTerminateContextKHR,
+#endif // defined(cl_khr_terminate_context)
+#if defined(cl_ext_buffer_device_address)
+    CLEXT_FUNCTION_clSetKernelArgDevicePointerEXT,
+#endif // defined(cl_ext_buffer_device_address)
+#if defined(cl_ext_device_fission)
+    CLEXT_FUNCTION_clReleaseDeviceEXT,
+    CLEXT_FUNCTION_clRetainDeviceEXT,
+    CLEXT_FUNCTION_clCreateSubDevicesEXT,
+#endif // defined(cl_ext_device_fission)
+#if defined(cl_ext_image_requirements_info)
+    CLEXT_FUNCTION_clGetImageRequirementsInfoEXT,
+#endif // defined(cl_ext_image_requirements_info)
+#if defined(cl_ext_migrate_memobject)
+    CLEXT_FUNCTION_clEnqueueMigrateMemObjectEXT,
+#endif // defined(cl_ext_migrate_memobject)
+#if defined(cl_arm_import_memory)
+    CLEXT_FUNCTION_clImportMemoryARM,
+#endif // defined(cl_arm_import_memory)
+#if defined(cl_arm_shared_virtual_memory)
+    CLEXT_FUNCTION_clSVMAllocARM,
+    CLEXT_FUNCTION_clSVMFreeARM,
+    CLEXT_FUNCTION_clEnqueueSVMFreeARM,
+    CLEXT_FUNCTION_clEnqueueSVMMemcpyARM,
+    CLEXT_FUNCTION_clEnqueueSVMMemFillARM,
+    CLEXT_FUNCTION_clEnqueueSVMMapARM,
+    CLEXT_FUNCTION_clEnqueueSVMUnmapARM,
+    CLEXT_FUNCTION_clSetKernelArgSVMPointerARM,
+    CLEXT_FUNCTION_clSetKernelExecInfoARM,
+#endif // defined(cl_arm_shared_virtual_memory)
+#if defined(cl_img_cancel_command)
+    CLEXT_FUNCTION_clCancelCommandsIMG,
+#endif // defined(cl_img_cancel_command)
+#if defined(cl_img_generate_mipmap)
+    CLEXT_FUNCTION_clEnqueueGenerateMipmapIMG,
+#endif // defined(cl_img_generate_mipmap)
+#if defined(cl_img_use_gralloc_ptr)
+    CLEXT_FUNCTION_clEnqueueAcquireGrallocObjectsIMG,
+    CLEXT_FUNCTION_clEnqueueReleaseGrallocObjectsIMG,
+#endif // defined(cl_img_use_gralloc_ptr)
+#if defined(cl_intel_accelerator)
+    CLEXT_FUNCTION_clCreateAcceleratorINTEL,
+    CLEXT_FUNCTION_clGetAcceleratorInfoINTEL,
+    CLEXT_FUNCTION_clRetainAcceleratorINTEL,
+    CLEXT_FUNCTION_clReleaseAcceleratorINTEL,
+#endif // defined(cl_intel_accelerator)
+#if defined(cl_intel_create_buffer_with_properties)
+    CLEXT_FUNCTION_clCreateBufferWithPropertiesINTEL,
+#endif // defined(cl_intel_create_buffer_with_properties)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_dx9_media_sharing)
+    CLEXT_FUNCTION_clGetDeviceIDsFromDX9INTEL,
+    CLEXT_FUNCTION_clCreateFromDX9MediaSurfaceINTEL,
+    CLEXT_FUNCTION_clEnqueueAcquireDX9ObjectsINTEL,
+    CLEXT_FUNCTION_clEnqueueReleaseDX9ObjectsINTEL,
+#endif // defined(cl_intel_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_program_scope_host_pipe)
+    CLEXT_FUNCTION_clEnqueueReadHostPipeINTEL,
+    CLEXT_FUNCTION_clEnqueueWriteHostPipeINTEL,
+#endif // defined(cl_intel_program_scope_host_pipe)
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_intel_sharing_format_query_d3d10)
+    CLEXT_FUNCTION_clGetSupportedD3D10TextureFormatsINTEL,
+#endif // defined(cl_intel_sharing_format_query_d3d10)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_intel_sharing_format_query_d3d11)
+    CLEXT_FUNCTION_clGetSupportedD3D11TextureFormatsINTEL,
+#endif // defined(cl_intel_sharing_format_query_d3d11)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_sharing_format_query_dx9)
+    CLEXT_FUNCTION_clGetSupportedDX9MediaSurfaceFormatsINTEL,
+#endif // defined(cl_intel_sharing_format_query_dx9)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_intel_sharing_format_query_gl)
+    CLEXT_FUNCTION_clGetSupportedGLTextureFormatsINTEL,
+#endif // defined(cl_intel_sharing_format_query_gl)
+#endif // defined(CLEXT_INCLUDE_GL)
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_sharing_format_query_va_api)
+    CLEXT_FUNCTION_clGetSupportedVA_APIMediaSurfaceFormatsINTEL,
+#endif // defined(cl_intel_sharing_format_query_va_api)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_unified_shared_memory)
+    CLEXT_FUNCTION_clHostMemAllocINTEL,
+    CLEXT_FUNCTION_clDeviceMemAllocINTEL,
+    CLEXT_FUNCTION_clSharedMemAllocINTEL,
+    CLEXT_FUNCTION_clMemFreeINTEL,
+    CLEXT_FUNCTION_clMemBlockingFreeINTEL,
+    CLEXT_FUNCTION_clGetMemAllocInfoINTEL,
+    CLEXT_FUNCTION_clSetKernelArgMemPointerINTEL,
+    CLEXT_FUNCTION_clEnqueueMemFillINTEL,
+    CLEXT_FUNCTION_clEnqueueMemcpyINTEL,
+    CLEXT_FUNCTION_clEnqueueMemAdviseINTEL,
+#if defined(CL_VERSION_1_2)
+    CLEXT_FUNCTION_clEnqueueMigrateMemINTEL,
+#endif // defined(CL_VERSION_1_2)
+    CLEXT_FUNCTION_clEnqueueMemsetINTEL,
+#endif // defined(cl_intel_unified_shared_memory)
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_va_api_media_sharing)
+    CLEXT_FUNCTION_clGetDeviceIDsFromVA_APIMediaAdapterINTEL,
+    CLEXT_FUNCTION_clCreateFromVA_APIMediaSurfaceINTEL,
+    CLEXT_FUNCTION_clEnqueueAcquireVA_APIMediaSurfacesINTEL,
+    CLEXT_FUNCTION_clEnqueueReleaseVA_APIMediaSurfacesINTEL,
+#endif // defined(cl_intel_va_api_media_sharing)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_loader_info)
+    CLEXT_FUNCTION_clGetICDLoaderInfoOCLICD,
+#endif // defined(cl_loader_info)
+#if defined(cl_pocl_content_size)
+    CLEXT_FUNCTION_clSetContentSizeBufferPoCL,
+#endif // defined(cl_pocl_content_size)
+#if defined(cl_qcom_ext_host_ptr)
+    CLEXT_FUNCTION_clGetDeviceImageInfoQCOM,
+#endif // defined(cl_qcom_ext_host_ptr)
+    CLEXT_FUNCTION_COUNT
+};
 
-cl_int CL_API_CALL clCommandCopyBufferKHR(
-    cl_command_buffer_khr command_buffer,
-    cl_command_queue command_queue,
-    const cl_command_properties_khr* properties,
-    cl_mem src_buffer,
-    cl_mem dst_buffer,
-    size_t src_offset,
-    size_t dst_offset,
-    size_t size,
-    cl_uint num_sync_points_in_wait_list,
-    const cl_sync_point_khr* sync_point_wait_list,
-    cl_sync_point_khr* sync_point,
-    cl_mutable_command_khr* mutable_handle)
+// How to find the dispatch table from the dispatch handle.
+enum openclext_handle_kind : uint8_t {
+    CLEXT_HANDLE_COMMON,
+    CLEXT_HANDLE_PLATFORM,
+    CLEXT_HANDLE_DEVICE,
+    CLEXT_HANDLE_CONTEXT,
+    CLEXT_HANDLE_COMMAND_QUEUE,
+    CLEXT_HANDLE_MEM,
+    CLEXT_HANDLE_KERNEL,
+    CLEXT_HANDLE_EVENT,
+    CLEXT_HANDLE_SEMAPHORE,
+    CLEXT_HANDLE_COMMAND_BUFFER,
+    CLEXT_HANDLE_MUTABLE_COMMAND,
+    CLEXT_HANDLE_ACCELERATOR,
+};
+
+// How an unsupported extension function returns an error.
+enum openclext_error_kind : uint8_t {
+    CLEXT_ERROR_STATUS,     // returns CL_INVALID_OPERATION
+    CLEXT_ERROR_ERRCODE,    // sets errcode_ret and returns nullptr
+    CLEXT_ERROR_NULL,       // returns nullptr
+    CLEXT_ERROR_VOID,       // returns nothing
+};
+
+struct openclext_function_info {
+    uint16_t offset;        // offset of the function in the dispatch table
+    openclext_handle_kind handle;
+    openclext_error_kind error;
+};
+
+static const openclext_function_info _function_info[] = {
+#if defined(cl_khr_command_buffer)
+    { offsetof(openclext_dispatch_table, clCreateCommandBufferKHR), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_ERRCODE },
+    { offsetof(openclext_dispatch_table, clFinalizeCommandBufferKHR), CLEXT_HANDLE_COMMAND_BUFFER, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clRetainCommandBufferKHR), CLEXT_HANDLE_COMMAND_BUFFER, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clReleaseCommandBufferKHR), CLEXT_HANDLE_COMMAND_BUFFER, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clEnqueueCommandBufferKHR), CLEXT_HANDLE_COMMAND_BUFFER, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clCommandBarrierWithWaitListKHR), CLEXT_HANDLE_COMMAND_BUFFER, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clCommandCopyBufferKHR), CLEXT_HANDLE_COMMAND_BUFFER, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clCommandCopyBufferRectKHR), CLEXT_HANDLE_COMMAND_BUFFER, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clCommandCopyBufferToImageKHR), CLEXT_HANDLE_COMMAND_BUFFER, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clCommandCopyImageKHR), CLEXT_HANDLE_COMMAND_BUFFER, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clCommandCopyImageToBufferKHR), CLEXT_HANDLE_COMMAND_BUFFER, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clCommandFillBufferKHR), CLEXT_HANDLE_COMMAND_BUFFER, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clCommandFillImageKHR), CLEXT_HANDLE_COMMAND_BUFFER, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clCommandNDRangeKernelKHR), CLEXT_HANDLE_COMMAND_BUFFER, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clGetCommandBufferInfoKHR), CLEXT_HANDLE_COMMAND_BUFFER, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clCommandSVMMemcpyKHR), CLEXT_HANDLE_COMMAND_BUFFER, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clCommandSVMMemFillKHR), CLEXT_HANDLE_COMMAND_BUFFER, CLEXT_ERROR_STATUS },
+#endif // defined(cl_khr_command_buffer)
+#if defined(cl_khr_command_buffer_multi_device)
+    { offsetof(openclext_dispatch_table, clRemapCommandBufferKHR), CLEXT_HANDLE_COMMAND_BUFFER, CLEXT_ERROR_ERRCODE },
+#endif // defined(cl_khr_command_buffer_multi_device)
+#if defined(cl_khr_command_buffer_mutable_dispatch)
+    { offsetof(openclext_dispatch_table, clUpdateMutableCommandsKHR), CLEXT_HANDLE_COMMAND_BUFFER, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clGetMutableCommandInfoKHR), CLEXT_HANDLE_MUTABLE_COMMAND, CLEXT_ERROR_STATUS },
+#endif // defined(cl_khr_command_buffer_mutable_dispatch)
+#if defined(cl_khr_create_command_queue)
+    { offsetof(openclext_dispatch_table, clCreateCommandQueueWithPropertiesKHR), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+#endif // defined(cl_khr_create_command_queue)
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_khr_d3d10_sharing)
+    { offsetof(openclext_dispatch_table, clGetDeviceIDsFromD3D10KHR), CLEXT_HANDLE_PLATFORM, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clCreateFromD3D10BufferKHR), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+    { offsetof(openclext_dispatch_table, clCreateFromD3D10Texture2DKHR), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+    { offsetof(openclext_dispatch_table, clCreateFromD3D10Texture3DKHR), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+    { offsetof(openclext_dispatch_table, clEnqueueAcquireD3D10ObjectsKHR), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clEnqueueReleaseD3D10ObjectsKHR), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+#endif // defined(cl_khr_d3d10_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_khr_d3d11_sharing)
+    { offsetof(openclext_dispatch_table, clGetDeviceIDsFromD3D11KHR), CLEXT_HANDLE_PLATFORM, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clCreateFromD3D11BufferKHR), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+    { offsetof(openclext_dispatch_table, clCreateFromD3D11Texture2DKHR), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+    { offsetof(openclext_dispatch_table, clCreateFromD3D11Texture3DKHR), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+    { offsetof(openclext_dispatch_table, clEnqueueAcquireD3D11ObjectsKHR), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clEnqueueReleaseD3D11ObjectsKHR), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+#endif // defined(cl_khr_d3d11_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_khr_dx9_media_sharing)
+    { offsetof(openclext_dispatch_table, clGetDeviceIDsFromDX9MediaAdapterKHR), CLEXT_HANDLE_PLATFORM, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clCreateFromDX9MediaSurfaceKHR), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+    { offsetof(openclext_dispatch_table, clEnqueueAcquireDX9MediaSurfacesKHR), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clEnqueueReleaseDX9MediaSurfacesKHR), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+#endif // defined(cl_khr_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_event)
+    { offsetof(openclext_dispatch_table, clCreateEventFromEGLSyncKHR), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+#endif // defined(cl_khr_egl_event)
+#endif // defined(CLEXT_INCLUDE_EGL)
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_image)
+    { offsetof(openclext_dispatch_table, clCreateFromEGLImageKHR), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+    { offsetof(openclext_dispatch_table, clEnqueueAcquireEGLObjectsKHR), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clEnqueueReleaseEGLObjectsKHR), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+#endif // defined(cl_khr_egl_image)
+#endif // defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_external_memory)
+    { offsetof(openclext_dispatch_table, clEnqueueAcquireExternalMemObjectsKHR), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clEnqueueReleaseExternalMemObjectsKHR), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+#endif // defined(cl_khr_external_memory)
+#if defined(cl_khr_external_semaphore)
+    { offsetof(openclext_dispatch_table, clGetSemaphoreHandleForTypeKHR), CLEXT_HANDLE_SEMAPHORE, CLEXT_ERROR_STATUS },
+#endif // defined(cl_khr_external_semaphore)
+#if defined(cl_khr_external_semaphore_sync_fd)
+    { offsetof(openclext_dispatch_table, clReImportSemaphoreSyncFdKHR), CLEXT_HANDLE_SEMAPHORE, CLEXT_ERROR_STATUS },
+#endif // defined(cl_khr_external_semaphore_sync_fd)
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_khr_gl_event)
+    { offsetof(openclext_dispatch_table, clCreateEventFromGLsyncKHR), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+#endif // defined(cl_khr_gl_event)
+#endif // defined(CLEXT_INCLUDE_GL)
+#if defined(cl_khr_il_program)
+    { offsetof(openclext_dispatch_table, clCreateProgramWithILKHR), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+#endif // defined(cl_khr_il_program)
+#if defined(cl_khr_semaphore)
+    { offsetof(openclext_dispatch_table, clCreateSemaphoreWithPropertiesKHR), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+    { offsetof(openclext_dispatch_table, clEnqueueWaitSemaphoresKHR), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clEnqueueSignalSemaphoresKHR), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clGetSemaphoreInfoKHR), CLEXT_HANDLE_SEMAPHORE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clReleaseSemaphoreKHR), CLEXT_HANDLE_SEMAPHORE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clRetainSemaphoreKHR), CLEXT_HANDLE_SEMAPHORE, CLEXT_ERROR_STATUS },
+#endif // defined(cl_khr_semaphore)
+#if defined(cl_khr_subgroups)
+    { offsetof(openclext_dispatch_table, clGetKernelSubGroupInfoKHR), CLEXT_HANDLE_KERNEL, CLEXT_ERROR_STATUS },
+#endif // defined(cl_khr_subgroups)
+#if defined(cl_khr_suggested_local_work_size)
+    { offsetof(openclext_dispatch_table, clGetKernelSuggestedLocalWorkSizeKHR), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+#endif // defined(cl_khr_suggested_local_work_size)
+#if defined(cl_khr_terminate_context)
+    { offsetof(openclext_dispatch_table, clTerminateContextKHR), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_STATUS },
+#endif // defined(cl_khr_terminate_context)
+#if defined(cl_ext_buffer_device_address)
+    { offsetof(openclext_dispatch_table, clSetKernelArgDevicePointerEXT), CLEXT_HANDLE_KERNEL, CLEXT_ERROR_STATUS },
+#endif // defined(cl_ext_buffer_device_address)
+#if defined(cl_ext_device_fission)
+    { offsetof(openclext_dispatch_table, clReleaseDeviceEXT), CLEXT_HANDLE_DEVICE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clRetainDeviceEXT), CLEXT_HANDLE_DEVICE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clCreateSubDevicesEXT), CLEXT_HANDLE_DEVICE, CLEXT_ERROR_STATUS },
+#endif // defined(cl_ext_device_fission)
+#if defined(cl_ext_image_requirements_info)
+    { offsetof(openclext_dispatch_table, clGetImageRequirementsInfoEXT), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_STATUS },
+#endif // defined(cl_ext_image_requirements_info)
+#if defined(cl_ext_migrate_memobject)
+    { offsetof(openclext_dispatch_table, clEnqueueMigrateMemObjectEXT), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+#endif // defined(cl_ext_migrate_memobject)
+#if defined(cl_arm_import_memory)
+    { offsetof(openclext_dispatch_table, clImportMemoryARM), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+#endif // defined(cl_arm_import_memory)
+#if defined(cl_arm_shared_virtual_memory)
+    { offsetof(openclext_dispatch_table, clSVMAllocARM), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_NULL },
+    { offsetof(openclext_dispatch_table, clSVMFreeARM), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_VOID },
+    { offsetof(openclext_dispatch_table, clEnqueueSVMFreeARM), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clEnqueueSVMMemcpyARM), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clEnqueueSVMMemFillARM), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clEnqueueSVMMapARM), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clEnqueueSVMUnmapARM), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clSetKernelArgSVMPointerARM), CLEXT_HANDLE_KERNEL, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clSetKernelExecInfoARM), CLEXT_HANDLE_KERNEL, CLEXT_ERROR_STATUS },
+#endif // defined(cl_arm_shared_virtual_memory)
+#if defined(cl_img_cancel_command)
+    { offsetof(openclext_dispatch_table, clCancelCommandsIMG), CLEXT_HANDLE_EVENT, CLEXT_ERROR_STATUS },
+#endif // defined(cl_img_cancel_command)
+#if defined(cl_img_generate_mipmap)
+    { offsetof(openclext_dispatch_table, clEnqueueGenerateMipmapIMG), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+#endif // defined(cl_img_generate_mipmap)
+#if defined(cl_img_use_gralloc_ptr)
+    { offsetof(openclext_dispatch_table, clEnqueueAcquireGrallocObjectsIMG), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clEnqueueReleaseGrallocObjectsIMG), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+#endif // defined(cl_img_use_gralloc_ptr)
+#if defined(cl_intel_accelerator)
+    { offsetof(openclext_dispatch_table, clCreateAcceleratorINTEL), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+    { offsetof(openclext_dispatch_table, clGetAcceleratorInfoINTEL), CLEXT_HANDLE_ACCELERATOR, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clRetainAcceleratorINTEL), CLEXT_HANDLE_ACCELERATOR, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clReleaseAcceleratorINTEL), CLEXT_HANDLE_ACCELERATOR, CLEXT_ERROR_STATUS },
+#endif // defined(cl_intel_accelerator)
+#if defined(cl_intel_create_buffer_with_properties)
+    { offsetof(openclext_dispatch_table, clCreateBufferWithPropertiesINTEL), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+#endif // defined(cl_intel_create_buffer_with_properties)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_dx9_media_sharing)
+    { offsetof(openclext_dispatch_table, clGetDeviceIDsFromDX9INTEL), CLEXT_HANDLE_PLATFORM, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clCreateFromDX9MediaSurfaceINTEL), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+    { offsetof(openclext_dispatch_table, clEnqueueAcquireDX9ObjectsINTEL), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clEnqueueReleaseDX9ObjectsINTEL), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+#endif // defined(cl_intel_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_program_scope_host_pipe)
+    { offsetof(openclext_dispatch_table, clEnqueueReadHostPipeINTEL), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clEnqueueWriteHostPipeINTEL), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+#endif // defined(cl_intel_program_scope_host_pipe)
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_intel_sharing_format_query_d3d10)
+    { offsetof(openclext_dispatch_table, clGetSupportedD3D10TextureFormatsINTEL), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_STATUS },
+#endif // defined(cl_intel_sharing_format_query_d3d10)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_intel_sharing_format_query_d3d11)
+    { offsetof(openclext_dispatch_table, clGetSupportedD3D11TextureFormatsINTEL), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_STATUS },
+#endif // defined(cl_intel_sharing_format_query_d3d11)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_sharing_format_query_dx9)
+    { offsetof(openclext_dispatch_table, clGetSupportedDX9MediaSurfaceFormatsINTEL), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_STATUS },
+#endif // defined(cl_intel_sharing_format_query_dx9)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_intel_sharing_format_query_gl)
+    { offsetof(openclext_dispatch_table, clGetSupportedGLTextureFormatsINTEL), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_STATUS },
+#endif // defined(cl_intel_sharing_format_query_gl)
+#endif // defined(CLEXT_INCLUDE_GL)
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_sharing_format_query_va_api)
+    { offsetof(openclext_dispatch_table, clGetSupportedVA_APIMediaSurfaceFormatsINTEL), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_STATUS },
+#endif // defined(cl_intel_sharing_format_query_va_api)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_unified_shared_memory)
+    { offsetof(openclext_dispatch_table, clHostMemAllocINTEL), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+    { offsetof(openclext_dispatch_table, clDeviceMemAllocINTEL), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+    { offsetof(openclext_dispatch_table, clSharedMemAllocINTEL), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+    { offsetof(openclext_dispatch_table, clMemFreeINTEL), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clMemBlockingFreeINTEL), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clGetMemAllocInfoINTEL), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clSetKernelArgMemPointerINTEL), CLEXT_HANDLE_KERNEL, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clEnqueueMemFillINTEL), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clEnqueueMemcpyINTEL), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clEnqueueMemAdviseINTEL), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+#if defined(CL_VERSION_1_2)
+    { offsetof(openclext_dispatch_table, clEnqueueMigrateMemINTEL), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+#endif // defined(CL_VERSION_1_2)
+    { offsetof(openclext_dispatch_table, clEnqueueMemsetINTEL), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+#endif // defined(cl_intel_unified_shared_memory)
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_va_api_media_sharing)
+    { offsetof(openclext_dispatch_table, clGetDeviceIDsFromVA_APIMediaAdapterINTEL), CLEXT_HANDLE_PLATFORM, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clCreateFromVA_APIMediaSurfaceINTEL), CLEXT_HANDLE_CONTEXT, CLEXT_ERROR_ERRCODE },
+    { offsetof(openclext_dispatch_table, clEnqueueAcquireVA_APIMediaSurfacesINTEL), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+    { offsetof(openclext_dispatch_table, clEnqueueReleaseVA_APIMediaSurfacesINTEL), CLEXT_HANDLE_COMMAND_QUEUE, CLEXT_ERROR_STATUS },
+#endif // defined(cl_intel_va_api_media_sharing)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_loader_info)
+    { offsetof(openclext_dispatch_table_common, clGetICDLoaderInfoOCLICD), CLEXT_HANDLE_COMMON, CLEXT_ERROR_STATUS },
+#endif // defined(cl_loader_info)
+#if defined(cl_pocl_content_size)
+    { offsetof(openclext_dispatch_table, clSetContentSizeBufferPoCL), CLEXT_HANDLE_MEM, CLEXT_ERROR_STATUS },
+#endif // defined(cl_pocl_content_size)
+#if defined(cl_qcom_ext_host_ptr)
+    { offsetof(openclext_dispatch_table, clGetDeviceImageInfoQCOM), CLEXT_HANDLE_DEVICE, CLEXT_ERROR_STATUS },
+#endif // defined(cl_qcom_ext_host_ptr)
+    { 0, CLEXT_HANDLE_COMMON, CLEXT_ERROR_VOID }    // CLEXT_FUNCTION_COUNT
+};
+
+static void* _resolve(
+    openclext_function_index index,
+    const void* handle,
+    cl_int* errcode_ret)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandCopyBufferKHR == nullptr) {
-        return CL_INVALID_OPERATION;
+    const openclext_function_info& info = _function_info[index];
+
+    const void* dispatch_ptr = nullptr;
+    switch (info.handle) {
+    case CLEXT_HANDLE_COMMON:
+        dispatch_ptr = _get_dispatch();
+        break;
+    case CLEXT_HANDLE_PLATFORM:
+        dispatch_ptr = _get_dispatch((cl_platform_id)handle);
+        break;
+    case CLEXT_HANDLE_DEVICE:
+        dispatch_ptr = _get_dispatch((cl_device_id)handle);
+        break;
+    case CLEXT_HANDLE_CONTEXT:
+        dispatch_ptr = _get_dispatch((cl_context)handle);
+        break;
+    case CLEXT_HANDLE_COMMAND_QUEUE:
+        dispatch_ptr = _get_dispatch((cl_command_queue)handle);
+        break;
+    case CLEXT_HANDLE_MEM:
+        dispatch_ptr = _get_dispatch((cl_mem)handle);
+        break;
+    case CLEXT_HANDLE_KERNEL:
+        dispatch_ptr = _get_dispatch((cl_kernel)handle);
+        break;
+    case CLEXT_HANDLE_EVENT:
+        dispatch_ptr = _get_dispatch((cl_event)handle);
+        break;
+#if defined(cl_khr_semaphore)
+    case CLEXT_HANDLE_SEMAPHORE:
+        dispatch_ptr = _get_dispatch((cl_semaphore_khr)handle);
+        break;
+#endif // defined(cl_khr_semaphore)
+#if defined(cl_khr_command_buffer)
+    case CLEXT_HANDLE_COMMAND_BUFFER:
+        dispatch_ptr = _get_dispatch((cl_command_buffer_khr)handle);
+        break;
+#endif // defined(cl_khr_command_buffer)
+#if defined(cl_khr_command_buffer_mutable_dispatch)
+    case CLEXT_HANDLE_MUTABLE_COMMAND:
+        dispatch_ptr = _get_dispatch((cl_mutable_command_khr)handle);
+        break;
+#endif // defined(cl_khr_command_buffer_mutable_dispatch)
+#if defined(cl_intel_accelerator)
+    case CLEXT_HANDLE_ACCELERATOR:
+        dispatch_ptr = _get_dispatch((cl_accelerator_intel)handle);
+        break;
+#endif // defined(cl_intel_accelerator)
+    default:
+        break;
     }
-    return dispatch_ptr->clCommandCopyBufferKHR(
-        command_buffer,
-        command_queue,
-        properties,
-        src_buffer,
-        dst_buffer,
-        src_offset,
-        dst_offset,
-        size,
-        num_sync_points_in_wait_list,
-        sync_point_wait_list,
-        sync_point,
-        mutable_handle);
+
+    void* function = nullptr;
+    if (dispatch_ptr) {
+        memcpy(&function, (const char*)dispatch_ptr + info.offset, sizeof(function));
+    }
+    if (function == nullptr && info.error == CLEXT_ERROR_ERRCODE && errcode_ret) {
+        *errcode_ret = CL_INVALID_OPERATION;
+    }
+    return function;
 }
 
-cl_int CL_API_CALL clCommandCopyBufferRectKHR(
-    cl_command_buffer_khr command_buffer,
-    cl_command_queue command_queue,
-    const cl_command_properties_khr* properties,
-    cl_mem src_buffer,
-    cl_mem dst_buffer,
-    const size_t* src_origin,
-    const size_t* dst_origin,
-    const size_t* region,
-    size_t src_row_pitch,
-    size_t src_slice_pitch,
-    size_t dst_row_pitch,
-    size_t dst_slice_pitch,
-    cl_uint num_sync_points_in_wait_list,
-    const cl_sync_point_khr* sync_point_wait_list,
-    cl_sync_point_khr* sync_point,
-    cl_mutable_command_khr* mutable_handle)
+#endif // defined(CLEXT_COMPACT_DISPATCH)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+* Extension Functions
+***************************************************************/
+
+#if defined(cl_khr_command_buffer)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_command_buffer_khr CL_API_CALL clCreateCommandBufferKHR(
+    cl_uint num_queues,
+    const cl_command_queue* queues,
+    const cl_command_buffer_properties_khr* properties,
+    cl_int* errcode_ret)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandCopyBufferRectKHR == nullptr) {
-        return CL_INVALID_OPERATION;
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateCommandBufferKHR,
+        (const void*)(num_queues > 0 && queues ? queues[0] : nullptr),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clCreateCommandBufferKHR_clextfn)function)(
+        num_queues,
+        queues,
+        properties,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY cl_command_buffer_khr CL_API_CALL clCreateCommandBufferKHR(
+    cl_uint num_queues,
+    const cl_command_queue* queues,
+    const cl_command_buffer_properties_khr* properties,
+    cl_int* errcode_ret)
+{
+    CLEXT_CALL_BEGIN(clCreateCommandBufferKHR, num_queues > 0 && queues ? queues[0] : nullptr);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(num_queues > 0 && queues ? queues[0] : nullptr);
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateCommandBufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateCommandBufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCreateCommandBufferKHR, dispatch_ptr);
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
     }
-    return dispatch_ptr->clCommandCopyBufferRectKHR(
-        command_buffer,
-        command_queue,
+    cl_command_buffer_khr retVal = dispatch_ptr->clCreateCommandBufferKHR(
+        num_queues,
+        queues,
         properties,
-        src_buffer,
-        dst_buffer,
-        src_origin,
-        dst_origin,
-        region,
-        src_row_pitch,
-        src_slice_pitch,
-        dst_row_pitch,
-        dst_slice_pitch,
-        num_sync_points_in_wait_list,
-        sync_point_wait_list,
-        sync_point,
-        mutable_handle);
+        errcode_ret);
+    CLEXT_CALL_ARGS(clCreateCommandBufferKHR, *errcode_ret, 0, num_queues, queues, properties, errcode_ret);
+    CLEXT_CALL_END(clCreateCommandBufferKHR, *errcode_ret);
+    return retVal;
 }
+#endif
 
-cl_int CL_API_CALL clCommandCopyBufferToImageKHR(
-    cl_command_buffer_khr command_buffer,
-    cl_command_queue command_queue,
-    const cl_command_properties_khr* properties,
-    cl_mem src_buffer,
-    cl_mem dst_image,
-    size_t src_offset,
-    const size_t* dst_origin,
-    const size_t* region,
-    cl_uint num_sync_points_in_wait_list,
-    const cl_sync_point_khr* sync_point_wait_list,
-    cl_sync_point_khr* sync_point,
-    cl_mutable_command_khr* mutable_handle)
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clFinalizeCommandBufferKHR(
+    cl_command_buffer_khr command_buffer)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clFinalizeCommandBufferKHR,
+        (const void*)(command_buffer),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clFinalizeCommandBufferKHR_clextfn)function)(
+        command_buffer);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clFinalizeCommandBufferKHR(
+    cl_command_buffer_khr command_buffer)
 {
+    CLEXT_CALL_BEGIN(clFinalizeCommandBufferKHR, command_buffer);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandCopyBufferToImageKHR == nullptr) {
+    CLEXT_CALL_DISPATCH(clFinalizeCommandBufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clFinalizeCommandBufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clFinalizeCommandBufferKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clCommandCopyBufferToImageKHR(
-        command_buffer,
-        command_queue,
-        properties,
-        src_buffer,
-        dst_image,
-        src_offset,
-        dst_origin,
-        region,
-        num_sync_points_in_wait_list,
-        sync_point_wait_list,
-        sync_point,
-        mutable_handle);
+    cl_int retVal = dispatch_ptr->clFinalizeCommandBufferKHR(
+        command_buffer);
+    CLEXT_CALL_ARGS(clFinalizeCommandBufferKHR, retVal, 0, command_buffer);
+    CLEXT_CALL_END(clFinalizeCommandBufferKHR, retVal);
+    return retVal;
 }
+#endif
 
-cl_int CL_API_CALL clCommandCopyImageKHR(
-    cl_command_buffer_khr command_buffer,
-    cl_command_queue command_queue,
-    const cl_command_properties_khr* properties,
-    cl_mem src_image,
-    cl_mem dst_image,
-    const size_t* src_origin,
-    const size_t* dst_origin,
-    const size_t* region,
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clRetainCommandBufferKHR(
+    cl_command_buffer_khr command_buffer)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clRetainCommandBufferKHR,
+        (const void*)(command_buffer),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clRetainCommandBufferKHR_clextfn)function)(
+        command_buffer);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clRetainCommandBufferKHR(
+    cl_command_buffer_khr command_buffer)
+{
+    CLEXT_CALL_BEGIN(clRetainCommandBufferKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clRetainCommandBufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clRetainCommandBufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clRetainCommandBufferKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clRetainCommandBufferKHR(
+        command_buffer);
+    CLEXT_CALL_ARGS(clRetainCommandBufferKHR, retVal, 0, command_buffer);
+    CLEXT_CALL_END(clRetainCommandBufferKHR, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clReleaseCommandBufferKHR(
+    cl_command_buffer_khr command_buffer)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clReleaseCommandBufferKHR,
+        (const void*)(command_buffer),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clReleaseCommandBufferKHR_clextfn)function)(
+        command_buffer);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clReleaseCommandBufferKHR(
+    cl_command_buffer_khr command_buffer)
+{
+    CLEXT_CALL_BEGIN(clReleaseCommandBufferKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clReleaseCommandBufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clReleaseCommandBufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clReleaseCommandBufferKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clReleaseCommandBufferKHR(
+        command_buffer);
+    CLEXT_CALL_ARGS(clReleaseCommandBufferKHR, retVal, 0, command_buffer);
+    CLEXT_CALL_END(clReleaseCommandBufferKHR, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueCommandBufferKHR(
+    cl_uint num_queues,
+    cl_command_queue* queues,
+    cl_command_buffer_khr command_buffer,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueCommandBufferKHR,
+        (const void*)(command_buffer),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueCommandBufferKHR_clextfn)function)(
+        num_queues,
+        queues,
+        command_buffer,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueCommandBufferKHR(
+    cl_uint num_queues,
+    cl_command_queue* queues,
+    cl_command_buffer_khr command_buffer,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueCommandBufferKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clEnqueueCommandBufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueCommandBufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueCommandBufferKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueCommandBufferKHR(
+        num_queues,
+        queues,
+        command_buffer,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueCommandBufferKHR, retVal, 0, num_queues, queues, command_buffer, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueCommandBufferKHR, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clCommandBarrierWithWaitListKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCommandBarrierWithWaitListKHR,
+        (const void*)(command_buffer),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clCommandBarrierWithWaitListKHR_clextfn)function)(
+        command_buffer,
+        command_queue,
+        properties,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clCommandBarrierWithWaitListKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
     cl_uint num_sync_points_in_wait_list,
     const cl_sync_point_khr* sync_point_wait_list,
     cl_sync_point_khr* sync_point,
     cl_mutable_command_khr* mutable_handle)
 {
+    CLEXT_CALL_BEGIN(clCommandBarrierWithWaitListKHR, command_buffer);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandCopyImageKHR == nullptr) {
+    CLEXT_CALL_DISPATCH(clCommandBarrierWithWaitListKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandBarrierWithWaitListKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandBarrierWithWaitListKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clCommandCopyImageKHR(
+    cl_int retVal = dispatch_ptr->clCommandBarrierWithWaitListKHR(
         command_buffer,
         command_queue,
         properties,
-        src_image,
-        dst_image,
-        src_origin,
-        dst_origin,
-        region,
         num_sync_points_in_wait_list,
         sync_point_wait_list,
         sync_point,
         mutable_handle);
+    CLEXT_CALL_ARGS(clCommandBarrierWithWaitListKHR, retVal, 0, command_buffer, command_queue, properties, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandBarrierWithWaitListKHR, retVal);
+    return retVal;
 }
+#endif
 
-cl_int CL_API_CALL clCommandCopyImageToBufferKHR(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clCommandCopyBufferKHR(
     cl_command_buffer_khr command_buffer,
     cl_command_queue command_queue,
     const cl_command_properties_khr* properties,
-    cl_mem src_image,
+    cl_mem src_buffer,
     cl_mem dst_buffer,
-    const size_t* src_origin,
-    const size_t* region,
+    size_t src_offset,
     size_t dst_offset,
+    size_t size,
     cl_uint num_sync_points_in_wait_list,
     const cl_sync_point_khr* sync_point_wait_list,
     cl_sync_point_khr* sync_point,
     cl_mutable_command_khr* mutable_handle)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandCopyImageToBufferKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clCommandCopyImageToBufferKHR(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCommandCopyBufferKHR,
+        (const void*)(command_buffer),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clCommandCopyBufferKHR_clextfn)function)(
         command_buffer,
         command_queue,
         properties,
-        src_image,
+        src_buffer,
         dst_buffer,
-        src_origin,
-        region,
+        src_offset,
         dst_offset,
+        size,
         num_sync_points_in_wait_list,
         sync_point_wait_list,
         sync_point,
         mutable_handle);
 }
-
-cl_int CL_API_CALL clCommandFillBufferKHR(
+#else
+CL_API_ENTRY cl_int CL_API_CALL clCommandCopyBufferKHR(
     cl_command_buffer_khr command_buffer,
     cl_command_queue command_queue,
     const cl_command_properties_khr* properties,
-    cl_mem buffer,
-    const void* pattern,
-    size_t pattern_size,
-    size_t offset,
+    cl_mem src_buffer,
+    cl_mem dst_buffer,
+    size_t src_offset,
+    size_t dst_offset,
     size_t size,
     cl_uint num_sync_points_in_wait_list,
     const cl_sync_point_khr* sync_point_wait_list,
     cl_sync_point_khr* sync_point,
     cl_mutable_command_khr* mutable_handle)
 {
+    CLEXT_CALL_BEGIN(clCommandCopyBufferKHR, command_buffer);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandFillBufferKHR == nullptr) {
+    CLEXT_CALL_DISPATCH(clCommandCopyBufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandCopyBufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandCopyBufferKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clCommandFillBufferKHR(
+    cl_int retVal = dispatch_ptr->clCommandCopyBufferKHR(
         command_buffer,
         command_queue,
         properties,
-        buffer,
-        pattern,
-        pattern_size,
-        offset,
+        src_buffer,
+        dst_buffer,
+        src_offset,
+        dst_offset,
         size,
         num_sync_points_in_wait_list,
         sync_point_wait_list,
         sync_point,
         mutable_handle);
+    CLEXT_CALL_ARGS(clCommandCopyBufferKHR, retVal, size, command_buffer, command_queue, properties, src_buffer, dst_buffer, src_offset, dst_offset, size, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_TRANSFER(clCommandCopyBufferKHR, command_buffer, dispatch_ptr, size, retVal);
+    CLEXT_CALL_END(clCommandCopyBufferKHR, retVal);
+    return retVal;
 }
+#endif
 
-cl_int CL_API_CALL clCommandFillImageKHR(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clCommandCopyBufferRectKHR(
     cl_command_buffer_khr command_buffer,
     cl_command_queue command_queue,
     const cl_command_properties_khr* properties,
-    cl_mem image,
-    const void* fill_color,
-    const size_t* origin,
+    cl_mem src_buffer,
+    cl_mem dst_buffer,
+    const size_t* src_origin,
+    const size_t* dst_origin,
     const size_t* region,
+    size_t src_row_pitch,
+    size_t src_slice_pitch,
+    size_t dst_row_pitch,
+    size_t dst_slice_pitch,
     cl_uint num_sync_points_in_wait_list,
     const cl_sync_point_khr* sync_point_wait_list,
     cl_sync_point_khr* sync_point,
     cl_mutable_command_khr* mutable_handle)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandFillImageKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clCommandFillImageKHR(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCommandCopyBufferRectKHR,
+        (const void*)(command_buffer),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clCommandCopyBufferRectKHR_clextfn)function)(
         command_buffer,
         command_queue,
         properties,
-        image,
-        fill_color,
-        origin,
+        src_buffer,
+        dst_buffer,
+        src_origin,
+        dst_origin,
         region,
+        src_row_pitch,
+        src_slice_pitch,
+        dst_row_pitch,
+        dst_slice_pitch,
         num_sync_points_in_wait_list,
         sync_point_wait_list,
         sync_point,
         mutable_handle);
 }
-
-cl_int CL_API_CALL clCommandNDRangeKernelKHR(
+#else
+CL_API_ENTRY cl_int CL_API_CALL clCommandCopyBufferRectKHR(
     cl_command_buffer_khr command_buffer,
     cl_command_queue command_queue,
     const cl_command_properties_khr* properties,
-    cl_kernel kernel,
-    cl_uint work_dim,
-    const size_t* global_work_offset,
-    const size_t* global_work_size,
-    const size_t* local_work_size,
+    cl_mem src_buffer,
+    cl_mem dst_buffer,
+    const size_t* src_origin,
+    const size_t* dst_origin,
+    const size_t* region,
+    size_t src_row_pitch,
+    size_t src_slice_pitch,
+    size_t dst_row_pitch,
+    size_t dst_slice_pitch,
     cl_uint num_sync_points_in_wait_list,
     const cl_sync_point_khr* sync_point_wait_list,
     cl_sync_point_khr* sync_point,
     cl_mutable_command_khr* mutable_handle)
 {
+    CLEXT_CALL_BEGIN(clCommandCopyBufferRectKHR, command_buffer);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandNDRangeKernelKHR == nullptr) {
+    CLEXT_CALL_DISPATCH(clCommandCopyBufferRectKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandCopyBufferRectKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandCopyBufferRectKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clCommandNDRangeKernelKHR(
+    cl_int retVal = dispatch_ptr->clCommandCopyBufferRectKHR(
         command_buffer,
         command_queue,
         properties,
-        kernel,
-        work_dim,
-        global_work_offset,
-        global_work_size,
-        local_work_size,
+        src_buffer,
+        dst_buffer,
+        src_origin,
+        dst_origin,
+        region,
+        src_row_pitch,
+        src_slice_pitch,
+        dst_row_pitch,
+        dst_slice_pitch,
         num_sync_points_in_wait_list,
         sync_point_wait_list,
         sync_point,
         mutable_handle);
+    CLEXT_CALL_ARGS(clCommandCopyBufferRectKHR, retVal, 0, command_buffer, command_queue, properties, src_buffer, dst_buffer, src_origin, dst_origin, region, src_row_pitch, src_slice_pitch, dst_row_pitch, dst_slice_pitch, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandCopyBufferRectKHR, retVal);
+    return retVal;
 }
+#endif
 
-cl_int CL_API_CALL clGetCommandBufferInfoKHR(
-    cl_command_buffer_khr command_buffer,
-    cl_command_buffer_info_khr param_name,
-    size_t param_value_size,
-    void* param_value,
-    size_t* param_value_size_ret)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetCommandBufferInfoKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clGetCommandBufferInfoKHR(
-        command_buffer,
-        param_name,
-        param_value_size,
-        param_value,
-        param_value_size_ret);
-}
-
-cl_int CL_API_CALL clCommandSVMMemcpyKHR(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clCommandCopyBufferToImageKHR(
     cl_command_buffer_khr command_buffer,
     cl_command_queue command_queue,
     const cl_command_properties_khr* properties,
-    void* dst_ptr,
-    const void* src_ptr,
-    size_t size,
+    cl_mem src_buffer,
+    cl_mem dst_image,
+    size_t src_offset,
+    const size_t* dst_origin,
+    const size_t* region,
     cl_uint num_sync_points_in_wait_list,
     const cl_sync_point_khr* sync_point_wait_list,
     cl_sync_point_khr* sync_point,
     cl_mutable_command_khr* mutable_handle)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandSVMMemcpyKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clCommandSVMMemcpyKHR(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCommandCopyBufferToImageKHR,
+        (const void*)(command_buffer),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clCommandCopyBufferToImageKHR_clextfn)function)(
         command_buffer,
         command_queue,
         properties,
-        dst_ptr,
-        src_ptr,
-        size,
+        src_buffer,
+        dst_image,
+        src_offset,
+        dst_origin,
+        region,
         num_sync_points_in_wait_list,
         sync_point_wait_list,
         sync_point,
         mutable_handle);
 }
-
-cl_int CL_API_CALL clCommandSVMMemFillKHR(
+#else
+CL_API_ENTRY cl_int CL_API_CALL clCommandCopyBufferToImageKHR(
     cl_command_buffer_khr command_buffer,
     cl_command_queue command_queue,
     const cl_command_properties_khr* properties,
-    void* svm_ptr,
-    const void* pattern,
-    size_t pattern_size,
-    size_t size,
+    cl_mem src_buffer,
+    cl_mem dst_image,
+    size_t src_offset,
+    const size_t* dst_origin,
+    const size_t* region,
     cl_uint num_sync_points_in_wait_list,
     const cl_sync_point_khr* sync_point_wait_list,
     cl_sync_point_khr* sync_point,
     cl_mutable_command_khr* mutable_handle)
 {
+    CLEXT_CALL_BEGIN(clCommandCopyBufferToImageKHR, command_buffer);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandSVMMemFillKHR == nullptr) {
+    CLEXT_CALL_DISPATCH(clCommandCopyBufferToImageKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandCopyBufferToImageKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandCopyBufferToImageKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clCommandSVMMemFillKHR(
+    cl_int retVal = dispatch_ptr->clCommandCopyBufferToImageKHR(
         command_buffer,
         command_queue,
         properties,
-        svm_ptr,
-        pattern,
-        pattern_size,
-        size,
-        num_sync_points_in_wait_list,
-        sync_point_wait_list,
-        sync_point,
-        mutable_handle);
+        src_buffer,
+        dst_image,
+        src_offset,
+        dst_origin,
+        region,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandCopyBufferToImageKHR, retVal, 0, command_buffer, command_queue, properties, src_buffer, dst_image, src_offset, dst_origin, region, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandCopyBufferToImageKHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_khr_command_buffer)
-
-#if defined(cl_khr_command_buffer_multi_device)
-
-cl_command_buffer_khr CL_API_CALL clRemapCommandBufferKHR(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clCommandCopyImageKHR(
     cl_command_buffer_khr command_buffer,
-    cl_bool automatic,
-    cl_uint num_queues,
-    const cl_command_queue* queues,
-    cl_uint num_handles,
-    const cl_mutable_command_khr* handles,
-    cl_mutable_command_khr* handles_ret,
-    cl_int* errcode_ret)
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_image,
+    cl_mem dst_image,
+    const size_t* src_origin,
+    const size_t* dst_origin,
+    const size_t* region,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clRemapCommandBufferKHR == nullptr) {
-        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
-        return nullptr;
-    }
-    return dispatch_ptr->clRemapCommandBufferKHR(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCommandCopyImageKHR,
+        (const void*)(command_buffer),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clCommandCopyImageKHR_clextfn)function)(
         command_buffer,
-        automatic,
-        num_queues,
-        queues,
-        num_handles,
-        handles,
-        handles_ret,
-        errcode_ret);
+        command_queue,
+        properties,
+        src_image,
+        dst_image,
+        src_origin,
+        dst_origin,
+        region,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
 }
-
-#endif // defined(cl_khr_command_buffer_multi_device)
-
-#if defined(cl_khr_command_buffer_mutable_dispatch)
-
-cl_int CL_API_CALL clUpdateMutableCommandsKHR(
+#else
+CL_API_ENTRY cl_int CL_API_CALL clCommandCopyImageKHR(
     cl_command_buffer_khr command_buffer,
-    cl_uint num_configs,
-    const cl_command_buffer_update_type_khr* config_types,
-    const void** configs)
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_image,
+    cl_mem dst_image,
+    const size_t* src_origin,
+    const size_t* dst_origin,
+    const size_t* region,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
 {
+    CLEXT_CALL_BEGIN(clCommandCopyImageKHR, command_buffer);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clUpdateMutableCommandsKHR == nullptr) {
+    CLEXT_CALL_DISPATCH(clCommandCopyImageKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandCopyImageKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandCopyImageKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clUpdateMutableCommandsKHR(
+    cl_int retVal = dispatch_ptr->clCommandCopyImageKHR(
         command_buffer,
-        num_configs,
-        config_types,
-        configs);
+        command_queue,
+        properties,
+        src_image,
+        dst_image,
+        src_origin,
+        dst_origin,
+        region,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandCopyImageKHR, retVal, 0, command_buffer, command_queue, properties, src_image, dst_image, src_origin, dst_origin, region, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandCopyImageKHR, retVal);
+    return retVal;
 }
+#endif
 
-cl_int CL_API_CALL clGetMutableCommandInfoKHR(
-    cl_mutable_command_khr command,
-    cl_mutable_command_info_khr param_name,
-    size_t param_value_size,
-    void* param_value,
-    size_t* param_value_size_ret)
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clCommandCopyImageToBufferKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_image,
+    cl_mem dst_buffer,
+    const size_t* src_origin,
+    const size_t* region,
+    size_t dst_offset,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetMutableCommandInfoKHR == nullptr) {
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCommandCopyImageToBufferKHR,
+        (const void*)(command_buffer),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clCommandCopyImageToBufferKHR_clextfn)function)(
+        command_buffer,
+        command_queue,
+        properties,
+        src_image,
+        dst_buffer,
+        src_origin,
+        region,
+        dst_offset,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clCommandCopyImageToBufferKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_image,
+    cl_mem dst_buffer,
+    const size_t* src_origin,
+    const size_t* region,
+    size_t dst_offset,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    CLEXT_CALL_BEGIN(clCommandCopyImageToBufferKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clCommandCopyImageToBufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandCopyImageToBufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandCopyImageToBufferKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clGetMutableCommandInfoKHR(
-        command,
-        param_name,
-        param_value_size,
-        param_value,
-        param_value_size_ret);
+    cl_int retVal = dispatch_ptr->clCommandCopyImageToBufferKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        src_image,
+        dst_buffer,
+        src_origin,
+        region,
+        dst_offset,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandCopyImageToBufferKHR, retVal, 0, command_buffer, command_queue, properties, src_image, dst_buffer, src_origin, region, dst_offset, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandCopyImageToBufferKHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_khr_command_buffer_mutable_dispatch)
-
-#if defined(cl_khr_create_command_queue)
-
-cl_command_queue CL_API_CALL clCreateCommandQueueWithPropertiesKHR(
-    cl_context context,
-    cl_device_id device,
-    const cl_queue_properties_khr* properties,
-    cl_int* errcode_ret)
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clCommandFillBufferKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem buffer,
+    const void* pattern,
+    size_t pattern_size,
+    size_t offset,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateCommandQueueWithPropertiesKHR == nullptr) {
-        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
-        return nullptr;
-    }
-    return dispatch_ptr->clCreateCommandQueueWithPropertiesKHR(
-        context,
-        device,
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCommandFillBufferKHR,
+        (const void*)(command_buffer),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clCommandFillBufferKHR_clextfn)function)(
+        command_buffer,
+        command_queue,
         properties,
-        errcode_ret);
+        buffer,
+        pattern,
+        pattern_size,
+        offset,
+        size,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
 }
-
-#endif // defined(cl_khr_create_command_queue)
-
-#if defined(CLEXT_INCLUDE_D3D10)
-#if defined(cl_khr_d3d10_sharing)
-
-cl_int CL_API_CALL clGetDeviceIDsFromD3D10KHR(
-    cl_platform_id platform,
-    cl_d3d10_device_source_khr d3d_device_source,
-    void* d3d_object,
-    cl_d3d10_device_set_khr d3d_device_set,
-    cl_uint num_entries,
-    cl_device_id* devices,
-    cl_uint* num_devices)
+#else
+CL_API_ENTRY cl_int CL_API_CALL clCommandFillBufferKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem buffer,
+    const void* pattern,
+    size_t pattern_size,
+    size_t offset,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(platform);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetDeviceIDsFromD3D10KHR == nullptr) {
+    CLEXT_CALL_BEGIN(clCommandFillBufferKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clCommandFillBufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandFillBufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandFillBufferKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clGetDeviceIDsFromD3D10KHR(
-        platform,
-        d3d_device_source,
-        d3d_object,
-        d3d_device_set,
-        num_entries,
-        devices,
-        num_devices);
+    cl_int retVal = dispatch_ptr->clCommandFillBufferKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        buffer,
+        pattern,
+        pattern_size,
+        offset,
+        size,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandFillBufferKHR, retVal, size, command_buffer, command_queue, properties, buffer, pattern, pattern_size, offset, size, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandFillBufferKHR, retVal);
+    return retVal;
 }
+#endif
 
-cl_mem CL_API_CALL clCreateFromD3D10BufferKHR(
-    cl_context context,
-    cl_mem_flags flags,
-    ID3D10Buffer* resource,
-    cl_int* errcode_ret)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromD3D10BufferKHR == nullptr) {
-        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
-        return nullptr;
-    }
-    return dispatch_ptr->clCreateFromD3D10BufferKHR(
-        context,
-        flags,
-        resource,
-        errcode_ret);
-}
-
-cl_mem CL_API_CALL clCreateFromD3D10Texture2DKHR(
-    cl_context context,
-    cl_mem_flags flags,
-    ID3D10Texture2D* resource,
-    UINT subresource,
-    cl_int* errcode_ret)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromD3D10Texture2DKHR == nullptr) {
-        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
-        return nullptr;
-    }
-    return dispatch_ptr->clCreateFromD3D10Texture2DKHR(
-        context,
-        flags,
-        resource,
-        subresource,
-        errcode_ret);
-}
-
-cl_mem CL_API_CALL clCreateFromD3D10Texture3DKHR(
-    cl_context context,
-    cl_mem_flags flags,
-    ID3D10Texture3D* resource,
-    UINT subresource,
-    cl_int* errcode_ret)
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clCommandFillImageKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem image,
+    const void* fill_color,
+    const size_t* origin,
+    const size_t* region,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromD3D10Texture3DKHR == nullptr) {
-        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
-        return nullptr;
-    }
-    return dispatch_ptr->clCreateFromD3D10Texture3DKHR(
-        context,
-        flags,
-        resource,
-        subresource,
-        errcode_ret);
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCommandFillImageKHR,
+        (const void*)(command_buffer),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clCommandFillImageKHR_clextfn)function)(
+        command_buffer,
+        command_queue,
+        properties,
+        image,
+        fill_color,
+        origin,
+        region,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
 }
-
-cl_int CL_API_CALL clEnqueueAcquireD3D10ObjectsKHR(
+#else
+CL_API_ENTRY cl_int CL_API_CALL clCommandFillImageKHR(
+    cl_command_buffer_khr command_buffer,
     cl_command_queue command_queue,
-    cl_uint num_objects,
-    const cl_mem* mem_objects,
-    cl_uint num_events_in_wait_list,
-    const cl_event* event_wait_list,
-    cl_event* event)
+    const cl_command_properties_khr* properties,
+    cl_mem image,
+    const void* fill_color,
+    const size_t* origin,
+    const size_t* region,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueAcquireD3D10ObjectsKHR == nullptr) {
+    CLEXT_CALL_BEGIN(clCommandFillImageKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clCommandFillImageKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandFillImageKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandFillImageKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clEnqueueAcquireD3D10ObjectsKHR(
+    cl_int retVal = dispatch_ptr->clCommandFillImageKHR(
+        command_buffer,
         command_queue,
-        num_objects,
-        mem_objects,
-        num_events_in_wait_list,
-        event_wait_list,
-        event);
+        properties,
+        image,
+        fill_color,
+        origin,
+        region,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandFillImageKHR, retVal, 0, command_buffer, command_queue, properties, image, fill_color, origin, region, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandFillImageKHR, retVal);
+    return retVal;
 }
+#endif
 
-cl_int CL_API_CALL clEnqueueReleaseD3D10ObjectsKHR(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clCommandNDRangeKernelKHR(
+    cl_command_buffer_khr command_buffer,
     cl_command_queue command_queue,
-    cl_uint num_objects,
-    const cl_mem* mem_objects,
-    cl_uint num_events_in_wait_list,
-    const cl_event* event_wait_list,
-    cl_event* event)
+    const cl_command_properties_khr* properties,
+    cl_kernel kernel,
+    cl_uint work_dim,
+    const size_t* global_work_offset,
+    const size_t* global_work_size,
+    const size_t* local_work_size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueReleaseD3D10ObjectsKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clEnqueueReleaseD3D10ObjectsKHR(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCommandNDRangeKernelKHR,
+        (const void*)(command_buffer),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clCommandNDRangeKernelKHR_clextfn)function)(
+        command_buffer,
         command_queue,
-        num_objects,
-        mem_objects,
-        num_events_in_wait_list,
-        event_wait_list,
-        event);
+        properties,
+        kernel,
+        work_dim,
+        global_work_offset,
+        global_work_size,
+        local_work_size,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
 }
-
-#endif // defined(cl_khr_d3d10_sharing)
-#endif // defined(CLEXT_INCLUDE_D3D10)
-
-
-#if defined(CLEXT_INCLUDE_D3D11)
-#if defined(cl_khr_d3d11_sharing)
-
-cl_int CL_API_CALL clGetDeviceIDsFromD3D11KHR(
-    cl_platform_id platform,
-    cl_d3d11_device_source_khr d3d_device_source,
-    void* d3d_object,
-    cl_d3d11_device_set_khr d3d_device_set,
-    cl_uint num_entries,
-    cl_device_id* devices,
-    cl_uint* num_devices)
+#else
+CL_API_ENTRY cl_int CL_API_CALL clCommandNDRangeKernelKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_kernel kernel,
+    cl_uint work_dim,
+    const size_t* global_work_offset,
+    const size_t* global_work_size,
+    const size_t* local_work_size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(platform);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetDeviceIDsFromD3D11KHR == nullptr) {
+    CLEXT_CALL_BEGIN(clCommandNDRangeKernelKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clCommandNDRangeKernelKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandNDRangeKernelKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandNDRangeKernelKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clGetDeviceIDsFromD3D11KHR(
-        platform,
-        d3d_device_source,
-        d3d_object,
-        d3d_device_set,
-        num_entries,
-        devices,
-        num_devices);
+    cl_int retVal = dispatch_ptr->clCommandNDRangeKernelKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        kernel,
+        work_dim,
+        global_work_offset,
+        global_work_size,
+        local_work_size,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandNDRangeKernelKHR, retVal, 0, command_buffer, command_queue, properties, kernel, work_dim, global_work_offset, global_work_size, local_work_size, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandNDRangeKernelKHR, retVal);
+    return retVal;
 }
+#endif
 
-cl_mem CL_API_CALL clCreateFromD3D11BufferKHR(
-    cl_context context,
-    cl_mem_flags flags,
-    ID3D11Buffer* resource,
-    cl_int* errcode_ret)
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetCommandBufferInfoKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_buffer_info_khr param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromD3D11BufferKHR == nullptr) {
-        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
-        return nullptr;
-    }
-    return dispatch_ptr->clCreateFromD3D11BufferKHR(
-        context,
-        flags,
-        resource,
-        errcode_ret);
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetCommandBufferInfoKHR,
+        (const void*)(command_buffer),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetCommandBufferInfoKHR_clextfn)function)(
+        command_buffer,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
 }
-
-cl_mem CL_API_CALL clCreateFromD3D11Texture2DKHR(
-    cl_context context,
-    cl_mem_flags flags,
-    ID3D11Texture2D* resource,
-    UINT subresource,
-    cl_int* errcode_ret)
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetCommandBufferInfoKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_buffer_info_khr param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromD3D11Texture2DKHR == nullptr) {
-        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
-        return nullptr;
+    CLEXT_CALL_BEGIN(clGetCommandBufferInfoKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clGetCommandBufferInfoKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetCommandBufferInfoKHR == nullptr) {
+        CLEXT_CALL_MISSING(clGetCommandBufferInfoKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clCreateFromD3D11Texture2DKHR(
-        context,
-        flags,
-        resource,
-        subresource,
-        errcode_ret);
+    cl_int retVal = dispatch_ptr->clGetCommandBufferInfoKHR(
+        command_buffer,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+    CLEXT_CALL_ARGS(clGetCommandBufferInfoKHR, retVal, param_value_size, command_buffer, param_name, param_value_size, param_value, param_value_size_ret);
+    CLEXT_CALL_END(clGetCommandBufferInfoKHR, retVal);
+    return retVal;
 }
+#endif
 
-cl_mem CL_API_CALL clCreateFromD3D11Texture3DKHR(
-    cl_context context,
-    cl_mem_flags flags,
-    ID3D11Texture3D* resource,
-    UINT subresource,
-    cl_int* errcode_ret)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromD3D11Texture3DKHR == nullptr) {
-        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
-        return nullptr;
-    }
-    return dispatch_ptr->clCreateFromD3D11Texture3DKHR(
-        context,
-        flags,
-        resource,
-        subresource,
-        errcode_ret);
-}
-
-cl_int CL_API_CALL clEnqueueAcquireD3D11ObjectsKHR(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clCommandSVMMemcpyKHR(
+    cl_command_buffer_khr command_buffer,
     cl_command_queue command_queue,
-    cl_uint num_objects,
-    const cl_mem* mem_objects,
-    cl_uint num_events_in_wait_list,
-    const cl_event* event_wait_list,
-    cl_event* event)
+    const cl_command_properties_khr* properties,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueAcquireD3D11ObjectsKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clEnqueueAcquireD3D11ObjectsKHR(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCommandSVMMemcpyKHR,
+        (const void*)(command_buffer),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clCommandSVMMemcpyKHR_clextfn)function)(
+        command_buffer,
         command_queue,
-        num_objects,
-        mem_objects,
-        num_events_in_wait_list,
-        event_wait_list,
-        event);
+        properties,
+        dst_ptr,
+        src_ptr,
+        size,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
 }
-
-cl_int CL_API_CALL clEnqueueReleaseD3D11ObjectsKHR(
+#else
+CL_API_ENTRY cl_int CL_API_CALL clCommandSVMMemcpyKHR(
+    cl_command_buffer_khr command_buffer,
     cl_command_queue command_queue,
-    cl_uint num_objects,
-    const cl_mem* mem_objects,
-    cl_uint num_events_in_wait_list,
-    const cl_event* event_wait_list,
-    cl_event* event)
+    const cl_command_properties_khr* properties,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueReleaseD3D11ObjectsKHR == nullptr) {
+    CLEXT_CALL_BEGIN(clCommandSVMMemcpyKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clCommandSVMMemcpyKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandSVMMemcpyKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandSVMMemcpyKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clEnqueueReleaseD3D11ObjectsKHR(
+    cl_int retVal = dispatch_ptr->clCommandSVMMemcpyKHR(
+        command_buffer,
         command_queue,
-        num_objects,
-        mem_objects,
-        num_events_in_wait_list,
-        event_wait_list,
-        event);
-}
-
-#endif // defined(cl_khr_d3d11_sharing)
-#endif // defined(CLEXT_INCLUDE_D3D11)
-
-
-#if defined(CLEXT_INCLUDE_DX9)
-#if defined(cl_khr_dx9_media_sharing)
-
-cl_int CL_API_CALL clGetDeviceIDsFromDX9MediaAdapterKHR(
-    cl_platform_id platform,
-    cl_uint num_media_adapters,
-    cl_dx9_media_adapter_type_khr* media_adapter_type,
-    void* media_adapters,
-    cl_dx9_media_adapter_set_khr media_adapter_set,
-    cl_uint num_entries,
-    cl_device_id* devices,
-    cl_uint* num_devices)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(platform);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetDeviceIDsFromDX9MediaAdapterKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clGetDeviceIDsFromDX9MediaAdapterKHR(
-        platform,
-        num_media_adapters,
-        media_adapter_type,
-        media_adapters,
-        media_adapter_set,
-        num_entries,
-        devices,
-        num_devices);
-}
-
-cl_mem CL_API_CALL clCreateFromDX9MediaSurfaceKHR(
-    cl_context context,
-    cl_mem_flags flags,
-    cl_dx9_media_adapter_type_khr adapter_type,
-    void* surface_info,
-    cl_uint plane,
-    cl_int* errcode_ret)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromDX9MediaSurfaceKHR == nullptr) {
-        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
-        return nullptr;
-    }
-    return dispatch_ptr->clCreateFromDX9MediaSurfaceKHR(
-        context,
-        flags,
-        adapter_type,
-        surface_info,
-        plane,
-        errcode_ret);
+        properties,
+        dst_ptr,
+        src_ptr,
+        size,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandSVMMemcpyKHR, retVal, size, command_buffer, command_queue, properties, dst_ptr, src_ptr, size, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandSVMMemcpyKHR, retVal);
+    return retVal;
 }
+#endif
 
-cl_int CL_API_CALL clEnqueueAcquireDX9MediaSurfacesKHR(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clCommandSVMMemFillKHR(
+    cl_command_buffer_khr command_buffer,
     cl_command_queue command_queue,
-    cl_uint num_objects,
-    const cl_mem* mem_objects,
-    cl_uint num_events_in_wait_list,
-    const cl_event* event_wait_list,
-    cl_event* event)
+    const cl_command_properties_khr* properties,
+    void* svm_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueAcquireDX9MediaSurfacesKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clEnqueueAcquireDX9MediaSurfacesKHR(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCommandSVMMemFillKHR,
+        (const void*)(command_buffer),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clCommandSVMMemFillKHR_clextfn)function)(
+        command_buffer,
         command_queue,
-        num_objects,
-        mem_objects,
-        num_events_in_wait_list,
-        event_wait_list,
-        event);
+        properties,
+        svm_ptr,
+        pattern,
+        pattern_size,
+        size,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
 }
-
-cl_int CL_API_CALL clEnqueueReleaseDX9MediaSurfacesKHR(
+#else
+CL_API_ENTRY cl_int CL_API_CALL clCommandSVMMemFillKHR(
+    cl_command_buffer_khr command_buffer,
     cl_command_queue command_queue,
-    cl_uint num_objects,
-    const cl_mem* mem_objects,
-    cl_uint num_events_in_wait_list,
-    const cl_event* event_wait_list,
-    cl_event* event)
+    const cl_command_properties_khr* properties,
+    void* svm_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueReleaseDX9MediaSurfacesKHR == nullptr) {
+    CLEXT_CALL_BEGIN(clCommandSVMMemFillKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clCommandSVMMemFillKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandSVMMemFillKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandSVMMemFillKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clEnqueueReleaseDX9MediaSurfacesKHR(
+    cl_int retVal = dispatch_ptr->clCommandSVMMemFillKHR(
+        command_buffer,
         command_queue,
-        num_objects,
-        mem_objects,
-        num_events_in_wait_list,
-        event_wait_list,
-        event);
+        properties,
+        svm_ptr,
+        pattern,
+        pattern_size,
+        size,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandSVMMemFillKHR, retVal, size, command_buffer, command_queue, properties, svm_ptr, pattern, pattern_size, size, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandSVMMemFillKHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_khr_dx9_media_sharing)
-#endif // defined(CLEXT_INCLUDE_DX9)
-
+#endif // defined(cl_khr_command_buffer)
 
-#if defined(CLEXT_INCLUDE_EGL)
-#if defined(cl_khr_egl_event)
+#if defined(cl_khr_command_buffer_multi_device)
 
-cl_event CL_API_CALL clCreateEventFromEGLSyncKHR(
-    cl_context context,
-    CLeglSyncKHR sync,
-    CLeglDisplayKHR display,
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_command_buffer_khr CL_API_CALL clRemapCommandBufferKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_bool automatic,
+    cl_uint num_queues,
+    const cl_command_queue* queues,
+    cl_uint num_handles,
+    const cl_mutable_command_khr* handles,
+    cl_mutable_command_khr* handles_ret,
     cl_int* errcode_ret)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateEventFromEGLSyncKHR == nullptr) {
+    void* function = _resolve(
+        CLEXT_FUNCTION_clRemapCommandBufferKHR,
+        (const void*)(command_buffer),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clRemapCommandBufferKHR_clextfn)function)(
+        command_buffer,
+        automatic,
+        num_queues,
+        queues,
+        num_handles,
+        handles,
+        handles_ret,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY cl_command_buffer_khr CL_API_CALL clRemapCommandBufferKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_bool automatic,
+    cl_uint num_queues,
+    const cl_command_queue* queues,
+    cl_uint num_handles,
+    const cl_mutable_command_khr* handles,
+    cl_mutable_command_khr* handles_ret,
+    cl_int* errcode_ret)
+{
+    CLEXT_CALL_BEGIN(clRemapCommandBufferKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clRemapCommandBufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clRemapCommandBufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clRemapCommandBufferKHR, dispatch_ptr);
         if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
         return nullptr;
     }
-    return dispatch_ptr->clCreateEventFromEGLSyncKHR(
-        context,
-        sync,
-        display,
+    cl_command_buffer_khr retVal = dispatch_ptr->clRemapCommandBufferKHR(
+        command_buffer,
+        automatic,
+        num_queues,
+        queues,
+        num_handles,
+        handles,
+        handles_ret,
         errcode_ret);
+    CLEXT_CALL_ARGS(clRemapCommandBufferKHR, *errcode_ret, 0, command_buffer, automatic, num_queues, queues, num_handles, handles, handles_ret, errcode_ret);
+    CLEXT_CALL_END(clRemapCommandBufferKHR, *errcode_ret);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_khr_egl_event)
-#endif // defined(CLEXT_INCLUDE_EGL)
+#endif // defined(cl_khr_command_buffer_multi_device)
 
+#if defined(cl_khr_command_buffer_mutable_dispatch)
 
-#if defined(CLEXT_INCLUDE_EGL)
-#if defined(cl_khr_egl_image)
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clUpdateMutableCommandsKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_uint num_configs,
+    const cl_command_buffer_update_type_khr* config_types,
+    const void** configs)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clUpdateMutableCommandsKHR,
+        (const void*)(command_buffer),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clUpdateMutableCommandsKHR_clextfn)function)(
+        command_buffer,
+        num_configs,
+        config_types,
+        configs);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clUpdateMutableCommandsKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_uint num_configs,
+    const cl_command_buffer_update_type_khr* config_types,
+    const void** configs)
+{
+    CLEXT_CALL_BEGIN(clUpdateMutableCommandsKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clUpdateMutableCommandsKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clUpdateMutableCommandsKHR == nullptr) {
+        CLEXT_CALL_MISSING(clUpdateMutableCommandsKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clUpdateMutableCommandsKHR(
+        command_buffer,
+        num_configs,
+        config_types,
+        configs);
+    CLEXT_CALL_ARGS(clUpdateMutableCommandsKHR, retVal, 0, command_buffer, num_configs, config_types, configs);
+    CLEXT_CALL_END(clUpdateMutableCommandsKHR, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetMutableCommandInfoKHR(
+    cl_mutable_command_khr command,
+    cl_mutable_command_info_khr param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetMutableCommandInfoKHR,
+        (const void*)(command),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetMutableCommandInfoKHR_clextfn)function)(
+        command,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetMutableCommandInfoKHR(
+    cl_mutable_command_khr command,
+    cl_mutable_command_info_khr param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    CLEXT_CALL_BEGIN(clGetMutableCommandInfoKHR, command);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command);
+    CLEXT_CALL_DISPATCH(clGetMutableCommandInfoKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetMutableCommandInfoKHR == nullptr) {
+        CLEXT_CALL_MISSING(clGetMutableCommandInfoKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clGetMutableCommandInfoKHR(
+        command,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+    CLEXT_CALL_ARGS(clGetMutableCommandInfoKHR, retVal, param_value_size, command, param_name, param_value_size, param_value, param_value_size_ret);
+    CLEXT_CALL_END(clGetMutableCommandInfoKHR, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_khr_command_buffer_mutable_dispatch)
+
+#if defined(cl_khr_create_command_queue)
 
-cl_mem CL_API_CALL clCreateFromEGLImageKHR(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_command_queue CL_API_CALL clCreateCommandQueueWithPropertiesKHR(
+    cl_context context,
+    cl_device_id device,
+    const cl_queue_properties_khr* properties,
+    cl_int* errcode_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateCommandQueueWithPropertiesKHR,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clCreateCommandQueueWithPropertiesKHR_clextfn)function)(
+        context,
+        device,
+        properties,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY cl_command_queue CL_API_CALL clCreateCommandQueueWithPropertiesKHR(
+    cl_context context,
+    cl_device_id device,
+    const cl_queue_properties_khr* properties,
+    cl_int* errcode_ret)
+{
+    CLEXT_CALL_BEGIN(clCreateCommandQueueWithPropertiesKHR, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateCommandQueueWithPropertiesKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateCommandQueueWithPropertiesKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCreateCommandQueueWithPropertiesKHR, dispatch_ptr);
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
+    }
+    cl_command_queue retVal = dispatch_ptr->clCreateCommandQueueWithPropertiesKHR(
+        context,
+        device,
+        properties,
+        errcode_ret);
+    CLEXT_CALL_ARGS(clCreateCommandQueueWithPropertiesKHR, *errcode_ret, 0, context, device, properties, errcode_ret);
+    CLEXT_CALL_END(clCreateCommandQueueWithPropertiesKHR, *errcode_ret);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_khr_create_command_queue)
+
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_khr_d3d10_sharing)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetDeviceIDsFromD3D10KHR(
+    cl_platform_id platform,
+    cl_d3d10_device_source_khr d3d_device_source,
+    void* d3d_object,
+    cl_d3d10_device_set_khr d3d_device_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetDeviceIDsFromD3D10KHR,
+        (const void*)(platform),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetDeviceIDsFromD3D10KHR_clextfn)function)(
+        platform,
+        d3d_device_source,
+        d3d_object,
+        d3d_device_set,
+        num_entries,
+        devices,
+        num_devices);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetDeviceIDsFromD3D10KHR(
+    cl_platform_id platform,
+    cl_d3d10_device_source_khr d3d_device_source,
+    void* d3d_object,
+    cl_d3d10_device_set_khr d3d_device_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices)
+{
+    CLEXT_CALL_BEGIN(clGetDeviceIDsFromD3D10KHR, platform);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(platform);
+    CLEXT_CALL_DISPATCH(clGetDeviceIDsFromD3D10KHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetDeviceIDsFromD3D10KHR == nullptr) {
+        CLEXT_CALL_MISSING(clGetDeviceIDsFromD3D10KHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clGetDeviceIDsFromD3D10KHR(
+        platform,
+        d3d_device_source,
+        d3d_object,
+        d3d_device_set,
+        num_entries,
+        devices,
+        num_devices);
+    CLEXT_CALL_ARGS(clGetDeviceIDsFromD3D10KHR, retVal, 0, platform, d3d_device_source, d3d_object, d3d_device_set, num_entries, devices, num_devices);
+    CLEXT_CALL_END(clGetDeviceIDsFromD3D10KHR, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromD3D10BufferKHR(
     cl_context context,
-    CLeglDisplayKHR egldisplay,
-    CLeglImageKHR eglimage,
     cl_mem_flags flags,
-    const cl_egl_image_properties_khr* properties,
+    ID3D10Buffer* resource,
+    cl_int* errcode_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateFromD3D10BufferKHR,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clCreateFromD3D10BufferKHR_clextfn)function)(
+        context,
+        flags,
+        resource,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromD3D10BufferKHR(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D10Buffer* resource,
     cl_int* errcode_ret)
 {
+    CLEXT_CALL_BEGIN(clCreateFromD3D10BufferKHR, context);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromEGLImageKHR == nullptr) {
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateFromD3D10BufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromD3D10BufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCreateFromD3D10BufferKHR, dispatch_ptr);
         if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
         return nullptr;
     }
-    return dispatch_ptr->clCreateFromEGLImageKHR(
+    cl_mem retVal = dispatch_ptr->clCreateFromD3D10BufferKHR(
         context,
-        egldisplay,
-        eglimage,
         flags,
-        properties,
+        resource,
+        errcode_ret);
+    CLEXT_CALL_ARGS(clCreateFromD3D10BufferKHR, *errcode_ret, 0, context, flags, resource, errcode_ret);
+    CLEXT_CALL_END(clCreateFromD3D10BufferKHR, *errcode_ret);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromD3D10Texture2DKHR(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D10Texture2D* resource,
+    UINT subresource,
+    cl_int* errcode_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateFromD3D10Texture2DKHR,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clCreateFromD3D10Texture2DKHR_clextfn)function)(
+        context,
+        flags,
+        resource,
+        subresource,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromD3D10Texture2DKHR(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D10Texture2D* resource,
+    UINT subresource,
+    cl_int* errcode_ret)
+{
+    CLEXT_CALL_BEGIN(clCreateFromD3D10Texture2DKHR, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateFromD3D10Texture2DKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromD3D10Texture2DKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCreateFromD3D10Texture2DKHR, dispatch_ptr);
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
+    }
+    cl_mem retVal = dispatch_ptr->clCreateFromD3D10Texture2DKHR(
+        context,
+        flags,
+        resource,
+        subresource,
         errcode_ret);
+    CLEXT_CALL_ARGS(clCreateFromD3D10Texture2DKHR, *errcode_ret, 0, context, flags, resource, subresource, errcode_ret);
+    CLEXT_CALL_END(clCreateFromD3D10Texture2DKHR, *errcode_ret);
+    return retVal;
 }
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromD3D10Texture3DKHR(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D10Texture3D* resource,
+    UINT subresource,
+    cl_int* errcode_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateFromD3D10Texture3DKHR,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clCreateFromD3D10Texture3DKHR_clextfn)function)(
+        context,
+        flags,
+        resource,
+        subresource,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromD3D10Texture3DKHR(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D10Texture3D* resource,
+    UINT subresource,
+    cl_int* errcode_ret)
+{
+    CLEXT_CALL_BEGIN(clCreateFromD3D10Texture3DKHR, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateFromD3D10Texture3DKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromD3D10Texture3DKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCreateFromD3D10Texture3DKHR, dispatch_ptr);
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
+    }
+    cl_mem retVal = dispatch_ptr->clCreateFromD3D10Texture3DKHR(
+        context,
+        flags,
+        resource,
+        subresource,
+        errcode_ret);
+    CLEXT_CALL_ARGS(clCreateFromD3D10Texture3DKHR, *errcode_ret, 0, context, flags, resource, subresource, errcode_ret);
+    CLEXT_CALL_END(clCreateFromD3D10Texture3DKHR, *errcode_ret);
+    return retVal;
+}
+#endif
 
-cl_int CL_API_CALL clEnqueueAcquireEGLObjectsKHR(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueAcquireD3D10ObjectsKHR(
     cl_command_queue command_queue,
     cl_uint num_objects,
     const cl_mem* mem_objects,
@@ -3084,11 +4117,12 @@ cl_int CL_API_CALL clEnqueueAcquireEGLObjectsKHR(
     const cl_event* event_wait_list,
     cl_event* event)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueAcquireEGLObjectsKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clEnqueueAcquireEGLObjectsKHR(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueAcquireD3D10ObjectsKHR,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueAcquireD3D10ObjectsKHR_clextfn)function)(
         command_queue,
         num_objects,
         mem_objects,
@@ -3096,8 +4130,8 @@ cl_int CL_API_CALL clEnqueueAcquireEGLObjectsKHR(
         event_wait_list,
         event);
 }
-
-cl_int CL_API_CALL clEnqueueReleaseEGLObjectsKHR(
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueAcquireD3D10ObjectsKHR(
     cl_command_queue command_queue,
     cl_uint num_objects,
     const cl_mem* mem_objects,
@@ -3105,1562 +4139,5511 @@ cl_int CL_API_CALL clEnqueueReleaseEGLObjectsKHR(
     const cl_event* event_wait_list,
     cl_event* event)
 {
+    CLEXT_CALL_BEGIN(clEnqueueAcquireD3D10ObjectsKHR, command_queue);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueReleaseEGLObjectsKHR == nullptr) {
+    CLEXT_CALL_DISPATCH(clEnqueueAcquireD3D10ObjectsKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueAcquireD3D10ObjectsKHR == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueAcquireD3D10ObjectsKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clEnqueueReleaseEGLObjectsKHR(
+    cl_int retVal = dispatch_ptr->clEnqueueAcquireD3D10ObjectsKHR(
         command_queue,
         num_objects,
         mem_objects,
         num_events_in_wait_list,
         event_wait_list,
         event);
+    CLEXT_CALL_ARGS(clEnqueueAcquireD3D10ObjectsKHR, retVal, 0, command_queue, num_objects, mem_objects, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueAcquireD3D10ObjectsKHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_khr_egl_image)
-#endif // defined(CLEXT_INCLUDE_EGL)
-
-
-#if defined(cl_khr_external_memory)
-
-cl_int CL_API_CALL clEnqueueAcquireExternalMemObjectsKHR(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueReleaseD3D10ObjectsKHR(
     cl_command_queue command_queue,
-    cl_uint num_mem_objects,
+    cl_uint num_objects,
     const cl_mem* mem_objects,
     cl_uint num_events_in_wait_list,
     const cl_event* event_wait_list,
     cl_event* event)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueAcquireExternalMemObjectsKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clEnqueueAcquireExternalMemObjectsKHR(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueReleaseD3D10ObjectsKHR,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueReleaseD3D10ObjectsKHR_clextfn)function)(
         command_queue,
-        num_mem_objects,
+        num_objects,
         mem_objects,
         num_events_in_wait_list,
         event_wait_list,
         event);
 }
-
-cl_int CL_API_CALL clEnqueueReleaseExternalMemObjectsKHR(
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueReleaseD3D10ObjectsKHR(
     cl_command_queue command_queue,
-    cl_uint num_mem_objects,
+    cl_uint num_objects,
     const cl_mem* mem_objects,
     cl_uint num_events_in_wait_list,
     const cl_event* event_wait_list,
     cl_event* event)
 {
+    CLEXT_CALL_BEGIN(clEnqueueReleaseD3D10ObjectsKHR, command_queue);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueReleaseExternalMemObjectsKHR == nullptr) {
+    CLEXT_CALL_DISPATCH(clEnqueueReleaseD3D10ObjectsKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueReleaseD3D10ObjectsKHR == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueReleaseD3D10ObjectsKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clEnqueueReleaseExternalMemObjectsKHR(
+    cl_int retVal = dispatch_ptr->clEnqueueReleaseD3D10ObjectsKHR(
         command_queue,
-        num_mem_objects,
+        num_objects,
         mem_objects,
         num_events_in_wait_list,
         event_wait_list,
         event);
+    CLEXT_CALL_ARGS(clEnqueueReleaseD3D10ObjectsKHR, retVal, 0, command_queue, num_objects, mem_objects, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueReleaseD3D10ObjectsKHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_khr_external_memory)
+#endif // defined(cl_khr_d3d10_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D10)
 
-#if defined(cl_khr_external_semaphore)
 
-cl_int CL_API_CALL clGetSemaphoreHandleForTypeKHR(
-    cl_semaphore_khr sema_object,
-    cl_device_id device,
-    cl_external_semaphore_handle_type_khr handle_type,
-    size_t handle_size,
-    void* handle_ptr,
-    size_t* handle_size_ret)
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_khr_d3d11_sharing)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetDeviceIDsFromD3D11KHR(
+    cl_platform_id platform,
+    cl_d3d11_device_source_khr d3d_device_source,
+    void* d3d_object,
+    cl_d3d11_device_set_khr d3d_device_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(sema_object);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetSemaphoreHandleForTypeKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clGetSemaphoreHandleForTypeKHR(
-        sema_object,
-        device,
-        handle_type,
-        handle_size,
-        handle_ptr,
-        handle_size_ret);
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetDeviceIDsFromD3D11KHR,
+        (const void*)(platform),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetDeviceIDsFromD3D11KHR_clextfn)function)(
+        platform,
+        d3d_device_source,
+        d3d_object,
+        d3d_device_set,
+        num_entries,
+        devices,
+        num_devices);
 }
-
-#endif // defined(cl_khr_external_semaphore)
-
-#if defined(cl_khr_external_semaphore_sync_fd)
-
-cl_int CL_API_CALL clReImportSemaphoreSyncFdKHR(
-    cl_semaphore_khr sema_object,
-    cl_semaphore_reimport_properties_khr* reimport_props,
-    int fd)
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetDeviceIDsFromD3D11KHR(
+    cl_platform_id platform,
+    cl_d3d11_device_source_khr d3d_device_source,
+    void* d3d_object,
+    cl_d3d11_device_set_khr d3d_device_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(sema_object);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clReImportSemaphoreSyncFdKHR == nullptr) {
+    CLEXT_CALL_BEGIN(clGetDeviceIDsFromD3D11KHR, platform);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(platform);
+    CLEXT_CALL_DISPATCH(clGetDeviceIDsFromD3D11KHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetDeviceIDsFromD3D11KHR == nullptr) {
+        CLEXT_CALL_MISSING(clGetDeviceIDsFromD3D11KHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clReImportSemaphoreSyncFdKHR(
-        sema_object,
-        reimport_props,
-        fd);
+    cl_int retVal = dispatch_ptr->clGetDeviceIDsFromD3D11KHR(
+        platform,
+        d3d_device_source,
+        d3d_object,
+        d3d_device_set,
+        num_entries,
+        devices,
+        num_devices);
+    CLEXT_CALL_ARGS(clGetDeviceIDsFromD3D11KHR, retVal, 0, platform, d3d_device_source, d3d_object, d3d_device_set, num_entries, devices, num_devices);
+    CLEXT_CALL_END(clGetDeviceIDsFromD3D11KHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_khr_external_semaphore_sync_fd)
-
-#if defined(CLEXT_INCLUDE_GL)
-#if defined(cl_khr_gl_event)
-
-cl_event CL_API_CALL clCreateEventFromGLsyncKHR(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromD3D11BufferKHR(
     cl_context context,
-    cl_GLsync sync,
+    cl_mem_flags flags,
+    ID3D11Buffer* resource,
+    cl_int* errcode_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateFromD3D11BufferKHR,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clCreateFromD3D11BufferKHR_clextfn)function)(
+        context,
+        flags,
+        resource,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromD3D11BufferKHR(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D11Buffer* resource,
     cl_int* errcode_ret)
 {
+    CLEXT_CALL_BEGIN(clCreateFromD3D11BufferKHR, context);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateEventFromGLsyncKHR == nullptr) {
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateFromD3D11BufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromD3D11BufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCreateFromD3D11BufferKHR, dispatch_ptr);
         if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
         return nullptr;
     }
-    return dispatch_ptr->clCreateEventFromGLsyncKHR(
+    cl_mem retVal = dispatch_ptr->clCreateFromD3D11BufferKHR(
         context,
-        sync,
+        flags,
+        resource,
         errcode_ret);
+    CLEXT_CALL_ARGS(clCreateFromD3D11BufferKHR, *errcode_ret, 0, context, flags, resource, errcode_ret);
+    CLEXT_CALL_END(clCreateFromD3D11BufferKHR, *errcode_ret);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_khr_gl_event)
-#endif // defined(CLEXT_INCLUDE_GL)
-
-
-#if defined(cl_khr_il_program)
-
-cl_program CL_API_CALL clCreateProgramWithILKHR(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromD3D11Texture2DKHR(
     cl_context context,
-    const void* il,
-    size_t length,
+    cl_mem_flags flags,
+    ID3D11Texture2D* resource,
+    UINT subresource,
+    cl_int* errcode_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateFromD3D11Texture2DKHR,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clCreateFromD3D11Texture2DKHR_clextfn)function)(
+        context,
+        flags,
+        resource,
+        subresource,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromD3D11Texture2DKHR(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D11Texture2D* resource,
+    UINT subresource,
     cl_int* errcode_ret)
 {
+    CLEXT_CALL_BEGIN(clCreateFromD3D11Texture2DKHR, context);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateProgramWithILKHR == nullptr) {
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateFromD3D11Texture2DKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromD3D11Texture2DKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCreateFromD3D11Texture2DKHR, dispatch_ptr);
         if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
         return nullptr;
     }
-    return dispatch_ptr->clCreateProgramWithILKHR(
+    cl_mem retVal = dispatch_ptr->clCreateFromD3D11Texture2DKHR(
         context,
-        il,
-        length,
+        flags,
+        resource,
+        subresource,
         errcode_ret);
+    CLEXT_CALL_ARGS(clCreateFromD3D11Texture2DKHR, *errcode_ret, 0, context, flags, resource, subresource, errcode_ret);
+    CLEXT_CALL_END(clCreateFromD3D11Texture2DKHR, *errcode_ret);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_khr_il_program)
-
-#if defined(cl_khr_semaphore)
-
-cl_semaphore_khr CL_API_CALL clCreateSemaphoreWithPropertiesKHR(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromD3D11Texture3DKHR(
     cl_context context,
-    const cl_semaphore_properties_khr* sema_props,
+    cl_mem_flags flags,
+    ID3D11Texture3D* resource,
+    UINT subresource,
+    cl_int* errcode_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateFromD3D11Texture3DKHR,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clCreateFromD3D11Texture3DKHR_clextfn)function)(
+        context,
+        flags,
+        resource,
+        subresource,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromD3D11Texture3DKHR(
+    cl_context context,
+    cl_mem_flags flags,
+    ID3D11Texture3D* resource,
+    UINT subresource,
     cl_int* errcode_ret)
 {
+    CLEXT_CALL_BEGIN(clCreateFromD3D11Texture3DKHR, context);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateSemaphoreWithPropertiesKHR == nullptr) {
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateFromD3D11Texture3DKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromD3D11Texture3DKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCreateFromD3D11Texture3DKHR, dispatch_ptr);
         if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
         return nullptr;
     }
-    return dispatch_ptr->clCreateSemaphoreWithPropertiesKHR(
+    cl_mem retVal = dispatch_ptr->clCreateFromD3D11Texture3DKHR(
         context,
-        sema_props,
+        flags,
+        resource,
+        subresource,
         errcode_ret);
+    CLEXT_CALL_ARGS(clCreateFromD3D11Texture3DKHR, *errcode_ret, 0, context, flags, resource, subresource, errcode_ret);
+    CLEXT_CALL_END(clCreateFromD3D11Texture3DKHR, *errcode_ret);
+    return retVal;
 }
+#endif
 
-cl_int CL_API_CALL clEnqueueWaitSemaphoresKHR(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueAcquireD3D11ObjectsKHR(
     cl_command_queue command_queue,
-    cl_uint num_sema_objects,
-    const cl_semaphore_khr* sema_objects,
-    const cl_semaphore_payload_khr* sema_payload_list,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
     cl_uint num_events_in_wait_list,
     const cl_event* event_wait_list,
     cl_event* event)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueWaitSemaphoresKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clEnqueueWaitSemaphoresKHR(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueAcquireD3D11ObjectsKHR,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueAcquireD3D11ObjectsKHR_clextfn)function)(
         command_queue,
-        num_sema_objects,
-        sema_objects,
-        sema_payload_list,
+        num_objects,
+        mem_objects,
         num_events_in_wait_list,
         event_wait_list,
         event);
 }
-
-cl_int CL_API_CALL clEnqueueSignalSemaphoresKHR(
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueAcquireD3D11ObjectsKHR(
     cl_command_queue command_queue,
-    cl_uint num_sema_objects,
-    const cl_semaphore_khr* sema_objects,
-    const cl_semaphore_payload_khr* sema_payload_list,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
     cl_uint num_events_in_wait_list,
     const cl_event* event_wait_list,
     cl_event* event)
 {
+    CLEXT_CALL_BEGIN(clEnqueueAcquireD3D11ObjectsKHR, command_queue);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueSignalSemaphoresKHR == nullptr) {
+    CLEXT_CALL_DISPATCH(clEnqueueAcquireD3D11ObjectsKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueAcquireD3D11ObjectsKHR == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueAcquireD3D11ObjectsKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clEnqueueSignalSemaphoresKHR(
+    cl_int retVal = dispatch_ptr->clEnqueueAcquireD3D11ObjectsKHR(
         command_queue,
-        num_sema_objects,
-        sema_objects,
-        sema_payload_list,
+        num_objects,
+        mem_objects,
         num_events_in_wait_list,
         event_wait_list,
         event);
+    CLEXT_CALL_ARGS(clEnqueueAcquireD3D11ObjectsKHR, retVal, 0, command_queue, num_objects, mem_objects, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueAcquireD3D11ObjectsKHR, retVal);
+    return retVal;
 }
+#endif
 
-cl_int CL_API_CALL clGetSemaphoreInfoKHR(
-    cl_semaphore_khr sema_object,
-    cl_semaphore_info_khr param_name,
-    size_t param_value_size,
-    void* param_value,
-    size_t* param_value_size_ret)
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueReleaseD3D11ObjectsKHR(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(sema_object);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetSemaphoreInfoKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clGetSemaphoreInfoKHR(
-        sema_object,
-        param_name,
-        param_value_size,
-        param_value,
-        param_value_size_ret);
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueReleaseD3D11ObjectsKHR,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueReleaseD3D11ObjectsKHR_clextfn)function)(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
 }
-
-cl_int CL_API_CALL clReleaseSemaphoreKHR(
-    cl_semaphore_khr sema_object)
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueReleaseD3D11ObjectsKHR(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(sema_object);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clReleaseSemaphoreKHR == nullptr) {
+    CLEXT_CALL_BEGIN(clEnqueueReleaseD3D11ObjectsKHR, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueReleaseD3D11ObjectsKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueReleaseD3D11ObjectsKHR == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueReleaseD3D11ObjectsKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clReleaseSemaphoreKHR(
-        sema_object);
+    cl_int retVal = dispatch_ptr->clEnqueueReleaseD3D11ObjectsKHR(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueReleaseD3D11ObjectsKHR, retVal, 0, command_queue, num_objects, mem_objects, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueReleaseD3D11ObjectsKHR, retVal);
+    return retVal;
 }
+#endif
 
-cl_int CL_API_CALL clRetainSemaphoreKHR(
-    cl_semaphore_khr sema_object)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(sema_object);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clRetainSemaphoreKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clRetainSemaphoreKHR(
-        sema_object);
-}
+#endif // defined(cl_khr_d3d11_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D11)
 
-#endif // defined(cl_khr_semaphore)
 
-#if defined(cl_khr_subgroups)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_khr_dx9_media_sharing)
 
-cl_int CL_API_CALL clGetKernelSubGroupInfoKHR(
-    cl_kernel in_kernel,
-    cl_device_id in_device,
-    cl_kernel_sub_group_info param_name,
-    size_t input_value_size,
-    const void* input_value,
-    size_t param_value_size,
-    void* param_value,
-    size_t* param_value_size_ret)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(in_kernel);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetKernelSubGroupInfoKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clGetKernelSubGroupInfoKHR(
-        in_kernel,
-        in_device,
-        param_name,
-        input_value_size,
-        input_value,
-        param_value_size,
-        param_value,
-        param_value_size_ret);
-}
-
-#endif // defined(cl_khr_subgroups)
-
-#if defined(cl_khr_suggested_local_work_size)
-
-cl_int CL_API_CALL clGetKernelSuggestedLocalWorkSizeKHR(
-    cl_command_queue command_queue,
-    cl_kernel kernel,
-    cl_uint work_dim,
-    const size_t* global_work_offset,
-    const size_t* global_work_size,
-    size_t* suggested_local_work_size)
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetDeviceIDsFromDX9MediaAdapterKHR(
+    cl_platform_id platform,
+    cl_uint num_media_adapters,
+    cl_dx9_media_adapter_type_khr* media_adapter_type,
+    void* media_adapters,
+    cl_dx9_media_adapter_set_khr media_adapter_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetKernelSuggestedLocalWorkSizeKHR == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clGetKernelSuggestedLocalWorkSizeKHR(
-        command_queue,
-        kernel,
-        work_dim,
-        global_work_offset,
-        global_work_size,
-        suggested_local_work_size);
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetDeviceIDsFromDX9MediaAdapterKHR,
+        (const void*)(platform),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetDeviceIDsFromDX9MediaAdapterKHR_clextfn)function)(
+        platform,
+        num_media_adapters,
+        media_adapter_type,
+        media_adapters,
+        media_adapter_set,
+        num_entries,
+        devices,
+        num_devices);
 }
-
-#endif // defined(cl_khr_suggested_local_work_size)
-
-#if defined(cl_khr_terminate_context)
-
-cl_int CL_API_CALL clTerminateContextKHR(
-    cl_context context)
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetDeviceIDsFromDX9MediaAdapterKHR(
+    cl_platform_id platform,
+    cl_uint num_media_adapters,
+    cl_dx9_media_adapter_type_khr* media_adapter_type,
+    void* media_adapters,
+    cl_dx9_media_adapter_set_khr media_adapter_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clTerminateContextKHR == nullptr) {
+    CLEXT_CALL_BEGIN(clGetDeviceIDsFromDX9MediaAdapterKHR, platform);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(platform);
+    CLEXT_CALL_DISPATCH(clGetDeviceIDsFromDX9MediaAdapterKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetDeviceIDsFromDX9MediaAdapterKHR == nullptr) {
+        CLEXT_CALL_MISSING(clGetDeviceIDsFromDX9MediaAdapterKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clTerminateContextKHR(
-        context);
+    cl_int retVal = dispatch_ptr->clGetDeviceIDsFromDX9MediaAdapterKHR(
+        platform,
+        num_media_adapters,
+        media_adapter_type,
+        media_adapters,
+        media_adapter_set,
+        num_entries,
+        devices,
+        num_devices);
+    CLEXT_CALL_ARGS(clGetDeviceIDsFromDX9MediaAdapterKHR, retVal, 0, platform, num_media_adapters, media_adapter_type, media_adapters, media_adapter_set, num_entries, devices, num_devices);
+    CLEXT_CALL_END(clGetDeviceIDsFromDX9MediaAdapterKHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_khr_terminate_context)
-
-#if defined(cl_ext_buffer_device_address)
-
-cl_int CL_API_CALL clSetKernelArgDevicePointerEXT(
-    cl_kernel kernel,
-    cl_uint arg_index,
-    cl_mem_device_address_ext arg_value)
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromDX9MediaSurfaceKHR(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_dx9_media_adapter_type_khr adapter_type,
+    void* surface_info,
+    cl_uint plane,
+    cl_int* errcode_ret)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(kernel);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clSetKernelArgDevicePointerEXT == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clSetKernelArgDevicePointerEXT(
-        kernel,
-        arg_index,
-        arg_value);
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateFromDX9MediaSurfaceKHR,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clCreateFromDX9MediaSurfaceKHR_clextfn)function)(
+        context,
+        flags,
+        adapter_type,
+        surface_info,
+        plane,
+        errcode_ret);
 }
-
-#endif // defined(cl_ext_buffer_device_address)
-
-#if defined(cl_ext_device_fission)
-
-cl_int CL_API_CALL clReleaseDeviceEXT(
-    cl_device_id device)
+#else
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromDX9MediaSurfaceKHR(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_dx9_media_adapter_type_khr adapter_type,
+    void* surface_info,
+    cl_uint plane,
+    cl_int* errcode_ret)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(device);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clReleaseDeviceEXT == nullptr) {
-        return CL_INVALID_OPERATION;
+    CLEXT_CALL_BEGIN(clCreateFromDX9MediaSurfaceKHR, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateFromDX9MediaSurfaceKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromDX9MediaSurfaceKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCreateFromDX9MediaSurfaceKHR, dispatch_ptr);
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
     }
-    return dispatch_ptr->clReleaseDeviceEXT(
-        device);
+    cl_mem retVal = dispatch_ptr->clCreateFromDX9MediaSurfaceKHR(
+        context,
+        flags,
+        adapter_type,
+        surface_info,
+        plane,
+        errcode_ret);
+    CLEXT_CALL_ARGS(clCreateFromDX9MediaSurfaceKHR, *errcode_ret, 0, context, flags, adapter_type, surface_info, plane, errcode_ret);
+    CLEXT_CALL_END(clCreateFromDX9MediaSurfaceKHR, *errcode_ret);
+    return retVal;
 }
+#endif
 
-cl_int CL_API_CALL clRetainDeviceEXT(
-    cl_device_id device)
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueAcquireDX9MediaSurfacesKHR(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(device);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clRetainDeviceEXT == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clRetainDeviceEXT(
-        device);
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueAcquireDX9MediaSurfacesKHR,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueAcquireDX9MediaSurfacesKHR_clextfn)function)(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
 }
-
-cl_int CL_API_CALL clCreateSubDevicesEXT(
-    cl_device_id in_device,
-    const cl_device_partition_property_ext* properties,
-    cl_uint num_entries,
-    cl_device_id* out_devices,
-    cl_uint* num_devices)
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueAcquireDX9MediaSurfacesKHR(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(in_device);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateSubDevicesEXT == nullptr) {
+    CLEXT_CALL_BEGIN(clEnqueueAcquireDX9MediaSurfacesKHR, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueAcquireDX9MediaSurfacesKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueAcquireDX9MediaSurfacesKHR == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueAcquireDX9MediaSurfacesKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clCreateSubDevicesEXT(
-        in_device,
-        properties,
-        num_entries,
-        out_devices,
-        num_devices);
+    cl_int retVal = dispatch_ptr->clEnqueueAcquireDX9MediaSurfacesKHR(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueAcquireDX9MediaSurfacesKHR, retVal, 0, command_queue, num_objects, mem_objects, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueAcquireDX9MediaSurfacesKHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_ext_device_fission)
-
-#if defined(cl_ext_image_requirements_info)
-
-cl_int CL_API_CALL clGetImageRequirementsInfoEXT(
-    cl_context context,
-    const cl_mem_properties* properties,
-    cl_mem_flags flags,
-    const cl_image_format* image_format,
-    const cl_image_desc* image_desc,
-    cl_image_requirements_info_ext param_name,
-    size_t param_value_size,
-    void* param_value,
-    size_t* param_value_size_ret)
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueReleaseDX9MediaSurfacesKHR(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetImageRequirementsInfoEXT == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clGetImageRequirementsInfoEXT(
-        context,
-        properties,
-        flags,
-        image_format,
-        image_desc,
-        param_name,
-        param_value_size,
-        param_value,
-        param_value_size_ret);
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueReleaseDX9MediaSurfacesKHR,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueReleaseDX9MediaSurfacesKHR_clextfn)function)(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
 }
-
-#endif // defined(cl_ext_image_requirements_info)
-
-#if defined(cl_ext_migrate_memobject)
-
-cl_int CL_API_CALL clEnqueueMigrateMemObjectEXT(
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueReleaseDX9MediaSurfacesKHR(
     cl_command_queue command_queue,
-    cl_uint num_mem_objects,
+    cl_uint num_objects,
     const cl_mem* mem_objects,
-    cl_mem_migration_flags_ext flags,
     cl_uint num_events_in_wait_list,
     const cl_event* event_wait_list,
     cl_event* event)
 {
+    CLEXT_CALL_BEGIN(clEnqueueReleaseDX9MediaSurfacesKHR, command_queue);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueMigrateMemObjectEXT == nullptr) {
+    CLEXT_CALL_DISPATCH(clEnqueueReleaseDX9MediaSurfacesKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueReleaseDX9MediaSurfacesKHR == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueReleaseDX9MediaSurfacesKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clEnqueueMigrateMemObjectEXT(
+    cl_int retVal = dispatch_ptr->clEnqueueReleaseDX9MediaSurfacesKHR(
         command_queue,
-        num_mem_objects,
+        num_objects,
         mem_objects,
-        flags,
         num_events_in_wait_list,
         event_wait_list,
         event);
+    CLEXT_CALL_ARGS(clEnqueueReleaseDX9MediaSurfacesKHR, retVal, 0, command_queue, num_objects, mem_objects, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueReleaseDX9MediaSurfacesKHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_ext_migrate_memobject)
+#endif // defined(cl_khr_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
 
-#if defined(cl_arm_import_memory)
 
-cl_mem CL_API_CALL clImportMemoryARM(
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_event)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_event CL_API_CALL clCreateEventFromEGLSyncKHR(
     cl_context context,
-    cl_mem_flags flags,
-    const cl_import_properties_arm* properties,
-    void* memory,
-    size_t size,
+    CLeglSyncKHR sync,
+    CLeglDisplayKHR display,
     cl_int* errcode_ret)
 {
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateEventFromEGLSyncKHR,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clCreateEventFromEGLSyncKHR_clextfn)function)(
+        context,
+        sync,
+        display,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY cl_event CL_API_CALL clCreateEventFromEGLSyncKHR(
+    cl_context context,
+    CLeglSyncKHR sync,
+    CLeglDisplayKHR display,
+    cl_int* errcode_ret)
+{
+    CLEXT_CALL_BEGIN(clCreateEventFromEGLSyncKHR, context);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clImportMemoryARM == nullptr) {
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateEventFromEGLSyncKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateEventFromEGLSyncKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCreateEventFromEGLSyncKHR, dispatch_ptr);
         if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
         return nullptr;
     }
-    return dispatch_ptr->clImportMemoryARM(
+    cl_event retVal = dispatch_ptr->clCreateEventFromEGLSyncKHR(
         context,
-        flags,
-        properties,
-        memory,
-        size,
+        sync,
+        display,
         errcode_ret);
+    CLEXT_CALL_ARGS(clCreateEventFromEGLSyncKHR, *errcode_ret, 0, context, sync, display, errcode_ret);
+    CLEXT_CALL_END(clCreateEventFromEGLSyncKHR, *errcode_ret);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_arm_import_memory)
+#endif // defined(cl_khr_egl_event)
+#endif // defined(CLEXT_INCLUDE_EGL)
 
-#if defined(cl_arm_shared_virtual_memory)
 
-void* CL_API_CALL clSVMAllocARM(
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_image)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromEGLImageKHR(
     cl_context context,
-    cl_svm_mem_flags_arm flags,
-    size_t size,
-    cl_uint alignment)
+    CLeglDisplayKHR egldisplay,
+    CLeglImageKHR eglimage,
+    cl_mem_flags flags,
+    const cl_egl_image_properties_khr* properties,
+    cl_int* errcode_ret)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clSVMAllocARM == nullptr) {
-        return nullptr;
-    }
-    return dispatch_ptr->clSVMAllocARM(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateFromEGLImageKHR,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clCreateFromEGLImageKHR_clextfn)function)(
         context,
+        egldisplay,
+        eglimage,
         flags,
-        size,
-        alignment);
+        properties,
+        errcode_ret);
 }
-
-void CL_API_CALL clSVMFreeARM(
+#else
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromEGLImageKHR(
     cl_context context,
-    void* svm_pointer)
+    CLeglDisplayKHR egldisplay,
+    CLeglImageKHR eglimage,
+    cl_mem_flags flags,
+    const cl_egl_image_properties_khr* properties,
+    cl_int* errcode_ret)
 {
+    CLEXT_CALL_BEGIN(clCreateFromEGLImageKHR, context);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clSVMFreeARM == nullptr) {
-        return;
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateFromEGLImageKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromEGLImageKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCreateFromEGLImageKHR, dispatch_ptr);
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
     }
-    dispatch_ptr->clSVMFreeARM(
+    cl_mem retVal = dispatch_ptr->clCreateFromEGLImageKHR(
         context,
-        svm_pointer);
+        egldisplay,
+        eglimage,
+        flags,
+        properties,
+        errcode_ret);
+    CLEXT_CALL_ARGS(clCreateFromEGLImageKHR, *errcode_ret, 0, context, egldisplay, eglimage, flags, properties, errcode_ret);
+    CLEXT_CALL_END(clCreateFromEGLImageKHR, *errcode_ret);
+    return retVal;
 }
+#endif
 
-cl_int CL_API_CALL clEnqueueSVMFreeARM(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueAcquireEGLObjectsKHR(
     cl_command_queue command_queue,
-    cl_uint num_svm_pointers,
-    void* svm_pointers[],
-    void (CL_CALLBACK* pfn_free_func)(cl_command_queue queue, cl_uint num_svm_pointers, void * svm_pointers[], void *user_data),
-    void* user_data,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
     cl_uint num_events_in_wait_list,
     const cl_event* event_wait_list,
     cl_event* event)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueSVMFreeARM == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clEnqueueSVMFreeARM(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueAcquireEGLObjectsKHR,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueAcquireEGLObjectsKHR_clextfn)function)(
         command_queue,
-        num_svm_pointers,
-        svm_pointers,
-        pfn_free_func,
-        user_data,
+        num_objects,
+        mem_objects,
         num_events_in_wait_list,
         event_wait_list,
         event);
 }
-
-cl_int CL_API_CALL clEnqueueSVMMemcpyARM(
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueAcquireEGLObjectsKHR(
     cl_command_queue command_queue,
-    cl_bool blocking_copy,
-    void* dst_ptr,
-    const void* src_ptr,
-    size_t size,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
     cl_uint num_events_in_wait_list,
     const cl_event* event_wait_list,
     cl_event* event)
 {
+    CLEXT_CALL_BEGIN(clEnqueueAcquireEGLObjectsKHR, command_queue);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueSVMMemcpyARM == nullptr) {
+    CLEXT_CALL_DISPATCH(clEnqueueAcquireEGLObjectsKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueAcquireEGLObjectsKHR == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueAcquireEGLObjectsKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clEnqueueSVMMemcpyARM(
+    cl_int retVal = dispatch_ptr->clEnqueueAcquireEGLObjectsKHR(
         command_queue,
-        blocking_copy,
-        dst_ptr,
-        src_ptr,
-        size,
+        num_objects,
+        mem_objects,
         num_events_in_wait_list,
         event_wait_list,
         event);
+    CLEXT_CALL_ARGS(clEnqueueAcquireEGLObjectsKHR, retVal, 0, command_queue, num_objects, mem_objects, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueAcquireEGLObjectsKHR, retVal);
+    return retVal;
 }
+#endif
 
-cl_int CL_API_CALL clEnqueueSVMMemFillARM(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueReleaseEGLObjectsKHR(
     cl_command_queue command_queue,
-    void* svm_ptr,
-    const void* pattern,
-    size_t pattern_size,
-    size_t size,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
     cl_uint num_events_in_wait_list,
     const cl_event* event_wait_list,
     cl_event* event)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueSVMMemFillARM == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clEnqueueSVMMemFillARM(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueReleaseEGLObjectsKHR,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueReleaseEGLObjectsKHR_clextfn)function)(
         command_queue,
-        svm_ptr,
-        pattern,
-        pattern_size,
-        size,
+        num_objects,
+        mem_objects,
         num_events_in_wait_list,
         event_wait_list,
         event);
 }
-
-cl_int CL_API_CALL clEnqueueSVMMapARM(
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueReleaseEGLObjectsKHR(
     cl_command_queue command_queue,
-    cl_bool blocking_map,
-    cl_map_flags flags,
-    void* svm_ptr,
-    size_t size,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
     cl_uint num_events_in_wait_list,
     const cl_event* event_wait_list,
     cl_event* event)
 {
+    CLEXT_CALL_BEGIN(clEnqueueReleaseEGLObjectsKHR, command_queue);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueSVMMapARM == nullptr) {
+    CLEXT_CALL_DISPATCH(clEnqueueReleaseEGLObjectsKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueReleaseEGLObjectsKHR == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueReleaseEGLObjectsKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clEnqueueSVMMapARM(
+    cl_int retVal = dispatch_ptr->clEnqueueReleaseEGLObjectsKHR(
         command_queue,
-        blocking_map,
-        flags,
-        svm_ptr,
-        size,
+        num_objects,
+        mem_objects,
         num_events_in_wait_list,
         event_wait_list,
         event);
+    CLEXT_CALL_ARGS(clEnqueueReleaseEGLObjectsKHR, retVal, 0, command_queue, num_objects, mem_objects, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueReleaseEGLObjectsKHR, retVal);
+    return retVal;
 }
+#endif
 
-cl_int CL_API_CALL clEnqueueSVMUnmapARM(
+#endif // defined(cl_khr_egl_image)
+#endif // defined(CLEXT_INCLUDE_EGL)
+
+
+#if defined(cl_khr_external_memory)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueAcquireExternalMemObjectsKHR(
     cl_command_queue command_queue,
-    void* svm_ptr,
+    cl_uint num_mem_objects,
+    const cl_mem* mem_objects,
     cl_uint num_events_in_wait_list,
     const cl_event* event_wait_list,
     cl_event* event)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueSVMUnmapARM == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clEnqueueSVMUnmapARM(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueAcquireExternalMemObjectsKHR,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueAcquireExternalMemObjectsKHR_clextfn)function)(
         command_queue,
-        svm_ptr,
+        num_mem_objects,
+        mem_objects,
         num_events_in_wait_list,
         event_wait_list,
         event);
 }
-
-cl_int CL_API_CALL clSetKernelArgSVMPointerARM(
-    cl_kernel kernel,
-    cl_uint arg_index,
-    const void* arg_value)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(kernel);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clSetKernelArgSVMPointerARM == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clSetKernelArgSVMPointerARM(
-        kernel,
-        arg_index,
-        arg_value);
-}
-
-cl_int CL_API_CALL clSetKernelExecInfoARM(
-    cl_kernel kernel,
-    cl_kernel_exec_info_arm param_name,
-    size_t param_value_size,
-    const void* param_value)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(kernel);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clSetKernelExecInfoARM == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clSetKernelExecInfoARM(
-        kernel,
-        param_name,
-        param_value_size,
-        param_value);
-}
-
-#endif // defined(cl_arm_shared_virtual_memory)
-
-#if defined(cl_img_cancel_command)
-
-cl_int CL_API_CALL clCancelCommandsIMG(
-    const cl_event* event_list,
-    size_t num_events_in_list)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(num_events_in_list > 0 && event_list ? event_list[0] : nullptr);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCancelCommandsIMG == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clCancelCommandsIMG(
-        event_list,
-        num_events_in_list);
-}
-
-#endif // defined(cl_img_cancel_command)
-
-#if defined(cl_img_generate_mipmap)
-
-cl_int CL_API_CALL clEnqueueGenerateMipmapIMG(
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueAcquireExternalMemObjectsKHR(
     cl_command_queue command_queue,
-    cl_mem src_image,
-    cl_mem dst_image,
-    cl_mipmap_filter_mode_img mipmap_filter_mode,
-    const size_t* array_region,
-    const size_t* mip_region,
+    cl_uint num_mem_objects,
+    const cl_mem* mem_objects,
     cl_uint num_events_in_wait_list,
     const cl_event* event_wait_list,
     cl_event* event)
 {
+    CLEXT_CALL_BEGIN(clEnqueueAcquireExternalMemObjectsKHR, command_queue);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueGenerateMipmapIMG == nullptr) {
+    CLEXT_CALL_DISPATCH(clEnqueueAcquireExternalMemObjectsKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueAcquireExternalMemObjectsKHR == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueAcquireExternalMemObjectsKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clEnqueueGenerateMipmapIMG(
+    cl_int retVal = dispatch_ptr->clEnqueueAcquireExternalMemObjectsKHR(
         command_queue,
-        src_image,
-        dst_image,
-        mipmap_filter_mode,
-        array_region,
-        mip_region,
+        num_mem_objects,
+        mem_objects,
         num_events_in_wait_list,
         event_wait_list,
         event);
+    CLEXT_CALL_ARGS(clEnqueueAcquireExternalMemObjectsKHR, retVal, 0, command_queue, num_mem_objects, mem_objects, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueAcquireExternalMemObjectsKHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_img_generate_mipmap)
-
-#if defined(cl_img_use_gralloc_ptr)
-
-cl_int CL_API_CALL clEnqueueAcquireGrallocObjectsIMG(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueReleaseExternalMemObjectsKHR(
     cl_command_queue command_queue,
-    cl_uint num_objects,
+    cl_uint num_mem_objects,
     const cl_mem* mem_objects,
     cl_uint num_events_in_wait_list,
     const cl_event* event_wait_list,
     cl_event* event)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueAcquireGrallocObjectsIMG == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clEnqueueAcquireGrallocObjectsIMG(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueReleaseExternalMemObjectsKHR,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueReleaseExternalMemObjectsKHR_clextfn)function)(
         command_queue,
-        num_objects,
+        num_mem_objects,
         mem_objects,
         num_events_in_wait_list,
         event_wait_list,
         event);
 }
-
-cl_int CL_API_CALL clEnqueueReleaseGrallocObjectsIMG(
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueReleaseExternalMemObjectsKHR(
     cl_command_queue command_queue,
-    cl_uint num_objects,
+    cl_uint num_mem_objects,
     const cl_mem* mem_objects,
     cl_uint num_events_in_wait_list,
     const cl_event* event_wait_list,
     cl_event* event)
 {
+    CLEXT_CALL_BEGIN(clEnqueueReleaseExternalMemObjectsKHR, command_queue);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueReleaseGrallocObjectsIMG == nullptr) {
+    CLEXT_CALL_DISPATCH(clEnqueueReleaseExternalMemObjectsKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueReleaseExternalMemObjectsKHR == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueReleaseExternalMemObjectsKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clEnqueueReleaseGrallocObjectsIMG(
+    cl_int retVal = dispatch_ptr->clEnqueueReleaseExternalMemObjectsKHR(
         command_queue,
-        num_objects,
+        num_mem_objects,
         mem_objects,
         num_events_in_wait_list,
         event_wait_list,
         event);
+    CLEXT_CALL_ARGS(clEnqueueReleaseExternalMemObjectsKHR, retVal, 0, command_queue, num_mem_objects, mem_objects, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueReleaseExternalMemObjectsKHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_img_use_gralloc_ptr)
+#endif // defined(cl_khr_external_memory)
 
-#if defined(cl_intel_accelerator)
+#if defined(cl_khr_external_semaphore)
 
-cl_accelerator_intel CL_API_CALL clCreateAcceleratorINTEL(
-    cl_context context,
-    cl_accelerator_type_intel accelerator_type,
-    size_t descriptor_size,
-    const void* descriptor,
-    cl_int* errcode_ret)
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetSemaphoreHandleForTypeKHR(
+    cl_semaphore_khr sema_object,
+    cl_device_id device,
+    cl_external_semaphore_handle_type_khr handle_type,
+    size_t handle_size,
+    void* handle_ptr,
+    size_t* handle_size_ret)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateAcceleratorINTEL == nullptr) {
-        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
-        return nullptr;
-    }
-    return dispatch_ptr->clCreateAcceleratorINTEL(
-        context,
-        accelerator_type,
-        descriptor_size,
-        descriptor,
-        errcode_ret);
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetSemaphoreHandleForTypeKHR,
+        (const void*)(sema_object),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetSemaphoreHandleForTypeKHR_clextfn)function)(
+        sema_object,
+        device,
+        handle_type,
+        handle_size,
+        handle_ptr,
+        handle_size_ret);
 }
-
-cl_int CL_API_CALL clGetAcceleratorInfoINTEL(
-    cl_accelerator_intel accelerator,
-    cl_accelerator_info_intel param_name,
-    size_t param_value_size,
-    void* param_value,
-    size_t* param_value_size_ret)
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetSemaphoreHandleForTypeKHR(
+    cl_semaphore_khr sema_object,
+    cl_device_id device,
+    cl_external_semaphore_handle_type_khr handle_type,
+    size_t handle_size,
+    void* handle_ptr,
+    size_t* handle_size_ret)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(accelerator);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetAcceleratorInfoINTEL == nullptr) {
+    CLEXT_CALL_BEGIN(clGetSemaphoreHandleForTypeKHR, sema_object);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(sema_object);
+    CLEXT_CALL_DISPATCH(clGetSemaphoreHandleForTypeKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetSemaphoreHandleForTypeKHR == nullptr) {
+        CLEXT_CALL_MISSING(clGetSemaphoreHandleForTypeKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clGetAcceleratorInfoINTEL(
-        accelerator,
-        param_name,
-        param_value_size,
-        param_value,
-        param_value_size_ret);
+    cl_int retVal = dispatch_ptr->clGetSemaphoreHandleForTypeKHR(
+        sema_object,
+        device,
+        handle_type,
+        handle_size,
+        handle_ptr,
+        handle_size_ret);
+    CLEXT_CALL_ARGS(clGetSemaphoreHandleForTypeKHR, retVal, 0, sema_object, device, handle_type, handle_size, handle_ptr, handle_size_ret);
+    CLEXT_CALL_END(clGetSemaphoreHandleForTypeKHR, retVal);
+    return retVal;
 }
+#endif
 
-cl_int CL_API_CALL clRetainAcceleratorINTEL(
-    cl_accelerator_intel accelerator)
+#endif // defined(cl_khr_external_semaphore)
+
+#if defined(cl_khr_external_semaphore_sync_fd)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clReImportSemaphoreSyncFdKHR(
+    cl_semaphore_khr sema_object,
+    cl_semaphore_reimport_properties_khr* reimport_props,
+    int fd)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(accelerator);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clRetainAcceleratorINTEL == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clRetainAcceleratorINTEL(
-        accelerator);
+    void* function = _resolve(
+        CLEXT_FUNCTION_clReImportSemaphoreSyncFdKHR,
+        (const void*)(sema_object),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clReImportSemaphoreSyncFdKHR_clextfn)function)(
+        sema_object,
+        reimport_props,
+        fd);
 }
-
-cl_int CL_API_CALL clReleaseAcceleratorINTEL(
-    cl_accelerator_intel accelerator)
+#else
+CL_API_ENTRY cl_int CL_API_CALL clReImportSemaphoreSyncFdKHR(
+    cl_semaphore_khr sema_object,
+    cl_semaphore_reimport_properties_khr* reimport_props,
+    int fd)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(accelerator);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clReleaseAcceleratorINTEL == nullptr) {
+    CLEXT_CALL_BEGIN(clReImportSemaphoreSyncFdKHR, sema_object);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(sema_object);
+    CLEXT_CALL_DISPATCH(clReImportSemaphoreSyncFdKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clReImportSemaphoreSyncFdKHR == nullptr) {
+        CLEXT_CALL_MISSING(clReImportSemaphoreSyncFdKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clReleaseAcceleratorINTEL(
-        accelerator);
+    cl_int retVal = dispatch_ptr->clReImportSemaphoreSyncFdKHR(
+        sema_object,
+        reimport_props,
+        fd);
+    CLEXT_CALL_ARGS(clReImportSemaphoreSyncFdKHR, retVal, 0, sema_object, reimport_props, fd);
+    CLEXT_CALL_END(clReImportSemaphoreSyncFdKHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_intel_accelerator)
+#endif // defined(cl_khr_external_semaphore_sync_fd)
 
-#if defined(cl_intel_create_buffer_with_properties)
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_khr_gl_event)
 
-cl_mem CL_API_CALL clCreateBufferWithPropertiesINTEL(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_event CL_API_CALL clCreateEventFromGLsyncKHR(
     cl_context context,
-    const cl_mem_properties_intel* properties,
-    cl_mem_flags flags,
-    size_t size,
-    void* host_ptr,
+    cl_GLsync sync,
+    cl_int* errcode_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateEventFromGLsyncKHR,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clCreateEventFromGLsyncKHR_clextfn)function)(
+        context,
+        sync,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY cl_event CL_API_CALL clCreateEventFromGLsyncKHR(
+    cl_context context,
+    cl_GLsync sync,
     cl_int* errcode_ret)
 {
+    CLEXT_CALL_BEGIN(clCreateEventFromGLsyncKHR, context);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateBufferWithPropertiesINTEL == nullptr) {
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateEventFromGLsyncKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateEventFromGLsyncKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCreateEventFromGLsyncKHR, dispatch_ptr);
         if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
         return nullptr;
     }
-    return dispatch_ptr->clCreateBufferWithPropertiesINTEL(
+    cl_event retVal = dispatch_ptr->clCreateEventFromGLsyncKHR(
         context,
-        properties,
-        flags,
-        size,
-        host_ptr,
+        sync,
         errcode_ret);
+    CLEXT_CALL_ARGS(clCreateEventFromGLsyncKHR, *errcode_ret, 0, context, sync, errcode_ret);
+    CLEXT_CALL_END(clCreateEventFromGLsyncKHR, *errcode_ret);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_intel_create_buffer_with_properties)
+#endif // defined(cl_khr_gl_event)
+#endif // defined(CLEXT_INCLUDE_GL)
 
-#if defined(CLEXT_INCLUDE_DX9)
-#if defined(cl_intel_dx9_media_sharing)
 
-cl_int CL_API_CALL clGetDeviceIDsFromDX9INTEL(
-    cl_platform_id platform,
-    cl_dx9_device_source_intel dx9_device_source,
-    void* dx9_object,
-    cl_dx9_device_set_intel dx9_device_set,
-    cl_uint num_entries,
-    cl_device_id* devices,
-    cl_uint* num_devices)
+#if defined(cl_khr_il_program)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_program CL_API_CALL clCreateProgramWithILKHR(
+    cl_context context,
+    const void* il,
+    size_t length,
+    cl_int* errcode_ret)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(platform);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetDeviceIDsFromDX9INTEL == nullptr) {
-        return CL_INVALID_OPERATION;
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateProgramWithILKHR,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clCreateProgramWithILKHR_clextfn)function)(
+        context,
+        il,
+        length,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY cl_program CL_API_CALL clCreateProgramWithILKHR(
+    cl_context context,
+    const void* il,
+    size_t length,
+    cl_int* errcode_ret)
+{
+    CLEXT_CALL_BEGIN(clCreateProgramWithILKHR, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateProgramWithILKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateProgramWithILKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCreateProgramWithILKHR, dispatch_ptr);
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
     }
-    return dispatch_ptr->clGetDeviceIDsFromDX9INTEL(
-        platform,
-        dx9_device_source,
-        dx9_object,
-        dx9_device_set,
-        num_entries,
-        devices,
-        num_devices);
+    cl_program retVal = dispatch_ptr->clCreateProgramWithILKHR(
+        context,
+        il,
+        length,
+        errcode_ret);
+    CLEXT_CALL_ARGS(clCreateProgramWithILKHR, *errcode_ret, 0, context, il, length, errcode_ret);
+    CLEXT_CALL_END(clCreateProgramWithILKHR, *errcode_ret);
+    return retVal;
 }
+#endif
+
+#endif // defined(cl_khr_il_program)
+
+#if defined(cl_khr_semaphore)
 
-cl_mem CL_API_CALL clCreateFromDX9MediaSurfaceINTEL(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_semaphore_khr CL_API_CALL clCreateSemaphoreWithPropertiesKHR(
     cl_context context,
-    cl_mem_flags flags,
-    IDirect3DSurface9* resource,
-    HANDLE sharedHandle,
-    UINT plane,
+    const cl_semaphore_properties_khr* sema_props,
+    cl_int* errcode_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateSemaphoreWithPropertiesKHR,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clCreateSemaphoreWithPropertiesKHR_clextfn)function)(
+        context,
+        sema_props,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY cl_semaphore_khr CL_API_CALL clCreateSemaphoreWithPropertiesKHR(
+    cl_context context,
+    const cl_semaphore_properties_khr* sema_props,
     cl_int* errcode_ret)
 {
+    CLEXT_CALL_BEGIN(clCreateSemaphoreWithPropertiesKHR, context);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromDX9MediaSurfaceINTEL == nullptr) {
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateSemaphoreWithPropertiesKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateSemaphoreWithPropertiesKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCreateSemaphoreWithPropertiesKHR, dispatch_ptr);
         if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
         return nullptr;
     }
-    return dispatch_ptr->clCreateFromDX9MediaSurfaceINTEL(
+    cl_semaphore_khr retVal = dispatch_ptr->clCreateSemaphoreWithPropertiesKHR(
         context,
-        flags,
-        resource,
-        sharedHandle,
-        plane,
+        sema_props,
         errcode_ret);
+    CLEXT_CALL_ARGS(clCreateSemaphoreWithPropertiesKHR, *errcode_ret, 0, context, sema_props, errcode_ret);
+    CLEXT_CALL_END(clCreateSemaphoreWithPropertiesKHR, *errcode_ret);
+    return retVal;
 }
+#endif
 
-cl_int CL_API_CALL clEnqueueAcquireDX9ObjectsINTEL(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueWaitSemaphoresKHR(
     cl_command_queue command_queue,
-    cl_uint num_objects,
-    const cl_mem* mem_objects,
+    cl_uint num_sema_objects,
+    const cl_semaphore_khr* sema_objects,
+    const cl_semaphore_payload_khr* sema_payload_list,
     cl_uint num_events_in_wait_list,
     const cl_event* event_wait_list,
     cl_event* event)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueAcquireDX9ObjectsINTEL == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clEnqueueAcquireDX9ObjectsINTEL(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueWaitSemaphoresKHR,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueWaitSemaphoresKHR_clextfn)function)(
         command_queue,
-        num_objects,
-        mem_objects,
+        num_sema_objects,
+        sema_objects,
+        sema_payload_list,
         num_events_in_wait_list,
         event_wait_list,
         event);
 }
-
-cl_int CL_API_CALL clEnqueueReleaseDX9ObjectsINTEL(
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueWaitSemaphoresKHR(
     cl_command_queue command_queue,
-    cl_uint num_objects,
-    cl_mem* mem_objects,
+    cl_uint num_sema_objects,
+    const cl_semaphore_khr* sema_objects,
+    const cl_semaphore_payload_khr* sema_payload_list,
     cl_uint num_events_in_wait_list,
     const cl_event* event_wait_list,
     cl_event* event)
 {
+    CLEXT_CALL_BEGIN(clEnqueueWaitSemaphoresKHR, command_queue);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueReleaseDX9ObjectsINTEL == nullptr) {
+    CLEXT_CALL_DISPATCH(clEnqueueWaitSemaphoresKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueWaitSemaphoresKHR == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueWaitSemaphoresKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clEnqueueReleaseDX9ObjectsINTEL(
+    cl_int retVal = dispatch_ptr->clEnqueueWaitSemaphoresKHR(
         command_queue,
-        num_objects,
-        mem_objects,
+        num_sema_objects,
+        sema_objects,
+        sema_payload_list,
         num_events_in_wait_list,
         event_wait_list,
         event);
+    CLEXT_CALL_ARGS(clEnqueueWaitSemaphoresKHR, retVal, 0, command_queue, num_sema_objects, sema_objects, sema_payload_list, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueWaitSemaphoresKHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_intel_dx9_media_sharing)
-#endif // defined(CLEXT_INCLUDE_DX9)
-
-
-#if defined(cl_intel_program_scope_host_pipe)
-
-cl_int CL_API_CALL clEnqueueReadHostPipeINTEL(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSignalSemaphoresKHR(
     cl_command_queue command_queue,
-    cl_program program,
-    const char* pipe_symbol,
-    cl_bool blocking_read,
-    void* ptr,
-    size_t size,
+    cl_uint num_sema_objects,
+    const cl_semaphore_khr* sema_objects,
+    const cl_semaphore_payload_khr* sema_payload_list,
     cl_uint num_events_in_wait_list,
     const cl_event* event_wait_list,
     cl_event* event)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueReadHostPipeINTEL == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clEnqueueReadHostPipeINTEL(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueSignalSemaphoresKHR,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueSignalSemaphoresKHR_clextfn)function)(
         command_queue,
-        program,
-        pipe_symbol,
-        blocking_read,
-        ptr,
-        size,
+        num_sema_objects,
+        sema_objects,
+        sema_payload_list,
         num_events_in_wait_list,
         event_wait_list,
         event);
 }
-
-cl_int CL_API_CALL clEnqueueWriteHostPipeINTEL(
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSignalSemaphoresKHR(
     cl_command_queue command_queue,
-    cl_program program,
-    const char* pipe_symbol,
-    cl_bool blocking_write,
-    const void* ptr,
-    size_t size,
+    cl_uint num_sema_objects,
+    const cl_semaphore_khr* sema_objects,
+    const cl_semaphore_payload_khr* sema_payload_list,
     cl_uint num_events_in_wait_list,
     const cl_event* event_wait_list,
     cl_event* event)
 {
+    CLEXT_CALL_BEGIN(clEnqueueSignalSemaphoresKHR, command_queue);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueWriteHostPipeINTEL == nullptr) {
+    CLEXT_CALL_DISPATCH(clEnqueueSignalSemaphoresKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueSignalSemaphoresKHR == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueSignalSemaphoresKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clEnqueueWriteHostPipeINTEL(
+    cl_int retVal = dispatch_ptr->clEnqueueSignalSemaphoresKHR(
         command_queue,
-        program,
-        pipe_symbol,
-        blocking_write,
-        ptr,
-        size,
+        num_sema_objects,
+        sema_objects,
+        sema_payload_list,
         num_events_in_wait_list,
         event_wait_list,
         event);
+    CLEXT_CALL_ARGS(clEnqueueSignalSemaphoresKHR, retVal, 0, command_queue, num_sema_objects, sema_objects, sema_payload_list, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueSignalSemaphoresKHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_intel_program_scope_host_pipe)
-
-#if defined(CLEXT_INCLUDE_D3D10)
-#if defined(cl_intel_sharing_format_query_d3d10)
-
-cl_int CL_API_CALL clGetSupportedD3D10TextureFormatsINTEL(
-    cl_context context,
-    cl_mem_flags flags,
-    cl_mem_object_type image_type,
-    cl_uint num_entries,
-    DXGI_FORMAT* d3d10_formats,
-    cl_uint* num_texture_formats)
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetSemaphoreInfoKHR(
+    cl_semaphore_khr sema_object,
+    cl_semaphore_info_khr param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetSupportedD3D10TextureFormatsINTEL == nullptr) {
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetSemaphoreInfoKHR,
+        (const void*)(sema_object),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetSemaphoreInfoKHR_clextfn)function)(
+        sema_object,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetSemaphoreInfoKHR(
+    cl_semaphore_khr sema_object,
+    cl_semaphore_info_khr param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    CLEXT_CALL_BEGIN(clGetSemaphoreInfoKHR, sema_object);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(sema_object);
+    CLEXT_CALL_DISPATCH(clGetSemaphoreInfoKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetSemaphoreInfoKHR == nullptr) {
+        CLEXT_CALL_MISSING(clGetSemaphoreInfoKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clGetSupportedD3D10TextureFormatsINTEL(
-        context,
-        flags,
-        image_type,
-        num_entries,
-        d3d10_formats,
-        num_texture_formats);
+    cl_int retVal = dispatch_ptr->clGetSemaphoreInfoKHR(
+        sema_object,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+    CLEXT_CALL_ARGS(clGetSemaphoreInfoKHR, retVal, param_value_size, sema_object, param_name, param_value_size, param_value, param_value_size_ret);
+    CLEXT_CALL_END(clGetSemaphoreInfoKHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_intel_sharing_format_query_d3d10)
-#endif // defined(CLEXT_INCLUDE_D3D10)
-
-
-#if defined(CLEXT_INCLUDE_D3D11)
-#if defined(cl_intel_sharing_format_query_d3d11)
-
-cl_int CL_API_CALL clGetSupportedD3D11TextureFormatsINTEL(
-    cl_context context,
-    cl_mem_flags flags,
-    cl_mem_object_type image_type,
-    cl_uint plane,
-    cl_uint num_entries,
-    DXGI_FORMAT* d3d11_formats,
-    cl_uint* num_texture_formats)
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clReleaseSemaphoreKHR(
+    cl_semaphore_khr sema_object)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetSupportedD3D11TextureFormatsINTEL == nullptr) {
+    void* function = _resolve(
+        CLEXT_FUNCTION_clReleaseSemaphoreKHR,
+        (const void*)(sema_object),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clReleaseSemaphoreKHR_clextfn)function)(
+        sema_object);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clReleaseSemaphoreKHR(
+    cl_semaphore_khr sema_object)
+{
+    CLEXT_CALL_BEGIN(clReleaseSemaphoreKHR, sema_object);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(sema_object);
+    CLEXT_CALL_DISPATCH(clReleaseSemaphoreKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clReleaseSemaphoreKHR == nullptr) {
+        CLEXT_CALL_MISSING(clReleaseSemaphoreKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clGetSupportedD3D11TextureFormatsINTEL(
-        context,
-        flags,
-        image_type,
-        plane,
-        num_entries,
-        d3d11_formats,
-        num_texture_formats);
+    cl_int retVal = dispatch_ptr->clReleaseSemaphoreKHR(
+        sema_object);
+    CLEXT_CALL_ARGS(clReleaseSemaphoreKHR, retVal, 0, sema_object);
+    CLEXT_CALL_END(clReleaseSemaphoreKHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_intel_sharing_format_query_d3d11)
-#endif // defined(CLEXT_INCLUDE_D3D11)
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clRetainSemaphoreKHR(
+    cl_semaphore_khr sema_object)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clRetainSemaphoreKHR,
+        (const void*)(sema_object),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clRetainSemaphoreKHR_clextfn)function)(
+        sema_object);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clRetainSemaphoreKHR(
+    cl_semaphore_khr sema_object)
+{
+    CLEXT_CALL_BEGIN(clRetainSemaphoreKHR, sema_object);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(sema_object);
+    CLEXT_CALL_DISPATCH(clRetainSemaphoreKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clRetainSemaphoreKHR == nullptr) {
+        CLEXT_CALL_MISSING(clRetainSemaphoreKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clRetainSemaphoreKHR(
+        sema_object);
+    CLEXT_CALL_ARGS(clRetainSemaphoreKHR, retVal, 0, sema_object);
+    CLEXT_CALL_END(clRetainSemaphoreKHR, retVal);
+    return retVal;
+}
+#endif
 
+#endif // defined(cl_khr_semaphore)
 
-#if defined(CLEXT_INCLUDE_DX9)
-#if defined(cl_intel_sharing_format_query_dx9)
+#if defined(cl_khr_subgroups)
 
-cl_int CL_API_CALL clGetSupportedDX9MediaSurfaceFormatsINTEL(
-    cl_context context,
-    cl_mem_flags flags,
-    cl_mem_object_type image_type,
-    cl_uint plane,
-    cl_uint num_entries,
-    D3DFORMAT* dx9_formats,
-    cl_uint* num_surface_formats)
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetKernelSubGroupInfoKHR(
+    cl_kernel in_kernel,
+    cl_device_id in_device,
+    cl_kernel_sub_group_info param_name,
+    size_t input_value_size,
+    const void* input_value,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetSupportedDX9MediaSurfaceFormatsINTEL == nullptr) {
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetKernelSubGroupInfoKHR,
+        (const void*)(in_kernel),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetKernelSubGroupInfoKHR_clextfn)function)(
+        in_kernel,
+        in_device,
+        param_name,
+        input_value_size,
+        input_value,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetKernelSubGroupInfoKHR(
+    cl_kernel in_kernel,
+    cl_device_id in_device,
+    cl_kernel_sub_group_info param_name,
+    size_t input_value_size,
+    const void* input_value,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    CLEXT_CALL_BEGIN(clGetKernelSubGroupInfoKHR, in_kernel);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(in_kernel);
+    CLEXT_CALL_DISPATCH(clGetKernelSubGroupInfoKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetKernelSubGroupInfoKHR == nullptr) {
+        CLEXT_CALL_MISSING(clGetKernelSubGroupInfoKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clGetSupportedDX9MediaSurfaceFormatsINTEL(
-        context,
-        flags,
-        image_type,
-        plane,
-        num_entries,
-        dx9_formats,
-        num_surface_formats);
+    cl_int retVal = dispatch_ptr->clGetKernelSubGroupInfoKHR(
+        in_kernel,
+        in_device,
+        param_name,
+        input_value_size,
+        input_value,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+    CLEXT_CALL_ARGS(clGetKernelSubGroupInfoKHR, retVal, param_value_size, in_kernel, in_device, param_name, input_value_size, input_value, param_value_size, param_value, param_value_size_ret);
+    CLEXT_CALL_END(clGetKernelSubGroupInfoKHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_intel_sharing_format_query_dx9)
-#endif // defined(CLEXT_INCLUDE_DX9)
-
+#endif // defined(cl_khr_subgroups)
 
-#if defined(CLEXT_INCLUDE_GL)
-#if defined(cl_intel_sharing_format_query_gl)
+#if defined(cl_khr_suggested_local_work_size)
 
-cl_int CL_API_CALL clGetSupportedGLTextureFormatsINTEL(
-    cl_context context,
-    cl_mem_flags flags,
-    cl_mem_object_type image_type,
-    cl_uint num_entries,
-    cl_GLenum* gl_formats,
-    cl_uint* num_texture_formats)
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetKernelSuggestedLocalWorkSizeKHR(
+    cl_command_queue command_queue,
+    cl_kernel kernel,
+    cl_uint work_dim,
+    const size_t* global_work_offset,
+    const size_t* global_work_size,
+    size_t* suggested_local_work_size)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetSupportedGLTextureFormatsINTEL == nullptr) {
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetKernelSuggestedLocalWorkSizeKHR,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetKernelSuggestedLocalWorkSizeKHR_clextfn)function)(
+        command_queue,
+        kernel,
+        work_dim,
+        global_work_offset,
+        global_work_size,
+        suggested_local_work_size);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetKernelSuggestedLocalWorkSizeKHR(
+    cl_command_queue command_queue,
+    cl_kernel kernel,
+    cl_uint work_dim,
+    const size_t* global_work_offset,
+    const size_t* global_work_size,
+    size_t* suggested_local_work_size)
+{
+    CLEXT_CALL_BEGIN(clGetKernelSuggestedLocalWorkSizeKHR, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clGetKernelSuggestedLocalWorkSizeKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetKernelSuggestedLocalWorkSizeKHR == nullptr) {
+        CLEXT_CALL_MISSING(clGetKernelSuggestedLocalWorkSizeKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clGetSupportedGLTextureFormatsINTEL(
-        context,
-        flags,
-        image_type,
-        num_entries,
-        gl_formats,
-        num_texture_formats);
+    cl_int retVal = dispatch_ptr->clGetKernelSuggestedLocalWorkSizeKHR(
+        command_queue,
+        kernel,
+        work_dim,
+        global_work_offset,
+        global_work_size,
+        suggested_local_work_size);
+    CLEXT_CALL_ARGS(clGetKernelSuggestedLocalWorkSizeKHR, retVal, 0, command_queue, kernel, work_dim, global_work_offset, global_work_size, suggested_local_work_size);
+    CLEXT_CALL_END(clGetKernelSuggestedLocalWorkSizeKHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_intel_sharing_format_query_gl)
-#endif // defined(CLEXT_INCLUDE_GL)
-
+#endif // defined(cl_khr_suggested_local_work_size)
 
-#if defined(CLEXT_INCLUDE_VA_API)
-#if defined(cl_intel_sharing_format_query_va_api)
+#if defined(cl_khr_terminate_context)
 
-cl_int CL_API_CALL clGetSupportedVA_APIMediaSurfaceFormatsINTEL(
-    cl_context context,
-    cl_mem_flags flags,
-    cl_mem_object_type image_type,
-    cl_uint plane,
-    cl_uint num_entries,
-    VAImageFormat* va_api_formats,
-    cl_uint* num_surface_formats)
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clTerminateContextKHR(
+    cl_context context)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clTerminateContextKHR,
+        (const void*)(context),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clTerminateContextKHR_clextfn)function)(
+        context);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clTerminateContextKHR(
+    cl_context context)
 {
+    CLEXT_CALL_BEGIN(clTerminateContextKHR, context);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetSupportedVA_APIMediaSurfaceFormatsINTEL == nullptr) {
+    CLEXT_CALL_DISPATCH(clTerminateContextKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clTerminateContextKHR == nullptr) {
+        CLEXT_CALL_MISSING(clTerminateContextKHR, dispatch_ptr);
         return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clGetSupportedVA_APIMediaSurfaceFormatsINTEL(
-        context,
-        flags,
-        image_type,
-        plane,
-        num_entries,
-        va_api_formats,
-        num_surface_formats);
+    cl_int retVal = dispatch_ptr->clTerminateContextKHR(
+        context);
+    CLEXT_CALL_ARGS(clTerminateContextKHR, retVal, 0, context);
+    CLEXT_CALL_END(clTerminateContextKHR, retVal);
+    return retVal;
 }
+#endif
 
-#endif // defined(cl_intel_sharing_format_query_va_api)
-#endif // defined(CLEXT_INCLUDE_VA_API)
-
+#endif // defined(cl_khr_terminate_context)
 
-#if defined(cl_intel_unified_shared_memory)
+#if defined(cl_ext_buffer_device_address)
 
-void* CL_API_CALL clHostMemAllocINTEL(
-    cl_context context,
-    const cl_mem_properties_intel* properties,
-    size_t size,
-    cl_uint alignment,
-    cl_int* errcode_ret)
-{
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clSetKernelArgDevicePointerEXT(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    cl_mem_device_address_ext arg_value)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clSetKernelArgDevicePointerEXT,
+        (const void*)(kernel),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clSetKernelArgDevicePointerEXT_clextfn)function)(
+        kernel,
+        arg_index,
+        arg_value);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clSetKernelArgDevicePointerEXT(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    cl_mem_device_address_ext arg_value)
+{
+    CLEXT_CALL_BEGIN(clSetKernelArgDevicePointerEXT, kernel);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(kernel);
+    CLEXT_CALL_DISPATCH(clSetKernelArgDevicePointerEXT, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clSetKernelArgDevicePointerEXT == nullptr) {
+        CLEXT_CALL_MISSING(clSetKernelArgDevicePointerEXT, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clSetKernelArgDevicePointerEXT(
+        kernel,
+        arg_index,
+        arg_value);
+    CLEXT_CALL_ARGS(clSetKernelArgDevicePointerEXT, retVal, 0, kernel, arg_index, arg_value);
+    CLEXT_CALL_END(clSetKernelArgDevicePointerEXT, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_ext_buffer_device_address)
+
+#if defined(cl_ext_device_fission)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clReleaseDeviceEXT(
+    cl_device_id device)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clReleaseDeviceEXT,
+        (const void*)(device),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clReleaseDeviceEXT_clextfn)function)(
+        device);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clReleaseDeviceEXT(
+    cl_device_id device)
+{
+    CLEXT_CALL_BEGIN(clReleaseDeviceEXT, device);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(device);
+    CLEXT_CALL_DISPATCH(clReleaseDeviceEXT, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clReleaseDeviceEXT == nullptr) {
+        CLEXT_CALL_MISSING(clReleaseDeviceEXT, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clReleaseDeviceEXT(
+        device);
+    CLEXT_CALL_ARGS(clReleaseDeviceEXT, retVal, 0, device);
+    CLEXT_CALL_END(clReleaseDeviceEXT, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clRetainDeviceEXT(
+    cl_device_id device)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clRetainDeviceEXT,
+        (const void*)(device),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clRetainDeviceEXT_clextfn)function)(
+        device);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clRetainDeviceEXT(
+    cl_device_id device)
+{
+    CLEXT_CALL_BEGIN(clRetainDeviceEXT, device);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(device);
+    CLEXT_CALL_DISPATCH(clRetainDeviceEXT, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clRetainDeviceEXT == nullptr) {
+        CLEXT_CALL_MISSING(clRetainDeviceEXT, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clRetainDeviceEXT(
+        device);
+    CLEXT_CALL_ARGS(clRetainDeviceEXT, retVal, 0, device);
+    CLEXT_CALL_END(clRetainDeviceEXT, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clCreateSubDevicesEXT(
+    cl_device_id in_device,
+    const cl_device_partition_property_ext* properties,
+    cl_uint num_entries,
+    cl_device_id* out_devices,
+    cl_uint* num_devices)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateSubDevicesEXT,
+        (const void*)(in_device),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clCreateSubDevicesEXT_clextfn)function)(
+        in_device,
+        properties,
+        num_entries,
+        out_devices,
+        num_devices);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clCreateSubDevicesEXT(
+    cl_device_id in_device,
+    const cl_device_partition_property_ext* properties,
+    cl_uint num_entries,
+    cl_device_id* out_devices,
+    cl_uint* num_devices)
+{
+    CLEXT_CALL_BEGIN(clCreateSubDevicesEXT, in_device);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(in_device);
+    CLEXT_CALL_DISPATCH(clCreateSubDevicesEXT, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateSubDevicesEXT == nullptr) {
+        CLEXT_CALL_MISSING(clCreateSubDevicesEXT, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clCreateSubDevicesEXT(
+        in_device,
+        properties,
+        num_entries,
+        out_devices,
+        num_devices);
+    CLEXT_CALL_ARGS(clCreateSubDevicesEXT, retVal, 0, in_device, properties, num_entries, out_devices, num_devices);
+    CLEXT_CALL_END(clCreateSubDevicesEXT, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_ext_device_fission)
+
+#if defined(cl_ext_image_requirements_info)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetImageRequirementsInfoEXT(
+    cl_context context,
+    const cl_mem_properties* properties,
+    cl_mem_flags flags,
+    const cl_image_format* image_format,
+    const cl_image_desc* image_desc,
+    cl_image_requirements_info_ext param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetImageRequirementsInfoEXT,
+        (const void*)(context),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetImageRequirementsInfoEXT_clextfn)function)(
+        context,
+        properties,
+        flags,
+        image_format,
+        image_desc,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetImageRequirementsInfoEXT(
+    cl_context context,
+    const cl_mem_properties* properties,
+    cl_mem_flags flags,
+    const cl_image_format* image_format,
+    const cl_image_desc* image_desc,
+    cl_image_requirements_info_ext param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    CLEXT_CALL_BEGIN(clGetImageRequirementsInfoEXT, context);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clHostMemAllocINTEL == nullptr) {
-        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
-        return nullptr;
+    CLEXT_CALL_DISPATCH(clGetImageRequirementsInfoEXT, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetImageRequirementsInfoEXT == nullptr) {
+        CLEXT_CALL_MISSING(clGetImageRequirementsInfoEXT, dispatch_ptr);
+        return CL_INVALID_OPERATION;
     }
-    return dispatch_ptr->clHostMemAllocINTEL(
+    cl_int retVal = dispatch_ptr->clGetImageRequirementsInfoEXT(
         context,
         properties,
-        size,
-        alignment,
-        errcode_ret);
+        flags,
+        image_format,
+        image_desc,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+    CLEXT_CALL_ARGS(clGetImageRequirementsInfoEXT, retVal, param_value_size, context, properties, flags, image_format, image_desc, param_name, param_value_size, param_value, param_value_size_ret);
+    CLEXT_CALL_END(clGetImageRequirementsInfoEXT, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_ext_image_requirements_info)
+
+#if defined(cl_ext_migrate_memobject)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueMigrateMemObjectEXT(
+    cl_command_queue command_queue,
+    cl_uint num_mem_objects,
+    const cl_mem* mem_objects,
+    cl_mem_migration_flags_ext flags,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueMigrateMemObjectEXT,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueMigrateMemObjectEXT_clextfn)function)(
+        command_queue,
+        num_mem_objects,
+        mem_objects,
+        flags,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueMigrateMemObjectEXT(
+    cl_command_queue command_queue,
+    cl_uint num_mem_objects,
+    const cl_mem* mem_objects,
+    cl_mem_migration_flags_ext flags,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueMigrateMemObjectEXT, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueMigrateMemObjectEXT, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueMigrateMemObjectEXT == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueMigrateMemObjectEXT, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueMigrateMemObjectEXT(
+        command_queue,
+        num_mem_objects,
+        mem_objects,
+        flags,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueMigrateMemObjectEXT, retVal, 0, command_queue, num_mem_objects, mem_objects, flags, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueMigrateMemObjectEXT, retVal);
+    return retVal;
 }
+#endif
+
+#endif // defined(cl_ext_migrate_memobject)
+
+#if defined(cl_arm_import_memory)
 
-void* CL_API_CALL clDeviceMemAllocINTEL(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_mem CL_API_CALL clImportMemoryARM(
     cl_context context,
-    cl_device_id device,
-    const cl_mem_properties_intel* properties,
+    cl_mem_flags flags,
+    const cl_import_properties_arm* properties,
+    void* memory,
     size_t size,
-    cl_uint alignment,
     cl_int* errcode_ret)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clDeviceMemAllocINTEL == nullptr) {
-        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
-        return nullptr;
-    }
-    return dispatch_ptr->clDeviceMemAllocINTEL(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clImportMemoryARM,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clImportMemoryARM_clextfn)function)(
         context,
-        device,
+        flags,
         properties,
+        memory,
         size,
-        alignment,
         errcode_ret);
 }
-
-void* CL_API_CALL clSharedMemAllocINTEL(
+#else
+CL_API_ENTRY cl_mem CL_API_CALL clImportMemoryARM(
     cl_context context,
-    cl_device_id device,
-    const cl_mem_properties_intel* properties,
+    cl_mem_flags flags,
+    const cl_import_properties_arm* properties,
+    void* memory,
     size_t size,
-    cl_uint alignment,
     cl_int* errcode_ret)
 {
+    CLEXT_CALL_BEGIN(clImportMemoryARM, context);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clSharedMemAllocINTEL == nullptr) {
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clImportMemoryARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clImportMemoryARM == nullptr) {
+        CLEXT_CALL_MISSING(clImportMemoryARM, dispatch_ptr);
         if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
         return nullptr;
     }
-    return dispatch_ptr->clSharedMemAllocINTEL(
+    cl_mem retVal = dispatch_ptr->clImportMemoryARM(
         context,
-        device,
+        flags,
         properties,
+        memory,
         size,
-        alignment,
         errcode_ret);
+    CLEXT_CALL_ARGS(clImportMemoryARM, *errcode_ret, size, context, flags, properties, memory, size, errcode_ret);
+    CLEXT_CALL_END(clImportMemoryARM, *errcode_ret);
+    return retVal;
 }
+#endif
+
+#endif // defined(cl_arm_import_memory)
+
+#if defined(cl_arm_shared_virtual_memory)
 
-cl_int CL_API_CALL clMemFreeINTEL(
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY void* CL_API_CALL clSVMAllocARM(
     cl_context context,
-    void* ptr)
+    cl_svm_mem_flags_arm flags,
+    size_t size,
+    cl_uint alignment)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clMemFreeINTEL == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clMemFreeINTEL(
+    void* function = _resolve(
+        CLEXT_FUNCTION_clSVMAllocARM,
+        (const void*)(context),
+        nullptr);
+    if (function == nullptr) return nullptr;
+    return ((clSVMAllocARM_clextfn)function)(
         context,
-        ptr);
+        flags,
+        size,
+        alignment);
 }
-
-cl_int CL_API_CALL clMemBlockingFreeINTEL(
+#else
+CL_API_ENTRY void* CL_API_CALL clSVMAllocARM(
     cl_context context,
-    void* ptr)
+    cl_svm_mem_flags_arm flags,
+    size_t size,
+    cl_uint alignment)
 {
+    CLEXT_CALL_BEGIN(clSVMAllocARM, context);
     struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clMemBlockingFreeINTEL == nullptr) {
-        return CL_INVALID_OPERATION;
+    CLEXT_CALL_DISPATCH(clSVMAllocARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clSVMAllocARM == nullptr) {
+        CLEXT_CALL_MISSING(clSVMAllocARM, dispatch_ptr);
+        return nullptr;
     }
-    return dispatch_ptr->clMemBlockingFreeINTEL(
+    void* retVal = dispatch_ptr->clSVMAllocARM(
         context,
-        ptr);
+        flags,
+        size,
+        alignment);
+    CLEXT_CALL_ARGS(clSVMAllocARM, retVal ? CL_SUCCESS : CL_OUT_OF_RESOURCES, size, context, flags, size, alignment);
+    CLEXT_CALL_END(clSVMAllocARM, retVal ? CL_SUCCESS : CL_OUT_OF_RESOURCES);
+    return retVal;
 }
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY void CL_API_CALL clSVMFreeARM(
+    cl_context context,
+    void* svm_pointer)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clSVMFreeARM,
+        (const void*)(context),
+        nullptr);
+    if (function == nullptr) return;
+    ((clSVMFreeARM_clextfn)function)(
+        context,
+        svm_pointer);
+}
+#else
+CL_API_ENTRY void CL_API_CALL clSVMFreeARM(
+    cl_context context,
+    void* svm_pointer)
+{
+    CLEXT_CALL_BEGIN(clSVMFreeARM, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_DISPATCH(clSVMFreeARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clSVMFreeARM == nullptr) {
+        CLEXT_CALL_MISSING(clSVMFreeARM, dispatch_ptr);
+        return;
+    }
+    dispatch_ptr->clSVMFreeARM(
+        context,
+        svm_pointer);
+    CLEXT_CALL_ARGS(clSVMFreeARM, CL_SUCCESS, 0, context, svm_pointer);
+    CLEXT_CALL_END(clSVMFreeARM, CL_SUCCESS);
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSVMFreeARM(
+    cl_command_queue command_queue,
+    cl_uint num_svm_pointers,
+    void* svm_pointers[],
+    void (CL_CALLBACK* pfn_free_func)(cl_command_queue queue, cl_uint num_svm_pointers, void * svm_pointers[], void *user_data),
+    void* user_data,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueSVMFreeARM,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueSVMFreeARM_clextfn)function)(
+        command_queue,
+        num_svm_pointers,
+        svm_pointers,
+        pfn_free_func,
+        user_data,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSVMFreeARM(
+    cl_command_queue command_queue,
+    cl_uint num_svm_pointers,
+    void* svm_pointers[],
+    void (CL_CALLBACK* pfn_free_func)(cl_command_queue queue, cl_uint num_svm_pointers, void * svm_pointers[], void *user_data),
+    void* user_data,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueSVMFreeARM, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueSVMFreeARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueSVMFreeARM == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueSVMFreeARM, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueSVMFreeARM(
+        command_queue,
+        num_svm_pointers,
+        svm_pointers,
+        pfn_free_func,
+        user_data,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueSVMFreeARM, retVal, 0, command_queue, num_svm_pointers, svm_pointers, pfn_free_func, user_data, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueSVMFreeARM, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSVMMemcpyARM(
+    cl_command_queue command_queue,
+    cl_bool blocking_copy,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueSVMMemcpyARM,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueSVMMemcpyARM_clextfn)function)(
+        command_queue,
+        blocking_copy,
+        dst_ptr,
+        src_ptr,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSVMMemcpyARM(
+    cl_command_queue command_queue,
+    cl_bool blocking_copy,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueSVMMemcpyARM, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueSVMMemcpyARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueSVMMemcpyARM == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueSVMMemcpyARM, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueSVMMemcpyARM(
+        command_queue,
+        blocking_copy,
+        dst_ptr,
+        src_ptr,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueSVMMemcpyARM, retVal, size, command_queue, blocking_copy, dst_ptr, src_ptr, size, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_TRANSFER(clEnqueueSVMMemcpyARM, command_queue, dispatch_ptr, size, retVal);
+    CLEXT_CALL_END(clEnqueueSVMMemcpyARM, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSVMMemFillARM(
+    cl_command_queue command_queue,
+    void* svm_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueSVMMemFillARM,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueSVMMemFillARM_clextfn)function)(
+        command_queue,
+        svm_ptr,
+        pattern,
+        pattern_size,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSVMMemFillARM(
+    cl_command_queue command_queue,
+    void* svm_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueSVMMemFillARM, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueSVMMemFillARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueSVMMemFillARM == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueSVMMemFillARM, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueSVMMemFillARM(
+        command_queue,
+        svm_ptr,
+        pattern,
+        pattern_size,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueSVMMemFillARM, retVal, size, command_queue, svm_ptr, pattern, pattern_size, size, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueSVMMemFillARM, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSVMMapARM(
+    cl_command_queue command_queue,
+    cl_bool blocking_map,
+    cl_map_flags flags,
+    void* svm_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueSVMMapARM,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueSVMMapARM_clextfn)function)(
+        command_queue,
+        blocking_map,
+        flags,
+        svm_ptr,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSVMMapARM(
+    cl_command_queue command_queue,
+    cl_bool blocking_map,
+    cl_map_flags flags,
+    void* svm_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueSVMMapARM, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueSVMMapARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueSVMMapARM == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueSVMMapARM, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueSVMMapARM(
+        command_queue,
+        blocking_map,
+        flags,
+        svm_ptr,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueSVMMapARM, retVal, size, command_queue, blocking_map, flags, svm_ptr, size, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueSVMMapARM, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSVMUnmapARM(
+    cl_command_queue command_queue,
+    void* svm_ptr,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueSVMUnmapARM,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueSVMUnmapARM_clextfn)function)(
+        command_queue,
+        svm_ptr,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSVMUnmapARM(
+    cl_command_queue command_queue,
+    void* svm_ptr,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueSVMUnmapARM, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueSVMUnmapARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueSVMUnmapARM == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueSVMUnmapARM, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueSVMUnmapARM(
+        command_queue,
+        svm_ptr,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueSVMUnmapARM, retVal, 0, command_queue, svm_ptr, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueSVMUnmapARM, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clSetKernelArgSVMPointerARM(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    const void* arg_value)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clSetKernelArgSVMPointerARM,
+        (const void*)(kernel),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clSetKernelArgSVMPointerARM_clextfn)function)(
+        kernel,
+        arg_index,
+        arg_value);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clSetKernelArgSVMPointerARM(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    const void* arg_value)
+{
+    CLEXT_CALL_BEGIN(clSetKernelArgSVMPointerARM, kernel);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(kernel);
+    CLEXT_CALL_DISPATCH(clSetKernelArgSVMPointerARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clSetKernelArgSVMPointerARM == nullptr) {
+        CLEXT_CALL_MISSING(clSetKernelArgSVMPointerARM, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clSetKernelArgSVMPointerARM(
+        kernel,
+        arg_index,
+        arg_value);
+    CLEXT_CALL_ARGS(clSetKernelArgSVMPointerARM, retVal, 0, kernel, arg_index, arg_value);
+    CLEXT_CALL_END(clSetKernelArgSVMPointerARM, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clSetKernelExecInfoARM(
+    cl_kernel kernel,
+    cl_kernel_exec_info_arm param_name,
+    size_t param_value_size,
+    const void* param_value)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clSetKernelExecInfoARM,
+        (const void*)(kernel),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clSetKernelExecInfoARM_clextfn)function)(
+        kernel,
+        param_name,
+        param_value_size,
+        param_value);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clSetKernelExecInfoARM(
+    cl_kernel kernel,
+    cl_kernel_exec_info_arm param_name,
+    size_t param_value_size,
+    const void* param_value)
+{
+    CLEXT_CALL_BEGIN(clSetKernelExecInfoARM, kernel);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(kernel);
+    CLEXT_CALL_DISPATCH(clSetKernelExecInfoARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clSetKernelExecInfoARM == nullptr) {
+        CLEXT_CALL_MISSING(clSetKernelExecInfoARM, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clSetKernelExecInfoARM(
+        kernel,
+        param_name,
+        param_value_size,
+        param_value);
+    CLEXT_CALL_ARGS(clSetKernelExecInfoARM, retVal, param_value_size, kernel, param_name, param_value_size, param_value);
+    CLEXT_CALL_END(clSetKernelExecInfoARM, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_arm_shared_virtual_memory)
+
+#if defined(cl_img_cancel_command)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clCancelCommandsIMG(
+    const cl_event* event_list,
+    size_t num_events_in_list)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCancelCommandsIMG,
+        (const void*)(num_events_in_list > 0 && event_list ? event_list[0] : nullptr),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clCancelCommandsIMG_clextfn)function)(
+        event_list,
+        num_events_in_list);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clCancelCommandsIMG(
+    const cl_event* event_list,
+    size_t num_events_in_list)
+{
+    CLEXT_CALL_BEGIN(clCancelCommandsIMG, num_events_in_list > 0 && event_list ? event_list[0] : nullptr);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(num_events_in_list > 0 && event_list ? event_list[0] : nullptr);
+    CLEXT_CALL_DISPATCH(clCancelCommandsIMG, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCancelCommandsIMG == nullptr) {
+        CLEXT_CALL_MISSING(clCancelCommandsIMG, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clCancelCommandsIMG(
+        event_list,
+        num_events_in_list);
+    CLEXT_CALL_ARGS(clCancelCommandsIMG, retVal, 0, event_list, num_events_in_list);
+    CLEXT_CALL_END(clCancelCommandsIMG, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_img_cancel_command)
+
+#if defined(cl_img_generate_mipmap)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueGenerateMipmapIMG(
+    cl_command_queue command_queue,
+    cl_mem src_image,
+    cl_mem dst_image,
+    cl_mipmap_filter_mode_img mipmap_filter_mode,
+    const size_t* array_region,
+    const size_t* mip_region,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueGenerateMipmapIMG,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueGenerateMipmapIMG_clextfn)function)(
+        command_queue,
+        src_image,
+        dst_image,
+        mipmap_filter_mode,
+        array_region,
+        mip_region,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueGenerateMipmapIMG(
+    cl_command_queue command_queue,
+    cl_mem src_image,
+    cl_mem dst_image,
+    cl_mipmap_filter_mode_img mipmap_filter_mode,
+    const size_t* array_region,
+    const size_t* mip_region,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueGenerateMipmapIMG, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueGenerateMipmapIMG, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueGenerateMipmapIMG == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueGenerateMipmapIMG, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueGenerateMipmapIMG(
+        command_queue,
+        src_image,
+        dst_image,
+        mipmap_filter_mode,
+        array_region,
+        mip_region,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueGenerateMipmapIMG, retVal, 0, command_queue, src_image, dst_image, mipmap_filter_mode, array_region, mip_region, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueGenerateMipmapIMG, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_img_generate_mipmap)
+
+#if defined(cl_img_use_gralloc_ptr)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueAcquireGrallocObjectsIMG(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueAcquireGrallocObjectsIMG,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueAcquireGrallocObjectsIMG_clextfn)function)(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueAcquireGrallocObjectsIMG(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueAcquireGrallocObjectsIMG, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueAcquireGrallocObjectsIMG, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueAcquireGrallocObjectsIMG == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueAcquireGrallocObjectsIMG, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueAcquireGrallocObjectsIMG(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueAcquireGrallocObjectsIMG, retVal, 0, command_queue, num_objects, mem_objects, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueAcquireGrallocObjectsIMG, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueReleaseGrallocObjectsIMG(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueReleaseGrallocObjectsIMG,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueReleaseGrallocObjectsIMG_clextfn)function)(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueReleaseGrallocObjectsIMG(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueReleaseGrallocObjectsIMG, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueReleaseGrallocObjectsIMG, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueReleaseGrallocObjectsIMG == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueReleaseGrallocObjectsIMG, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueReleaseGrallocObjectsIMG(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueReleaseGrallocObjectsIMG, retVal, 0, command_queue, num_objects, mem_objects, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueReleaseGrallocObjectsIMG, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_img_use_gralloc_ptr)
+
+#if defined(cl_intel_accelerator)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_accelerator_intel CL_API_CALL clCreateAcceleratorINTEL(
+    cl_context context,
+    cl_accelerator_type_intel accelerator_type,
+    size_t descriptor_size,
+    const void* descriptor,
+    cl_int* errcode_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateAcceleratorINTEL,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clCreateAcceleratorINTEL_clextfn)function)(
+        context,
+        accelerator_type,
+        descriptor_size,
+        descriptor,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY cl_accelerator_intel CL_API_CALL clCreateAcceleratorINTEL(
+    cl_context context,
+    cl_accelerator_type_intel accelerator_type,
+    size_t descriptor_size,
+    const void* descriptor,
+    cl_int* errcode_ret)
+{
+    CLEXT_CALL_BEGIN(clCreateAcceleratorINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateAcceleratorINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateAcceleratorINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clCreateAcceleratorINTEL, dispatch_ptr);
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
+    }
+    cl_accelerator_intel retVal = dispatch_ptr->clCreateAcceleratorINTEL(
+        context,
+        accelerator_type,
+        descriptor_size,
+        descriptor,
+        errcode_ret);
+    CLEXT_CALL_ARGS(clCreateAcceleratorINTEL, *errcode_ret, 0, context, accelerator_type, descriptor_size, descriptor, errcode_ret);
+    CLEXT_CALL_END(clCreateAcceleratorINTEL, *errcode_ret);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetAcceleratorInfoINTEL(
+    cl_accelerator_intel accelerator,
+    cl_accelerator_info_intel param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetAcceleratorInfoINTEL,
+        (const void*)(accelerator),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetAcceleratorInfoINTEL_clextfn)function)(
+        accelerator,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetAcceleratorInfoINTEL(
+    cl_accelerator_intel accelerator,
+    cl_accelerator_info_intel param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    CLEXT_CALL_BEGIN(clGetAcceleratorInfoINTEL, accelerator);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(accelerator);
+    CLEXT_CALL_DISPATCH(clGetAcceleratorInfoINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetAcceleratorInfoINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clGetAcceleratorInfoINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clGetAcceleratorInfoINTEL(
+        accelerator,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+    CLEXT_CALL_ARGS(clGetAcceleratorInfoINTEL, retVal, param_value_size, accelerator, param_name, param_value_size, param_value, param_value_size_ret);
+    CLEXT_CALL_END(clGetAcceleratorInfoINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clRetainAcceleratorINTEL(
+    cl_accelerator_intel accelerator)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clRetainAcceleratorINTEL,
+        (const void*)(accelerator),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clRetainAcceleratorINTEL_clextfn)function)(
+        accelerator);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clRetainAcceleratorINTEL(
+    cl_accelerator_intel accelerator)
+{
+    CLEXT_CALL_BEGIN(clRetainAcceleratorINTEL, accelerator);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(accelerator);
+    CLEXT_CALL_DISPATCH(clRetainAcceleratorINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clRetainAcceleratorINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clRetainAcceleratorINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clRetainAcceleratorINTEL(
+        accelerator);
+    CLEXT_CALL_ARGS(clRetainAcceleratorINTEL, retVal, 0, accelerator);
+    CLEXT_CALL_END(clRetainAcceleratorINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clReleaseAcceleratorINTEL(
+    cl_accelerator_intel accelerator)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clReleaseAcceleratorINTEL,
+        (const void*)(accelerator),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clReleaseAcceleratorINTEL_clextfn)function)(
+        accelerator);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clReleaseAcceleratorINTEL(
+    cl_accelerator_intel accelerator)
+{
+    CLEXT_CALL_BEGIN(clReleaseAcceleratorINTEL, accelerator);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(accelerator);
+    CLEXT_CALL_DISPATCH(clReleaseAcceleratorINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clReleaseAcceleratorINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clReleaseAcceleratorINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clReleaseAcceleratorINTEL(
+        accelerator);
+    CLEXT_CALL_ARGS(clReleaseAcceleratorINTEL, retVal, 0, accelerator);
+    CLEXT_CALL_END(clReleaseAcceleratorINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_intel_accelerator)
+
+#if defined(cl_intel_create_buffer_with_properties)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_mem CL_API_CALL clCreateBufferWithPropertiesINTEL(
+    cl_context context,
+    const cl_mem_properties_intel* properties,
+    cl_mem_flags flags,
+    size_t size,
+    void* host_ptr,
+    cl_int* errcode_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateBufferWithPropertiesINTEL,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clCreateBufferWithPropertiesINTEL_clextfn)function)(
+        context,
+        properties,
+        flags,
+        size,
+        host_ptr,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY cl_mem CL_API_CALL clCreateBufferWithPropertiesINTEL(
+    cl_context context,
+    const cl_mem_properties_intel* properties,
+    cl_mem_flags flags,
+    size_t size,
+    void* host_ptr,
+    cl_int* errcode_ret)
+{
+    CLEXT_CALL_BEGIN(clCreateBufferWithPropertiesINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateBufferWithPropertiesINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateBufferWithPropertiesINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clCreateBufferWithPropertiesINTEL, dispatch_ptr);
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
+    }
+    cl_mem retVal = dispatch_ptr->clCreateBufferWithPropertiesINTEL(
+        context,
+        properties,
+        flags,
+        size,
+        host_ptr,
+        errcode_ret);
+    CLEXT_CALL_ARGS(clCreateBufferWithPropertiesINTEL, *errcode_ret, size, context, properties, flags, size, host_ptr, errcode_ret);
+    CLEXT_CALL_END(clCreateBufferWithPropertiesINTEL, *errcode_ret);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_intel_create_buffer_with_properties)
+
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_dx9_media_sharing)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetDeviceIDsFromDX9INTEL(
+    cl_platform_id platform,
+    cl_dx9_device_source_intel dx9_device_source,
+    void* dx9_object,
+    cl_dx9_device_set_intel dx9_device_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetDeviceIDsFromDX9INTEL,
+        (const void*)(platform),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetDeviceIDsFromDX9INTEL_clextfn)function)(
+        platform,
+        dx9_device_source,
+        dx9_object,
+        dx9_device_set,
+        num_entries,
+        devices,
+        num_devices);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetDeviceIDsFromDX9INTEL(
+    cl_platform_id platform,
+    cl_dx9_device_source_intel dx9_device_source,
+    void* dx9_object,
+    cl_dx9_device_set_intel dx9_device_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices)
+{
+    CLEXT_CALL_BEGIN(clGetDeviceIDsFromDX9INTEL, platform);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(platform);
+    CLEXT_CALL_DISPATCH(clGetDeviceIDsFromDX9INTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetDeviceIDsFromDX9INTEL == nullptr) {
+        CLEXT_CALL_MISSING(clGetDeviceIDsFromDX9INTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clGetDeviceIDsFromDX9INTEL(
+        platform,
+        dx9_device_source,
+        dx9_object,
+        dx9_device_set,
+        num_entries,
+        devices,
+        num_devices);
+    CLEXT_CALL_ARGS(clGetDeviceIDsFromDX9INTEL, retVal, 0, platform, dx9_device_source, dx9_object, dx9_device_set, num_entries, devices, num_devices);
+    CLEXT_CALL_END(clGetDeviceIDsFromDX9INTEL, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromDX9MediaSurfaceINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    IDirect3DSurface9* resource,
+    HANDLE sharedHandle,
+    UINT plane,
+    cl_int* errcode_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateFromDX9MediaSurfaceINTEL,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clCreateFromDX9MediaSurfaceINTEL_clextfn)function)(
+        context,
+        flags,
+        resource,
+        sharedHandle,
+        plane,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromDX9MediaSurfaceINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    IDirect3DSurface9* resource,
+    HANDLE sharedHandle,
+    UINT plane,
+    cl_int* errcode_ret)
+{
+    CLEXT_CALL_BEGIN(clCreateFromDX9MediaSurfaceINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateFromDX9MediaSurfaceINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromDX9MediaSurfaceINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clCreateFromDX9MediaSurfaceINTEL, dispatch_ptr);
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
+    }
+    cl_mem retVal = dispatch_ptr->clCreateFromDX9MediaSurfaceINTEL(
+        context,
+        flags,
+        resource,
+        sharedHandle,
+        plane,
+        errcode_ret);
+    CLEXT_CALL_ARGS(clCreateFromDX9MediaSurfaceINTEL, *errcode_ret, 0, context, flags, resource, sharedHandle, plane, errcode_ret);
+    CLEXT_CALL_END(clCreateFromDX9MediaSurfaceINTEL, *errcode_ret);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueAcquireDX9ObjectsINTEL(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueAcquireDX9ObjectsINTEL,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueAcquireDX9ObjectsINTEL_clextfn)function)(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueAcquireDX9ObjectsINTEL(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueAcquireDX9ObjectsINTEL, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueAcquireDX9ObjectsINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueAcquireDX9ObjectsINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueAcquireDX9ObjectsINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueAcquireDX9ObjectsINTEL(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueAcquireDX9ObjectsINTEL, retVal, 0, command_queue, num_objects, mem_objects, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueAcquireDX9ObjectsINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueReleaseDX9ObjectsINTEL(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueReleaseDX9ObjectsINTEL,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueReleaseDX9ObjectsINTEL_clextfn)function)(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueReleaseDX9ObjectsINTEL(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueReleaseDX9ObjectsINTEL, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueReleaseDX9ObjectsINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueReleaseDX9ObjectsINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueReleaseDX9ObjectsINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueReleaseDX9ObjectsINTEL(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueReleaseDX9ObjectsINTEL, retVal, 0, command_queue, num_objects, mem_objects, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueReleaseDX9ObjectsINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_intel_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+
+
+#if defined(cl_intel_program_scope_host_pipe)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueReadHostPipeINTEL(
+    cl_command_queue command_queue,
+    cl_program program,
+    const char* pipe_symbol,
+    cl_bool blocking_read,
+    void* ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueReadHostPipeINTEL,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueReadHostPipeINTEL_clextfn)function)(
+        command_queue,
+        program,
+        pipe_symbol,
+        blocking_read,
+        ptr,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueReadHostPipeINTEL(
+    cl_command_queue command_queue,
+    cl_program program,
+    const char* pipe_symbol,
+    cl_bool blocking_read,
+    void* ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueReadHostPipeINTEL, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueReadHostPipeINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueReadHostPipeINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueReadHostPipeINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueReadHostPipeINTEL(
+        command_queue,
+        program,
+        pipe_symbol,
+        blocking_read,
+        ptr,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueReadHostPipeINTEL, retVal, size, command_queue, program, pipe_symbol, blocking_read, ptr, size, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_TRANSFER(clEnqueueReadHostPipeINTEL, command_queue, dispatch_ptr, size, retVal);
+    CLEXT_CALL_END(clEnqueueReadHostPipeINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueWriteHostPipeINTEL(
+    cl_command_queue command_queue,
+    cl_program program,
+    const char* pipe_symbol,
+    cl_bool blocking_write,
+    const void* ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueWriteHostPipeINTEL,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueWriteHostPipeINTEL_clextfn)function)(
+        command_queue,
+        program,
+        pipe_symbol,
+        blocking_write,
+        ptr,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueWriteHostPipeINTEL(
+    cl_command_queue command_queue,
+    cl_program program,
+    const char* pipe_symbol,
+    cl_bool blocking_write,
+    const void* ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueWriteHostPipeINTEL, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueWriteHostPipeINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueWriteHostPipeINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueWriteHostPipeINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueWriteHostPipeINTEL(
+        command_queue,
+        program,
+        pipe_symbol,
+        blocking_write,
+        ptr,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueWriteHostPipeINTEL, retVal, size, command_queue, program, pipe_symbol, blocking_write, ptr, size, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_TRANSFER(clEnqueueWriteHostPipeINTEL, command_queue, dispatch_ptr, size, retVal);
+    CLEXT_CALL_END(clEnqueueWriteHostPipeINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_intel_program_scope_host_pipe)
+
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_intel_sharing_format_query_d3d10)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetSupportedD3D10TextureFormatsINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint num_entries,
+    DXGI_FORMAT* d3d10_formats,
+    cl_uint* num_texture_formats)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetSupportedD3D10TextureFormatsINTEL,
+        (const void*)(context),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetSupportedD3D10TextureFormatsINTEL_clextfn)function)(
+        context,
+        flags,
+        image_type,
+        num_entries,
+        d3d10_formats,
+        num_texture_formats);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetSupportedD3D10TextureFormatsINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint num_entries,
+    DXGI_FORMAT* d3d10_formats,
+    cl_uint* num_texture_formats)
+{
+    CLEXT_CALL_BEGIN(clGetSupportedD3D10TextureFormatsINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_DISPATCH(clGetSupportedD3D10TextureFormatsINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetSupportedD3D10TextureFormatsINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clGetSupportedD3D10TextureFormatsINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clGetSupportedD3D10TextureFormatsINTEL(
+        context,
+        flags,
+        image_type,
+        num_entries,
+        d3d10_formats,
+        num_texture_formats);
+    CLEXT_CALL_ARGS(clGetSupportedD3D10TextureFormatsINTEL, retVal, 0, context, flags, image_type, num_entries, d3d10_formats, num_texture_formats);
+    CLEXT_CALL_END(clGetSupportedD3D10TextureFormatsINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_intel_sharing_format_query_d3d10)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+
+
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_intel_sharing_format_query_d3d11)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetSupportedD3D11TextureFormatsINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint plane,
+    cl_uint num_entries,
+    DXGI_FORMAT* d3d11_formats,
+    cl_uint* num_texture_formats)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetSupportedD3D11TextureFormatsINTEL,
+        (const void*)(context),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetSupportedD3D11TextureFormatsINTEL_clextfn)function)(
+        context,
+        flags,
+        image_type,
+        plane,
+        num_entries,
+        d3d11_formats,
+        num_texture_formats);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetSupportedD3D11TextureFormatsINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint plane,
+    cl_uint num_entries,
+    DXGI_FORMAT* d3d11_formats,
+    cl_uint* num_texture_formats)
+{
+    CLEXT_CALL_BEGIN(clGetSupportedD3D11TextureFormatsINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_DISPATCH(clGetSupportedD3D11TextureFormatsINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetSupportedD3D11TextureFormatsINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clGetSupportedD3D11TextureFormatsINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clGetSupportedD3D11TextureFormatsINTEL(
+        context,
+        flags,
+        image_type,
+        plane,
+        num_entries,
+        d3d11_formats,
+        num_texture_formats);
+    CLEXT_CALL_ARGS(clGetSupportedD3D11TextureFormatsINTEL, retVal, 0, context, flags, image_type, plane, num_entries, d3d11_formats, num_texture_formats);
+    CLEXT_CALL_END(clGetSupportedD3D11TextureFormatsINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_intel_sharing_format_query_d3d11)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+
+
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_sharing_format_query_dx9)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetSupportedDX9MediaSurfaceFormatsINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint plane,
+    cl_uint num_entries,
+    D3DFORMAT* dx9_formats,
+    cl_uint* num_surface_formats)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetSupportedDX9MediaSurfaceFormatsINTEL,
+        (const void*)(context),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetSupportedDX9MediaSurfaceFormatsINTEL_clextfn)function)(
+        context,
+        flags,
+        image_type,
+        plane,
+        num_entries,
+        dx9_formats,
+        num_surface_formats);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetSupportedDX9MediaSurfaceFormatsINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint plane,
+    cl_uint num_entries,
+    D3DFORMAT* dx9_formats,
+    cl_uint* num_surface_formats)
+{
+    CLEXT_CALL_BEGIN(clGetSupportedDX9MediaSurfaceFormatsINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_DISPATCH(clGetSupportedDX9MediaSurfaceFormatsINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetSupportedDX9MediaSurfaceFormatsINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clGetSupportedDX9MediaSurfaceFormatsINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clGetSupportedDX9MediaSurfaceFormatsINTEL(
+        context,
+        flags,
+        image_type,
+        plane,
+        num_entries,
+        dx9_formats,
+        num_surface_formats);
+    CLEXT_CALL_ARGS(clGetSupportedDX9MediaSurfaceFormatsINTEL, retVal, 0, context, flags, image_type, plane, num_entries, dx9_formats, num_surface_formats);
+    CLEXT_CALL_END(clGetSupportedDX9MediaSurfaceFormatsINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_intel_sharing_format_query_dx9)
+#endif // defined(CLEXT_INCLUDE_DX9)
+
+
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_intel_sharing_format_query_gl)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetSupportedGLTextureFormatsINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint num_entries,
+    cl_GLenum* gl_formats,
+    cl_uint* num_texture_formats)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetSupportedGLTextureFormatsINTEL,
+        (const void*)(context),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetSupportedGLTextureFormatsINTEL_clextfn)function)(
+        context,
+        flags,
+        image_type,
+        num_entries,
+        gl_formats,
+        num_texture_formats);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetSupportedGLTextureFormatsINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint num_entries,
+    cl_GLenum* gl_formats,
+    cl_uint* num_texture_formats)
+{
+    CLEXT_CALL_BEGIN(clGetSupportedGLTextureFormatsINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_DISPATCH(clGetSupportedGLTextureFormatsINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetSupportedGLTextureFormatsINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clGetSupportedGLTextureFormatsINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clGetSupportedGLTextureFormatsINTEL(
+        context,
+        flags,
+        image_type,
+        num_entries,
+        gl_formats,
+        num_texture_formats);
+    CLEXT_CALL_ARGS(clGetSupportedGLTextureFormatsINTEL, retVal, 0, context, flags, image_type, num_entries, gl_formats, num_texture_formats);
+    CLEXT_CALL_END(clGetSupportedGLTextureFormatsINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_intel_sharing_format_query_gl)
+#endif // defined(CLEXT_INCLUDE_GL)
+
+
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_sharing_format_query_va_api)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetSupportedVA_APIMediaSurfaceFormatsINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint plane,
+    cl_uint num_entries,
+    VAImageFormat* va_api_formats,
+    cl_uint* num_surface_formats)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetSupportedVA_APIMediaSurfaceFormatsINTEL,
+        (const void*)(context),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetSupportedVA_APIMediaSurfaceFormatsINTEL_clextfn)function)(
+        context,
+        flags,
+        image_type,
+        plane,
+        num_entries,
+        va_api_formats,
+        num_surface_formats);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetSupportedVA_APIMediaSurfaceFormatsINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    cl_mem_object_type image_type,
+    cl_uint plane,
+    cl_uint num_entries,
+    VAImageFormat* va_api_formats,
+    cl_uint* num_surface_formats)
+{
+    CLEXT_CALL_BEGIN(clGetSupportedVA_APIMediaSurfaceFormatsINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_DISPATCH(clGetSupportedVA_APIMediaSurfaceFormatsINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetSupportedVA_APIMediaSurfaceFormatsINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clGetSupportedVA_APIMediaSurfaceFormatsINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clGetSupportedVA_APIMediaSurfaceFormatsINTEL(
+        context,
+        flags,
+        image_type,
+        plane,
+        num_entries,
+        va_api_formats,
+        num_surface_formats);
+    CLEXT_CALL_ARGS(clGetSupportedVA_APIMediaSurfaceFormatsINTEL, retVal, 0, context, flags, image_type, plane, num_entries, va_api_formats, num_surface_formats);
+    CLEXT_CALL_END(clGetSupportedVA_APIMediaSurfaceFormatsINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_intel_sharing_format_query_va_api)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+
+
+#if defined(cl_intel_unified_shared_memory)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY void* CL_API_CALL clHostMemAllocINTEL(
+    cl_context context,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clHostMemAllocINTEL,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clHostMemAllocINTEL_clextfn)function)(
+        context,
+        properties,
+        size,
+        alignment,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY void* CL_API_CALL clHostMemAllocINTEL(
+    cl_context context,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    CLEXT_CALL_BEGIN(clHostMemAllocINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clHostMemAllocINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clHostMemAllocINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clHostMemAllocINTEL, dispatch_ptr);
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
+    }
+    void* retVal = dispatch_ptr->clHostMemAllocINTEL(
+        context,
+        properties,
+        size,
+        alignment,
+        errcode_ret);
+    CLEXT_CALL_ARGS(clHostMemAllocINTEL, *errcode_ret, size, context, properties, size, alignment, errcode_ret);
+    CLEXT_CALL_USM_ALLOC(context, nullptr, CL_MEM_TYPE_HOST_INTEL, retVal, size);
+    CLEXT_CALL_END(clHostMemAllocINTEL, *errcode_ret);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY void* CL_API_CALL clDeviceMemAllocINTEL(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clDeviceMemAllocINTEL,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clDeviceMemAllocINTEL_clextfn)function)(
+        context,
+        device,
+        properties,
+        size,
+        alignment,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY void* CL_API_CALL clDeviceMemAllocINTEL(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    CLEXT_CALL_BEGIN(clDeviceMemAllocINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clDeviceMemAllocINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clDeviceMemAllocINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clDeviceMemAllocINTEL, dispatch_ptr);
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
+    }
+    void* retVal = dispatch_ptr->clDeviceMemAllocINTEL(
+        context,
+        device,
+        properties,
+        size,
+        alignment,
+        errcode_ret);
+    CLEXT_CALL_ARGS(clDeviceMemAllocINTEL, *errcode_ret, size, context, device, properties, size, alignment, errcode_ret);
+    CLEXT_CALL_USM_ALLOC(context, device, CL_MEM_TYPE_DEVICE_INTEL, retVal, size);
+    CLEXT_CALL_END(clDeviceMemAllocINTEL, *errcode_ret);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY void* CL_API_CALL clSharedMemAllocINTEL(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clSharedMemAllocINTEL,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clSharedMemAllocINTEL_clextfn)function)(
+        context,
+        device,
+        properties,
+        size,
+        alignment,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY void* CL_API_CALL clSharedMemAllocINTEL(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    CLEXT_CALL_BEGIN(clSharedMemAllocINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clSharedMemAllocINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clSharedMemAllocINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clSharedMemAllocINTEL, dispatch_ptr);
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
+    }
+    void* retVal = dispatch_ptr->clSharedMemAllocINTEL(
+        context,
+        device,
+        properties,
+        size,
+        alignment,
+        errcode_ret);
+    CLEXT_CALL_ARGS(clSharedMemAllocINTEL, *errcode_ret, size, context, device, properties, size, alignment, errcode_ret);
+    CLEXT_CALL_USM_ALLOC(context, device, CL_MEM_TYPE_SHARED_INTEL, retVal, size);
+    CLEXT_CALL_END(clSharedMemAllocINTEL, *errcode_ret);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clMemFreeINTEL(
+    cl_context context,
+    void* ptr)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clMemFreeINTEL,
+        (const void*)(context),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clMemFreeINTEL_clextfn)function)(
+        context,
+        ptr);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clMemFreeINTEL(
+    cl_context context,
+    void* ptr)
+{
+    CLEXT_CALL_BEGIN(clMemFreeINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_DISPATCH(clMemFreeINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clMemFreeINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clMemFreeINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    CLEXT_CALL_USM_FREE(context, ptr);
+    cl_int retVal = dispatch_ptr->clMemFreeINTEL(
+        context,
+        ptr);
+    CLEXT_CALL_ARGS(clMemFreeINTEL, retVal, 0, context, ptr);
+    CLEXT_CALL_USM_FREE_END(context, ptr, retVal);
+    CLEXT_CALL_END(clMemFreeINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clMemBlockingFreeINTEL(
+    cl_context context,
+    void* ptr)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clMemBlockingFreeINTEL,
+        (const void*)(context),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clMemBlockingFreeINTEL_clextfn)function)(
+        context,
+        ptr);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clMemBlockingFreeINTEL(
+    cl_context context,
+    void* ptr)
+{
+    CLEXT_CALL_BEGIN(clMemBlockingFreeINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_DISPATCH(clMemBlockingFreeINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clMemBlockingFreeINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clMemBlockingFreeINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    CLEXT_CALL_USM_FREE(context, ptr);
+    cl_int retVal = dispatch_ptr->clMemBlockingFreeINTEL(
+        context,
+        ptr);
+    CLEXT_CALL_ARGS(clMemBlockingFreeINTEL, retVal, 0, context, ptr);
+    CLEXT_CALL_USM_FREE_END(context, ptr, retVal);
+    CLEXT_CALL_END(clMemBlockingFreeINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetMemAllocInfoINTEL(
+    cl_context context,
+    const void* ptr,
+    cl_mem_info_intel param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetMemAllocInfoINTEL,
+        (const void*)(context),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetMemAllocInfoINTEL_clextfn)function)(
+        context,
+        ptr,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetMemAllocInfoINTEL(
+    cl_context context,
+    const void* ptr,
+    cl_mem_info_intel param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    CLEXT_CALL_BEGIN(clGetMemAllocInfoINTEL, context);
+    // Queries answered by the USM allocation registry skip finding the
+    // dispatch table, but still reach the end-of-call hooks.
+    cl_int retVal = CL_SUCCESS;
+    struct openclext_dispatch_table* dispatch_ptr = nullptr;
+    if (CLEXT_CALL_USM_INFO(context, ptr, param_name, param_value_size, param_value, param_value_size_ret, &retVal)) goto call_end;
+    dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_DISPATCH(clGetMemAllocInfoINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetMemAllocInfoINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clGetMemAllocInfoINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    retVal = dispatch_ptr->clGetMemAllocInfoINTEL(
+        context,
+        ptr,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+call_end:
+    CLEXT_CALL_ARGS(clGetMemAllocInfoINTEL, retVal, param_value_size, context, ptr, param_name, param_value_size, param_value, param_value_size_ret);
+    CLEXT_CALL_END(clGetMemAllocInfoINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clSetKernelArgMemPointerINTEL(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    const void* arg_value)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clSetKernelArgMemPointerINTEL,
+        (const void*)(kernel),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clSetKernelArgMemPointerINTEL_clextfn)function)(
+        kernel,
+        arg_index,
+        arg_value);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clSetKernelArgMemPointerINTEL(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    const void* arg_value)
+{
+    CLEXT_CALL_BEGIN(clSetKernelArgMemPointerINTEL, kernel);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(kernel);
+    CLEXT_CALL_DISPATCH(clSetKernelArgMemPointerINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clSetKernelArgMemPointerINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clSetKernelArgMemPointerINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clSetKernelArgMemPointerINTEL(
+        kernel,
+        arg_index,
+        arg_value);
+    CLEXT_CALL_ARGS(clSetKernelArgMemPointerINTEL, retVal, 0, kernel, arg_index, arg_value);
+    CLEXT_CALL_USM_KERNEL_ARG(kernel, arg_index, arg_value, retVal);
+    CLEXT_CALL_END(clSetKernelArgMemPointerINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueMemFillINTEL(
+    cl_command_queue command_queue,
+    void* dst_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueMemFillINTEL,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueMemFillINTEL_clextfn)function)(
+        command_queue,
+        dst_ptr,
+        pattern,
+        pattern_size,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueMemFillINTEL(
+    cl_command_queue command_queue,
+    void* dst_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueMemFillINTEL, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueMemFillINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueMemFillINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueMemFillINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueMemFillINTEL(
+        command_queue,
+        dst_ptr,
+        pattern,
+        pattern_size,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueMemFillINTEL, retVal, size, command_queue, dst_ptr, pattern, pattern_size, size, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_TRANSFER(clEnqueueMemFillINTEL, command_queue, dispatch_ptr, size, retVal);
+    CLEXT_CALL_END(clEnqueueMemFillINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueMemcpyINTEL(
+    cl_command_queue command_queue,
+    cl_bool blocking,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueMemcpyINTEL,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueMemcpyINTEL_clextfn)function)(
+        command_queue,
+        blocking,
+        dst_ptr,
+        src_ptr,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueMemcpyINTEL(
+    cl_command_queue command_queue,
+    cl_bool blocking,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueMemcpyINTEL, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueMemcpyINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueMemcpyINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueMemcpyINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = CL_SUCCESS;
+    if (!CLEXT_CALL_USM_STAGE(dispatch_ptr->clEnqueueMemcpyINTEL, command_queue, blocking, dst_ptr, src_ptr, size, num_events_in_wait_list, event_wait_list, event, &retVal)) {
+        retVal = dispatch_ptr->clEnqueueMemcpyINTEL(
+            command_queue,
+            blocking,
+            dst_ptr,
+            src_ptr,
+            size,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+    CLEXT_CALL_ARGS(clEnqueueMemcpyINTEL, retVal, size, command_queue, blocking, dst_ptr, src_ptr, size, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_TRANSFER(clEnqueueMemcpyINTEL, command_queue, dispatch_ptr, size, retVal);
+    CLEXT_CALL_END(clEnqueueMemcpyINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueMemAdviseINTEL(
+    cl_command_queue command_queue,
+    const void* ptr,
+    size_t size,
+    cl_mem_advice_intel advice,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueMemAdviseINTEL,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueMemAdviseINTEL_clextfn)function)(
+        command_queue,
+        ptr,
+        size,
+        advice,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueMemAdviseINTEL(
+    cl_command_queue command_queue,
+    const void* ptr,
+    size_t size,
+    cl_mem_advice_intel advice,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueMemAdviseINTEL, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueMemAdviseINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueMemAdviseINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueMemAdviseINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueMemAdviseINTEL(
+        command_queue,
+        ptr,
+        size,
+        advice,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueMemAdviseINTEL, retVal, size, command_queue, ptr, size, advice, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueMemAdviseINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CL_VERSION_1_2)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueMigrateMemINTEL(
+    cl_command_queue command_queue,
+    const void* ptr,
+    size_t size,
+    cl_mem_migration_flags flags,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueMigrateMemINTEL,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueMigrateMemINTEL_clextfn)function)(
+        command_queue,
+        ptr,
+        size,
+        flags,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueMigrateMemINTEL(
+    cl_command_queue command_queue,
+    const void* ptr,
+    size_t size,
+    cl_mem_migration_flags flags,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueMigrateMemINTEL, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueMigrateMemINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueMigrateMemINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueMigrateMemINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueMigrateMemINTEL(
+        command_queue,
+        ptr,
+        size,
+        flags,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueMigrateMemINTEL, retVal, size, command_queue, ptr, size, flags, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_TRANSFER(clEnqueueMigrateMemINTEL, command_queue, dispatch_ptr, size, retVal);
+    CLEXT_CALL_END(clEnqueueMigrateMemINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(CL_VERSION_1_2)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueMemsetINTEL(
+    cl_command_queue command_queue,
+    void* dst_ptr,
+    cl_int value,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueMemsetINTEL,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueMemsetINTEL_clextfn)function)(
+        command_queue,
+        dst_ptr,
+        value,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueMemsetINTEL(
+    cl_command_queue command_queue,
+    void* dst_ptr,
+    cl_int value,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueMemsetINTEL, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueMemsetINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueMemsetINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueMemsetINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueMemsetINTEL(
+        command_queue,
+        dst_ptr,
+        value,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueMemsetINTEL, retVal, size, command_queue, dst_ptr, value, size, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueMemsetINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_intel_unified_shared_memory)
+
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_va_api_media_sharing)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetDeviceIDsFromVA_APIMediaAdapterINTEL(
+    cl_platform_id platform,
+    cl_va_api_device_source_intel media_adapter_type,
+    void* media_adapter,
+    cl_va_api_device_set_intel media_adapter_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetDeviceIDsFromVA_APIMediaAdapterINTEL,
+        (const void*)(platform),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetDeviceIDsFromVA_APIMediaAdapterINTEL_clextfn)function)(
+        platform,
+        media_adapter_type,
+        media_adapter,
+        media_adapter_set,
+        num_entries,
+        devices,
+        num_devices);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetDeviceIDsFromVA_APIMediaAdapterINTEL(
+    cl_platform_id platform,
+    cl_va_api_device_source_intel media_adapter_type,
+    void* media_adapter,
+    cl_va_api_device_set_intel media_adapter_set,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices)
+{
+    CLEXT_CALL_BEGIN(clGetDeviceIDsFromVA_APIMediaAdapterINTEL, platform);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(platform);
+    CLEXT_CALL_DISPATCH(clGetDeviceIDsFromVA_APIMediaAdapterINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetDeviceIDsFromVA_APIMediaAdapterINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clGetDeviceIDsFromVA_APIMediaAdapterINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clGetDeviceIDsFromVA_APIMediaAdapterINTEL(
+        platform,
+        media_adapter_type,
+        media_adapter,
+        media_adapter_set,
+        num_entries,
+        devices,
+        num_devices);
+    CLEXT_CALL_ARGS(clGetDeviceIDsFromVA_APIMediaAdapterINTEL, retVal, 0, platform, media_adapter_type, media_adapter, media_adapter_set, num_entries, devices, num_devices);
+    CLEXT_CALL_END(clGetDeviceIDsFromVA_APIMediaAdapterINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromVA_APIMediaSurfaceINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    VASurfaceID* surface,
+    cl_uint plane,
+    cl_int* errcode_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clCreateFromVA_APIMediaSurfaceINTEL,
+        (const void*)(context),
+        errcode_ret);
+    if (function == nullptr) return nullptr;
+    return ((clCreateFromVA_APIMediaSurfaceINTEL_clextfn)function)(
+        context,
+        flags,
+        surface,
+        plane,
+        errcode_ret);
+}
+#else
+CL_API_ENTRY cl_mem CL_API_CALL clCreateFromVA_APIMediaSurfaceINTEL(
+    cl_context context,
+    cl_mem_flags flags,
+    VASurfaceID* surface,
+    cl_uint plane,
+    cl_int* errcode_ret)
+{
+    CLEXT_CALL_BEGIN(clCreateFromVA_APIMediaSurfaceINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateFromVA_APIMediaSurfaceINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromVA_APIMediaSurfaceINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clCreateFromVA_APIMediaSurfaceINTEL, dispatch_ptr);
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
+    }
+    cl_mem retVal = dispatch_ptr->clCreateFromVA_APIMediaSurfaceINTEL(
+        context,
+        flags,
+        surface,
+        plane,
+        errcode_ret);
+    CLEXT_CALL_ARGS(clCreateFromVA_APIMediaSurfaceINTEL, *errcode_ret, 0, context, flags, surface, plane, errcode_ret);
+    CLEXT_CALL_END(clCreateFromVA_APIMediaSurfaceINTEL, *errcode_ret);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueAcquireVA_APIMediaSurfacesINTEL(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueAcquireVA_APIMediaSurfacesINTEL,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueAcquireVA_APIMediaSurfacesINTEL_clextfn)function)(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueAcquireVA_APIMediaSurfacesINTEL(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueAcquireVA_APIMediaSurfacesINTEL, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueAcquireVA_APIMediaSurfacesINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueAcquireVA_APIMediaSurfacesINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueAcquireVA_APIMediaSurfacesINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueAcquireVA_APIMediaSurfacesINTEL(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueAcquireVA_APIMediaSurfacesINTEL, retVal, 0, command_queue, num_objects, mem_objects, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueAcquireVA_APIMediaSurfacesINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueReleaseVA_APIMediaSurfacesINTEL(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clEnqueueReleaseVA_APIMediaSurfacesINTEL,
+        (const void*)(command_queue),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clEnqueueReleaseVA_APIMediaSurfacesINTEL_clextfn)function)(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueReleaseVA_APIMediaSurfacesINTEL(
+    cl_command_queue command_queue,
+    cl_uint num_objects,
+    const cl_mem* mem_objects,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueReleaseVA_APIMediaSurfacesINTEL, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueReleaseVA_APIMediaSurfacesINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueReleaseVA_APIMediaSurfacesINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueReleaseVA_APIMediaSurfacesINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueReleaseVA_APIMediaSurfacesINTEL(
+        command_queue,
+        num_objects,
+        mem_objects,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueReleaseVA_APIMediaSurfacesINTEL, retVal, 0, command_queue, num_objects, mem_objects, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueReleaseVA_APIMediaSurfacesINTEL, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_intel_va_api_media_sharing)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+
+
+#if defined(cl_loader_info)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetICDLoaderInfoOCLICD(
+    cl_icdl_info param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetICDLoaderInfoOCLICD,
+        nullptr,
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetICDLoaderInfoOCLICD_clextfn)function)(
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetICDLoaderInfoOCLICD(
+    cl_icdl_info param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    CLEXT_CALL_BEGIN(clGetICDLoaderInfoOCLICD, nullptr);
+    struct openclext_dispatch_table_common* dispatch_ptr = _get_dispatch();
+    CLEXT_CALL_DISPATCH(clGetICDLoaderInfoOCLICD, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetICDLoaderInfoOCLICD == nullptr) {
+        CLEXT_CALL_MISSING(clGetICDLoaderInfoOCLICD, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clGetICDLoaderInfoOCLICD(
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+    CLEXT_CALL_ARGS(clGetICDLoaderInfoOCLICD, retVal, param_value_size, param_name, param_value_size, param_value, param_value_size_ret);
+    CLEXT_CALL_END(clGetICDLoaderInfoOCLICD, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_loader_info)
+
+#if defined(cl_pocl_content_size)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clSetContentSizeBufferPoCL(
+    cl_mem buffer,
+    cl_mem content_size_buffer)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clSetContentSizeBufferPoCL,
+        (const void*)(buffer),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clSetContentSizeBufferPoCL_clextfn)function)(
+        buffer,
+        content_size_buffer);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clSetContentSizeBufferPoCL(
+    cl_mem buffer,
+    cl_mem content_size_buffer)
+{
+    CLEXT_CALL_BEGIN(clSetContentSizeBufferPoCL, buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(buffer);
+    CLEXT_CALL_DISPATCH(clSetContentSizeBufferPoCL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clSetContentSizeBufferPoCL == nullptr) {
+        CLEXT_CALL_MISSING(clSetContentSizeBufferPoCL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clSetContentSizeBufferPoCL(
+        buffer,
+        content_size_buffer);
+    CLEXT_CALL_ARGS(clSetContentSizeBufferPoCL, retVal, 0, buffer, content_size_buffer);
+    CLEXT_CALL_END(clSetContentSizeBufferPoCL, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_pocl_content_size)
+
+#if defined(cl_qcom_ext_host_ptr)
+
+#if defined(CLEXT_COMPACT_DISPATCH)
+CL_API_ENTRY cl_int CL_API_CALL clGetDeviceImageInfoQCOM(
+    cl_device_id device,
+    size_t image_width,
+    size_t image_height,
+    const cl_image_format* image_format,
+    cl_image_pitch_info_qcom param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    void* function = _resolve(
+        CLEXT_FUNCTION_clGetDeviceImageInfoQCOM,
+        (const void*)(device),
+        nullptr);
+    if (function == nullptr) return CL_INVALID_OPERATION;
+    return ((clGetDeviceImageInfoQCOM_clextfn)function)(
+        device,
+        image_width,
+        image_height,
+        image_format,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+}
+#else
+CL_API_ENTRY cl_int CL_API_CALL clGetDeviceImageInfoQCOM(
+    cl_device_id device,
+    size_t image_width,
+    size_t image_height,
+    const cl_image_format* image_format,
+    cl_image_pitch_info_qcom param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    CLEXT_CALL_BEGIN(clGetDeviceImageInfoQCOM, device);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(device);
+    CLEXT_CALL_DISPATCH(clGetDeviceImageInfoQCOM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetDeviceImageInfoQCOM == nullptr) {
+        CLEXT_CALL_MISSING(clGetDeviceImageInfoQCOM, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clGetDeviceImageInfoQCOM(
+        device,
+        image_width,
+        image_height,
+        image_format,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+    CLEXT_CALL_ARGS(clGetDeviceImageInfoQCOM, retVal, param_value_size, device, image_width, image_height, image_format, param_name, param_value_size, param_value, param_value_size_ret);
+    CLEXT_CALL_END(clGetDeviceImageInfoQCOM, retVal);
+    return retVal;
+}
+#endif
+
+#endif // defined(cl_qcom_ext_host_ptr)
+
+#ifdef __cplusplus
+}
+#endif
+
+/***************************************************************
+* Function Name Lookup
+***************************************************************/
+
+// Extension functions are found by name using a minimal perfect hash that is
+// computed when this file is generated.  The first hash of the name chooses a
+// seed, and the hash of the name with the seed chooses a slot.  Slots for
+// extension functions that are not supported by the headers are empty.
+
+struct openclext_function_name {
+    const char* name;
+    uint16_t offset;        // offset of the function in the dispatch table
+    bool common;            // the function is in the common dispatch table
+};
+
+static const uint32_t _function_name_seeds[111] = {
+    6, 2, 1, 1, 0, 0, 3, 1,
+    7, 0, 0, 1, 0, 2, 1, 3,
+    1, 1, 2, 0, 2, 0, 5, 4,
+    2, 1, 6, 0, 12, 1, 6, 0,
+    0, 2, 1, 0, 5, 0, 1, 1,
+    0, 5, 0, 2, 3, 0, 0, 9,
+    0, 1, 1, 0, 2, 1, 1, 4,
+    1, 0, 0, 2, 32, 16, 1, 0,
+    6, 1, 18, 3, 4, 10, 0, 6,
+    7, 13, 1, 5, 0, 5, 0, 0,
+    8, 5, 4, 1, 0, 4, 1, 0,
+    0, 0, 12, 0, 0, 0, 15, 22,
+    0, 0, 0, 0, 0, 1, 0, 1,
+    0, 0, 8, 0, 9, 39, 146,
+};
+
+static const openclext_function_name _function_names[111] = {
+#if defined(cl_khr_semaphore)
+    { "clReleaseSemaphoreKHR", offsetof(openclext_dispatch_table, clReleaseSemaphoreKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_DX9) && defined(cl_intel_dx9_media_sharing)
+    { "clGetDeviceIDsFromDX9INTEL", offsetof(openclext_dispatch_table, clGetDeviceIDsFromDX9INTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer_mutable_dispatch)
+    { "clUpdateMutableCommandsKHR", offsetof(openclext_dispatch_table, clUpdateMutableCommandsKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_VA_API) && defined(cl_intel_va_api_media_sharing)
+    { "clEnqueueReleaseVA_APIMediaSurfacesINTEL", offsetof(openclext_dispatch_table, clEnqueueReleaseVA_APIMediaSurfacesINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_ext_device_fission)
+    { "clCreateSubDevicesEXT", offsetof(openclext_dispatch_table, clCreateSubDevicesEXT), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_unified_shared_memory)
+    { "clMemFreeINTEL", offsetof(openclext_dispatch_table, clMemFreeINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_D3D11) && defined(cl_khr_d3d11_sharing)
+    { "clEnqueueAcquireD3D11ObjectsKHR", offsetof(openclext_dispatch_table, clEnqueueAcquireD3D11ObjectsKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_img_generate_mipmap)
+    { "clEnqueueGenerateMipmapIMG", offsetof(openclext_dispatch_table, clEnqueueGenerateMipmapIMG), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_DX9) && defined(cl_intel_dx9_media_sharing)
+    { "clCreateFromDX9MediaSurfaceINTEL", offsetof(openclext_dispatch_table, clCreateFromDX9MediaSurfaceINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer)
+    { "clCommandFillBufferKHR", offsetof(openclext_dispatch_table, clCommandFillBufferKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_ext_device_fission)
+    { "clReleaseDeviceEXT", offsetof(openclext_dispatch_table, clReleaseDeviceEXT), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_DX9) && defined(cl_khr_dx9_media_sharing)
+    { "clEnqueueAcquireDX9MediaSurfacesKHR", offsetof(openclext_dispatch_table, clEnqueueAcquireDX9MediaSurfacesKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_program_scope_host_pipe)
+    { "clEnqueueReadHostPipeINTEL", offsetof(openclext_dispatch_table, clEnqueueReadHostPipeINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_D3D11) && defined(cl_khr_d3d11_sharing)
+    { "clGetDeviceIDsFromD3D11KHR", offsetof(openclext_dispatch_table, clGetDeviceIDsFromD3D11KHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_ext_buffer_device_address)
+    { "clSetKernelArgDevicePointerEXT", offsetof(openclext_dispatch_table, clSetKernelArgDevicePointerEXT), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_GL) && defined(cl_intel_sharing_format_query_gl)
+    { "clGetSupportedGLTextureFormatsINTEL", offsetof(openclext_dispatch_table, clGetSupportedGLTextureFormatsINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_unified_shared_memory)
+    { "clSharedMemAllocINTEL", offsetof(openclext_dispatch_table, clSharedMemAllocINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer)
+    { "clEnqueueCommandBufferKHR", offsetof(openclext_dispatch_table, clEnqueueCommandBufferKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_qcom_ext_host_ptr)
+    { "clGetDeviceImageInfoQCOM", offsetof(openclext_dispatch_table, clGetDeviceImageInfoQCOM), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer)
+    { "clReleaseCommandBufferKHR", offsetof(openclext_dispatch_table, clReleaseCommandBufferKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_img_use_gralloc_ptr)
+    { "clEnqueueReleaseGrallocObjectsIMG", offsetof(openclext_dispatch_table, clEnqueueReleaseGrallocObjectsIMG), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_il_program)
+    { "clCreateProgramWithILKHR", offsetof(openclext_dispatch_table, clCreateProgramWithILKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_unified_shared_memory)
+    { "clEnqueueMemFillINTEL", offsetof(openclext_dispatch_table, clEnqueueMemFillINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_arm_shared_virtual_memory)
+    { "clEnqueueSVMUnmapARM", offsetof(openclext_dispatch_table, clEnqueueSVMUnmapARM), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer)
+    { "clCommandBarrierWithWaitListKHR", offsetof(openclext_dispatch_table, clCommandBarrierWithWaitListKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer)
+    { "clCommandSVMMemcpyKHR", offsetof(openclext_dispatch_table, clCommandSVMMemcpyKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_VA_API) && defined(cl_intel_va_api_media_sharing)
+    { "clEnqueueAcquireVA_APIMediaSurfacesINTEL", offsetof(openclext_dispatch_table, clEnqueueAcquireVA_APIMediaSurfacesINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_unified_shared_memory)
+    { "clHostMemAllocINTEL", offsetof(openclext_dispatch_table, clHostMemAllocINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_arm_import_memory)
+    { "clImportMemoryARM", offsetof(openclext_dispatch_table, clImportMemoryARM), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_D3D10) && defined(cl_khr_d3d10_sharing)
+    { "clCreateFromD3D10BufferKHR", offsetof(openclext_dispatch_table, clCreateFromD3D10BufferKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_unified_shared_memory)
+    { "clEnqueueMemcpyINTEL", offsetof(openclext_dispatch_table, clEnqueueMemcpyINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_GL) && defined(cl_khr_gl_event)
+    { "clCreateEventFromGLsyncKHR", offsetof(openclext_dispatch_table, clCreateEventFromGLsyncKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_D3D10) && defined(cl_khr_d3d10_sharing)
+    { "clCreateFromD3D10Texture3DKHR", offsetof(openclext_dispatch_table, clCreateFromD3D10Texture3DKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_DX9) && defined(cl_khr_dx9_media_sharing)
+    { "clGetDeviceIDsFromDX9MediaAdapterKHR", offsetof(openclext_dispatch_table, clGetDeviceIDsFromDX9MediaAdapterKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_VA_API) && defined(cl_intel_va_api_media_sharing)
+    { "clCreateFromVA_APIMediaSurfaceINTEL", offsetof(openclext_dispatch_table, clCreateFromVA_APIMediaSurfaceINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_subgroups)
+    { "clGetKernelSubGroupInfoKHR", offsetof(openclext_dispatch_table, clGetKernelSubGroupInfoKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_D3D11) && defined(cl_intel_sharing_format_query_d3d11)
+    { "clGetSupportedD3D11TextureFormatsINTEL", offsetof(openclext_dispatch_table, clGetSupportedD3D11TextureFormatsINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer)
+    { "clCommandCopyImageToBufferKHR", offsetof(openclext_dispatch_table, clCommandCopyImageToBufferKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_D3D10) && defined(cl_khr_d3d10_sharing)
+    { "clEnqueueReleaseD3D10ObjectsKHR", offsetof(openclext_dispatch_table, clEnqueueReleaseD3D10ObjectsKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer)
+    { "clCommandCopyBufferRectKHR", offsetof(openclext_dispatch_table, clCommandCopyBufferRectKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_arm_shared_virtual_memory)
+    { "clEnqueueSVMMemFillARM", offsetof(openclext_dispatch_table, clEnqueueSVMMemFillARM), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_create_command_queue)
+    { "clCreateCommandQueueWithPropertiesKHR", offsetof(openclext_dispatch_table, clCreateCommandQueueWithPropertiesKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_create_buffer_with_properties)
+    { "clCreateBufferWithPropertiesINTEL", offsetof(openclext_dispatch_table, clCreateBufferWithPropertiesINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_img_cancel_command)
+    { "clCancelCommandsIMG", offsetof(openclext_dispatch_table, clCancelCommandsIMG), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_EGL) && defined(cl_khr_egl_image)
+    { "clCreateFromEGLImageKHR", offsetof(openclext_dispatch_table, clCreateFromEGLImageKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_semaphore)
+    { "clGetSemaphoreInfoKHR", offsetof(openclext_dispatch_table, clGetSemaphoreInfoKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer)
+    { "clCreateCommandBufferKHR", offsetof(openclext_dispatch_table, clCreateCommandBufferKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer)
+    { "clCommandCopyBufferToImageKHR", offsetof(openclext_dispatch_table, clCommandCopyBufferToImageKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_external_memory)
+    { "clEnqueueReleaseExternalMemObjectsKHR", offsetof(openclext_dispatch_table, clEnqueueReleaseExternalMemObjectsKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_D3D10) && defined(cl_intel_sharing_format_query_d3d10)
+    { "clGetSupportedD3D10TextureFormatsINTEL", offsetof(openclext_dispatch_table, clGetSupportedD3D10TextureFormatsINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_arm_shared_virtual_memory)
+    { "clEnqueueSVMMapARM", offsetof(openclext_dispatch_table, clEnqueueSVMMapARM), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_program_scope_host_pipe)
+    { "clEnqueueWriteHostPipeINTEL", offsetof(openclext_dispatch_table, clEnqueueWriteHostPipeINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_semaphore)
+    { "clCreateSemaphoreWithPropertiesKHR", offsetof(openclext_dispatch_table, clCreateSemaphoreWithPropertiesKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_EGL) && defined(cl_khr_egl_event)
+    { "clCreateEventFromEGLSyncKHR", offsetof(openclext_dispatch_table, clCreateEventFromEGLSyncKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer_multi_device)
+    { "clRemapCommandBufferKHR", offsetof(openclext_dispatch_table, clRemapCommandBufferKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer)
+    { "clCommandFillImageKHR", offsetof(openclext_dispatch_table, clCommandFillImageKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_img_use_gralloc_ptr)
+    { "clEnqueueAcquireGrallocObjectsIMG", offsetof(openclext_dispatch_table, clEnqueueAcquireGrallocObjectsIMG), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer)
+    { "clCommandNDRangeKernelKHR", offsetof(openclext_dispatch_table, clCommandNDRangeKernelKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_unified_shared_memory)
+    { "clDeviceMemAllocINTEL", offsetof(openclext_dispatch_table, clDeviceMemAllocINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_arm_shared_virtual_memory)
+    { "clSVMFreeARM", offsetof(openclext_dispatch_table, clSVMFreeARM), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_external_memory)
+    { "clEnqueueAcquireExternalMemObjectsKHR", offsetof(openclext_dispatch_table, clEnqueueAcquireExternalMemObjectsKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_EGL) && defined(cl_khr_egl_image)
+    { "clEnqueueReleaseEGLObjectsKHR", offsetof(openclext_dispatch_table, clEnqueueReleaseEGLObjectsKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_accelerator)
+    { "clRetainAcceleratorINTEL", offsetof(openclext_dispatch_table, clRetainAcceleratorINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_arm_shared_virtual_memory)
+    { "clSVMAllocARM", offsetof(openclext_dispatch_table, clSVMAllocARM), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_accelerator)
+    { "clReleaseAcceleratorINTEL", offsetof(openclext_dispatch_table, clReleaseAcceleratorINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_D3D11) && defined(cl_khr_d3d11_sharing)
+    { "clCreateFromD3D11Texture3DKHR", offsetof(openclext_dispatch_table, clCreateFromD3D11Texture3DKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_external_semaphore_sync_fd)
+    { "clReImportSemaphoreSyncFdKHR", offsetof(openclext_dispatch_table, clReImportSemaphoreSyncFdKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer)
+    { "clRetainCommandBufferKHR", offsetof(openclext_dispatch_table, clRetainCommandBufferKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer)
+    { "clFinalizeCommandBufferKHR", offsetof(openclext_dispatch_table, clFinalizeCommandBufferKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer_mutable_dispatch)
+    { "clGetMutableCommandInfoKHR", offsetof(openclext_dispatch_table, clGetMutableCommandInfoKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_terminate_context)
+    { "clTerminateContextKHR", offsetof(openclext_dispatch_table, clTerminateContextKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_arm_shared_virtual_memory)
+    { "clEnqueueSVMFreeARM", offsetof(openclext_dispatch_table, clEnqueueSVMFreeARM), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_accelerator)
+    { "clGetAcceleratorInfoINTEL", offsetof(openclext_dispatch_table, clGetAcceleratorInfoINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer)
+    { "clCommandSVMMemFillKHR", offsetof(openclext_dispatch_table, clCommandSVMMemFillKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_D3D11) && defined(cl_khr_d3d11_sharing)
+    { "clCreateFromD3D11BufferKHR", offsetof(openclext_dispatch_table, clCreateFromD3D11BufferKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_unified_shared_memory)
+    { "clMemBlockingFreeINTEL", offsetof(openclext_dispatch_table, clMemBlockingFreeINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_loader_info)
+    { "clGetICDLoaderInfoOCLICD", offsetof(openclext_dispatch_table_common, clGetICDLoaderInfoOCLICD), true },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_D3D10) && defined(cl_khr_d3d10_sharing)
+    { "clGetDeviceIDsFromD3D10KHR", offsetof(openclext_dispatch_table, clGetDeviceIDsFromD3D10KHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_DX9) && defined(cl_intel_sharing_format_query_dx9)
+    { "clGetSupportedDX9MediaSurfaceFormatsINTEL", offsetof(openclext_dispatch_table, clGetSupportedDX9MediaSurfaceFormatsINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_ext_image_requirements_info)
+    { "clGetImageRequirementsInfoEXT", offsetof(openclext_dispatch_table, clGetImageRequirementsInfoEXT), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_semaphore)
+    { "clRetainSemaphoreKHR", offsetof(openclext_dispatch_table, clRetainSemaphoreKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_external_semaphore)
+    { "clGetSemaphoreHandleForTypeKHR", offsetof(openclext_dispatch_table, clGetSemaphoreHandleForTypeKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_DX9) && defined(cl_khr_dx9_media_sharing)
+    { "clCreateFromDX9MediaSurfaceKHR", offsetof(openclext_dispatch_table, clCreateFromDX9MediaSurfaceKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_semaphore)
+    { "clEnqueueSignalSemaphoresKHR", offsetof(openclext_dispatch_table, clEnqueueSignalSemaphoresKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_unified_shared_memory)
+    { "clGetMemAllocInfoINTEL", offsetof(openclext_dispatch_table, clGetMemAllocInfoINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_DX9) && defined(cl_intel_dx9_media_sharing)
+    { "clEnqueueAcquireDX9ObjectsINTEL", offsetof(openclext_dispatch_table, clEnqueueAcquireDX9ObjectsINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_D3D11) && defined(cl_khr_d3d11_sharing)
+    { "clEnqueueReleaseD3D11ObjectsKHR", offsetof(openclext_dispatch_table, clEnqueueReleaseD3D11ObjectsKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_ext_device_fission)
+    { "clRetainDeviceEXT", offsetof(openclext_dispatch_table, clRetainDeviceEXT), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_pocl_content_size)
+    { "clSetContentSizeBufferPoCL", offsetof(openclext_dispatch_table, clSetContentSizeBufferPoCL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_accelerator)
+    { "clCreateAcceleratorINTEL", offsetof(openclext_dispatch_table, clCreateAcceleratorINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_unified_shared_memory)
+    { "clEnqueueMemAdviseINTEL", offsetof(openclext_dispatch_table, clEnqueueMemAdviseINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_VA_API) && defined(cl_intel_va_api_media_sharing)
+    { "clGetDeviceIDsFromVA_APIMediaAdapterINTEL", offsetof(openclext_dispatch_table, clGetDeviceIDsFromVA_APIMediaAdapterINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer)
+    { "clCommandCopyBufferKHR", offsetof(openclext_dispatch_table, clCommandCopyBufferKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_VA_API) && defined(cl_intel_sharing_format_query_va_api)
+    { "clGetSupportedVA_APIMediaSurfaceFormatsINTEL", offsetof(openclext_dispatch_table, clGetSupportedVA_APIMediaSurfaceFormatsINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer)
+    { "clGetCommandBufferInfoKHR", offsetof(openclext_dispatch_table, clGetCommandBufferInfoKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_D3D10) && defined(cl_khr_d3d10_sharing)
+    { "clCreateFromD3D10Texture2DKHR", offsetof(openclext_dispatch_table, clCreateFromD3D10Texture2DKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_D3D10) && defined(cl_khr_d3d10_sharing)
+    { "clEnqueueAcquireD3D10ObjectsKHR", offsetof(openclext_dispatch_table, clEnqueueAcquireD3D10ObjectsKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_DX9) && defined(cl_khr_dx9_media_sharing)
+    { "clEnqueueReleaseDX9MediaSurfacesKHR", offsetof(openclext_dispatch_table, clEnqueueReleaseDX9MediaSurfacesKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_arm_shared_virtual_memory)
+    { "clSetKernelArgSVMPointerARM", offsetof(openclext_dispatch_table, clSetKernelArgSVMPointerARM), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_unified_shared_memory)
+    { "clEnqueueMemsetINTEL", offsetof(openclext_dispatch_table, clEnqueueMemsetINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_DX9) && defined(cl_intel_dx9_media_sharing)
+    { "clEnqueueReleaseDX9ObjectsINTEL", offsetof(openclext_dispatch_table, clEnqueueReleaseDX9ObjectsINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_D3D11) && defined(cl_khr_d3d11_sharing)
+    { "clCreateFromD3D11Texture2DKHR", offsetof(openclext_dispatch_table, clCreateFromD3D11Texture2DKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_ext_migrate_memobject)
+    { "clEnqueueMigrateMemObjectEXT", offsetof(openclext_dispatch_table, clEnqueueMigrateMemObjectEXT), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(CLEXT_INCLUDE_EGL) && defined(cl_khr_egl_image)
+    { "clEnqueueAcquireEGLObjectsKHR", offsetof(openclext_dispatch_table, clEnqueueAcquireEGLObjectsKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_arm_shared_virtual_memory)
+    { "clSetKernelExecInfoARM", offsetof(openclext_dispatch_table, clSetKernelExecInfoARM), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_suggested_local_work_size)
+    { "clGetKernelSuggestedLocalWorkSizeKHR", offsetof(openclext_dispatch_table, clGetKernelSuggestedLocalWorkSizeKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_command_buffer)
+    { "clCommandCopyImageKHR", offsetof(openclext_dispatch_table, clCommandCopyImageKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_khr_semaphore)
+    { "clEnqueueWaitSemaphoresKHR", offsetof(openclext_dispatch_table, clEnqueueWaitSemaphoresKHR), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_unified_shared_memory)
+    { "clSetKernelArgMemPointerINTEL", offsetof(openclext_dispatch_table, clSetKernelArgMemPointerINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_intel_unified_shared_memory) && (defined(CL_VERSION_1_2))
+    { "clEnqueueMigrateMemINTEL", offsetof(openclext_dispatch_table, clEnqueueMigrateMemINTEL), false },
+#else
+    { nullptr, 0, false },
+#endif
+#if defined(cl_arm_shared_virtual_memory)
+    { "clEnqueueSVMMemcpyARM", offsetof(openclext_dispatch_table, clEnqueueSVMMemcpyARM), false },
+#else
+    { nullptr, 0, false },
+#endif
+};
 
-cl_int CL_API_CALL clGetMemAllocInfoINTEL(
-    cl_context context,
-    const void* ptr,
-    cl_mem_info_intel param_name,
-    size_t param_value_size,
-    void* param_value,
-    size_t* param_value_size_ret)
+static inline uint32_t _hash_name(uint32_t seed, const char* name)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetMemAllocInfoINTEL == nullptr) {
-        return CL_INVALID_OPERATION;
+    uint32_t hash = 2166136261u ^ seed;
+    for (; *name; name++) {
+        hash = (hash ^ (uint8_t)*name) * 16777619u;
     }
-    return dispatch_ptr->clGetMemAllocInfoINTEL(
-        context,
-        ptr,
-        param_name,
-        param_value_size,
-        param_value,
-        param_value_size_ret);
+    return hash;
 }
 
-cl_int CL_API_CALL clSetKernelArgMemPointerINTEL(
-    cl_kernel kernel,
-    cl_uint arg_index,
-    const void* arg_value)
+void* CL_API_CALL clextGetFunctionAddress(
+    cl_platform_id platform,
+    const char* func_name)
 {
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(kernel);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clSetKernelArgMemPointerINTEL == nullptr) {
-        return CL_INVALID_OPERATION;
+    if (func_name == nullptr) {
+        return nullptr;
     }
-    return dispatch_ptr->clSetKernelArgMemPointerINTEL(
-        kernel,
-        arg_index,
-        arg_value);
-}
 
-cl_int CL_API_CALL clEnqueueMemFillINTEL(
-    cl_command_queue command_queue,
-    void* dst_ptr,
-    const void* pattern,
-    size_t pattern_size,
-    size_t size,
-    cl_uint num_events_in_wait_list,
-    const cl_event* event_wait_list,
-    cl_event* event)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueMemFillINTEL == nullptr) {
-        return CL_INVALID_OPERATION;
+    const size_t count = 111;
+    uint32_t seed = _function_name_seeds[_hash_name(0, func_name) % count];
+    const openclext_function_name& entry =
+        _function_names[_hash_name(seed, func_name) % count];
+    if (entry.name == nullptr || strcmp(entry.name, func_name) != 0) {
+        return nullptr;
     }
-    return dispatch_ptr->clEnqueueMemFillINTEL(
-        command_queue,
-        dst_ptr,
-        pattern,
-        pattern_size,
-        size,
-        num_events_in_wait_list,
-        event_wait_list,
-        event);
-}
 
-cl_int CL_API_CALL clEnqueueMemcpyINTEL(
-    cl_command_queue command_queue,
-    cl_bool blocking,
-    void* dst_ptr,
-    const void* src_ptr,
-    size_t size,
-    cl_uint num_events_in_wait_list,
-    const cl_event* event_wait_list,
-    cl_event* event)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueMemcpyINTEL == nullptr) {
-        return CL_INVALID_OPERATION;
+    const void* dispatch_ptr = nullptr;
+    if (entry.common) {
+        dispatch_ptr = _get_dispatch();
+    } else if (platform != nullptr) {
+        // With a single platform, the one dispatch table may be for a
+        // different platform.
+        openclext_dispatch_table* platform_dispatch_ptr = _get_dispatch(platform);
+        if (_get_dispatch_platform(platform_dispatch_ptr) == platform) {
+            dispatch_ptr = platform_dispatch_ptr;
+        }
     }
-    return dispatch_ptr->clEnqueueMemcpyINTEL(
-        command_queue,
-        blocking,
-        dst_ptr,
-        src_ptr,
-        size,
-        num_events_in_wait_list,
-        event_wait_list,
-        event);
-}
 
-cl_int CL_API_CALL clEnqueueMemAdviseINTEL(
-    cl_command_queue command_queue,
-    const void* ptr,
-    size_t size,
-    cl_mem_advice_intel advice,
-    cl_uint num_events_in_wait_list,
-    const cl_event* event_wait_list,
-    cl_event* event)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueMemAdviseINTEL == nullptr) {
-        return CL_INVALID_OPERATION;
+    void* function = nullptr;
+    if (dispatch_ptr) {
+        memcpy(&function, (const char*)dispatch_ptr + entry.offset, sizeof(function));
     }
-    return dispatch_ptr->clEnqueueMemAdviseINTEL(
-        command_queue,
-        ptr,
-        size,
-        advice,
-        num_events_in_wait_list,
-        event_wait_list,
-        event);
+    return function;
 }
 
-#if defined(CL_VERSION_1_2)
+#if defined(CLEXT_ENABLE_CAPTURE)
 
-cl_int CL_API_CALL clEnqueueMigrateMemINTEL(
-    cl_command_queue command_queue,
-    const void* ptr,
-    size_t size,
-    cl_mem_migration_flags flags,
-    cl_uint num_events_in_wait_list,
-    const cl_event* event_wait_list,
-    cl_event* event)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueMigrateMemINTEL == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clEnqueueMigrateMemINTEL(
-        command_queue,
-        ptr,
-        size,
-        flags,
-        num_events_in_wait_list,
-        event_wait_list,
-        event);
-}
+/***************************************************************
+* Replay Function Table
+***************************************************************/
 
-#endif // defined(CL_VERSION_1_2)
+#include "openclext_replay.h"
 
-cl_int CL_API_CALL clEnqueueMemsetINTEL(
-    cl_command_queue command_queue,
-    void* dst_ptr,
-    cl_int value,
-    size_t size,
-    cl_uint num_events_in_wait_list,
-    const cl_event* event_wait_list,
-    cl_event* event)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueMemsetINTEL == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clEnqueueMemsetINTEL(
-        command_queue,
-        dst_ptr,
-        value,
-        size,
-        num_events_in_wait_list,
-        event_wait_list,
-        event);
-}
+#define CLEXT_REPLAY_FUNCTION(_funcname)                                       \
+    { #_funcname,                                                              \
+      openclext_replay_invoker<decltype(&_funcname), &_funcname>::invoke,      \
+      (void*)openclext_null_function<decltype(&_funcname)>::call },
 
+const openclext_replay_function openclext_replay_functions[] = {
+#if defined(cl_khr_command_buffer)
+    CLEXT_REPLAY_FUNCTION(clCreateCommandBufferKHR)
+    CLEXT_REPLAY_FUNCTION(clFinalizeCommandBufferKHR)
+    CLEXT_REPLAY_FUNCTION(clRetainCommandBufferKHR)
+    CLEXT_REPLAY_FUNCTION(clReleaseCommandBufferKHR)
+    CLEXT_REPLAY_FUNCTION(clEnqueueCommandBufferKHR)
+    CLEXT_REPLAY_FUNCTION(clCommandBarrierWithWaitListKHR)
+    CLEXT_REPLAY_FUNCTION(clCommandCopyBufferKHR)
+    CLEXT_REPLAY_FUNCTION(clCommandCopyBufferRectKHR)
+    CLEXT_REPLAY_FUNCTION(clCommandCopyBufferToImageKHR)
+    CLEXT_REPLAY_FUNCTION(clCommandCopyImageKHR)
+    CLEXT_REPLAY_FUNCTION(clCommandCopyImageToBufferKHR)
+    CLEXT_REPLAY_FUNCTION(clCommandFillBufferKHR)
+    CLEXT_REPLAY_FUNCTION(clCommandFillImageKHR)
+    CLEXT_REPLAY_FUNCTION(clCommandNDRangeKernelKHR)
+    CLEXT_REPLAY_FUNCTION(clGetCommandBufferInfoKHR)
+    CLEXT_REPLAY_FUNCTION(clCommandSVMMemcpyKHR)
+    CLEXT_REPLAY_FUNCTION(clCommandSVMMemFillKHR)
+#endif // defined(cl_khr_command_buffer)
+#if defined(cl_khr_command_buffer_multi_device)
+    CLEXT_REPLAY_FUNCTION(clRemapCommandBufferKHR)
+#endif // defined(cl_khr_command_buffer_multi_device)
+#if defined(cl_khr_command_buffer_mutable_dispatch)
+    CLEXT_REPLAY_FUNCTION(clUpdateMutableCommandsKHR)
+    CLEXT_REPLAY_FUNCTION(clGetMutableCommandInfoKHR)
+#endif // defined(cl_khr_command_buffer_mutable_dispatch)
+#if defined(cl_khr_create_command_queue)
+    CLEXT_REPLAY_FUNCTION(clCreateCommandQueueWithPropertiesKHR)
+#endif // defined(cl_khr_create_command_queue)
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_khr_d3d10_sharing)
+    CLEXT_REPLAY_FUNCTION(clGetDeviceIDsFromD3D10KHR)
+    CLEXT_REPLAY_FUNCTION(clCreateFromD3D10BufferKHR)
+    CLEXT_REPLAY_FUNCTION(clCreateFromD3D10Texture2DKHR)
+    CLEXT_REPLAY_FUNCTION(clCreateFromD3D10Texture3DKHR)
+    CLEXT_REPLAY_FUNCTION(clEnqueueAcquireD3D10ObjectsKHR)
+    CLEXT_REPLAY_FUNCTION(clEnqueueReleaseD3D10ObjectsKHR)
+#endif // defined(cl_khr_d3d10_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_khr_d3d11_sharing)
+    CLEXT_REPLAY_FUNCTION(clGetDeviceIDsFromD3D11KHR)
+    CLEXT_REPLAY_FUNCTION(clCreateFromD3D11BufferKHR)
+    CLEXT_REPLAY_FUNCTION(clCreateFromD3D11Texture2DKHR)
+    CLEXT_REPLAY_FUNCTION(clCreateFromD3D11Texture3DKHR)
+    CLEXT_REPLAY_FUNCTION(clEnqueueAcquireD3D11ObjectsKHR)
+    CLEXT_REPLAY_FUNCTION(clEnqueueReleaseD3D11ObjectsKHR)
+#endif // defined(cl_khr_d3d11_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_khr_dx9_media_sharing)
+    CLEXT_REPLAY_FUNCTION(clGetDeviceIDsFromDX9MediaAdapterKHR)
+    CLEXT_REPLAY_FUNCTION(clCreateFromDX9MediaSurfaceKHR)
+    CLEXT_REPLAY_FUNCTION(clEnqueueAcquireDX9MediaSurfacesKHR)
+    CLEXT_REPLAY_FUNCTION(clEnqueueReleaseDX9MediaSurfacesKHR)
+#endif // defined(cl_khr_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_event)
+    CLEXT_REPLAY_FUNCTION(clCreateEventFromEGLSyncKHR)
+#endif // defined(cl_khr_egl_event)
+#endif // defined(CLEXT_INCLUDE_EGL)
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_image)
+    CLEXT_REPLAY_FUNCTION(clCreateFromEGLImageKHR)
+    CLEXT_REPLAY_FUNCTION(clEnqueueAcquireEGLObjectsKHR)
+    CLEXT_REPLAY_FUNCTION(clEnqueueReleaseEGLObjectsKHR)
+#endif // defined(cl_khr_egl_image)
+#endif // defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_external_memory)
+    CLEXT_REPLAY_FUNCTION(clEnqueueAcquireExternalMemObjectsKHR)
+    CLEXT_REPLAY_FUNCTION(clEnqueueReleaseExternalMemObjectsKHR)
+#endif // defined(cl_khr_external_memory)
+#if defined(cl_khr_external_semaphore)
+    CLEXT_REPLAY_FUNCTION(clGetSemaphoreHandleForTypeKHR)
+#endif // defined(cl_khr_external_semaphore)
+#if defined(cl_khr_external_semaphore_sync_fd)
+    CLEXT_REPLAY_FUNCTION(clReImportSemaphoreSyncFdKHR)
+#endif // defined(cl_khr_external_semaphore_sync_fd)
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_khr_gl_event)
+    CLEXT_REPLAY_FUNCTION(clCreateEventFromGLsyncKHR)
+#endif // defined(cl_khr_gl_event)
+#endif // defined(CLEXT_INCLUDE_GL)
+#if defined(cl_khr_il_program)
+    CLEXT_REPLAY_FUNCTION(clCreateProgramWithILKHR)
+#endif // defined(cl_khr_il_program)
+#if defined(cl_khr_semaphore)
+    CLEXT_REPLAY_FUNCTION(clCreateSemaphoreWithPropertiesKHR)
+    CLEXT_REPLAY_FUNCTION(clEnqueueWaitSemaphoresKHR)
+    CLEXT_REPLAY_FUNCTION(clEnqueueSignalSemaphoresKHR)
+    CLEXT_REPLAY_FUNCTION(clGetSemaphoreInfoKHR)
+    CLEXT_REPLAY_FUNCTION(clReleaseSemaphoreKHR)
+    CLEXT_REPLAY_FUNCTION(clRetainSemaphoreKHR)
+#endif // defined(cl_khr_semaphore)
+#if defined(cl_khr_subgroups)
+    CLEXT_REPLAY_FUNCTION(clGetKernelSubGroupInfoKHR)
+#endif // defined(cl_khr_subgroups)
+#if defined(cl_khr_suggested_local_work_size)
+    CLEXT_REPLAY_FUNCTION(clGetKernelSuggestedLocalWorkSizeKHR)
+#endif // defined(cl_khr_suggested_local_work_size)
+#if defined(cl_khr_terminate_context)
+    CLEXT_REPLAY_FUNCTION(clTerminateContextKHR)
+#endif // defined(cl_khr_terminate_context)
+#if defined(cl_ext_buffer_device_address)
+    CLEXT_REPLAY_FUNCTION(clSetKernelArgDevicePointerEXT)
+#endif // defined(cl_ext_buffer_device_address)
+#if defined(cl_ext_device_fission)
+    CLEXT_REPLAY_FUNCTION(clReleaseDeviceEXT)
+    CLEXT_REPLAY_FUNCTION(clRetainDeviceEXT)
+    CLEXT_REPLAY_FUNCTION(clCreateSubDevicesEXT)
+#endif // defined(cl_ext_device_fission)
+#if defined(cl_ext_image_requirements_info)
+    CLEXT_REPLAY_FUNCTION(clGetImageRequirementsInfoEXT)
+#endif // defined(cl_ext_image_requirements_info)
+#if defined(cl_ext_migrate_memobject)
+    CLEXT_REPLAY_FUNCTION(clEnqueueMigrateMemObjectEXT)
+#endif // defined(cl_ext_migrate_memobject)
+#if defined(cl_arm_import_memory)
+    CLEXT_REPLAY_FUNCTION(clImportMemoryARM)
+#endif // defined(cl_arm_import_memory)
+#if defined(cl_arm_shared_virtual_memory)
+    CLEXT_REPLAY_FUNCTION(clSVMAllocARM)
+    CLEXT_REPLAY_FUNCTION(clSVMFreeARM)
+    CLEXT_REPLAY_FUNCTION(clEnqueueSVMFreeARM)
+    CLEXT_REPLAY_FUNCTION(clEnqueueSVMMemcpyARM)
+    CLEXT_REPLAY_FUNCTION(clEnqueueSVMMemFillARM)
+    CLEXT_REPLAY_FUNCTION(clEnqueueSVMMapARM)
+    CLEXT_REPLAY_FUNCTION(clEnqueueSVMUnmapARM)
+    CLEXT_REPLAY_FUNCTION(clSetKernelArgSVMPointerARM)
+    CLEXT_REPLAY_FUNCTION(clSetKernelExecInfoARM)
+#endif // defined(cl_arm_shared_virtual_memory)
+#if defined(cl_img_cancel_command)
+    CLEXT_REPLAY_FUNCTION(clCancelCommandsIMG)
+#endif // defined(cl_img_cancel_command)
+#if defined(cl_img_generate_mipmap)
+    CLEXT_REPLAY_FUNCTION(clEnqueueGenerateMipmapIMG)
+#endif // defined(cl_img_generate_mipmap)
+#if defined(cl_img_use_gralloc_ptr)
+    CLEXT_REPLAY_FUNCTION(clEnqueueAcquireGrallocObjectsIMG)
+    CLEXT_REPLAY_FUNCTION(clEnqueueReleaseGrallocObjectsIMG)
+#endif // defined(cl_img_use_gralloc_ptr)
+#if defined(cl_intel_accelerator)
+    CLEXT_REPLAY_FUNCTION(clCreateAcceleratorINTEL)
+    CLEXT_REPLAY_FUNCTION(clGetAcceleratorInfoINTEL)
+    CLEXT_REPLAY_FUNCTION(clRetainAcceleratorINTEL)
+    CLEXT_REPLAY_FUNCTION(clReleaseAcceleratorINTEL)
+#endif // defined(cl_intel_accelerator)
+#if defined(cl_intel_create_buffer_with_properties)
+    CLEXT_REPLAY_FUNCTION(clCreateBufferWithPropertiesINTEL)
+#endif // defined(cl_intel_create_buffer_with_properties)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_dx9_media_sharing)
+    CLEXT_REPLAY_FUNCTION(clGetDeviceIDsFromDX9INTEL)
+    CLEXT_REPLAY_FUNCTION(clCreateFromDX9MediaSurfaceINTEL)
+    CLEXT_REPLAY_FUNCTION(clEnqueueAcquireDX9ObjectsINTEL)
+    CLEXT_REPLAY_FUNCTION(clEnqueueReleaseDX9ObjectsINTEL)
+#endif // defined(cl_intel_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_program_scope_host_pipe)
+    CLEXT_REPLAY_FUNCTION(clEnqueueReadHostPipeINTEL)
+    CLEXT_REPLAY_FUNCTION(clEnqueueWriteHostPipeINTEL)
+#endif // defined(cl_intel_program_scope_host_pipe)
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_intel_sharing_format_query_d3d10)
+    CLEXT_REPLAY_FUNCTION(clGetSupportedD3D10TextureFormatsINTEL)
+#endif // defined(cl_intel_sharing_format_query_d3d10)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_intel_sharing_format_query_d3d11)
+    CLEXT_REPLAY_FUNCTION(clGetSupportedD3D11TextureFormatsINTEL)
+#endif // defined(cl_intel_sharing_format_query_d3d11)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_sharing_format_query_dx9)
+    CLEXT_REPLAY_FUNCTION(clGetSupportedDX9MediaSurfaceFormatsINTEL)
+#endif // defined(cl_intel_sharing_format_query_dx9)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_intel_sharing_format_query_gl)
+    CLEXT_REPLAY_FUNCTION(clGetSupportedGLTextureFormatsINTEL)
+#endif // defined(cl_intel_sharing_format_query_gl)
+#endif // defined(CLEXT_INCLUDE_GL)
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_sharing_format_query_va_api)
+    CLEXT_REPLAY_FUNCTION(clGetSupportedVA_APIMediaSurfaceFormatsINTEL)
+#endif // defined(cl_intel_sharing_format_query_va_api)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_unified_shared_memory)
+    CLEXT_REPLAY_FUNCTION(clHostMemAllocINTEL)
+    CLEXT_REPLAY_FUNCTION(clDeviceMemAllocINTEL)
+    CLEXT_REPLAY_FUNCTION(clSharedMemAllocINTEL)
+    CLEXT_REPLAY_FUNCTION(clMemFreeINTEL)
+    CLEXT_REPLAY_FUNCTION(clMemBlockingFreeINTEL)
+    CLEXT_REPLAY_FUNCTION(clGetMemAllocInfoINTEL)
+    CLEXT_REPLAY_FUNCTION(clSetKernelArgMemPointerINTEL)
+    CLEXT_REPLAY_FUNCTION(clEnqueueMemFillINTEL)
+    CLEXT_REPLAY_FUNCTION(clEnqueueMemcpyINTEL)
+    CLEXT_REPLAY_FUNCTION(clEnqueueMemAdviseINTEL)
+#if defined(CL_VERSION_1_2)
+    CLEXT_REPLAY_FUNCTION(clEnqueueMigrateMemINTEL)
+#endif // defined(CL_VERSION_1_2)
+    CLEXT_REPLAY_FUNCTION(clEnqueueMemsetINTEL)
 #endif // defined(cl_intel_unified_shared_memory)
-
 #if defined(CLEXT_INCLUDE_VA_API)
 #if defined(cl_intel_va_api_media_sharing)
+    CLEXT_REPLAY_FUNCTION(clGetDeviceIDsFromVA_APIMediaAdapterINTEL)
+    CLEXT_REPLAY_FUNCTION(clCreateFromVA_APIMediaSurfaceINTEL)
+    CLEXT_REPLAY_FUNCTION(clEnqueueAcquireVA_APIMediaSurfacesINTEL)
+    CLEXT_REPLAY_FUNCTION(clEnqueueReleaseVA_APIMediaSurfacesINTEL)
+#endif // defined(cl_intel_va_api_media_sharing)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_loader_info)
+    CLEXT_REPLAY_FUNCTION(clGetICDLoaderInfoOCLICD)
+#endif // defined(cl_loader_info)
+#if defined(cl_pocl_content_size)
+    CLEXT_REPLAY_FUNCTION(clSetContentSizeBufferPoCL)
+#endif // defined(cl_pocl_content_size)
+#if defined(cl_qcom_ext_host_ptr)
+    CLEXT_REPLAY_FUNCTION(clGetDeviceImageInfoQCOM)
+#endif // defined(cl_qcom_ext_host_ptr)
+    { nullptr, nullptr, nullptr }
+};
 
-cl_int CL_API_CALL clGetDeviceIDsFromVA_APIMediaAdapterINTEL(
-    cl_platform_id platform,
-    cl_va_api_device_source_intel media_adapter_type,
-    void* media_adapter,
-    cl_va_api_device_set_intel media_adapter_set,
-    cl_uint num_entries,
-    cl_device_id* devices,
-    cl_uint* num_devices)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(platform);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetDeviceIDsFromVA_APIMediaAdapterINTEL == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clGetDeviceIDsFromVA_APIMediaAdapterINTEL(
-        platform,
-        media_adapter_type,
-        media_adapter,
-        media_adapter_set,
-        num_entries,
-        devices,
-        num_devices);
-}
+#undef CLEXT_REPLAY_FUNCTION
 
-cl_mem CL_API_CALL clCreateFromVA_APIMediaSurfaceINTEL(
-    cl_context context,
-    cl_mem_flags flags,
-    VASurfaceID* surface,
-    cl_uint plane,
-    cl_int* errcode_ret)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateFromVA_APIMediaSurfaceINTEL == nullptr) {
-        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
-        return nullptr;
-    }
-    return dispatch_ptr->clCreateFromVA_APIMediaSurfaceINTEL(
-        context,
-        flags,
-        surface,
-        plane,
-        errcode_ret);
-}
+#endif // defined(CLEXT_ENABLE_CAPTURE)
 
-cl_int CL_API_CALL clEnqueueAcquireVA_APIMediaSurfacesINTEL(
-    cl_command_queue command_queue,
-    cl_uint num_objects,
-    const cl_mem* mem_objects,
-    cl_uint num_events_in_wait_list,
-    const cl_event* event_wait_list,
-    cl_event* event)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueAcquireVA_APIMediaSurfacesINTEL == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clEnqueueAcquireVA_APIMediaSurfacesINTEL(
-        command_queue,
-        num_objects,
-        mem_objects,
-        num_events_in_wait_list,
-        event_wait_list,
-        event);
-}
+#if defined(CLEXT_INTERPOSER)
 
-cl_int CL_API_CALL clEnqueueReleaseVA_APIMediaSurfacesINTEL(
-    cl_command_queue command_queue,
-    cl_uint num_objects,
-    const cl_mem* mem_objects,
-    cl_uint num_events_in_wait_list,
-    const cl_event* event_wait_list,
-    cl_event* event)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueReleaseVA_APIMediaSurfacesINTEL == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clEnqueueReleaseVA_APIMediaSurfacesINTEL(
-        command_queue,
-        num_objects,
-        mem_objects,
-        num_events_in_wait_list,
-        event_wait_list,
-        event);
-}
+/***************************************************************
+* Interposer Function Table
+***************************************************************/
 
+#define CLEXT_INTERPOSER_FUNCTION(_funcname)                                   \
+    { #_funcname, (void*)&_funcname },
+
+const openclext_interposer_function openclext_interposer_functions[] = {
+#if defined(cl_khr_command_buffer)
+    CLEXT_INTERPOSER_FUNCTION(clCreateCommandBufferKHR)
+    CLEXT_INTERPOSER_FUNCTION(clFinalizeCommandBufferKHR)
+    CLEXT_INTERPOSER_FUNCTION(clRetainCommandBufferKHR)
+    CLEXT_INTERPOSER_FUNCTION(clReleaseCommandBufferKHR)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueCommandBufferKHR)
+    CLEXT_INTERPOSER_FUNCTION(clCommandBarrierWithWaitListKHR)
+    CLEXT_INTERPOSER_FUNCTION(clCommandCopyBufferKHR)
+    CLEXT_INTERPOSER_FUNCTION(clCommandCopyBufferRectKHR)
+    CLEXT_INTERPOSER_FUNCTION(clCommandCopyBufferToImageKHR)
+    CLEXT_INTERPOSER_FUNCTION(clCommandCopyImageKHR)
+    CLEXT_INTERPOSER_FUNCTION(clCommandCopyImageToBufferKHR)
+    CLEXT_INTERPOSER_FUNCTION(clCommandFillBufferKHR)
+    CLEXT_INTERPOSER_FUNCTION(clCommandFillImageKHR)
+    CLEXT_INTERPOSER_FUNCTION(clCommandNDRangeKernelKHR)
+    CLEXT_INTERPOSER_FUNCTION(clGetCommandBufferInfoKHR)
+    CLEXT_INTERPOSER_FUNCTION(clCommandSVMMemcpyKHR)
+    CLEXT_INTERPOSER_FUNCTION(clCommandSVMMemFillKHR)
+#endif // defined(cl_khr_command_buffer)
+#if defined(cl_khr_command_buffer_multi_device)
+    CLEXT_INTERPOSER_FUNCTION(clRemapCommandBufferKHR)
+#endif // defined(cl_khr_command_buffer_multi_device)
+#if defined(cl_khr_command_buffer_mutable_dispatch)
+    CLEXT_INTERPOSER_FUNCTION(clUpdateMutableCommandsKHR)
+    CLEXT_INTERPOSER_FUNCTION(clGetMutableCommandInfoKHR)
+#endif // defined(cl_khr_command_buffer_mutable_dispatch)
+#if defined(cl_khr_create_command_queue)
+    CLEXT_INTERPOSER_FUNCTION(clCreateCommandQueueWithPropertiesKHR)
+#endif // defined(cl_khr_create_command_queue)
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_khr_d3d10_sharing)
+    CLEXT_INTERPOSER_FUNCTION(clGetDeviceIDsFromD3D10KHR)
+    CLEXT_INTERPOSER_FUNCTION(clCreateFromD3D10BufferKHR)
+    CLEXT_INTERPOSER_FUNCTION(clCreateFromD3D10Texture2DKHR)
+    CLEXT_INTERPOSER_FUNCTION(clCreateFromD3D10Texture3DKHR)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueAcquireD3D10ObjectsKHR)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueReleaseD3D10ObjectsKHR)
+#endif // defined(cl_khr_d3d10_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_khr_d3d11_sharing)
+    CLEXT_INTERPOSER_FUNCTION(clGetDeviceIDsFromD3D11KHR)
+    CLEXT_INTERPOSER_FUNCTION(clCreateFromD3D11BufferKHR)
+    CLEXT_INTERPOSER_FUNCTION(clCreateFromD3D11Texture2DKHR)
+    CLEXT_INTERPOSER_FUNCTION(clCreateFromD3D11Texture3DKHR)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueAcquireD3D11ObjectsKHR)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueReleaseD3D11ObjectsKHR)
+#endif // defined(cl_khr_d3d11_sharing)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_khr_dx9_media_sharing)
+    CLEXT_INTERPOSER_FUNCTION(clGetDeviceIDsFromDX9MediaAdapterKHR)
+    CLEXT_INTERPOSER_FUNCTION(clCreateFromDX9MediaSurfaceKHR)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueAcquireDX9MediaSurfacesKHR)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueReleaseDX9MediaSurfacesKHR)
+#endif // defined(cl_khr_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_event)
+    CLEXT_INTERPOSER_FUNCTION(clCreateEventFromEGLSyncKHR)
+#endif // defined(cl_khr_egl_event)
+#endif // defined(CLEXT_INCLUDE_EGL)
+#if defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_egl_image)
+    CLEXT_INTERPOSER_FUNCTION(clCreateFromEGLImageKHR)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueAcquireEGLObjectsKHR)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueReleaseEGLObjectsKHR)
+#endif // defined(cl_khr_egl_image)
+#endif // defined(CLEXT_INCLUDE_EGL)
+#if defined(cl_khr_external_memory)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueAcquireExternalMemObjectsKHR)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueReleaseExternalMemObjectsKHR)
+#endif // defined(cl_khr_external_memory)
+#if defined(cl_khr_external_semaphore)
+    CLEXT_INTERPOSER_FUNCTION(clGetSemaphoreHandleForTypeKHR)
+#endif // defined(cl_khr_external_semaphore)
+#if defined(cl_khr_external_semaphore_sync_fd)
+    CLEXT_INTERPOSER_FUNCTION(clReImportSemaphoreSyncFdKHR)
+#endif // defined(cl_khr_external_semaphore_sync_fd)
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_khr_gl_event)
+    CLEXT_INTERPOSER_FUNCTION(clCreateEventFromGLsyncKHR)
+#endif // defined(cl_khr_gl_event)
+#endif // defined(CLEXT_INCLUDE_GL)
+#if defined(cl_khr_il_program)
+    CLEXT_INTERPOSER_FUNCTION(clCreateProgramWithILKHR)
+#endif // defined(cl_khr_il_program)
+#if defined(cl_khr_semaphore)
+    CLEXT_INTERPOSER_FUNCTION(clCreateSemaphoreWithPropertiesKHR)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueWaitSemaphoresKHR)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueSignalSemaphoresKHR)
+    CLEXT_INTERPOSER_FUNCTION(clGetSemaphoreInfoKHR)
+    CLEXT_INTERPOSER_FUNCTION(clReleaseSemaphoreKHR)
+    CLEXT_INTERPOSER_FUNCTION(clRetainSemaphoreKHR)
+#endif // defined(cl_khr_semaphore)
+#if defined(cl_khr_subgroups)
+    CLEXT_INTERPOSER_FUNCTION(clGetKernelSubGroupInfoKHR)
+#endif // defined(cl_khr_subgroups)
+#if defined(cl_khr_suggested_local_work_size)
+    CLEXT_INTERPOSER_FUNCTION(clGetKernelSuggestedLocalWorkSizeKHR)
+#endif // defined(cl_khr_suggested_local_work_size)
+#if defined(cl_khr_terminate_context)
+    CLEXT_INTERPOSER_FUNCTION(clTerminateContextKHR)
+#endif // defined(cl_khr_terminate_context)
+#if defined(cl_ext_buffer_device_address)
+    CLEXT_INTERPOSER_FUNCTION(clSetKernelArgDevicePointerEXT)
+#endif // defined(cl_ext_buffer_device_address)
+#if defined(cl_ext_device_fission)
+    CLEXT_INTERPOSER_FUNCTION(clReleaseDeviceEXT)
+    CLEXT_INTERPOSER_FUNCTION(clRetainDeviceEXT)
+    CLEXT_INTERPOSER_FUNCTION(clCreateSubDevicesEXT)
+#endif // defined(cl_ext_device_fission)
+#if defined(cl_ext_image_requirements_info)
+    CLEXT_INTERPOSER_FUNCTION(clGetImageRequirementsInfoEXT)
+#endif // defined(cl_ext_image_requirements_info)
+#if defined(cl_ext_migrate_memobject)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueMigrateMemObjectEXT)
+#endif // defined(cl_ext_migrate_memobject)
+#if defined(cl_arm_import_memory)
+    CLEXT_INTERPOSER_FUNCTION(clImportMemoryARM)
+#endif // defined(cl_arm_import_memory)
+#if defined(cl_arm_shared_virtual_memory)
+    CLEXT_INTERPOSER_FUNCTION(clSVMAllocARM)
+    CLEXT_INTERPOSER_FUNCTION(clSVMFreeARM)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueSVMFreeARM)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueSVMMemcpyARM)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueSVMMemFillARM)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueSVMMapARM)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueSVMUnmapARM)
+    CLEXT_INTERPOSER_FUNCTION(clSetKernelArgSVMPointerARM)
+    CLEXT_INTERPOSER_FUNCTION(clSetKernelExecInfoARM)
+#endif // defined(cl_arm_shared_virtual_memory)
+#if defined(cl_img_cancel_command)
+    CLEXT_INTERPOSER_FUNCTION(clCancelCommandsIMG)
+#endif // defined(cl_img_cancel_command)
+#if defined(cl_img_generate_mipmap)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueGenerateMipmapIMG)
+#endif // defined(cl_img_generate_mipmap)
+#if defined(cl_img_use_gralloc_ptr)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueAcquireGrallocObjectsIMG)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueReleaseGrallocObjectsIMG)
+#endif // defined(cl_img_use_gralloc_ptr)
+#if defined(cl_intel_accelerator)
+    CLEXT_INTERPOSER_FUNCTION(clCreateAcceleratorINTEL)
+    CLEXT_INTERPOSER_FUNCTION(clGetAcceleratorInfoINTEL)
+    CLEXT_INTERPOSER_FUNCTION(clRetainAcceleratorINTEL)
+    CLEXT_INTERPOSER_FUNCTION(clReleaseAcceleratorINTEL)
+#endif // defined(cl_intel_accelerator)
+#if defined(cl_intel_create_buffer_with_properties)
+    CLEXT_INTERPOSER_FUNCTION(clCreateBufferWithPropertiesINTEL)
+#endif // defined(cl_intel_create_buffer_with_properties)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_dx9_media_sharing)
+    CLEXT_INTERPOSER_FUNCTION(clGetDeviceIDsFromDX9INTEL)
+    CLEXT_INTERPOSER_FUNCTION(clCreateFromDX9MediaSurfaceINTEL)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueAcquireDX9ObjectsINTEL)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueReleaseDX9ObjectsINTEL)
+#endif // defined(cl_intel_dx9_media_sharing)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_program_scope_host_pipe)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueReadHostPipeINTEL)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueWriteHostPipeINTEL)
+#endif // defined(cl_intel_program_scope_host_pipe)
+#if defined(CLEXT_INCLUDE_D3D10)
+#if defined(cl_intel_sharing_format_query_d3d10)
+    CLEXT_INTERPOSER_FUNCTION(clGetSupportedD3D10TextureFormatsINTEL)
+#endif // defined(cl_intel_sharing_format_query_d3d10)
+#endif // defined(CLEXT_INCLUDE_D3D10)
+#if defined(CLEXT_INCLUDE_D3D11)
+#if defined(cl_intel_sharing_format_query_d3d11)
+    CLEXT_INTERPOSER_FUNCTION(clGetSupportedD3D11TextureFormatsINTEL)
+#endif // defined(cl_intel_sharing_format_query_d3d11)
+#endif // defined(CLEXT_INCLUDE_D3D11)
+#if defined(CLEXT_INCLUDE_DX9)
+#if defined(cl_intel_sharing_format_query_dx9)
+    CLEXT_INTERPOSER_FUNCTION(clGetSupportedDX9MediaSurfaceFormatsINTEL)
+#endif // defined(cl_intel_sharing_format_query_dx9)
+#endif // defined(CLEXT_INCLUDE_DX9)
+#if defined(CLEXT_INCLUDE_GL)
+#if defined(cl_intel_sharing_format_query_gl)
+    CLEXT_INTERPOSER_FUNCTION(clGetSupportedGLTextureFormatsINTEL)
+#endif // defined(cl_intel_sharing_format_query_gl)
+#endif // defined(CLEXT_INCLUDE_GL)
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_sharing_format_query_va_api)
+    CLEXT_INTERPOSER_FUNCTION(clGetSupportedVA_APIMediaSurfaceFormatsINTEL)
+#endif // defined(cl_intel_sharing_format_query_va_api)
+#endif // defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_unified_shared_memory)
+    CLEXT_INTERPOSER_FUNCTION(clHostMemAllocINTEL)
+    CLEXT_INTERPOSER_FUNCTION(clDeviceMemAllocINTEL)
+    CLEXT_INTERPOSER_FUNCTION(clSharedMemAllocINTEL)
+    CLEXT_INTERPOSER_FUNCTION(clMemFreeINTEL)
+    CLEXT_INTERPOSER_FUNCTION(clMemBlockingFreeINTEL)
+    CLEXT_INTERPOSER_FUNCTION(clGetMemAllocInfoINTEL)
+    CLEXT_INTERPOSER_FUNCTION(clSetKernelArgMemPointerINTEL)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueMemFillINTEL)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueMemcpyINTEL)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueMemAdviseINTEL)
+#if defined(CL_VERSION_1_2)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueMigrateMemINTEL)
+#endif // defined(CL_VERSION_1_2)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueMemsetINTEL)
+#endif // defined(cl_intel_unified_shared_memory)
+#if defined(CLEXT_INCLUDE_VA_API)
+#if defined(cl_intel_va_api_media_sharing)
+    CLEXT_INTERPOSER_FUNCTION(clGetDeviceIDsFromVA_APIMediaAdapterINTEL)
+    CLEXT_INTERPOSER_FUNCTION(clCreateFromVA_APIMediaSurfaceINTEL)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueAcquireVA_APIMediaSurfacesINTEL)
+    CLEXT_INTERPOSER_FUNCTION(clEnqueueReleaseVA_APIMediaSurfacesINTEL)
 #endif // defined(cl_intel_va_api_media_sharing)
 #endif // defined(CLEXT_INCLUDE_VA_API)
-
-
 #if defined(cl_loader_info)
-
-cl_int CL_API_CALL clGetICDLoaderInfoOCLICD(
-    cl_icdl_info param_name,
-    size_t param_value_size,
-    void* param_value,
-    size_t* param_value_size_ret)
-{
-    struct openclext_dispatch_table_common* dispatch_ptr = _get_dispatch();
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetICDLoaderInfoOCLICD == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clGetICDLoaderInfoOCLICD(
-        param_name,
-        param_value_size,
-        param_value,
-        param_value_size_ret);
-}
-
+    CLEXT_INTERPOSER_FUNCTION(clGetICDLoaderInfoOCLICD)
 #endif // defined(cl_loader_info)
-
 #if defined(cl_pocl_content_size)
-
-cl_int CL_API_CALL clSetContentSizeBufferPoCL(
-    cl_mem buffer,
-    cl_mem content_size_buffer)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(buffer);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clSetContentSizeBufferPoCL == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clSetContentSizeBufferPoCL(
-        buffer,
-        content_size_buffer);
-}
-
+    CLEXT_INTERPOSER_FUNCTION(clSetContentSizeBufferPoCL)
 #endif // defined(cl_pocl_content_size)
-
 #if defined(cl_qcom_ext_host_ptr)
-
-cl_int CL_API_CALL clGetDeviceImageInfoQCOM(
-    cl_device_id device,
-    size_t image_width,
-    size_t image_height,
-    const cl_image_format* image_format,
-    cl_image_pitch_info_qcom param_name,
-    size_t param_value_size,
-    void* param_value,
-    size_t* param_value_size_ret)
-{
-    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(device);
-    if (dispatch_ptr == nullptr || dispatch_ptr->clGetDeviceImageInfoQCOM == nullptr) {
-        return CL_INVALID_OPERATION;
-    }
-    return dispatch_ptr->clGetDeviceImageInfoQCOM(
-        device,
-        image_width,
-        image_height,
-        image_format,
-        param_name,
-        param_value_size,
-        param_value,
-        param_value_size_ret);
-}
-
+    CLEXT_INTERPOSER_FUNCTION(clGetDeviceImageInfoQCOM)
 #endif // defined(cl_qcom_ext_host_ptr)
+    { nullptr, nullptr }
+};
 
-#ifdef __cplusplus
-}
-#endif
+#undef CLEXT_INTERPOSER_FUNCTION
+
+#endif // defined(CLEXT_INTERPOSER)
@@ -0,0 +1,125 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include <CL/cl.h>
+
+#include "openclext_capture.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <mutex>
+#include <unordered_map>
+
+std::atomic<int> openclext_capture_state(OPENCLEXT_CAPTURE_UNINITIALIZED);
+
+struct openclext_capturer {
+    FILE* file = nullptr;
+    uint64_t start_ns = 0;
+    uint32_t next_function_id = 1;
+
+    std::mutex lock;
+    std::unordered_map<const void*, uint64_t> handles;
+};
+
+// The capturer is intentionally never destroyed, since extension functions
+// may be called from other static destructors.
+static openclext_capturer* _capturer = nullptr;
+
+static void _write(const openclext_capture_encoder& enc)
+{
+    if (_capturer->file && !enc.overflow) {
+        fwrite(enc.data, 1, enc.size, _capturer->file);
+    }
+}
+
+static void _finish(void)
+{
+    std::lock_guard<std::mutex> guard(_capturer->lock);
+    openclext_capture_state.store(
+        OPENCLEXT_CAPTURE_DISABLED, std::memory_order_relaxed);
+    fclose(_capturer->file);
+    _capturer->file = nullptr;
+}
+
+int openclext_capture_init(void)
+{
+    static std::mutex init_lock;
+    std::lock_guard<std::mutex> guard(init_lock);
+
+    int state = openclext_capture_state.load(std::memory_order_relaxed);
+    if (state != OPENCLEXT_CAPTURE_UNINITIALIZED) {
+        return state;
+    }
+
+    state = OPENCLEXT_CAPTURE_DISABLED;
+
+    const char* filename = getenv("CLEXT_CAPTURE_FILE");
+    FILE* file = filename && filename[0] ? fopen(filename, "wb") : nullptr;
+    if (file) {
+        _capturer = new openclext_capturer;
+        _capturer->file = file;
+        _capturer->start_ns = openclext_now_ns();
+
+        openclext_capture_encoder enc;
+        for (const char* magic = OPENCLEXT_CAPTURE_MAGIC; ; magic++) {
+            enc.byte((uint8_t)*magic);
+            if (*magic == '\0') break;
+        }
+        enc.varint(OPENCLEXT_CAPTURE_VERSION);
+        _write(enc);
+
+        atexit(_finish);
+
+        state = OPENCLEXT_CAPTURE_ENABLED;
+    }
+
+    openclext_capture_state.store(state, std::memory_order_relaxed);
+    return state;
+}
+
+uint64_t openclext_capture_handle_id(const void* handle)
+{
+    auto it = _capturer->handles.find(handle);
+    if (it != _capturer->handles.end()) {
+        return it->second;
+    }
+
+    // Handles may be reused after objects are released, in which case the
+    // new object shares the ID of the old object.
+    uint64_t id = _capturer->handles.size() + 1;
+    _capturer->handles.emplace(handle, id);
+    return id;
+}
+
+uint64_t openclext_capture_lock(
+    openclext_capture_function* function,
+    uint64_t start_ns)
+{
+    _capturer->lock.lock();
+
+    if (function->id == 0) {
+        function->id = _capturer->next_function_id++;
+
+        openclext_capture_encoder enc;
+        enc.byte(OPENCLEXT_CAPTURE_RECORD_FUNCTION);
+        enc.varint(function->id);
+        size_t length = strlen(function->name);
+        enc.varint(length);
+        for (size_t i = 0; i < length; i++) {
+            enc.byte((uint8_t)function->name[i]);
+        }
+        _write(enc);
+    }
+
+    return start_ns > _capturer->start_ns ? start_ns - _capturer->start_ns : 0;
+}
+
+void openclext_capture_write_call(const openclext_capture_encoder& enc)
+{
+    _write(enc);
+    _capturer->lock.unlock();
+}
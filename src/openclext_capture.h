@@ -0,0 +1,233 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_CAPTURE_H_
+#define OPENCLEXT_CAPTURE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+#include <type_traits>
+
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+
+#include "openclext_capture_format.h"
+#include "openclext_clock.h"
+
+// Capture of extension function calls to a binary log, which may be replayed
+// with clext-replay.
+//
+// Capture is compiled in with CLEXT_ENABLE_CAPTURE and is enabled at runtime
+// by setting the CLEXT_CAPTURE_FILE environment variable to the name of the
+// file to write.  Each call is encoded into a small buffer on the stack and
+// written to the log under a lock, so capture is intended for collecting
+// workloads rather than for always-on use.
+//
+// Arguments are encoded by type: integers are stored by value, OpenCL object
+// handles are stored as small per-log IDs, strings are stored by value, and
+// for other pointers only whether the pointer is null and the most bytes the
+// call may access through the pointer are stored.
+
+enum {
+    OPENCLEXT_CAPTURE_UNINITIALIZED = 0,
+    OPENCLEXT_CAPTURE_DISABLED,
+    OPENCLEXT_CAPTURE_ENABLED,
+};
+
+extern std::atomic<int> openclext_capture_state;
+
+int openclext_capture_init(void);
+
+static inline uint64_t openclext_capture_start(void)
+{
+    int state = openclext_capture_state.load(std::memory_order_relaxed);
+    if (state == OPENCLEXT_CAPTURE_UNINITIALIZED) {
+        state = openclext_capture_init();
+    }
+    return state == OPENCLEXT_CAPTURE_ENABLED ? openclext_now_ns() : 0;
+}
+
+// Each extension function has a constant-initialized function-local static
+// openclext_capture_function.  Its ID is assigned, and its name is written
+// to the log, the first time the function is captured.
+struct openclext_capture_function {
+    const char* name;
+    uint32_t id;
+};
+
+// A record that does not fit in the encoder is never written, rather than
+// being truncated, since a truncated record would corrupt every record after
+// it in the log.
+struct openclext_capture_encoder {
+    static const size_t maxStringLength = 256;
+
+    uint8_t data[2048];
+    size_t size = 0;
+    uint64_t pointerSize = 0;
+    bool overflow = false;
+
+    void byte(uint8_t value)
+    {
+        if (size < sizeof(data)) {
+            data[size++] = value;
+        } else {
+            overflow = true;
+        }
+    }
+
+    void varint(uint64_t value)
+    {
+        while (value >= 0x80) {
+            byte((uint8_t)(value | 0x80));
+            value >>= 7;
+        }
+        byte((uint8_t)value);
+    }
+
+    void svarint(int64_t value)
+    {
+        varint(((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+    }
+};
+
+// Returns the log ID for an OpenCL object handle.  Must be called with the
+// capture lock held, i.e. from openclext_capture_write_call.
+uint64_t openclext_capture_handle_id(const void* handle);
+
+// Identifies OpenCL object handle types.
+template<typename T> struct openclext_is_handle : std::false_type {};
+#define CLEXT_CAPTURE_HANDLE_TYPE(_type)                                       \
+    template<> struct openclext_is_handle<_type> : std::true_type {}
+CLEXT_CAPTURE_HANDLE_TYPE(cl_platform_id);
+CLEXT_CAPTURE_HANDLE_TYPE(cl_device_id);
+CLEXT_CAPTURE_HANDLE_TYPE(cl_context);
+CLEXT_CAPTURE_HANDLE_TYPE(cl_command_queue);
+CLEXT_CAPTURE_HANDLE_TYPE(cl_mem);
+CLEXT_CAPTURE_HANDLE_TYPE(cl_program);
+CLEXT_CAPTURE_HANDLE_TYPE(cl_kernel);
+CLEXT_CAPTURE_HANDLE_TYPE(cl_event);
+CLEXT_CAPTURE_HANDLE_TYPE(cl_sampler);
+#if defined(cl_khr_semaphore)
+CLEXT_CAPTURE_HANDLE_TYPE(cl_semaphore_khr);
+#endif
+#if defined(cl_khr_command_buffer)
+CLEXT_CAPTURE_HANDLE_TYPE(cl_command_buffer_khr);
+#endif
+#if defined(cl_khr_command_buffer_mutable_dispatch)
+CLEXT_CAPTURE_HANDLE_TYPE(cl_mutable_command_khr);
+#endif
+#if defined(cl_intel_accelerator)
+CLEXT_CAPTURE_HANDLE_TYPE(cl_accelerator_intel);
+#endif
+#undef CLEXT_CAPTURE_HANDLE_TYPE
+
+template<typename T>
+static inline typename std::enable_if<
+    std::is_integral<T>::value || std::is_enum<T>::value>::type
+openclext_capture_arg(openclext_capture_encoder& enc, T value)
+{
+    enc.byte(OPENCLEXT_CAPTURE_ARG_SCALAR);
+    enc.svarint((int64_t)value);
+}
+
+template<typename T>
+static inline typename std::enable_if<
+    std::is_floating_point<T>::value>::type
+openclext_capture_arg(openclext_capture_encoder& enc, T value)
+{
+    double d = value;
+    uint64_t bits = 0;
+    memcpy(&bits, &d, sizeof(bits));
+    enc.byte(OPENCLEXT_CAPTURE_ARG_FLOAT);
+    enc.varint(bits);
+}
+
+// Structures passed by value are not captured.
+template<typename T>
+static inline typename std::enable_if<
+    std::is_class<T>::value || std::is_union<T>::value>::type
+openclext_capture_arg(openclext_capture_encoder& enc, const T&)
+{
+    enc.byte(OPENCLEXT_CAPTURE_ARG_POINTER);
+    enc.varint(0);
+}
+
+template<typename T>
+static inline void openclext_capture_arg(openclext_capture_encoder& enc, T* ptr)
+{
+    if (ptr == nullptr) {
+        enc.byte(OPENCLEXT_CAPTURE_ARG_NULL);
+    } else if (openclext_is_handle<T*>::value) {
+        enc.byte(OPENCLEXT_CAPTURE_ARG_HANDLE);
+        enc.varint(openclext_capture_handle_id((const void*)ptr));
+    } else {
+        enc.byte(OPENCLEXT_CAPTURE_ARG_POINTER);
+        enc.varint(enc.pointerSize);
+    }
+}
+
+static inline void openclext_capture_arg(openclext_capture_encoder& enc, const char* str)
+{
+    if (str == nullptr) {
+        enc.byte(OPENCLEXT_CAPTURE_ARG_NULL);
+        return;
+    }
+    size_t length = strnlen(str, openclext_capture_encoder::maxStringLength);
+    enc.byte(OPENCLEXT_CAPTURE_ARG_STRING);
+    enc.varint(length);
+    for (size_t i = 0; i < length; i++) {
+        enc.byte((uint8_t)str[i]);
+    }
+}
+
+static inline void openclext_capture_args(openclext_capture_encoder&)
+{
+}
+
+template<typename T, typename... Rest>
+static inline void openclext_capture_args(
+    openclext_capture_encoder& enc, T arg, Rest... rest)
+{
+    openclext_capture_arg(enc, arg);
+    openclext_capture_args(enc, rest...);
+}
+
+// Locks the log, assigns a function ID if needed, and returns the relative
+// start time.  openclext_capture_write_call() then writes the encoded call
+// and unlocks the log.
+uint64_t openclext_capture_lock(
+    openclext_capture_function* function,
+    uint64_t start_ns);
+void openclext_capture_write_call(const openclext_capture_encoder& enc);
+
+template<typename... Args>
+static inline void openclext_capture_call(
+    openclext_capture_function* function,
+    uint64_t start_ns,
+    cl_int status,
+    uint64_t pointer_size,
+    Args... args)
+{
+    uint64_t end_ns = openclext_now_ns();
+    uint64_t start = openclext_capture_lock(function, start_ns);
+
+    openclext_capture_encoder enc;
+    enc.pointerSize = pointer_size;
+    enc.byte(OPENCLEXT_CAPTURE_RECORD_CALL);
+    enc.varint(function->id);
+    enc.varint(start);
+    enc.varint(end_ns - start_ns);
+    enc.svarint(status);
+    enc.varint(sizeof...(Args));
+    openclext_capture_args(enc, args...);
+
+    openclext_capture_write_call(enc);
+}
+
+#endif // OPENCLEXT_CAPTURE_H_
@@ -0,0 +1,53 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_CAPTURE_FORMAT_H_
+#define OPENCLEXT_CAPTURE_FORMAT_H_
+
+// Format of the capture log.  This is shared by the extension loader, which
+// writes the log, and by clext-replay, which reads it.  Increment
+// OPENCLEXT_CAPTURE_VERSION when the format changes.
+//
+// The log starts with the 8-byte magic string and the format version as a
+// varint, followed by a sequence of records.  Unsigned integers are LEB128
+// varints and signed integers are zigzag-encoded varints.
+//
+// FUNCTION record: id, name length, name bytes.
+//     Assigns an ID to a function name.  Written before the first call to
+//     the function.
+// CALL record: function id, start time, duration, status, argument count,
+//     then each argument.
+//     Times are in nanoseconds; start times are relative to the start of the
+//     capture.  Calls are written in the order they return.  Calls with
+//     arguments that are too large to encode are not written.
+//
+// Each argument is a one-byte kind followed by its value:
+//     NULL: no value.
+//     POINTER: the most bytes the call may access through the pointer, or 0
+//         if it is not known.
+//     SCALAR: signed varint.
+//     FLOAT: the bits of a double as a varint.
+//     HANDLE: handle id.  IDs are assigned in order of first use.
+//     STRING: length, bytes.
+
+#define OPENCLEXT_CAPTURE_MAGIC     "CLXTCAP"   // with the terminating null
+#define OPENCLEXT_CAPTURE_VERSION   2
+
+enum {
+    OPENCLEXT_CAPTURE_RECORD_FUNCTION = 1,
+    OPENCLEXT_CAPTURE_RECORD_CALL = 2,
+};
+
+enum {
+    OPENCLEXT_CAPTURE_ARG_NULL = 0,
+    OPENCLEXT_CAPTURE_ARG_POINTER = 1,
+    OPENCLEXT_CAPTURE_ARG_SCALAR = 2,
+    OPENCLEXT_CAPTURE_ARG_FLOAT = 3,
+    OPENCLEXT_CAPTURE_ARG_HANDLE = 4,
+    OPENCLEXT_CAPTURE_ARG_STRING = 5,
+};
+
+#endif // OPENCLEXT_CAPTURE_FORMAT_H_
@@ -0,0 +1,22 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_CLOCK_H_
+#define OPENCLEXT_CLOCK_H_
+
+#include <stdint.h>
+
+#include <chrono>
+
+// Uses the same clock as most application tracers (CLOCK_MONOTONIC on Linux)
+// so timestamps line up with timestamps from the application.
+static inline uint64_t openclext_now_ns(void)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#endif // OPENCLEXT_CLOCK_H_
@@ -0,0 +1,27 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_EXPORT_H_
+#define OPENCLEXT_EXPORT_H_
+
+// Exports OpenCL Extension Loader APIs from shared libraries.  This must be
+// included before any OpenCL headers.
+
+#if defined _WIN32 || defined __CYGWIN__
+    #ifdef __GNUC__
+        #define CL_API_ENTRY __attribute__((dllexport))
+    #else
+        #define CL_API_ENTRY __declspec(dllexport)
+    #endif
+#else
+    #if __GNUC__ >= 4
+        #define CL_API_ENTRY __attribute__((visibility("default")))
+    #else
+        #define CL_API_ENTRY
+    #endif
+#endif
+
+#endif // OPENCLEXT_EXPORT_H_
@@ -0,0 +1,121 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_histogram.h"
+#include "openclext_stats.h"
+
+#include <inttypes.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+static std::atomic<openclext_histogram_data*> _histograms(nullptr);
+
+openclext_histogram_data* openclext_histogram_create(
+    openclext_histogram* histogram)
+{
+    openclext_histogram_data* data = new openclext_histogram_data();
+    data->name = histogram->name;
+
+    openclext_histogram_data* expected = nullptr;
+    if (!histogram->data.compare_exchange_strong(expected, data)) {
+        // Another thread created the histogram data first.
+        delete data;
+        return expected;
+    }
+
+    openclext_histogram_data* head = _histograms.load(std::memory_order_relaxed);
+    do {
+        data->next = head;
+    } while (!_histograms.compare_exchange_weak(
+        head, data, std::memory_order_release, std::memory_order_relaxed));
+
+    openclext_stats_init();
+    return data;
+}
+
+// Returns the largest value that is counted in the specified bucket.
+static uint64_t _get_bucket_max(unsigned bucket)
+{
+    if (bucket < openclext_histogram_data::subBucketCount) {
+        return bucket;
+    }
+
+    unsigned shift = (bucket - openclext_histogram_data::subBucketCount) /
+        openclext_histogram_data::subBucketCount;
+    uint64_t sub = (bucket - openclext_histogram_data::subBucketCount) %
+        openclext_histogram_data::subBucketCount;
+    return ((openclext_histogram_data::subBucketCount + sub + 1) << shift) - 1;
+}
+
+static uint64_t _get_percentile(
+    const std::vector<uint64_t>& buckets,
+    uint64_t count,
+    uint64_t max,
+    double percentile)
+{
+    uint64_t rank = (uint64_t)(count * percentile / 100.0 + 0.5);
+    rank = std::max<uint64_t>(rank, 1);
+
+    uint64_t total = 0;
+    for (unsigned b = 0; b < buckets.size(); b++) {
+        total += buckets[b];
+        if (total >= rank) {
+            return std::min(_get_bucket_max(b), max);
+        }
+    }
+    return max;
+}
+
+void openclext_histogram_dump(FILE* stream)
+{
+    std::vector<openclext_histogram_data*> histograms;
+    for (openclext_histogram_data* histogram =
+            _histograms.load(std::memory_order_acquire);
+         histogram != nullptr;
+         histogram = histogram->next) {
+        histograms.push_back(histogram);
+    }
+    if (histograms.empty()) {
+        return;
+    }
+
+    std::sort(histograms.begin(), histograms.end(),
+        [](const openclext_histogram_data* a,
+           const openclext_histogram_data* b) {
+            return strcmp(a->name, b->name) < 0;
+        });
+
+    fprintf(stream, "Extension API Latency (ns):\n");
+    fprintf(stream, "%-48s %12s %12s %12s %12s %12s %12s\n",
+        "Function", "Calls", "Mean", "p50", "p99", "p99.9", "Max");
+
+    std::vector<uint64_t> buckets(openclext_histogram_data::bucketCount);
+    for (auto histogram : histograms) {
+        uint64_t count = 0;
+        for (unsigned b = 0; b < openclext_histogram_data::bucketCount; b++) {
+            buckets[b] = histogram->buckets[b].load(std::memory_order_relaxed);
+            count += buckets[b];
+        }
+        if (count == 0) {
+            continue;
+        }
+
+        uint64_t sum = histogram->sum.load(std::memory_order_relaxed);
+        uint64_t max = histogram->max.load(std::memory_order_relaxed);
+        fprintf(stream,
+            "%-48s %12" PRIu64 " %12" PRIu64 " %12" PRIu64 " %12" PRIu64
+            " %12" PRIu64 " %12" PRIu64 "\n",
+            histogram->name,
+            count,
+            sum / count,
+            _get_percentile(buckets, count, max, 50.0),
+            _get_percentile(buckets, count, max, 99.0),
+            _get_percentile(buckets, count, max, 99.9),
+            max);
+    }
+}
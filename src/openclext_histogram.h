@@ -0,0 +1,108 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_HISTOGRAM_H_
+#define OPENCLEXT_HISTOGRAM_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <atomic>
+
+#include "openclext_clock.h"
+
+// Per-function latency histograms for extension functions.
+//
+// Each histogram is log-linear: values less than 2^subBucketBits nanoseconds
+// are counted exactly, and each larger power of two is split into
+// 2^subBucketBits linear sub-buckets, for a worst-case relative error of
+// 1/2^subBucketBits.  Latencies are recorded with relaxed atomic increments
+// and no locking.
+//
+// Each extension function has a constant-initialized function-local static
+// openclext_histogram.  The histogram data is allocated and added to a
+// global list the first time the extension function records a latency.
+
+struct openclext_histogram_data {
+    static const unsigned subBucketBits = 4;
+    static const unsigned subBucketCount = 1u << subBucketBits;
+    static const unsigned maxExponent = 35;     // about 34 seconds
+    static const unsigned bucketCount =
+        subBucketCount + (maxExponent - subBucketBits + 1) * subBucketCount;
+
+    const char* name;
+    openclext_histogram_data* next;
+    std::atomic<uint64_t> sum;
+    std::atomic<uint64_t> max;
+    std::atomic<uint64_t> buckets[bucketCount];
+};
+
+struct openclext_histogram {
+    const char* name;
+    std::atomic<openclext_histogram_data*> data;
+};
+
+openclext_histogram_data* openclext_histogram_create(
+    openclext_histogram* histogram);
+void openclext_histogram_dump(FILE* stream);
+
+static inline unsigned openclext_histogram_bucket(uint64_t ns)
+{
+    const unsigned S = openclext_histogram_data::subBucketBits;
+    if (ns < openclext_histogram_data::subBucketCount) {
+        return (unsigned)ns;
+    }
+
+    unsigned exponent = 63;
+    while ((ns >> exponent) == 0) {
+        exponent--;
+    }
+    if (exponent > openclext_histogram_data::maxExponent) {
+        return openclext_histogram_data::bucketCount - 1;
+    }
+
+    unsigned sub = (unsigned)(ns >> (exponent - S)) -
+        openclext_histogram_data::subBucketCount;
+    return openclext_histogram_data::subBucketCount +
+        (exponent - S) * openclext_histogram_data::subBucketCount + sub;
+}
+
+static inline void openclext_histogram_record(
+    openclext_histogram* histogram,
+    uint64_t ns)
+{
+    openclext_histogram_data* data =
+        histogram->data.load(std::memory_order_acquire);
+    if (data == nullptr) {
+        data = openclext_histogram_create(histogram);
+    }
+
+    data->buckets[openclext_histogram_bucket(ns)].fetch_add(
+        1, std::memory_order_relaxed);
+    data->sum.fetch_add(ns, std::memory_order_relaxed);
+
+    uint64_t max = data->max.load(std::memory_order_relaxed);
+    while (ns > max &&
+        !data->max.compare_exchange_weak(
+            max, ns, std::memory_order_relaxed)) {
+    }
+}
+
+struct openclext_histogram_scope {
+    openclext_histogram_scope(openclext_histogram* histogram_) :
+        histogram(histogram_),
+        start_ns(openclext_now_ns()) {}
+
+    ~openclext_histogram_scope()
+    {
+        openclext_histogram_record(histogram, openclext_now_ns() - start_ns);
+    }
+
+    openclext_histogram* histogram;
+    uint64_t start_ns;
+};
+
+#endif // OPENCLEXT_HISTOGRAM_H_
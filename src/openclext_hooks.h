@@ -0,0 +1,275 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_HOOKS_H_
+#define OPENCLEXT_HOOKS_H_
+
+// Hooks called by each generated extension function.  All hooks expand to
+// nothing unless a feature that needs them is enabled, so by default the
+// generated extension functions are unchanged.
+//
+// CLEXT_CALL_BEGIN(_funcname, _handle):
+//     The first statement in each extension function.  _handle is the
+//     object that will be used to find the dispatch table, or nullptr for
+//     functions that use the common dispatch table.
+// CLEXT_CALL_ERRCODE(_errcode_ret):
+//     Called by extension functions that return an error via errcode_ret.
+//     Features that need the status of these functions may replace a null
+//     _errcode_ret with a pointer to a local error code.
+// CLEXT_CALL_DISPATCH(_funcname, _dispatch_ptr):
+//     Called after the dispatch table has been found.  _dispatch_ptr may be
+//     nullptr.
+// CLEXT_CALL_MISSING(_funcname, _dispatch_ptr):
+//     Called when there is no dispatch table or the dispatch table does not
+//     contain the extension function, immediately before returning an error.
+// CLEXT_CALL_END(_funcname, _status):
+//     Called after the extension function returns.  _status is the returned
+//     error code, the value of errcode_ret, or for functions that do not
+//     return an error, CL_SUCCESS.  For clSVMAllocARM, a null pointer is
+//     reported as CL_OUT_OF_RESOURCES.
+// CLEXT_CALL_ARGS(_funcname, _status, _pointer_size, ...):
+//     Called after the extension function returns, before any other hooks,
+//     with the status (as for CLEXT_CALL_END) and all of the arguments that
+//     were passed to the extension function.  _pointer_size is the most
+//     bytes the extension function may access through each pointer argument,
+//     or 0 if it is not known.
+// CLEXT_CALL_TRANSFER(_funcname, _handle, _dispatch_ptr, _size, _status):
+//     Called by extension functions that move data, immediately before
+//     CLEXT_CALL_END.  _size is the number of bytes moved.
+//
+// CLEXT_CALL_USM_ALLOC(_context, _device, _type, _ptr, _size):
+//     Called by extension functions that allocate unified shared memory,
+//     immediately before CLEXT_CALL_END.  _ptr is the allocated memory, or
+//     nullptr if the allocation failed.  _device is nullptr for host memory.
+// CLEXT_CALL_USM_FREE(_context, _ptr):
+//     Called by extension functions that free unified shared memory,
+//     immediately before calling the extension function, so the allocation
+//     is forgotten before its memory may be allocated again.
+// CLEXT_CALL_USM_FREE_END(_context, _ptr, _status):
+//     Called by extension functions that free unified shared memory,
+//     immediately before CLEXT_CALL_END, with the status of the free.
+// CLEXT_CALL_USM_INFO(<arguments>, _status_ptr):
+//     Called by clGetMemAllocInfoINTEL instead of calling the extension
+//     function with the arguments.  Evaluates to true if the query was
+//     answered by the hook, in which case the error code for the query is
+//     returned in *_status_ptr.
+// CLEXT_CALL_USM_STAGE(_enqueue_memcpy, <arguments>, _status_ptr):
+//     Called by clEnqueueMemcpyINTEL instead of calling the extension
+//     function _enqueue_memcpy with the arguments.  Evaluates to true if the
+//     copy was done by the hook, in which case the error code for the copy
+//     is returned in *_status_ptr.
+// CLEXT_CALL_USM_KERNEL_ARG(_kernel, _arg_index, _arg_value, _status):
+//     Called by clSetKernelArgMemPointerINTEL immediately before
+//     CLEXT_CALL_END.
+//
+// CLEXT_COUNT_ICD_CALL():
+//     Called immediately before each call the extension loader makes into the
+//     ICD on its own behalf, for example to find the platform for an object or
+//     to get the address of an extension function.
+
+#if defined(CLEXT_ENABLE_TRACE)
+#include "openclext_trace.h"
+#define CLEXT_TRACE_BEGIN(_funcname, _handle)                                  \
+    openclext_trace_scope _trace_scope(#_funcname, (const void*)(_handle))
+#define CLEXT_TRACE_DISPATCH(_dispatch_ptr)                                    \
+    _trace_scope.platform = _get_dispatch_platform(_dispatch_ptr)
+#else
+#define CLEXT_TRACE_BEGIN(_funcname, _handle)
+#define CLEXT_TRACE_DISPATCH(_dispatch_ptr)
+#endif
+
+#if defined(CLEXT_ENABLE_HISTOGRAMS)
+#include "openclext_histogram.h"
+#define CLEXT_HISTOGRAM_BEGIN(_funcname)                                       \
+    static openclext_histogram _histogram = { #_funcname, {nullptr} };        \
+    openclext_histogram_scope _histogram_scope(&_histogram)
+#else
+#define CLEXT_HISTOGRAM_BEGIN(_funcname)
+#endif
+
+#if defined(CLEXT_ENABLE_LIVE_METRICS)
+#include "openclext_metrics.h"
+#define CLEXT_METRICS_BEGIN(_funcname)                                         \
+    static openclext_metrics_counter _metrics =                                \
+        { #_funcname, {nullptr}, nullptr };                                    \
+    openclext_metrics_scope _metrics_scope(&_metrics)
+#define CLEXT_METRICS_DISPATCH()                                               \
+    _metrics_scope.dispatched()
+#define CLEXT_METRICS_STATUS(_status)                                          \
+    _metrics_scope.status(_status)
+#else
+#define CLEXT_METRICS_BEGIN(_funcname)
+#define CLEXT_METRICS_DISPATCH()
+#define CLEXT_METRICS_STATUS(_status)
+#endif
+
+#if defined(CLEXT_ENABLE_CAPTURE)
+#include "openclext_capture.h"
+#define CLEXT_CAPTURE_BEGIN(_funcname)                                         \
+    static openclext_capture_function _capture_function = { #_funcname, 0 };  \
+    uint64_t _capture_start_ns = openclext_capture_start()
+#define CLEXT_CAPTURE_ARGS(_status, _pointer_size, ...)                        \
+    if (_capture_start_ns != 0)                                                \
+        openclext_capture_call(&_capture_function, _capture_start_ns,          \
+            _status, (uint64_t)(_pointer_size), __VA_ARGS__)
+#else
+#define CLEXT_CAPTURE_BEGIN(_funcname)
+#define CLEXT_CAPTURE_ARGS(_status, _pointer_size, ...)
+#endif
+
+#if defined(CLEXT_ENABLE_TRANSFER_STATS)
+#include "openclext_transfer.h"
+#define CLEXT_TRANSFER_RECORD(_handle, _dispatch_ptr, _size, _status)         \
+    if ((_status) == CL_SUCCESS)                                               \
+        openclext_transfer_record((const void*)(_handle),                      \
+            _get_dispatch_platform(_dispatch_ptr), (uint64_t)(_size))
+#else
+#define CLEXT_TRANSFER_RECORD(_handle, _dispatch_ptr, _size, _status)
+#endif
+
+// The USM allocation statistics share the allocation records in the
+// registry.  An allocation that fails to be freed is recorded again.
+#if defined(CLEXT_ENABLE_USM_REGISTRY) || defined(CLEXT_ENABLE_USM_STATS)
+#include "openclext_usm_registry.h"
+#define CLEXT_REGISTRY_USM_ALLOC(_context, _device, _type, _ptr, _size)        \
+    if (_ptr)                                                                  \
+        openclext_usm_registry_insert(_context, _device, _type, _ptr, _size)
+#define CLEXT_REGISTRY_USM_FREE(_context, _ptr)                                \
+    openclext_usm_allocation _usm_allocation;                                  \
+    bool _usm_removed =                                                        \
+        openclext_usm_registry_remove(_context, _ptr, &_usm_allocation)
+#define CLEXT_REGISTRY_USM_FREE_END(_context, _ptr, _status)                   \
+    if (_usm_removed && (_status) != CL_SUCCESS)                               \
+        openclext_usm_registry_insert(_context, _usm_allocation.device,        \
+            _usm_allocation.type, _ptr, _usm_allocation.size)
+#else
+#define CLEXT_REGISTRY_USM_ALLOC(_context, _device, _type, _ptr, _size)
+#define CLEXT_REGISTRY_USM_FREE(_context, _ptr)
+#define CLEXT_REGISTRY_USM_FREE_END(_context, _ptr, _status)
+#endif
+
+#if defined(CLEXT_ENABLE_USM_REGISTRY)
+#define CLEXT_CALL_USM_INFO(...)                                               \
+    openclext_usm_registry_get_info(__VA_ARGS__)
+#else
+#define CLEXT_CALL_USM_INFO(...) false
+#endif
+
+#if defined(CLEXT_ENABLE_USM_EMULATION)
+#include "openclext_usm_emulation.h"
+#endif
+
+#if defined(CLEXT_ENABLE_USM_STATS)
+#include "openclext_usm_stats.h"
+#define CLEXT_USM_STATS_ALLOC(_context, _device, _type, _ptr, _size)           \
+    if (_ptr)                                                                  \
+        openclext_usm_stats_alloc(                                             \
+            openclext_usm_allocation{ _context, _device, _type, _size })
+#define CLEXT_USM_STATS_FREE_END(_status)                                      \
+    if (_usm_removed && (_status) == CL_SUCCESS)                               \
+        openclext_usm_stats_release(_usm_allocation, true)
+#else
+#define CLEXT_USM_STATS_ALLOC(_context, _device, _type, _ptr, _size)
+#define CLEXT_USM_STATS_FREE_END(_status)
+#endif
+
+#if defined(CLEXT_ENABLE_USM_STAGING)
+#include "openclext_usm_staging.h"
+#define CLEXT_CALL_USM_STAGE(_enqueue_memcpy, ...)                             \
+    openclext_usm_staging_memcpy(_enqueue_memcpy, __VA_ARGS__)
+#else
+#define CLEXT_CALL_USM_STAGE(_enqueue_memcpy, ...) false
+#endif
+
+#if defined(CLEXT_ENABLE_USM_PREFETCH)
+#include "openclext_usm_prefetch.h"
+#define CLEXT_CALL_USM_KERNEL_ARG(_kernel, _arg_index, _arg_value, _status)    \
+    if ((_status) == CL_SUCCESS)                                               \
+        openclext_usm_prefetch_set_arg(_kernel, _arg_index, _arg_value)
+#else
+#define CLEXT_CALL_USM_KERNEL_ARG(_kernel, _arg_index, _arg_value, _status)
+#endif
+
+#if defined(CLEXT_ENABLE_USDT) || defined(CLEXT_ENABLE_LIVE_METRICS) ||        \
+    defined(CLEXT_ENABLE_CAPTURE)
+#define CLEXT_STATUS_NEEDED
+#endif
+
+#if defined(CLEXT_ENABLE_USDT)
+// Disabled USDT probes are a single nop.  The probes may be listed with
+// "bpftrace -l 'usdt:/path/to/binary:openclext:*'".
+#include <sys/sdt.h>
+#define CLEXT_PROBE_ENTRY(_funcname, _handle)                                  \
+    DTRACE_PROBE2(openclext, call_entry, #_funcname, (const void*)(_handle))
+#define CLEXT_PROBE_DISPATCH(_funcname, _dispatch_ptr)                         \
+    DTRACE_PROBE2(openclext, call_dispatch, #_funcname,                        \
+        _get_dispatch_platform(_dispatch_ptr))
+#define CLEXT_PROBE_MISSING(_funcname, _dispatch_ptr)                          \
+    DTRACE_PROBE2(openclext, call_missing, #_funcname,                         \
+        _get_dispatch_platform(_dispatch_ptr))
+#define CLEXT_PROBE_END(_funcname, _status)                                    \
+    DTRACE_PROBE2(openclext, call_return, #_funcname, (cl_int)(_status))
+#else
+#define CLEXT_PROBE_ENTRY(_funcname, _handle)
+#define CLEXT_PROBE_DISPATCH(_funcname, _dispatch_ptr)
+#define CLEXT_PROBE_MISSING(_funcname, _dispatch_ptr)
+#define CLEXT_PROBE_END(_funcname, _status)
+#endif
+
+#if defined(CLEXT_ENABLE_TEST_API)
+#include "openclext_test_api.h"
+#define CLEXT_COUNT_ICD_CALL()                                                 \
+    openclext_icd_call_count.fetch_add(1, std::memory_order_relaxed)
+#else
+#define CLEXT_COUNT_ICD_CALL()
+#endif
+
+#if defined(CLEXT_STATUS_NEEDED)
+#define CLEXT_CALL_ERRCODE(_errcode_ret)                                       \
+    cl_int _errcode_local = CL_SUCCESS;                                        \
+    if (_errcode_ret == nullptr) _errcode_ret = &_errcode_local
+#else
+#define CLEXT_CALL_ERRCODE(_errcode_ret)
+#endif
+
+#define CLEXT_CALL_BEGIN(_funcname, _handle)                                   \
+    CLEXT_TRACE_BEGIN(_funcname, _handle);                                     \
+    CLEXT_HISTOGRAM_BEGIN(_funcname);                                          \
+    CLEXT_METRICS_BEGIN(_funcname);                                            \
+    CLEXT_CAPTURE_BEGIN(_funcname);                                            \
+    CLEXT_PROBE_ENTRY(_funcname, _handle)
+
+#define CLEXT_CALL_DISPATCH(_funcname, _dispatch_ptr)                          \
+    CLEXT_TRACE_DISPATCH(_dispatch_ptr);                                       \
+    CLEXT_METRICS_DISPATCH();                                                  \
+    CLEXT_PROBE_DISPATCH(_funcname, _dispatch_ptr)
+
+#define CLEXT_CALL_MISSING(_funcname, _dispatch_ptr)                           \
+    CLEXT_METRICS_STATUS(CL_INVALID_OPERATION);                                \
+    CLEXT_PROBE_MISSING(_funcname, _dispatch_ptr)
+
+#define CLEXT_CALL_ARGS(_funcname, _status, _pointer_size, ...)                \
+    CLEXT_CAPTURE_ARGS(_status, _pointer_size, __VA_ARGS__)
+
+#define CLEXT_CALL_TRANSFER(_funcname, _handle, _dispatch_ptr, _size, _status) \
+    CLEXT_TRANSFER_RECORD(_handle, _dispatch_ptr, _size, _status)
+
+#define CLEXT_CALL_USM_ALLOC(_context, _device, _type, _ptr, _size)            \
+    CLEXT_REGISTRY_USM_ALLOC(_context, _device, _type, _ptr, _size);           \
+    CLEXT_USM_STATS_ALLOC(_context, _device, _type, _ptr, _size)
+
+#define CLEXT_CALL_USM_FREE(_context, _ptr)                                    \
+    CLEXT_REGISTRY_USM_FREE(_context, _ptr)
+
+#define CLEXT_CALL_USM_FREE_END(_context, _ptr, _status)                       \
+    CLEXT_REGISTRY_USM_FREE_END(_context, _ptr, _status);                      \
+    CLEXT_USM_STATS_FREE_END(_status)
+
+#define CLEXT_CALL_END(_funcname, _status)                                     \
+    CLEXT_METRICS_STATUS(_status);                                             \
+    CLEXT_PROBE_END(_funcname, _status)
+
+#endif // OPENCLEXT_HOOKS_H_
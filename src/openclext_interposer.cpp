@@ -0,0 +1,106 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_export.h"
+
+#define CL_USE_DEPRECATED_OPENCL_1_1_APIS
+#include <CL/cl.h>
+
+#include <dlfcn.h>
+#include <string.h>
+
+#include <atomic>
+
+typedef void* (CL_API_CALL* clGetExtensionFunctionAddressForPlatform_fn)(
+    cl_platform_id platform,
+    const char* func_name);
+typedef void* (CL_API_CALL* clGetExtensionFunctionAddress_fn)(
+    const char* func_name);
+
+// Gets a function from the next library in the search order, usually the
+// OpenCL ICD loader.
+template<typename T>
+static T _get_next(std::atomic<T>& cache, const char* name)
+{
+    T fn = cache.load(std::memory_order_acquire);
+    if (fn == nullptr) {
+        fn = (T)dlsym(RTLD_NEXT, name);
+        cache.store(fn, std::memory_order_release);
+    }
+    return fn;
+}
+
+extern "C" {
+
+void* CL_API_CALL openclext_real_clGetExtensionFunctionAddressForPlatform(
+    cl_platform_id platform,
+    const char* func_name)
+{
+    static std::atomic<clGetExtensionFunctionAddressForPlatform_fn> next(nullptr);
+    clGetExtensionFunctionAddressForPlatform_fn fn =
+        _get_next(next, "clGetExtensionFunctionAddressForPlatform");
+    return fn ? fn(platform, func_name) : nullptr;
+}
+
+void* CL_API_CALL openclext_real_clGetExtensionFunctionAddress(
+    const char* func_name)
+{
+    static std::atomic<clGetExtensionFunctionAddress_fn> next(nullptr);
+    clGetExtensionFunctionAddress_fn fn =
+        _get_next(next, "clGetExtensionFunctionAddress");
+    return fn ? fn(func_name) : nullptr;
+}
+
+} // extern "C"
+
+#include "openclext_interposer.h"
+
+// Returns the extension loader's function with the specified name, or the
+// OpenCL implementation's function if the extension loader does not have a
+// function with this name.  If the OpenCL implementation does not support
+// the function, returns nullptr, so applications can still detect whether
+// an extension function is supported.
+static void* _interpose(void* function, const char* func_name)
+{
+    if (function == nullptr || func_name == nullptr) {
+        return function;
+    }
+
+    for (const openclext_interposer_function* interposer =
+            openclext_interposer_functions;
+         interposer->name != nullptr;
+         interposer++) {
+        if (strcmp(interposer->name, func_name) == 0) {
+            return interposer->function;
+        }
+    }
+    return function;
+}
+
+#undef clGetExtensionFunctionAddressForPlatform
+#undef clGetExtensionFunctionAddress
+
+extern "C" {
+
+CL_API_ENTRY void* CL_API_CALL clGetExtensionFunctionAddressForPlatform(
+    cl_platform_id platform,
+    const char* func_name)
+{
+    return _interpose(
+        openclext_real_clGetExtensionFunctionAddressForPlatform(
+            platform, func_name),
+        func_name);
+}
+
+CL_API_ENTRY void* CL_API_CALL clGetExtensionFunctionAddress(
+    const char* func_name)
+{
+    return _interpose(
+        openclext_real_clGetExtensionFunctionAddress(func_name),
+        func_name);
+}
+
+} // extern "C"
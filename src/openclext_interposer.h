@@ -0,0 +1,47 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_INTERPOSER_H_
+#define OPENCLEXT_INTERPOSER_H_
+
+// Support for building the extension loader as a preloadable shared library
+// that interposes extension functions in unmodified applications.
+//
+// The interposer exports its own clGetExtensionFunctionAddress and
+// clGetExtensionFunctionAddressForPlatform, which return the extension
+// loader's functions in place of the OpenCL implementation's functions.  The
+// extension loader must therefore get the OpenCL implementation's functions
+// from the next library in the search order, rather than from itself.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void* CL_API_CALL openclext_real_clGetExtensionFunctionAddressForPlatform(
+    cl_platform_id platform,
+    const char* func_name);
+
+void* CL_API_CALL openclext_real_clGetExtensionFunctionAddress(
+    const char* func_name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define clGetExtensionFunctionAddressForPlatform                               \
+    openclext_real_clGetExtensionFunctionAddressForPlatform
+#define clGetExtensionFunctionAddress                                          \
+    openclext_real_clGetExtensionFunctionAddress
+
+struct openclext_interposer_function {
+    const char* name;
+    void* function;
+};
+
+// Terminated by an entry with a null name.
+extern const openclext_interposer_function openclext_interposer_functions[];
+
+#endif // OPENCLEXT_INTERPOSER_H_
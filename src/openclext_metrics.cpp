@@ -0,0 +1,171 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_metrics.h"
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <mutex>
+
+// The lock protects creating the segment and claiming slots, which are rare.
+// Counters that have claimed a slot are kept in a list, so their slots can be
+// forgotten by a child process.
+static std::mutex _lock;
+static bool _initialized = false;
+static bool _registered = false;
+static openclext_metrics_counter* _counters = nullptr;
+
+static openclext_metrics_segment* _segment = nullptr;
+static char _segment_name[64];
+
+// Slots used when the shared memory segment is not available.  These are
+// never read.
+static openclext_metrics_slot _local_slots[OPENCLEXT_METRICS_SLOTS];
+static std::atomic<uint32_t> _local_slot_used(0);
+
+static void _get_process_name(char* name, size_t size)
+{
+    name[0] = '\0';
+#if defined(__linux__)
+    FILE* file = fopen("/proc/self/comm", "r");
+    if (file) {
+        if (fgets(name, (int)size, file)) {
+            name[strcspn(name, "\n")] = '\0';
+        }
+        fclose(file);
+    }
+#endif
+}
+
+static void _destroy_segment(void)
+{
+    // Only the process that created the segment removes it, not any child
+    // processes that inherited the exit handler.
+    if (_segment && _segment->header.pid == (uint32_t)getpid()) {
+        shm_unlink(_segment_name);
+    }
+}
+
+static void _create_segment(void)
+{
+    snprintf(_segment_name, sizeof(_segment_name),
+        "/" OPENCLEXT_METRICS_PREFIX "%u", (unsigned)getpid());
+
+    int fd = shm_open(_segment_name, O_CREAT | O_TRUNC | O_RDWR, 0644);
+    if (fd < 0) {
+        return;
+    }
+    if (ftruncate(fd, sizeof(openclext_metrics_segment)) != 0) {
+        close(fd);
+        shm_unlink(_segment_name);
+        return;
+    }
+
+    void* ptr = mmap(nullptr, sizeof(openclext_metrics_segment),
+        PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED) {
+        shm_unlink(_segment_name);
+        return;
+    }
+
+    // The new segment is zero-filled, so only the non-zero fields of the
+    // header need to be written.
+    openclext_metrics_segment* segment = (openclext_metrics_segment*)ptr;
+    segment->header.version = OPENCLEXT_METRICS_VERSION;
+    segment->header.pid = (uint32_t)getpid();
+    segment->header.slot_count = OPENCLEXT_METRICS_SLOTS;
+    segment->header.sample_interval = openclext_metrics_sample_interval;
+    segment->header.start_time = (uint64_t)time(nullptr);
+    _get_process_name(
+        segment->header.process_name, sizeof(segment->header.process_name));
+    segment->header.magic.store(
+        OPENCLEXT_METRICS_MAGIC, std::memory_order_release);
+
+    _segment = segment;
+}
+
+static void _atfork_prepare(void)
+{
+    _lock.lock();
+}
+
+static void _atfork_parent(void)
+{
+    _lock.unlock();
+}
+
+// The child process must not write to the parent's segment, so it unmaps the
+// segment and forgets every claimed slot.  The lock is held across fork(), so
+// the segment and the list of counters are consistent.
+static void _atfork_child(void)
+{
+    if (_segment) {
+        munmap(_segment, sizeof(openclext_metrics_segment));
+        _segment = nullptr;
+    }
+    for (openclext_metrics_counter* counter = _counters; counter; ) {
+        openclext_metrics_counter* next = counter->next;
+        counter->slot.store(nullptr, std::memory_order_relaxed);
+        counter->next = nullptr;
+        counter = next;
+    }
+    _counters = nullptr;
+    _local_slot_used.store(0, std::memory_order_relaxed);
+    _initialized = false;
+    _lock.unlock();
+}
+
+openclext_metrics_slot* openclext_metrics_create(
+    openclext_metrics_counter* counter)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    // Another thread may have claimed a slot for the same function first.
+    openclext_metrics_slot* slot =
+        counter->slot.load(std::memory_order_acquire);
+    if (slot) {
+        return slot;
+    }
+
+    if (!_initialized) {
+        _initialized = true;
+        _create_segment();
+        if (!_registered) {
+            _registered = true;
+            atexit(_destroy_segment);
+            pthread_atfork(_atfork_prepare, _atfork_parent, _atfork_child);
+        }
+    }
+
+    if (_segment) {
+        uint32_t index = _segment->header.slot_used.fetch_add(
+            1, std::memory_order_relaxed);
+        if (index < OPENCLEXT_METRICS_SLOTS) {
+            slot = &_segment->slots[index];
+        }
+    }
+    if (slot == nullptr) {
+        uint32_t index = _local_slot_used.fetch_add(
+            1, std::memory_order_relaxed);
+        slot = &_local_slots[index % OPENCLEXT_METRICS_SLOTS];
+    }
+
+    strncpy(slot->name, counter->name, sizeof(slot->name) - 1);
+    slot->ready.store(1, std::memory_order_release);
+
+    counter->next = _counters;
+    _counters = counter;
+    counter->slot.store(slot, std::memory_order_release);
+    return slot;
+}
@@ -0,0 +1,75 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_METRICS_H_
+#define OPENCLEXT_METRICS_H_
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include <CL/cl.h>
+
+#include "openclext_clock.h"
+#include "openclext_metrics_layout.h"
+
+// Live metrics for extension functions, published in a shared memory segment
+// that may be read by clext-top while the process is running.
+//
+// Like the latency histograms, each extension function has a constant-
+// initialized function-local static openclext_metrics_counter, and its slot
+// in the shared memory segment is claimed the first time the extension
+// function is called.  If the segment cannot be created, or all of its slots
+// are in use, the counters are written to process-local memory instead.
+//
+// The segment belongs to the process that created it.  A child process
+// created by fork() forgets the segment and the slots that were claimed, so
+// it creates its own segment the next time an extension function is called.
+
+static const uint64_t openclext_metrics_sample_interval = 64;
+
+struct openclext_metrics_counter {
+    const char* name;
+    std::atomic<openclext_metrics_slot*> slot;
+    openclext_metrics_counter* next;    // counters that have claimed a slot
+};
+
+openclext_metrics_slot* openclext_metrics_create(
+    openclext_metrics_counter* counter);
+
+struct openclext_metrics_scope {
+    openclext_metrics_scope(openclext_metrics_counter* counter)
+    {
+        slot = counter->slot.load(std::memory_order_acquire);
+        if (slot == nullptr) {
+            slot = openclext_metrics_create(counter);
+        }
+        uint64_t calls = slot->calls.fetch_add(1, std::memory_order_relaxed);
+        start_ns = calls % openclext_metrics_sample_interval == 0 ?
+            openclext_now_ns() : 0;
+    }
+
+    void dispatched(void)
+    {
+        if (start_ns != 0) {
+            slot->overhead_samples.fetch_add(1, std::memory_order_relaxed);
+            slot->overhead_ns.fetch_add(
+                openclext_now_ns() - start_ns, std::memory_order_relaxed);
+        }
+    }
+
+    void status(cl_int status)
+    {
+        if (status != CL_SUCCESS) {
+            slot->errors.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    openclext_metrics_slot* slot;
+    uint64_t start_ns;
+};
+
+#endif // OPENCLEXT_METRICS_H_
@@ -0,0 +1,62 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_METRICS_LAYOUT_H_
+#define OPENCLEXT_METRICS_LAYOUT_H_
+
+#include <stdint.h>
+
+#include <atomic>
+
+// Layout of the live metrics shared memory segment.  This is shared by the
+// extension loader, which writes the segment, and by clext-top, which reads
+// it.  Increment OPENCLEXT_METRICS_VERSION when the layout changes.
+//
+// Each process using the extension loader creates one segment, named
+// OPENCLEXT_METRICS_PREFIX followed by the process ID.  The header is
+// written first and the magic number is stored last, so readers ignore
+// segments that are not fully initialized.  Slots are claimed by
+// incrementing slot_used, and each slot becomes valid once its ready flag
+// is set.  All counters are updated with relaxed atomics.
+
+#define OPENCLEXT_METRICS_PREFIX    "openclext."
+#define OPENCLEXT_METRICS_MAGIC     0x54584C43u     // "CLXT"
+#define OPENCLEXT_METRICS_VERSION   1u
+#define OPENCLEXT_METRICS_SLOTS     512u
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+    "live metrics require lock-free atomics");
+
+struct openclext_metrics_slot {
+    char name[64];
+    std::atomic<uint32_t> ready;
+    uint32_t reserved;
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> errors;
+    // Loader overhead is the time from entry until the dispatch table has
+    // been found, and is only measured for one call in every sample_interval
+    // calls.
+    std::atomic<uint64_t> overhead_samples;
+    std::atomic<uint64_t> overhead_ns;
+};
+
+struct openclext_metrics_header {
+    std::atomic<uint32_t> magic;
+    uint32_t version;
+    uint32_t pid;
+    uint32_t slot_count;
+    uint32_t sample_interval;
+    std::atomic<uint32_t> slot_used;
+    uint64_t start_time;    // seconds since the epoch
+    char process_name[64];
+};
+
+struct openclext_metrics_segment {
+    openclext_metrics_header header;
+    openclext_metrics_slot slots[OPENCLEXT_METRICS_SLOTS];
+};
+
+#endif // OPENCLEXT_METRICS_LAYOUT_H_
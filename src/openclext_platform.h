@@ -0,0 +1,136 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_PLATFORM_H_
+#define OPENCLEXT_PLATFORM_H_
+
+#include <CL/cl.h>
+
+#include <vector>
+
+#include "openclext_hooks.h"
+
+// Finds the platform for an OpenCL object, which is used to find the dispatch
+// table for the object.  Used by all generated dispatch tables.
+
+static inline cl_platform_id _get_platform(cl_platform_id platform)
+{
+    return platform;
+}
+
+static inline cl_platform_id _get_platform(cl_device_id device)
+{
+    if (device == nullptr) return nullptr;
+
+    cl_platform_id platform = nullptr;
+    CLEXT_COUNT_ICD_CALL();
+    clGetDeviceInfo(
+        device,
+        CL_DEVICE_PLATFORM,
+        sizeof(platform),
+        &platform,
+        nullptr);
+    return platform;
+}
+
+static inline cl_platform_id _get_platform(cl_command_queue command_queue)
+{
+    if (command_queue == nullptr) return nullptr;
+
+    cl_device_id device = nullptr;
+    CLEXT_COUNT_ICD_CALL();
+    clGetCommandQueueInfo(
+        command_queue,
+        CL_QUEUE_DEVICE,
+        sizeof(device),
+        &device,
+        nullptr);
+    return _get_platform(device);
+}
+
+static inline cl_platform_id _get_platform(cl_context context)
+{
+    if (context == nullptr) return nullptr;
+
+    cl_uint numDevices = 0;
+    CLEXT_COUNT_ICD_CALL();
+    clGetContextInfo(
+        context,
+        CL_CONTEXT_NUM_DEVICES,
+        sizeof(numDevices),
+        &numDevices,
+        nullptr );
+
+    if (numDevices == 1) {  // fast path, no dynamic allocation
+        cl_device_id    device = nullptr;
+        CLEXT_COUNT_ICD_CALL();
+        clGetContextInfo(
+            context,
+            CL_CONTEXT_DEVICES,
+            sizeof(cl_device_id),
+            &device,
+            nullptr );
+        return _get_platform(device);
+    }
+
+    // slower path, dynamic allocation
+    std::vector<cl_device_id> devices(numDevices);
+    CLEXT_COUNT_ICD_CALL();
+    clGetContextInfo(
+        context,
+        CL_CONTEXT_DEVICES,
+        numDevices * sizeof(cl_device_id),
+        devices.data(),
+        nullptr );
+    return _get_platform(devices[0]);
+}
+
+static inline cl_platform_id _get_platform(cl_kernel kernel)
+{
+    if (kernel == nullptr) return nullptr;
+
+    cl_context context = nullptr;
+    CLEXT_COUNT_ICD_CALL();
+    clGetKernelInfo(
+        kernel,
+        CL_KERNEL_CONTEXT,
+        sizeof(context),
+        &context,
+        nullptr);
+    return _get_platform(context);
+}
+
+static inline cl_platform_id _get_platform(cl_mem memobj)
+{
+    if (memobj == nullptr) return nullptr;
+
+    cl_context context = nullptr;
+    CLEXT_COUNT_ICD_CALL();
+    clGetMemObjectInfo(
+        memobj,
+        CL_MEM_CONTEXT,
+        sizeof(context),
+        &context,
+        nullptr);
+    return _get_platform(context);
+}
+
+static inline cl_platform_id _get_platform(cl_event event)
+{
+    if (event == nullptr) return nullptr;
+
+    cl_context context = nullptr;
+    CLEXT_COUNT_ICD_CALL();
+    clGetEventInfo(
+        event,
+        CL_EVENT_CONTEXT,
+        sizeof(context),
+        &context,
+        nullptr);
+    return _get_platform(context);
+}
+
+#endif // OPENCLEXT_PLATFORM_H_
@@ -0,0 +1,284 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_REPLAY_H_
+#define OPENCLEXT_REPLAY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <tuple>
+#include <type_traits>
+
+#include "openclext_capture.h"
+
+// Support for replaying captured extension function calls.
+//
+// When capture is enabled, the extension loader includes a table of all
+// extension functions, openclext_replay_functions.  For each function, the
+// table has an invoker that converts captured arguments back to the
+// function's parameter types and calls the extension function, and a null
+// implementation of the function that may be returned by a mock ICD.
+
+struct openclext_replay_arg {
+    uint8_t kind;
+    uint64_t value;         // SCALAR, FLOAT, HANDLE, or POINTER size
+    const char* string;     // STRING, null-terminated
+};
+
+// Supplies objects for captured arguments during replay.  If an argument
+// cannot be supplied, the call is skipped.
+class openclext_replay_binder {
+public:
+    virtual ~openclext_replay_binder() {}
+
+    // Returns the object to use for the captured handle ID, where handle is
+    // a value of the handle type, e.g. (cl_command_queue)nullptr.
+    virtual void* handle(cl_platform_id, uint64_t id) = 0;
+    virtual void* handle(cl_device_id, uint64_t id) = 0;
+    virtual void* handle(cl_context, uint64_t id) = 0;
+    virtual void* handle(cl_command_queue, uint64_t id) = 0;
+    virtual void* handle(const void*, uint64_t id) = 0;
+
+    // Returns memory to use for a non-null pointer argument that the call may
+    // access size bytes of, or nullptr if there is not enough memory.  size
+    // is 0 if it is not known.
+    virtual void* pointer(uint64_t size) = 0;
+
+    // Returns zero-filled memory for a non-null pointer argument that the call
+    // writes values of elementSize bytes through, such as a returned event,
+    // or nullptr if there is not enough memory.  The memory is not shared
+    // with any other argument.  After the call, release is called with the
+    // values, if release is not nullptr.
+    virtual void* output(
+        uint64_t size,
+        size_t elementSize,
+        void (*release)(const void* values, size_t count)) = 0;
+
+    const openclext_replay_arg* args = nullptr;
+    size_t count = 0;
+    bool skipped = false;
+};
+
+template<size_t... I> struct openclext_replay_indices {};
+template<size_t N, size_t... I> struct openclext_replay_make_indices :
+    openclext_replay_make_indices<N - 1, N - 1, I...> {};
+template<size_t... I> struct openclext_replay_make_indices<0, I...> {
+    typedef openclext_replay_indices<I...> type;
+};
+
+template<typename T>
+static inline typename std::enable_if<
+    std::is_integral<T>::value || std::is_enum<T>::value, T>::type
+openclext_replay_get(openclext_replay_binder&, const openclext_replay_arg& arg, T*)
+{
+    return (T)(int64_t)arg.value;
+}
+
+template<typename T>
+static inline typename std::enable_if<
+    std::is_floating_point<T>::value, T>::type
+openclext_replay_get(openclext_replay_binder&, const openclext_replay_arg& arg, T*)
+{
+    double d = 0.0;
+    memcpy(&d, &arg.value, sizeof(d));
+    return (T)d;
+}
+
+template<typename T>
+static inline typename std::enable_if<
+    std::is_class<T>::value || std::is_union<T>::value, T>::type
+openclext_replay_get(openclext_replay_binder&, const openclext_replay_arg&, T*)
+{
+    return T();
+}
+
+template<typename T>
+static inline void* openclext_replay_handle(
+    openclext_replay_binder& binder, T* handle, uint64_t id, std::true_type)
+{
+    return binder.handle(*handle, id);
+}
+
+template<typename T>
+static inline void* openclext_replay_handle(
+    openclext_replay_binder&, T*, uint64_t, std::false_type)
+{
+    return nullptr;
+}
+
+// Releases the objects returned through output pointers, so that replaying a
+// call many times does not leak the objects it creates.
+template<typename T>
+static inline void openclext_replay_release(T)
+{
+}
+
+#define CLEXT_REPLAY_RELEASE(_type, _release)                                  \
+    static inline void openclext_replay_release(_type object)                  \
+    {                                                                          \
+        if (object) _release(object);                                          \
+    }
+CLEXT_REPLAY_RELEASE(cl_context, clReleaseContext)
+CLEXT_REPLAY_RELEASE(cl_command_queue, clReleaseCommandQueue)
+CLEXT_REPLAY_RELEASE(cl_mem, clReleaseMemObject)
+CLEXT_REPLAY_RELEASE(cl_program, clReleaseProgram)
+CLEXT_REPLAY_RELEASE(cl_kernel, clReleaseKernel)
+CLEXT_REPLAY_RELEASE(cl_event, clReleaseEvent)
+#if defined(cl_khr_semaphore)
+CLEXT_REPLAY_RELEASE(cl_semaphore_khr, clReleaseSemaphoreKHR)
+#endif
+#if defined(cl_khr_command_buffer)
+CLEXT_REPLAY_RELEASE(cl_command_buffer_khr, clReleaseCommandBufferKHR)
+#endif
+#if defined(cl_intel_accelerator)
+CLEXT_REPLAY_RELEASE(cl_accelerator_intel, clReleaseAcceleratorINTEL)
+#endif
+#undef CLEXT_REPLAY_RELEASE
+
+// Pointers to incomplete types, e.g. CLeglImageKHR, are opaque handles.
+template<typename T, typename = void>
+struct openclext_replay_is_complete : std::false_type {};
+template<typename T>
+struct openclext_replay_is_complete<T, decltype(void(sizeof(T)))> : std::true_type {};
+
+template<typename T>
+static inline void openclext_replay_release_values(const void* values, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        openclext_replay_release(((const T*)values)[i]);
+    }
+}
+
+template<typename T>
+static inline void* openclext_replay_pointer(
+    openclext_replay_binder& binder, const openclext_replay_arg& arg, std::true_type)
+{
+    return binder.output(arg.value, sizeof(T), openclext_replay_release_values<T>);
+}
+
+template<typename T>
+static inline void* openclext_replay_pointer(
+    openclext_replay_binder& binder, const openclext_replay_arg& arg, std::false_type)
+{
+    return binder.pointer(arg.value);
+}
+
+// Function pointers, e.g. callbacks, are never replayed.
+template<typename T>
+static inline typename std::enable_if<std::is_function<T>::value, T*>::type
+openclext_replay_get(openclext_replay_binder&, const openclext_replay_arg&, T**)
+{
+    return nullptr;
+}
+
+template<typename T>
+static inline typename std::enable_if<!std::is_function<T>::value, T*>::type
+openclext_replay_get(
+    openclext_replay_binder& binder, const openclext_replay_arg& arg, T**)
+{
+    switch (arg.kind) {
+    case OPENCLEXT_CAPTURE_ARG_NULL:
+        return nullptr;
+    case OPENCLEXT_CAPTURE_ARG_STRING:
+        return (T*)arg.string;
+    case OPENCLEXT_CAPTURE_ARG_HANDLE: {
+            T* handle = nullptr;
+            void* object = openclext_replay_handle(
+                binder, &handle, arg.value, openclext_is_handle<T*>());
+            if (object == nullptr) binder.skipped = true;
+            return (T*)object;
+        }
+    default: {
+            // Pointers to typed, non-const values are outputs.  Other pointers
+            // are to memory.
+            void* ptr = openclext_replay_pointer<T>(binder, arg,
+                std::integral_constant<bool,
+                    !std::is_const<T>::value &&
+                    openclext_replay_is_complete<T>::value>());
+            if (ptr == nullptr) binder.skipped = true;
+            return (T*)ptr;
+        }
+    }
+}
+
+template<typename F, F fn> struct openclext_replay_invoker;
+
+template<typename R, typename... Args, R (CL_API_CALL *fn)(Args...)>
+struct openclext_replay_invoker<R (CL_API_CALL *)(Args...), fn>
+{
+    template<size_t... I>
+    static R call(openclext_replay_binder& binder, openclext_replay_indices<I...>)
+    {
+        std::tuple<Args...> values(openclext_replay_get(
+            binder, binder.args[I], (Args*)nullptr)...);
+        if (binder.skipped) {
+            return R();
+        }
+        return fn(std::get<I>(values)...);
+    }
+
+    static cl_int status(cl_int retVal) { return retVal; }
+    template<typename T> static cl_int status(T) { return CL_SUCCESS; }
+
+    // Returns the status of the call, if the function returns an error code.
+    static cl_int invoke(openclext_replay_binder& binder)
+    {
+        if (binder.count != sizeof...(Args)) {
+            binder.skipped = true;
+            return CL_INVALID_VALUE;
+        }
+        return status(call(binder,
+            typename openclext_replay_make_indices<sizeof...(Args)>::type()));
+    }
+};
+
+template<typename... Args, void (CL_API_CALL *fn)(Args...)>
+struct openclext_replay_invoker<void (CL_API_CALL *)(Args...), fn>
+{
+    template<size_t... I>
+    static void call(openclext_replay_binder& binder, openclext_replay_indices<I...>)
+    {
+        std::tuple<Args...> values(openclext_replay_get(
+            binder, binder.args[I], (Args*)nullptr)...);
+        if (!binder.skipped) {
+            fn(std::get<I>(values)...);
+        }
+    }
+
+    static cl_int invoke(openclext_replay_binder& binder)
+    {
+        if (binder.count != sizeof...(Args)) {
+            binder.skipped = true;
+            return CL_INVALID_VALUE;
+        }
+        call(binder,
+            typename openclext_replay_make_indices<sizeof...(Args)>::type());
+        return CL_SUCCESS;
+    }
+};
+
+// A null implementation of an extension function, which returns CL_SUCCESS
+// or a null pointer.
+template<typename F> struct openclext_null_function;
+
+template<typename R, typename... Args>
+struct openclext_null_function<R (CL_API_CALL *)(Args...)>
+{
+    static R CL_API_CALL call(Args...) { return R(); }
+};
+
+struct openclext_replay_function {
+    const char* name;
+    cl_int (*invoke)(openclext_replay_binder& binder);
+    void* null_function;
+};
+
+// Terminated by an entry with a null name.
+extern const openclext_replay_function openclext_replay_functions[];
+
+#endif // OPENCLEXT_REPLAY_H_
@@ -0,0 +1,227 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_export.h"
+
+#include <CL/cl_ext.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+#include "openclext.h"
+#include "openclext_resolution.h"
+
+#if defined(CLEXT_INTERPOSER)
+#include "openclext_interposer.h"
+#endif
+
+struct openclext_lookup {
+    const char* name;
+    void*       function;
+    uint64_t    ns;
+};
+
+struct openclext_resolution {
+    cl_platform_id platform;
+    uint64_t start_ns;
+    uint64_t end_ns;
+    bool finished;
+    std::vector<openclext_lookup> lookups;
+};
+
+// Resolutions are intentionally never destroyed, since extension functions
+// may be called from other static destructors.
+static std::mutex* _lock = new std::mutex;
+static std::vector<openclext_resolution*>* _resolutions =
+    new std::vector<openclext_resolution*>;
+
+static bool _debug_resolution(void)
+{
+    const char* value = getenv("CLEXT_DEBUG_RESOLUTION");
+    return value && value[0] && strcmp(value, "0") != 0;
+}
+
+static void _dump_platform_name(FILE* stream, cl_platform_id platform)
+{
+    size_t size = 0;
+    clGetPlatformInfo(platform, CL_PLATFORM_NAME, 0, nullptr, &size);
+
+    std::vector<char> name(size + 1);
+    if (size == 0 ||
+        clGetPlatformInfo(
+            platform, CL_PLATFORM_NAME, size, name.data(), nullptr) != CL_SUCCESS) {
+        name[0] = '\0';
+    }
+    fprintf(stream, "%s", name[0] ? name.data() : "(unknown)");
+}
+
+#if defined(cl_loader_info)
+typedef cl_int (CL_API_CALL* openclext_get_loader_info_fn)(
+    cl_icdl_info param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret);
+
+static void _dump_loader_info(
+    FILE* stream,
+    openclext_get_loader_info_fn getLoaderInfo,
+    const char* label,
+    cl_icdl_info param)
+{
+    size_t size = 0;
+    getLoaderInfo(param, 0, nullptr, &size);
+
+    std::vector<char> value(size + 1);
+    if (size == 0 ||
+        getLoaderInfo(param, size, value.data(), nullptr) != CL_SUCCESS) {
+        value[0] = '\0';
+    }
+    fprintf(stream, "    %-16s %s\n", label, value[0] ? value.data() : "(unknown)");
+}
+
+// Queries the ICD loader directly, so the loader information is available
+// even if the common dispatch table has not been initialized.
+static void _dump_loader(FILE* stream)
+{
+    openclext_get_loader_info_fn getLoaderInfo =
+        (openclext_get_loader_info_fn)clGetExtensionFunctionAddress(
+            "clGetICDLoaderInfoOCLICD");
+    if (getLoaderInfo == nullptr) {
+        fprintf(stream, "ICD Loader: clGetICDLoaderInfoOCLICD is not supported\n");
+        return;
+    }
+
+    fprintf(stream, "ICD Loader:\n");
+    _dump_loader_info(stream, getLoaderInfo, "Name", CL_ICDL_NAME);
+    _dump_loader_info(stream, getLoaderInfo, "Vendor", CL_ICDL_VENDOR);
+    _dump_loader_info(stream, getLoaderInfo, "Version", CL_ICDL_VERSION);
+    _dump_loader_info(stream, getLoaderInfo, "OpenCL Version", CL_ICDL_OCL_VERSION);
+}
+#endif // defined(cl_loader_info)
+
+static void _dump_resolution(
+    FILE* stream,
+    const openclext_resolution* resolution,
+    size_t index)
+{
+    size_t resolved = 0;
+    for (const auto& lookup : resolution->lookups) {
+        if (lookup.function) {
+            resolved++;
+        }
+    }
+
+    if (resolution->platform) {
+        fprintf(stream, "Platform %zu (0x%" PRIxPTR "): ",
+            index, (uintptr_t)resolution->platform);
+        _dump_platform_name(stream, resolution->platform);
+        fprintf(stream, "\n");
+    } else {
+        fprintf(stream, "Common Extension APIs:\n");
+    }
+    fprintf(stream,
+        "    %zu of %zu extension APIs resolved in %" PRIu64 " ns\n",
+        resolved, resolution->lookups.size(),
+        resolution->end_ns - resolution->start_ns);
+
+    fprintf(stream, "    %-48s %-8s %12s\n", "Function", "Status", "Lookup (ns)");
+    for (const auto& lookup : resolution->lookups) {
+        fprintf(stream, "    %-48s %-8s %12" PRIu64 "\n",
+            lookup.name,
+            lookup.function ? "Resolved" : "Null",
+            lookup.ns);
+    }
+
+}
+
+openclext_resolution* openclext_resolution_begin(cl_platform_id platform)
+{
+    openclext_resolution* resolution = new openclext_resolution();
+    resolution->platform = platform;
+    resolution->start_ns = openclext_now_ns();
+    resolution->end_ns = resolution->start_ns;
+    resolution->finished = false;
+
+    std::lock_guard<std::mutex> guard(*_lock);
+    _resolutions->push_back(resolution);
+    return resolution;
+}
+
+void openclext_resolution_record(
+    openclext_resolution* resolution,
+    const char* name,
+    void* function,
+    uint64_t start_ns)
+{
+    openclext_lookup lookup = { name, function, openclext_now_ns() - start_ns };
+    resolution->lookups.push_back(lookup);
+}
+
+// Returns the index of the platform, in the order the platforms were first
+// seen.  Each platform may have several resolutions, for example when the
+// extension loader is split into one translation unit per extension.
+static size_t _get_platform_index(cl_platform_id platform)
+{
+    std::vector<cl_platform_id> platforms;
+    for (auto resolution : *_resolutions) {
+        if (resolution->platform == platform) {
+            break;
+        }
+        if (resolution->platform &&
+            std::find(platforms.begin(), platforms.end(), resolution->platform) ==
+                platforms.end()) {
+            platforms.push_back(resolution->platform);
+        }
+    }
+    return platforms.size();
+}
+
+void openclext_resolution_end(openclext_resolution* resolution)
+{
+    size_t index = 0;
+    {
+        std::lock_guard<std::mutex> guard(*_lock);
+        resolution->end_ns = openclext_now_ns();
+        resolution->finished = true;
+        index = _get_platform_index(resolution->platform);
+    }
+
+    if (_debug_resolution()) {
+        fprintf(stderr, "Extension API Resolution:\n");
+        _dump_resolution(stderr, resolution, index);
+        fflush(stderr);
+    }
+}
+
+cl_int CL_API_CALL clextDumpResolution(
+    FILE* stream)
+{
+    if (stream == nullptr) {
+        return CL_INVALID_VALUE;
+    }
+
+    std::lock_guard<std::mutex> guard(*_lock);
+
+    fprintf(stream, "Extension API Resolution:\n");
+#if defined(cl_loader_info)
+    _dump_loader(stream);
+#endif
+    for (auto resolution : *_resolutions) {
+        if (resolution->finished) {
+            _dump_resolution(
+                stream, resolution, _get_platform_index(resolution->platform));
+        }
+    }
+
+    fflush(stream);
+    return CL_SUCCESS;
+}
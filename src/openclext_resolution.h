@@ -0,0 +1,37 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_RESOLUTION_H_
+#define OPENCLEXT_RESOLUTION_H_
+
+#include <CL/cl.h>
+
+#include <stdint.h>
+
+#include "openclext_clock.h"
+
+// A record of how each dispatch table was initialized: which extension
+// functions were resolved, which were not, and how long each lookup took.
+//
+// A resolution is started when the extension loader starts to initialize a
+// dispatch table, each extension function lookup is added to it, and it is
+// finished when the dispatch table is initialized.  Resolutions are kept for
+// the lifetime of the process so they may be written by clextDumpResolution.
+// If the CLEXT_DEBUG_RESOLUTION environment variable is set to a value other
+// than 0, each resolution is also written to stderr when it is finished.
+
+struct openclext_resolution;
+
+// platform is nullptr for the common dispatch table.
+openclext_resolution* openclext_resolution_begin(cl_platform_id platform);
+void openclext_resolution_record(
+    openclext_resolution* resolution,
+    const char* name,
+    void* function,
+    uint64_t start_ns);
+void openclext_resolution_end(openclext_resolution* resolution);
+
+#endif // OPENCLEXT_RESOLUTION_H_
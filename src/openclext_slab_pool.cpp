@@ -0,0 +1,351 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_slab_pool.h"
+
+#include <stdint.h>
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+static const unsigned kMinClassShift = 7;           // 128 bytes
+static const unsigned kMaxClassShift = 18;          // 256 KB
+static const unsigned kClassCount = kMaxClassShift - kMinClassShift + 1;
+static const size_t kSlabSize = 2 * 1024 * 1024;    // 2 MB
+static const cl_uint kSlabAlignment = 4096;
+
+struct openclext_slab_pool;
+struct openclext_slab_context;
+
+struct openclext_slab {
+    openclext_slab_pool* pool;
+    unsigned sizeClass;
+    char* base;
+    size_t chunkSize;
+    uint32_t chunkCount;
+    uint32_t used;
+    uint32_t next;
+    std::vector<uint32_t> freeChunks;
+    std::vector<bool> allocated;
+};
+
+struct openclext_slab_pool {
+    cl_device_id device;
+    cl_ulong kind;
+    std::vector<openclext_slab*> classes[kClassCount];
+};
+
+struct openclext_slab_context {
+    openclext_slab_allocator* allocator;
+    std::mutex lock;
+    std::vector<openclext_slab_pool*> pools;
+    std::map<uintptr_t, openclext_slab*> slabs;
+};
+
+// Contexts that are not pooled are recorded with no pools, rather than trying
+// to set a destructor callback for every allocation.
+struct openclext_slab_allocator {
+    openclext_slab_alloc_fn alloc;
+    openclext_slab_free_fn free;
+    std::mutex lock;
+    std::map<cl_context, openclext_slab_context*> contexts;
+};
+
+openclext_slab_allocator* openclext_slab_allocator_create(
+    openclext_slab_alloc_fn alloc,
+    openclext_slab_free_fn free)
+{
+    openclext_slab_allocator* allocator = new openclext_slab_allocator();
+    allocator->alloc = alloc;
+    allocator->free = free;
+    return allocator;
+}
+
+static void CL_CALLBACK _context_destructor(cl_context context, void* user_data)
+{
+    openclext_slab_context* slabContext = (openclext_slab_context*)user_data;
+    {
+        openclext_slab_allocator* allocator = slabContext->allocator;
+        std::lock_guard<std::mutex> guard(allocator->lock);
+        allocator->contexts.erase(context);
+    }
+
+    // The slabs were freed with the context.
+    for (auto& slab : slabContext->slabs) {
+        delete slab.second;
+    }
+    for (auto pool : slabContext->pools) {
+        delete pool;
+    }
+    delete slabContext;
+}
+
+// Returns the pools for the context, or nullptr if memory for the context is
+// not pooled.
+static openclext_slab_context* _get_context(
+    openclext_slab_allocator* allocator,
+    cl_context context,
+    bool create)
+{
+    std::lock_guard<std::mutex> guard(allocator->lock);
+
+    auto it = allocator->contexts.find(context);
+    if (it != allocator->contexts.end()) {
+        return it->second;
+    }
+    if (!create) {
+        return nullptr;
+    }
+
+    openclext_slab_context* slabContext = new openclext_slab_context();
+    slabContext->allocator = allocator;
+    if (clSetContextDestructorCallback(
+            context, _context_destructor, slabContext) != CL_SUCCESS) {
+        delete slabContext;
+        slabContext = nullptr;
+    }
+    allocator->contexts.insert(std::make_pair(context, slabContext));
+    return slabContext;
+}
+
+static openclext_slab_pool* _get_pool(
+    openclext_slab_context* slabContext,
+    cl_device_id device,
+    cl_ulong kind)
+{
+    for (auto pool : slabContext->pools) {
+        if (pool->device == device && pool->kind == kind) {
+            return pool;
+        }
+    }
+
+    openclext_slab_pool* pool = new openclext_slab_pool();
+    pool->device = device;
+    pool->kind = kind;
+    slabContext->pools.push_back(pool);
+    return pool;
+}
+
+// Returns the index of the size class for an allocation, or kClassCount if
+// the allocation cannot be pooled.
+static unsigned _get_size_class(size_t size, cl_uint alignment)
+{
+    if (size == 0 || size > ((size_t)1 << kMaxClassShift) ||
+        alignment > kSlabAlignment) {
+        return kClassCount;
+    }
+
+    // A chunk is aligned to its size, up to the slab alignment.
+    if (size < alignment) {
+        size = alignment;
+    }
+
+    unsigned shift = kMinClassShift;
+    while (((size_t)1 << shift) < size) {
+        shift++;
+    }
+    return shift - kMinClassShift;
+}
+
+// Returns the slab that contains ptr, or nullptr if ptr is not in a slab.
+static openclext_slab* _find_slab(
+    openclext_slab_context* slabContext,
+    const void* ptr)
+{
+    auto it = slabContext->slabs.upper_bound((uintptr_t)ptr);
+    if (it == slabContext->slabs.begin()) {
+        return nullptr;
+    }
+    --it;
+    openclext_slab* slab = it->second;
+    if ((uintptr_t)ptr >= (uintptr_t)slab->base + kSlabSize) {
+        return nullptr;
+    }
+    return slab;
+}
+
+static cl_int _release_slab(
+    cl_context context,
+    openclext_slab_context* slabContext,
+    std::vector<openclext_slab*>& slabs,
+    size_t index)
+{
+    openclext_slab* slab = slabs[index];
+    cl_int errorCode = slabContext->allocator->free(context, slab->base);
+    if (errorCode == CL_SUCCESS) {
+        slabContext->slabs.erase((uintptr_t)slab->base);
+        slabs.erase(slabs.begin() + index);
+        delete slab;
+    }
+    return errorCode;
+}
+
+void* openclext_slab_alloc(
+    openclext_slab_allocator* allocator,
+    cl_context context,
+    cl_device_id device,
+    cl_ulong kind,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    unsigned sizeClass = _get_size_class(size, alignment);
+    openclext_slab_context* slabContext =
+        context && sizeClass != kClassCount ?
+        _get_context(allocator, context, true) : nullptr;
+    if (slabContext == nullptr) {
+        return allocator->alloc(
+            context, device, kind, size, alignment, errcode_ret);
+    }
+    std::lock_guard<std::mutex> guard(slabContext->lock);
+
+    openclext_slab_pool* pool = _get_pool(slabContext, device, kind);
+    std::vector<openclext_slab*>& slabs = pool->classes[sizeClass];
+
+    // Prefer the most recently allocated slab with a free chunk.
+    openclext_slab* slab = nullptr;
+    for (auto it = slabs.rbegin(); it != slabs.rend(); ++it) {
+        if (!(*it)->freeChunks.empty() || (*it)->next < (*it)->chunkCount) {
+            slab = *it;
+            break;
+        }
+    }
+
+    if (slab == nullptr) {
+        cl_int errorCode = CL_SUCCESS;
+        void* base = allocator->alloc(
+            context, device, kind, kSlabSize, kSlabAlignment, &errorCode);
+        if (base == nullptr) {
+            if (errcode_ret) *errcode_ret = errorCode;
+            return nullptr;
+        }
+
+        slab = new openclext_slab();
+        slab->pool = pool;
+        slab->sizeClass = sizeClass;
+        slab->base = (char*)base;
+        slab->chunkSize = (size_t)1 << (sizeClass + kMinClassShift);
+        slab->chunkCount = (uint32_t)(kSlabSize / slab->chunkSize);
+        slab->used = 0;
+        slab->next = 0;
+        slab->allocated.resize(slab->chunkCount);
+        slabs.push_back(slab);
+        slabContext->slabs.insert(std::make_pair((uintptr_t)base, slab));
+    }
+
+    uint32_t chunk = 0;
+    if (!slab->freeChunks.empty()) {
+        chunk = slab->freeChunks.back();
+        slab->freeChunks.pop_back();
+    } else {
+        chunk = slab->next++;
+    }
+    slab->allocated[chunk] = true;
+    slab->used++;
+
+    if (errcode_ret) *errcode_ret = CL_SUCCESS;
+    return slab->base + chunk * slab->chunkSize;
+}
+
+cl_int openclext_slab_free(
+    openclext_slab_allocator* allocator,
+    cl_context context,
+    void* ptr)
+{
+    openclext_slab_context* slabContext =
+        context ? _get_context(allocator, context, false) : nullptr;
+    if (slabContext == nullptr) {
+        return allocator->free(context, ptr);
+    }
+
+    std::lock_guard<std::mutex> guard(slabContext->lock);
+
+    openclext_slab* slab = _find_slab(slabContext, ptr);
+    if (slab == nullptr) {
+        return allocator->free(context, ptr);
+    }
+
+    // Double frees and pointers to chunks that were never allocated would
+    // corrupt the free list.
+    size_t offset = (char*)ptr - slab->base;
+    uint32_t chunk = (uint32_t)(offset / slab->chunkSize);
+    if (offset % slab->chunkSize != 0 || !slab->allocated[chunk]) {
+        return CL_INVALID_VALUE;
+    }
+    slab->allocated[chunk] = false;
+    slab->freeChunks.push_back(chunk);
+    slab->used--;
+
+    // Each size class keeps at most one empty slab, so freeing and then
+    // allocating the same size does not allocate and free a slab each time.
+    if (slab->used == 0) {
+        std::vector<openclext_slab*>& slabs =
+            slab->pool->classes[slab->sizeClass];
+        for (size_t i = 0; i < slabs.size(); i++) {
+            if (slabs[i] != slab && slabs[i]->used == 0) {
+                return _release_slab(context, slabContext, slabs, i);
+            }
+        }
+    }
+
+    return CL_SUCCESS;
+}
+
+bool openclext_slab_get_chunk(
+    openclext_slab_allocator* allocator,
+    cl_context context,
+    const void* ptr,
+    void** base,
+    size_t* size)
+{
+    openclext_slab_context* slabContext =
+        context ? _get_context(allocator, context, false) : nullptr;
+    if (slabContext == nullptr) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(slabContext->lock);
+
+    openclext_slab* slab = _find_slab(slabContext, ptr);
+    if (slab == nullptr) {
+        return false;
+    }
+
+    size_t offset = (const char*)ptr - slab->base;
+    *base = slab->base + offset / slab->chunkSize * slab->chunkSize;
+    *size = slab->chunkSize;
+    return true;
+}
+
+cl_int openclext_slab_trim(
+    openclext_slab_allocator* allocator,
+    cl_context context)
+{
+    openclext_slab_context* slabContext =
+        _get_context(allocator, context, false);
+    if (slabContext == nullptr) {
+        return CL_SUCCESS;
+    }
+
+    std::lock_guard<std::mutex> guard(slabContext->lock);
+
+    cl_int errorCode = CL_SUCCESS;
+    for (auto pool : slabContext->pools) {
+        for (auto& slabs : pool->classes) {
+            for (size_t i = slabs.size(); i-- > 0; ) {
+                if (slabs[i]->used == 0) {
+                    cl_int releaseError =
+                        _release_slab(context, slabContext, slabs, i);
+                    if (releaseError != CL_SUCCESS) {
+                        errorCode = releaseError;
+                    }
+                }
+            }
+        }
+    }
+    return errorCode;
+}
@@ -0,0 +1,76 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_SLAB_POOL_H_
+#define OPENCLEXT_SLAB_POOL_H_
+
+#include <CL/cl.h>
+
+#include <stddef.h>
+
+// A slab allocator that pools small allocations for the USM and ARM SVM
+// pools.  Each slab is a large allocation that is divided into equally-sized
+// chunks of a single power-of-two size class.  Each context has a pool for
+// each device and kind of memory, where the kind is the USM type or the SVM
+// flags.  Allocations that are larger than the largest size class or that
+// need more alignment than a slab provides are not pooled, and are allocated
+// and freed directly with the callbacks.
+//
+// The pools for each context are destroyed when the context is destroyed.  If
+// a context destructor callback cannot be set, for example on platforms
+// before OpenCL 3.0, memory for the context is never pooled, since a pool
+// that outlived its context could give memory that was freed with the context
+// to a new context with the same handle.
+
+typedef void* (*openclext_slab_alloc_fn)(
+    cl_context context,
+    cl_device_id device,
+    cl_ulong kind,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret);
+typedef cl_int (*openclext_slab_free_fn)(
+    cl_context context,
+    void* ptr);
+
+struct openclext_slab_allocator;
+
+// Allocators are intentionally never destroyed, since pooled allocations may
+// be freed from other static destructors.
+openclext_slab_allocator* openclext_slab_allocator_create(
+    openclext_slab_alloc_fn alloc,
+    openclext_slab_free_fn free);
+
+void* openclext_slab_alloc(
+    openclext_slab_allocator* allocator,
+    cl_context context,
+    cl_device_id device,
+    cl_ulong kind,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret);
+
+// Returns CL_INVALID_VALUE for pointers into a slab that are not allocated
+// chunks, including chunks that were already freed.
+cl_int openclext_slab_free(
+    openclext_slab_allocator* allocator,
+    cl_context context,
+    void* ptr);
+
+// Returns true and gets the chunk that contains ptr if ptr is in a slab.
+bool openclext_slab_get_chunk(
+    openclext_slab_allocator* allocator,
+    cl_context context,
+    const void* ptr,
+    void** base,
+    size_t* size);
+
+// Frees the slabs for the context that have no allocations.
+cl_int openclext_slab_trim(
+    openclext_slab_allocator* allocator,
+    cl_context context);
+
+#endif // OPENCLEXT_SLAB_POOL_H_
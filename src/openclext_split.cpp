@@ -0,0 +1,67 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_export.h"
+
+#include <atomic>
+#include <vector>
+
+#include "openclext.h"
+#include "openclext_hooks.h"
+#include "openclext_split.h"
+
+struct openclext_split_platforms {
+    openclext_split_platforms()
+    {
+        cl_uint numPlatforms = 0;
+        CLEXT_COUNT_ICD_CALL();
+        clGetPlatformIDs(0, nullptr, &numPlatforms);
+        if (numPlatforms != 0) {
+            platforms.resize(numPlatforms);
+            CLEXT_COUNT_ICD_CALL();
+            clGetPlatformIDs(numPlatforms, platforms.data(), nullptr);
+        }
+    }
+
+    std::vector<cl_platform_id> platforms;
+};
+
+const cl_platform_id* openclext_split_get_platforms(size_t* numPlatforms)
+{
+    // The platforms are intentionally never destroyed, since extension
+    // functions may be called from other static destructors.
+    static openclext_split_platforms* platforms = new openclext_split_platforms;
+    *numPlatforms = platforms->platforms.size();
+    return platforms->platforms.data();
+}
+
+cl_platform_id openclext_split_get_single_platform(cl_platform_id platform)
+{
+    static std::atomic<cl_platform_id> single(nullptr);
+
+    if (platform == nullptr) {
+        return single.load();
+    }
+
+    cl_platform_id expected = nullptr;
+    single.compare_exchange_strong(expected, platform);
+    return expected ? expected : platform;
+}
+
+// When the extension loader is split by extension there is no dispatch table
+// with every extension function, so extension functions are found by asking
+// the ICD loader instead.
+void* CL_API_CALL clextGetFunctionAddress(
+    cl_platform_id platform,
+    const char* func_name)
+{
+    if (func_name == nullptr) {
+        return nullptr;
+    }
+
+    CLEXT_COUNT_ICD_CALL();
+    return clGetExtensionFunctionAddressForPlatform(platform, func_name);
+}
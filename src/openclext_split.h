@@ -0,0 +1,29 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_SPLIT_H_
+#define OPENCLEXT_SPLIT_H_
+
+#include <CL/cl.h>
+
+#include <stddef.h>
+
+// State shared by the per-extension translation units generated when the
+// extension loader is split into one translation unit per extension.  Each
+// translation unit has its own dispatch table that is initialized the first
+// time one of its extension functions is called, so these functions ensure
+// that all of the dispatch tables agree on the platforms.
+
+// Returns the platforms to initialize dispatch tables for.  The platforms
+// are queried once and are shared by all translation units.
+const cl_platform_id* openclext_split_get_platforms(size_t* numPlatforms);
+
+// When only a single platform is supported, returns the platform that was
+// found first by any translation unit.  If no platform has been found yet,
+// platform becomes the single platform, unless it is nullptr.
+cl_platform_id openclext_split_get_single_platform(cl_platform_id platform);
+
+#endif // OPENCLEXT_SPLIT_H_
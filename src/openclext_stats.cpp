@@ -0,0 +1,88 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_export.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <mutex>
+
+#include "openclext.h"
+#include "openclext_stats.h"
+
+#if defined(CLEXT_ENABLE_HISTOGRAMS)
+#include "openclext_histogram.h"
+#endif
+#if defined(CLEXT_ENABLE_TRANSFER_STATS)
+#include "openclext_transfer.h"
+#endif
+#if defined(CLEXT_ENABLE_USM_STATS)
+#include "openclext_usm_stats.h"
+#endif
+
+static void _dump_stats_at_exit(void)
+{
+    const char* filename = getenv("CLEXT_STATS_FILE");
+    FILE* stream = fopen(filename, "w");
+    if (stream) {
+        clextDumpStats(stream);
+        fclose(stream);
+    }
+}
+
+void openclext_stats_init(void)
+{
+    static std::once_flag once;
+    std::call_once(once, []() {
+        const char* filename = getenv("CLEXT_STATS_FILE");
+        if (filename && filename[0]) {
+            atexit(_dump_stats_at_exit);
+        }
+    });
+}
+
+cl_int CL_API_CALL clextDumpStats(
+    FILE* stream)
+{
+    if (stream == nullptr) {
+        return CL_INVALID_VALUE;
+    }
+
+#if defined(CLEXT_ENABLE_HISTOGRAMS)
+    openclext_histogram_dump(stream);
+#endif
+#if defined(CLEXT_ENABLE_TRANSFER_STATS)
+    openclext_transfer_dump(stream);
+#endif
+#if defined(CLEXT_ENABLE_USM_STATS)
+    openclext_usm_stats_dump(stream);
+#endif
+
+    fflush(stream);
+    return CL_SUCCESS;
+}
+
+#if defined(cl_intel_unified_shared_memory)
+
+cl_int CL_API_CALL clextGetUSMStats(
+    cl_context context,
+    cl_device_id device,
+    cl_unified_shared_memory_type_intel type,
+    clext_usm_stats* stats)
+{
+#if defined(CLEXT_ENABLE_USM_STATS)
+    if (stats == nullptr) {
+        return CL_INVALID_VALUE;
+    }
+    openclext_usm_stats_get(context, device, type, stats);
+    return CL_SUCCESS;
+#else
+    return CL_INVALID_OPERATION;
+#endif
+}
+
+#endif // defined(cl_intel_unified_shared_memory)
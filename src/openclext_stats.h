@@ -0,0 +1,15 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_STATS_H_
+#define OPENCLEXT_STATS_H_
+
+// Called by each feature that collects statistics when it first collects a
+// statistic.  Registers an exit handler to write all statistics to the file
+// named by the CLEXT_STATS_FILE environment variable, if it is set.
+void openclext_stats_init(void);
+
+#endif // OPENCLEXT_STATS_H_
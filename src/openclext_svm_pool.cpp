@@ -0,0 +1,123 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_export.h"
+
+#include <CL/cl_ext.h>
+
+#include "openclext.h"
+#include "openclext_slab_pool.h"
+
+#if defined(cl_arm_shared_virtual_memory)
+
+// Pooled ARM SVM allocations are carved from slabs by the slab allocator, like
+// pooled USM allocations.  Each context has a pool for each set of SVM flags,
+// since the flags decide how the memory may be accessed.
+
+static void* _alloc_slab(
+    cl_context context,
+    cl_device_id device,
+    cl_ulong kind,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    void* ptr = clSVMAllocARM(context, kind, size, alignment);
+    if (errcode_ret) *errcode_ret = ptr ? CL_SUCCESS : CL_OUT_OF_RESOURCES;
+    return ptr;
+}
+
+static cl_int _free_slab(
+    cl_context context,
+    void* ptr)
+{
+    clSVMFreeARM(context, ptr);
+    return CL_SUCCESS;
+}
+
+static openclext_slab_allocator* _allocator =
+    openclext_slab_allocator_create(_alloc_slab, _free_slab);
+
+void* CL_API_CALL clextSVMAllocARM(
+    cl_context context,
+    cl_svm_mem_flags_arm flags,
+    size_t size,
+    cl_uint alignment)
+{
+    return openclext_slab_alloc(
+        _allocator, context, nullptr, flags, size, alignment, nullptr);
+}
+
+// As for clSVMFreeARM, pointers that were not allocated are ignored.
+void CL_API_CALL clextSVMFreeARM(
+    cl_context context,
+    void* svm_pointer)
+{
+    if (svm_pointer == nullptr) {
+        return;
+    }
+    openclext_slab_free(_allocator, context, svm_pointer);
+}
+
+// Called when the free command executes, after all of the commands that it
+// waited for have completed.
+static void CL_CALLBACK _free_func(
+    cl_command_queue queue,
+    cl_uint num_svm_pointers,
+    void* svm_pointers[],
+    void* user_data)
+{
+    cl_context context = (cl_context)user_data;
+    for (cl_uint i = 0; i < num_svm_pointers; i++) {
+        clextSVMFreeARM(context, svm_pointers[i]);
+    }
+    clReleaseContext(context);
+}
+
+cl_int CL_API_CALL clextEnqueueSVMFreeARM(
+    cl_command_queue command_queue,
+    cl_uint num_svm_pointers,
+    void* svm_pointers[],
+    void (CL_CALLBACK* pfn_free_func)(cl_command_queue queue, cl_uint num_svm_pointers, void* svm_pointers[], void* user_data),
+    void* user_data,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    if (pfn_free_func) {
+        return clEnqueueSVMFreeARM(command_queue, num_svm_pointers,
+            svm_pointers, pfn_free_func, user_data,
+            num_events_in_wait_list, event_wait_list, event);
+    }
+
+    cl_context context = nullptr;
+    cl_int errorCode = clGetCommandQueueInfo(command_queue, CL_QUEUE_CONTEXT,
+        sizeof(context), &context, nullptr);
+    if (errorCode != CL_SUCCESS) {
+        return errorCode;
+    }
+
+    // The context must not be destroyed before the pointers are freed.
+    clRetainContext(context);
+    errorCode = clEnqueueSVMFreeARM(command_queue, num_svm_pointers,
+        svm_pointers, _free_func, context,
+        num_events_in_wait_list, event_wait_list, event);
+    if (errorCode != CL_SUCCESS) {
+        clReleaseContext(context);
+    }
+    return errorCode;
+}
+
+cl_int CL_API_CALL clextSVMPoolTrimARM(
+    cl_context context)
+{
+    if (context == nullptr) {
+        return CL_INVALID_CONTEXT;
+    }
+    return openclext_slab_trim(_allocator, context);
+}
+
+#endif // defined(cl_arm_shared_virtual_memory)
@@ -0,0 +1,27 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_export.h"
+
+#include <CL/cl.h>
+
+#include "openclext_test_api.h"
+
+std::atomic<uint64_t> openclext_icd_call_count(0);
+
+extern "C" {
+
+CL_API_ENTRY cl_ulong CL_API_CALL clextGetICDCallCount(void)
+{
+    return openclext_icd_call_count.load(std::memory_order_relaxed);
+}
+
+CL_API_ENTRY void CL_API_CALL clextResetICDCallCount(void)
+{
+    openclext_icd_call_count.store(0, std::memory_order_relaxed);
+}
+
+} // extern "C"
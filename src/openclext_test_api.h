@@ -0,0 +1,24 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_TEST_API_H_
+#define OPENCLEXT_TEST_API_H_
+
+#include <stdint.h>
+
+#include <atomic>
+
+// Test-only instrumentation, compiled in with CLEXT_ENABLE_TEST_API.
+//
+// openclext_icd_call_count counts every call the extension loader makes into
+// the ICD on its own behalf: platform queries while finding a dispatch table,
+// probing calls to query functions such as clGetSemaphoreInfoKHR, and calls
+// to get extension function addresses.  Calls to the extension functions
+// themselves are not counted.
+
+extern std::atomic<uint64_t> openclext_icd_call_count;
+
+#endif // OPENCLEXT_TEST_API_H_
@@ -0,0 +1,272 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_trace.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+#endif
+
+std::atomic<int> openclext_trace_state(OPENCLEXT_TRACE_UNINITIALIZED);
+
+struct openclext_trace_event {
+    const char* name;
+    const void* handle;
+    const void* platform;
+    uint64_t    start_ns;
+    uint64_t    end_ns;
+};
+
+// A single-producer single-consumer ring buffer.  The owning thread is the
+// only producer and the flush thread is the only consumer.  Events are
+// dropped (and counted) rather than blocking when the ring is full.
+struct openclext_trace_ring {
+    static const uint64_t capacity = 4096;
+
+    openclext_trace_ring(uint64_t tid_) : tid(tid_) {}
+
+    openclext_trace_event events[capacity];
+    std::atomic<uint64_t> head{0};
+    std::atomic<uint64_t> tail{0};
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<bool> retired{false};
+    uint64_t tid;
+};
+
+struct openclext_tracer {
+    FILE* file = nullptr;
+    unsigned long pid = 0;
+    bool first = true;
+    uint64_t dropped = 0;
+
+    std::mutex lock;
+    std::vector<openclext_trace_ring*> rings;
+
+    std::mutex flush_lock;
+    std::condition_variable flush_cv;
+    bool stop = false;
+    std::thread flusher;
+};
+
+// The tracer is intentionally never destroyed, since extension functions may
+// be called from other static destructors.
+static openclext_tracer* _tracer = nullptr;
+
+static uint64_t _get_thread_id(void)
+{
+#if defined(_WIN32)
+    return GetCurrentThreadId();
+#elif defined(__linux__)
+    return (uint64_t)syscall(SYS_gettid);
+#else
+    static std::atomic<uint64_t> counter(0);
+    return ++counter;
+#endif
+}
+
+static unsigned long _get_process_id(void)
+{
+#if defined(_WIN32)
+    return GetCurrentProcessId();
+#else
+    return (unsigned long)getpid();
+#endif
+}
+
+static void _write_event(
+    openclext_tracer* tracer,
+    uint64_t tid,
+    const openclext_trace_event& event)
+{
+    fprintf(tracer->file,
+        "%s{\"name\":\"%s\",\"cat\":\"openclext\",\"ph\":\"B\","
+        "\"pid\":%lu,\"tid\":%" PRIu64 ",\"ts\":%.3f,"
+        "\"args\":{\"handle\":\"0x%" PRIxPTR "\",\"platform\":\"0x%" PRIxPTR "\"}},\n"
+        "{\"name\":\"%s\",\"cat\":\"openclext\",\"ph\":\"E\","
+        "\"pid\":%lu,\"tid\":%" PRIu64 ",\"ts\":%.3f,"
+        "\"args\":{\"duration_ns\":%" PRIu64 "}}",
+        tracer->first ? "" : ",\n",
+        event.name,
+        tracer->pid, tid, event.start_ns / 1000.0,
+        (uintptr_t)event.handle, (uintptr_t)event.platform,
+        event.name,
+        tracer->pid, tid, event.end_ns / 1000.0,
+        event.end_ns - event.start_ns);
+    tracer->first = false;
+}
+
+// Drains all ring buffers to the trace file.  Only called from the flush
+// thread, or at exit after the flush thread has stopped.
+static void _flush(openclext_tracer* tracer)
+{
+    std::vector<openclext_trace_ring*> rings;
+    {
+        std::lock_guard<std::mutex> guard(tracer->lock);
+        rings = tracer->rings;
+    }
+
+    for (auto ring : rings) {
+        bool retired = ring->retired.load(std::memory_order_acquire);
+        uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+        for (; tail != head; tail++) {
+            _write_event(
+                tracer,
+                ring->tid,
+                ring->events[tail % openclext_trace_ring::capacity]);
+        }
+        ring->tail.store(tail, std::memory_order_release);
+
+        if (retired) {
+            tracer->dropped += ring->dropped.load(std::memory_order_relaxed);
+            std::lock_guard<std::mutex> guard(tracer->lock);
+            for (auto it = tracer->rings.begin(); it != tracer->rings.end(); ++it) {
+                if (*it == ring) {
+                    tracer->rings.erase(it);
+                    break;
+                }
+            }
+            delete ring;
+        }
+    }
+
+    fflush(tracer->file);
+}
+
+static void _flush_thread(openclext_tracer* tracer)
+{
+    std::unique_lock<std::mutex> guard(tracer->flush_lock);
+    while (!tracer->stop) {
+        tracer->flush_cv.wait_for(guard, std::chrono::milliseconds(100));
+        _flush(tracer);
+    }
+}
+
+static void _finish(void)
+{
+    openclext_tracer* tracer = _tracer;
+    openclext_trace_state.store(
+        OPENCLEXT_TRACE_DISABLED, std::memory_order_relaxed);
+
+    {
+        std::lock_guard<std::mutex> guard(tracer->flush_lock);
+        tracer->stop = true;
+    }
+    tracer->flush_cv.notify_one();
+    tracer->flusher.join();
+
+    _flush(tracer);
+
+    std::lock_guard<std::mutex> guard(tracer->lock);
+    for (auto ring : tracer->rings) {
+        tracer->dropped += ring->dropped.load(std::memory_order_relaxed);
+    }
+    fprintf(tracer->file,
+        "\n],\"otherData\":{\"dropped_events\":\"%" PRIu64 "\"}}\n",
+        tracer->dropped);
+    fclose(tracer->file);
+    tracer->file = nullptr;
+}
+
+int openclext_trace_init(void)
+{
+    static std::mutex init_lock;
+    std::lock_guard<std::mutex> guard(init_lock);
+
+    int state = openclext_trace_state.load(std::memory_order_relaxed);
+    if (state != OPENCLEXT_TRACE_UNINITIALIZED) {
+        return state;
+    }
+
+    state = OPENCLEXT_TRACE_DISABLED;
+
+    const char* filename = getenv("CLEXT_TRACE_FILE");
+    FILE* file = filename && filename[0] ? fopen(filename, "w") : nullptr;
+    if (file) {
+        _tracer = new openclext_tracer;
+        _tracer->file = file;
+        _tracer->pid = _get_process_id();
+        fprintf(file, "{\"traceEvents\":[\n");
+
+        _tracer->flusher = std::thread(_flush_thread, _tracer);
+        atexit(_finish);
+
+        state = OPENCLEXT_TRACE_ENABLED;
+    }
+
+    openclext_trace_state.store(state, std::memory_order_relaxed);
+    return state;
+}
+
+// Marks the calling thread's ring buffer as retired when the thread exits.
+// The flush thread frees the ring buffer after it has been drained.
+struct openclext_trace_thread {
+    openclext_trace_ring* ring = nullptr;
+
+    ~openclext_trace_thread()
+    {
+        if (ring) {
+            ring->retired.store(true, std::memory_order_release);
+        }
+    }
+};
+
+static openclext_trace_ring* _get_ring(void)
+{
+    static thread_local openclext_trace_thread thread;
+    if (thread.ring == nullptr) {
+        openclext_trace_ring* ring = new openclext_trace_ring(_get_thread_id());
+        std::lock_guard<std::mutex> guard(_tracer->lock);
+        _tracer->rings.push_back(ring);
+        thread.ring = ring;
+    }
+    return thread.ring;
+}
+
+void openclext_trace_record(
+    const char* name,
+    const void* handle,
+    const void* platform,
+    uint64_t start_ns,
+    uint64_t end_ns)
+{
+    if (openclext_trace_state.load(std::memory_order_relaxed) !=
+        OPENCLEXT_TRACE_ENABLED) {
+        return;
+    }
+
+    openclext_trace_ring* ring = _get_ring();
+
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    uint64_t tail = ring->tail.load(std::memory_order_acquire);
+    if (head - tail >= openclext_trace_ring::capacity) {
+        ring->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    openclext_trace_event& event =
+        ring->events[head % openclext_trace_ring::capacity];
+    event.name = name;
+    event.handle = handle;
+    event.platform = platform;
+    event.start_ns = start_ns;
+    event.end_ns = end_ns;
+    ring->head.store(head + 1, std::memory_order_release);
+}
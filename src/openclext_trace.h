@@ -0,0 +1,70 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_TRACE_H_
+#define OPENCLEXT_TRACE_H_
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include "openclext_clock.h"
+
+// Chrome trace output for extension functions.
+//
+// Tracing is compiled in with CLEXT_ENABLE_TRACE and is enabled at runtime by
+// setting the CLEXT_TRACE_FILE environment variable to the name of the file
+// to write.  Each thread records events into its own ring buffer without any
+// locking.  The ring buffers are drained to the trace file by a background
+// thread, and once more when the process exits.
+
+enum {
+    OPENCLEXT_TRACE_UNINITIALIZED = 0,
+    OPENCLEXT_TRACE_DISABLED,
+    OPENCLEXT_TRACE_ENABLED,
+};
+
+extern std::atomic<int> openclext_trace_state;
+
+int openclext_trace_init(void);
+void openclext_trace_record(
+    const char* name,
+    const void* handle,
+    const void* platform,
+    uint64_t start_ns,
+    uint64_t end_ns);
+
+static inline bool openclext_trace_enabled(void)
+{
+    int state = openclext_trace_state.load(std::memory_order_relaxed);
+    if (state == OPENCLEXT_TRACE_UNINITIALIZED) {
+        state = openclext_trace_init();
+    }
+    return state == OPENCLEXT_TRACE_ENABLED;
+}
+
+struct openclext_trace_scope {
+    openclext_trace_scope(const char* name_, const void* handle_) :
+        name(name_),
+        handle(handle_),
+        platform(nullptr),
+        start_ns(openclext_trace_enabled() ? openclext_now_ns() : 0) {}
+
+    ~openclext_trace_scope()
+    {
+        if (start_ns != 0) {
+            openclext_trace_record(
+                name, handle, platform, start_ns, openclext_now_ns());
+        }
+    }
+
+    const char* name;
+    const void* handle;
+    const void* platform;
+    uint64_t    start_ns;
+};
+
+#endif // OPENCLEXT_TRACE_H_
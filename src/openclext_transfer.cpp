@@ -0,0 +1,259 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_transfer.h"
+#include "openclext_clock.h"
+#include "openclext_stats.h"
+
+#include <inttypes.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+struct openclext_transfer_stats {
+    // Transfer sizes are counted in buckets that grow by a factor of 16:
+    // <= 64B, <= 1KB, <= 16KB, <= 256KB, <= 4MB, <= 64MB, and larger.
+    static const unsigned sizeBucketCount = 7;
+
+    std::atomic<const void*> handle;
+    std::atomic<const void*> platform;
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> bytes;
+    std::atomic<uint64_t> first_ns;
+    std::atomic<uint64_t> last_ns;
+    std::atomic<uint64_t> sizes[sizeBucketCount];
+};
+
+// Transfers to queues that do not fit in the table are accounted to an
+// overflow entry for their platform, so they are still in the platform
+// totals.  Transfers that do not fit in either table, e.g. for more platforms
+// than there are overflow entries, are accounted to an unknown platform.
+static const size_t _table_size = 256;  // must be a power of two
+static const size_t _overflow_size = 16;
+static openclext_transfer_stats _table[_table_size];
+static openclext_transfer_stats _overflow[_overflow_size];
+static openclext_transfer_stats _unknown;
+
+static unsigned _get_size_bucket(uint64_t bytes)
+{
+    unsigned bucket = 0;
+    uint64_t limit = 64;
+    while (bucket < openclext_transfer_stats::sizeBucketCount - 1 && bytes > limit) {
+        bucket++;
+        limit <<= 4;
+    }
+    return bucket;
+}
+
+// Returns the entry for handle in table, or nullptr if the table is full.
+static openclext_transfer_stats* _find_entry(
+    openclext_transfer_stats* table,
+    size_t table_size,
+    const void* handle,
+    const void* platform)
+{
+    size_t index = (size_t)(((uintptr_t)handle >> 4) * 0x9E3779B97F4A7C15ull);
+    for (size_t probe = 0; probe < table_size; probe++) {
+        openclext_transfer_stats* stats = &table[(index + probe) % table_size];
+        const void* current = stats->handle.load(std::memory_order_acquire);
+        if (current == handle) {
+            return stats;
+        }
+        if (current == nullptr) {
+            if (stats->handle.compare_exchange_strong(current, handle)) {
+                stats->platform.store(platform, std::memory_order_relaxed);
+                openclext_stats_init();
+                return stats;
+            }
+            if (current == handle) {
+                return stats;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+static openclext_transfer_stats* _find_stats(
+    const void* handle,
+    const void* platform)
+{
+    openclext_transfer_stats* stats = handle ?
+        _find_entry(_table, _table_size, handle, platform) : nullptr;
+    if (stats == nullptr && platform) {
+        stats = _find_entry(_overflow, _overflow_size, platform, platform);
+    }
+    if (stats == nullptr) {
+        openclext_stats_init();
+        stats = &_unknown;
+    }
+    return stats;
+}
+
+void openclext_transfer_record(
+    const void* handle,
+    const void* platform,
+    uint64_t bytes)
+{
+    openclext_transfer_stats* stats = _find_stats(handle, platform);
+    uint64_t now = openclext_now_ns();
+
+    stats->calls.fetch_add(1, std::memory_order_relaxed);
+    stats->bytes.fetch_add(bytes, std::memory_order_relaxed);
+    stats->sizes[_get_size_bucket(bytes)].fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t first = 0;
+    stats->first_ns.compare_exchange_strong(
+        first, now, std::memory_order_relaxed);
+
+    uint64_t last = stats->last_ns.load(std::memory_order_relaxed);
+    while (now > last &&
+        !stats->last_ns.compare_exchange_weak(
+            last, now, std::memory_order_relaxed)) {
+    }
+}
+
+// A snapshot of the statistics for one queue or one platform.
+struct openclext_transfer_totals {
+    const void* handle = nullptr;
+    const void* platform = nullptr;
+    uint64_t calls = 0;
+    uint64_t bytes = 0;
+    uint64_t first_ns = UINT64_MAX;
+    uint64_t last_ns = 0;
+    uint64_t sizes[openclext_transfer_stats::sizeBucketCount] = {};
+
+    void add(const openclext_transfer_totals& other)
+    {
+        calls += other.calls;
+        bytes += other.bytes;
+        first_ns = std::min(first_ns, other.first_ns);
+        last_ns = std::max(last_ns, other.last_ns);
+        for (unsigned b = 0; b < openclext_transfer_stats::sizeBucketCount; b++) {
+            sizes[b] += other.sizes[b];
+        }
+    }
+};
+
+static openclext_transfer_totals _snapshot(const openclext_transfer_stats& stats)
+{
+    openclext_transfer_totals totals;
+    totals.handle = stats.handle.load(std::memory_order_acquire);
+    totals.platform = stats.platform.load(std::memory_order_relaxed);
+    totals.calls = stats.calls.load(std::memory_order_relaxed);
+    totals.bytes = stats.bytes.load(std::memory_order_relaxed);
+    totals.first_ns = stats.first_ns.load(std::memory_order_relaxed);
+    totals.last_ns = stats.last_ns.load(std::memory_order_relaxed);
+    for (unsigned b = 0; b < openclext_transfer_stats::sizeBucketCount; b++) {
+        totals.sizes[b] = stats.sizes[b].load(std::memory_order_relaxed);
+    }
+    return totals;
+}
+
+static void _print_header(FILE* stream, const char* title, const char* name)
+{
+    fprintf(stream, "%s\n", title);
+    fprintf(stream,
+        "%-20s %10s %14s %10s %10s %8s %8s %8s %8s %8s %8s %8s\n",
+        name, "Calls", "Bytes", "Mean", "MB/s",
+        "<=64B", "<=1KB", "<=16KB", "<=256KB", "<=4MB", "<=64MB", ">64MB");
+}
+
+static void _print_totals(
+    FILE* stream,
+    const void* handle,
+    const openclext_transfer_totals& totals)
+{
+    // The rate is the number of bytes moved over the interval from the
+    // first to the last transfer, so it is not reported for a single
+    // transfer.
+    uint64_t interval = totals.last_ns - totals.first_ns;
+    double rate = totals.calls > 1 && interval > 0 ?
+        totals.bytes * 1000.0 / interval : 0.0;
+
+    fprintf(stream,
+        "0x%-18" PRIxPTR " %10" PRIu64 " %14" PRIu64 " %10" PRIu64 " %10.1f",
+        (uintptr_t)handle,
+        totals.calls,
+        totals.bytes,
+        totals.bytes / totals.calls,
+        rate);
+    for (unsigned b = 0; b < openclext_transfer_stats::sizeBucketCount; b++) {
+        fprintf(stream, " %8" PRIu64, totals.sizes[b]);
+    }
+    fprintf(stream, "\n");
+}
+
+void openclext_transfer_dump(FILE* stream)
+{
+    std::vector<openclext_transfer_totals> queues;
+    for (size_t i = 0; i < _table_size; i++) {
+        openclext_transfer_totals totals = _snapshot(_table[i]);
+        if (totals.handle != nullptr && totals.calls != 0) {
+            queues.push_back(totals);
+        }
+    }
+    // The overflow entries only count towards the platform totals.
+    std::vector<openclext_transfer_totals> overflows;
+    for (size_t i = 0; i < _overflow_size; i++) {
+        openclext_transfer_totals totals = _snapshot(_overflow[i]);
+        if (totals.handle != nullptr && totals.calls != 0) {
+            overflows.push_back(totals);
+        }
+    }
+    openclext_transfer_totals unknown = _snapshot(_unknown);
+    if (unknown.calls != 0) {
+        overflows.push_back(unknown);
+    }
+    if (queues.empty() && overflows.empty()) {
+        return;
+    }
+
+    std::sort(queues.begin(), queues.end(),
+        [](const openclext_transfer_totals& a,
+           const openclext_transfer_totals& b) {
+            return a.bytes > b.bytes;
+        });
+
+    std::vector<openclext_transfer_totals> platforms;
+    auto addToPlatform = [&](const openclext_transfer_totals& queue) {
+        auto it = std::find_if(platforms.begin(), platforms.end(),
+            [&](const openclext_transfer_totals& platform) {
+                return platform.handle == queue.platform;
+            });
+        if (it == platforms.end()) {
+            openclext_transfer_totals platform;
+            platform.handle = queue.platform;
+            platforms.push_back(platform);
+            it = platforms.end() - 1;
+        }
+        it->add(queue);
+    };
+    for (const auto& queue : queues) {
+        addToPlatform(queue);
+    }
+    openclext_transfer_totals overflow;
+    for (const auto& entry : overflows) {
+        addToPlatform(entry);
+        overflow.add(entry);
+    }
+
+    _print_header(stream, "Extension API Transfers by Platform:", "Platform");
+    for (const auto& platform : platforms) {
+        _print_totals(stream, platform.handle, platform);
+    }
+
+    _print_header(stream, "Extension API Transfers by Queue:", "Queue");
+    for (const auto& queue : queues) {
+        _print_totals(stream, queue.handle, queue);
+    }
+    if (overflow.calls != 0) {
+        fprintf(stream,
+            "(%" PRIu64 " transfers of %" PRIu64 " bytes to other queues are not shown)\n",
+            overflow.calls, overflow.bytes);
+    }
+}
@@ -0,0 +1,29 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_TRANSFER_H_
+#define OPENCLEXT_TRANSFER_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Data volume statistics for extension functions that move data, such as
+// clEnqueueMemcpyINTEL.
+//
+// Successful transfers are accounted to the queue (or command buffer) they
+// were enqueued to, in a fixed-size open-addressed table that is updated
+// with relaxed atomics and no locking.  Per-platform totals are computed
+// from the queue statistics when the statistics are written.  Transfers to
+// queues that do not fit in the table are accounted to an overflow entry for
+// their platform, which is included in the platform totals.
+
+void openclext_transfer_record(
+    const void* handle,
+    const void* platform,
+    uint64_t bytes);
+void openclext_transfer_dump(FILE* stream);
+
+#endif // OPENCLEXT_TRANSFER_H_
@@ -0,0 +1,306 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_usm_emulation.h"
+#include "openclext_hooks.h"
+#include "openclext_usm_registry.h"
+
+#include <vector>
+
+bool openclext_usm_emulation_is_supported(cl_platform_id platform)
+{
+    cl_uint numDevices = 0;
+    CLEXT_COUNT_ICD_CALL();
+    if (clGetDeviceIDs(platform, CL_DEVICE_TYPE_ALL, 0, nullptr, &numDevices) !=
+            CL_SUCCESS || numDevices == 0) {
+        return false;
+    }
+
+    std::vector<cl_device_id> devices(numDevices);
+    CLEXT_COUNT_ICD_CALL();
+    if (clGetDeviceIDs(platform, CL_DEVICE_TYPE_ALL, numDevices,
+            devices.data(), nullptr) != CL_SUCCESS) {
+        return false;
+    }
+
+    for (auto device : devices) {
+        cl_device_svm_capabilities svmCaps = 0;
+        CLEXT_COUNT_ICD_CALL();
+        if (clGetDeviceInfo(device, CL_DEVICE_SVM_CAPABILITIES,
+                sizeof(svmCaps), &svmCaps, nullptr) == CL_SUCCESS &&
+            (svmCaps & CL_DEVICE_SVM_COARSE_GRAIN_BUFFER)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Returns true if device, or every device in the context if device is
+// nullptr, supports fine-grained SVM buffers.
+static bool _supports_fine_grain(cl_context context, cl_device_id device)
+{
+    std::vector<cl_device_id> devices;
+    if (device) {
+        devices.push_back(device);
+    } else {
+        size_t size = 0;
+        if (clGetContextInfo(context, CL_CONTEXT_DEVICES, 0, nullptr, &size) !=
+                CL_SUCCESS || size == 0) {
+            return false;
+        }
+        devices.resize(size / sizeof(cl_device_id));
+        if (clGetContextInfo(context, CL_CONTEXT_DEVICES, size,
+                devices.data(), nullptr) != CL_SUCCESS) {
+            return false;
+        }
+    }
+
+    for (auto device : devices) {
+        cl_device_svm_capabilities svmCaps = 0;
+        if (clGetDeviceInfo(device, CL_DEVICE_SVM_CAPABILITIES,
+                sizeof(svmCaps), &svmCaps, nullptr) != CL_SUCCESS ||
+            !(svmCaps & CL_DEVICE_SVM_FINE_GRAIN_BUFFER)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void* _alloc(
+    cl_context context,
+    cl_device_id device,
+    cl_unified_shared_memory_type_intel type,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    cl_int errorCode = CL_SUCCESS;
+    for (const cl_mem_properties_intel* property = properties;
+         property && property[0] != 0; property += 2) {
+        if (property[0] != CL_MEM_ALLOC_FLAGS_INTEL) {
+            errorCode = CL_INVALID_PROPERTY;
+        }
+    }
+
+    void* ptr = nullptr;
+    if (context == nullptr) {
+        errorCode = CL_INVALID_CONTEXT;
+    } else if (size == 0) {
+        errorCode = CL_INVALID_BUFFER_SIZE;
+    } else if (alignment & (alignment - 1)) {
+        errorCode = CL_INVALID_VALUE;
+    } else if (errorCode == CL_SUCCESS) {
+        cl_svm_mem_flags flags = CL_MEM_READ_WRITE;
+        if (type != CL_MEM_TYPE_DEVICE_INTEL) {
+            flags |= CL_MEM_SVM_FINE_GRAIN_BUFFER;
+        }
+        if (type != CL_MEM_TYPE_DEVICE_INTEL &&
+            !_supports_fine_grain(context, device)) {
+            errorCode = CL_INVALID_OPERATION;
+        } else {
+            ptr = clSVMAlloc(context, flags, size, alignment);
+            if (ptr == nullptr) {
+                errorCode = CL_OUT_OF_RESOURCES;
+            }
+        }
+    }
+
+    if (ptr) {
+        openclext_usm_registry_insert(context, device, type, ptr, size);
+    }
+    if (errcode_ret) *errcode_ret = errorCode;
+    return ptr;
+}
+
+void* CL_API_CALL openclext_usm_emulation_clHostMemAllocINTEL(
+    cl_context context,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    return _alloc(context, nullptr, CL_MEM_TYPE_HOST_INTEL,
+        properties, size, alignment, errcode_ret);
+}
+
+void* CL_API_CALL openclext_usm_emulation_clDeviceMemAllocINTEL(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    if (device == nullptr) {
+        if (errcode_ret) *errcode_ret = CL_INVALID_DEVICE;
+        return nullptr;
+    }
+    return _alloc(context, device, CL_MEM_TYPE_DEVICE_INTEL,
+        properties, size, alignment, errcode_ret);
+}
+
+void* CL_API_CALL openclext_usm_emulation_clSharedMemAllocINTEL(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    return _alloc(context, device, CL_MEM_TYPE_SHARED_INTEL,
+        properties, size, alignment, errcode_ret);
+}
+
+cl_int CL_API_CALL openclext_usm_emulation_clMemFreeINTEL(
+    cl_context context,
+    void* ptr)
+{
+    if (context == nullptr) {
+        return CL_INVALID_CONTEXT;
+    }
+    if (ptr) {
+        openclext_usm_registry_erase(context, ptr);
+        clSVMFree(context, ptr);
+    }
+    return CL_SUCCESS;
+}
+
+template<typename T>
+static cl_int _return_info(
+    T value,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    if (param_value) {
+        if (param_value_size < sizeof(T)) {
+            return CL_INVALID_VALUE;
+        }
+        *(T*)param_value = value;
+    }
+    if (param_value_size_ret) {
+        *param_value_size_ret = sizeof(T);
+    }
+    return CL_SUCCESS;
+}
+
+cl_int CL_API_CALL openclext_usm_emulation_clGetMemAllocInfoINTEL(
+    cl_context context,
+    const void* ptr,
+    cl_mem_info_intel param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    if (context == nullptr) {
+        return CL_INVALID_CONTEXT;
+    }
+
+    cl_int errorCode = CL_SUCCESS;
+    if (openclext_usm_registry_get_info(context, ptr, param_name,
+            param_value_size, param_value, param_value_size_ret, &errorCode)) {
+        return errorCode;
+    }
+
+    // The pointer is not a USM allocation in the context, or the query is
+    // for the allocation flags, which are always zero.
+    switch (param_name) {
+    case CL_MEM_ALLOC_TYPE_INTEL:
+        return _return_info((cl_unified_shared_memory_type_intel)CL_MEM_TYPE_UNKNOWN_INTEL,
+            param_value_size, param_value, param_value_size_ret);
+    case CL_MEM_ALLOC_BASE_PTR_INTEL:
+        return _return_info((void*)nullptr,
+            param_value_size, param_value, param_value_size_ret);
+    case CL_MEM_ALLOC_SIZE_INTEL:
+        return _return_info((size_t)0,
+            param_value_size, param_value, param_value_size_ret);
+    case CL_MEM_ALLOC_DEVICE_INTEL:
+        return _return_info((cl_device_id)nullptr,
+            param_value_size, param_value, param_value_size_ret);
+    case CL_MEM_ALLOC_FLAGS_INTEL:
+        return _return_info((cl_mem_alloc_flags_intel)0,
+            param_value_size, param_value, param_value_size_ret);
+    default:
+        return CL_INVALID_VALUE;
+    }
+}
+
+cl_int CL_API_CALL openclext_usm_emulation_clSetKernelArgMemPointerINTEL(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    const void* arg_value)
+{
+    return clSetKernelArgSVMPointer(kernel, arg_index, arg_value);
+}
+
+cl_int CL_API_CALL openclext_usm_emulation_clEnqueueMemFillINTEL(
+    cl_command_queue command_queue,
+    void* dst_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clEnqueueSVMMemFill(command_queue, dst_ptr, pattern, pattern_size,
+        size, num_events_in_wait_list, event_wait_list, event);
+}
+
+cl_int CL_API_CALL openclext_usm_emulation_clEnqueueMemcpyINTEL(
+    cl_command_queue command_queue,
+    cl_bool blocking,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clEnqueueSVMMemcpy(command_queue, blocking, dst_ptr, src_ptr,
+        size, num_events_in_wait_list, event_wait_list, event);
+}
+
+cl_int CL_API_CALL openclext_usm_emulation_clEnqueueMemAdviseINTEL(
+    cl_command_queue command_queue,
+    const void* ptr,
+    size_t size,
+    cl_mem_advice_intel advice,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clEnqueueMarkerWithWaitList(command_queue,
+        num_events_in_wait_list, event_wait_list, event);
+}
+
+cl_int CL_API_CALL openclext_usm_emulation_clEnqueueMigrateMemINTEL(
+    cl_command_queue command_queue,
+    const void* ptr,
+    size_t size,
+    cl_mem_migration_flags flags,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    return clEnqueueSVMMigrateMem(command_queue, 1, &ptr, &size, flags,
+        num_events_in_wait_list, event_wait_list, event);
+}
+
+cl_int CL_API_CALL openclext_usm_emulation_clEnqueueMemsetINTEL(
+    cl_command_queue command_queue,
+    void* dst_ptr,
+    cl_int value,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    cl_uchar pattern = (cl_uchar)value;
+    return clEnqueueSVMMemFill(command_queue, dst_ptr, &pattern, sizeof(pattern),
+        size, num_events_in_wait_list, event_wait_list, event);
+}
@@ -0,0 +1,108 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_USM_EMULATION_H_
+#define OPENCLEXT_USM_EMULATION_H_
+
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+
+#include <stddef.h>
+
+// Emulation of cl_intel_unified_shared_memory with OpenCL 2.0 SVM, for
+// platforms that support SVM but not unified shared memory.  When a dispatch
+// table is initialized for such a platform, the unified shared memory
+// functions in the dispatch table are replaced with these functions.
+//
+// Device memory is coarse-grained SVM, and host and shared memory are
+// fine-grained SVM, since the host may access them without mapping them.
+// Allocations are recorded in the USM allocation registry so
+// clGetMemAllocInfoINTEL can be answered.  Advice is ignored.
+// clMemBlockingFreeINTEL is not emulated, since SVM has no free that waits for
+// the commands that use the memory, so it returns CL_INVALID_OPERATION.
+
+// Returns true if any device in the platform supports coarse-grained SVM
+// buffers.
+bool openclext_usm_emulation_is_supported(cl_platform_id platform);
+
+void* CL_API_CALL openclext_usm_emulation_clHostMemAllocINTEL(
+    cl_context context,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret);
+void* CL_API_CALL openclext_usm_emulation_clDeviceMemAllocINTEL(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret);
+void* CL_API_CALL openclext_usm_emulation_clSharedMemAllocINTEL(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret);
+cl_int CL_API_CALL openclext_usm_emulation_clMemFreeINTEL(
+    cl_context context,
+    void* ptr);
+cl_int CL_API_CALL openclext_usm_emulation_clGetMemAllocInfoINTEL(
+    cl_context context,
+    const void* ptr,
+    cl_mem_info_intel param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret);
+cl_int CL_API_CALL openclext_usm_emulation_clSetKernelArgMemPointerINTEL(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    const void* arg_value);
+cl_int CL_API_CALL openclext_usm_emulation_clEnqueueMemFillINTEL(
+    cl_command_queue command_queue,
+    void* dst_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+cl_int CL_API_CALL openclext_usm_emulation_clEnqueueMemcpyINTEL(
+    cl_command_queue command_queue,
+    cl_bool blocking,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+cl_int CL_API_CALL openclext_usm_emulation_clEnqueueMemAdviseINTEL(
+    cl_command_queue command_queue,
+    const void* ptr,
+    size_t size,
+    cl_mem_advice_intel advice,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+cl_int CL_API_CALL openclext_usm_emulation_clEnqueueMigrateMemINTEL(
+    cl_command_queue command_queue,
+    const void* ptr,
+    size_t size,
+    cl_mem_migration_flags flags,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+cl_int CL_API_CALL openclext_usm_emulation_clEnqueueMemsetINTEL(
+    cl_command_queue command_queue,
+    void* dst_ptr,
+    cl_int value,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+
+#endif // OPENCLEXT_USM_EMULATION_H_
@@ -0,0 +1,155 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_export.h"
+
+#include <CL/cl_ext.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "openclext.h"
+
+#if defined(cl_intel_unified_shared_memory)
+
+// Deferred frees wait for their events using event callbacks.  When the last
+// event for a deferred free completes, the deferred free is queued for a
+// background thread, which frees all of the queued memory each time it wakes,
+// so memory is never freed from an event callback and the thread that
+// deferred the free never waits.
+
+struct openclext_deferred_free {
+    cl_context context;
+    void* ptr;
+    std::atomic<cl_uint> remaining;
+    std::atomic<bool> failed;
+};
+
+struct openclext_reaper {
+    std::mutex lock;
+    std::condition_variable wake;
+    std::vector<openclext_deferred_free*> queue;
+};
+
+static void _reaper_thread(openclext_reaper* reaper)
+{
+    std::vector<openclext_deferred_free*> batch;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> guard(reaper->lock);
+            reaper->wake.wait(guard, [reaper]() { return !reaper->queue.empty(); });
+            batch.swap(reaper->queue);
+        }
+
+        for (auto deferred : batch) {
+            clextMemFreeINTEL(deferred->context, deferred->ptr);
+            clReleaseContext(deferred->context);
+            delete deferred;
+        }
+        batch.clear();
+    }
+}
+
+// The reaper is intentionally never destroyed, since deferred frees may still
+// be queued when the process exits.
+static openclext_reaper* _get_reaper(void)
+{
+    static openclext_reaper* reaper = []() {
+        openclext_reaper* reaper = new openclext_reaper();
+        std::thread(_reaper_thread, reaper).detach();
+        return reaper;
+    }();
+    return reaper;
+}
+
+// Called when the last reference to a deferred free is released.  The
+// deferred free holds one reference for each event and one for the thread
+// that deferred the free, until all of the event callbacks are set.
+static void _release(openclext_deferred_free* deferred)
+{
+    if (deferred->remaining.fetch_sub(1) != 1) {
+        return;
+    }
+
+    // If an event callback could not be set, the memory is not freed, and
+    // the error is returned to the caller, which still owns the memory.
+    if (deferred->failed.load()) {
+        clReleaseContext(deferred->context);
+        delete deferred;
+        return;
+    }
+
+    openclext_reaper* reaper = _get_reaper();
+    {
+        std::lock_guard<std::mutex> guard(reaper->lock);
+        reaper->queue.push_back(deferred);
+    }
+    reaper->wake.notify_one();
+}
+
+static void CL_CALLBACK _event_callback(
+    cl_event event,
+    cl_int event_command_status,
+    void* user_data)
+{
+    _release((openclext_deferred_free*)user_data);
+}
+
+cl_int CL_API_CALL clextMemFreeAfterEvents(
+    cl_context context,
+    void* ptr,
+    cl_uint num_events,
+    const cl_event* events)
+{
+    if (context == nullptr) {
+        return CL_INVALID_CONTEXT;
+    }
+    if ((num_events == 0) != (events == nullptr)) {
+        return CL_INVALID_EVENT_WAIT_LIST;
+    }
+    for (cl_uint i = 0; i < num_events; i++) {
+        if (events[i] == nullptr) {
+            return CL_INVALID_EVENT_WAIT_LIST;
+        }
+    }
+    if (ptr == nullptr) {
+        return CL_SUCCESS;
+    }
+    if (num_events == 0) {
+        return clextMemFreeINTEL(context, ptr);
+    }
+
+    // Start the reaper before setting any event callbacks, so it is never
+    // started from an event callback.
+    _get_reaper();
+
+    openclext_deferred_free* deferred = new openclext_deferred_free();
+    deferred->context = context;
+    deferred->ptr = ptr;
+    deferred->remaining.store(num_events + 1);
+    deferred->failed.store(false);
+    clRetainContext(context);
+
+    cl_int errorCode = CL_SUCCESS;
+    for (cl_uint i = 0; i < num_events; i++) {
+        cl_int setError = clSetEventCallback(
+            events[i], CL_COMPLETE, _event_callback, deferred);
+        if (setError != CL_SUCCESS) {
+            // This callback will never be called, so release its reference.
+            errorCode = setError;
+            deferred->failed.store(true);
+            _release(deferred);
+        }
+    }
+
+    _release(deferred);
+    return errorCode;
+}
+
+#endif // defined(cl_intel_unified_shared_memory)
@@ -0,0 +1,146 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_export.h"
+
+#include <CL/cl_ext.h>
+
+#include "openclext.h"
+#include "openclext_slab_pool.h"
+#include "openclext_usm_pool.h"
+
+#if defined(cl_intel_unified_shared_memory)
+
+// Pooled USM allocations are carved from slabs by the slab allocator, with a
+// pool for each device and USM type.  Allocations that have allocation
+// properties are not pooled and are allocated and freed directly.
+
+static void* _alloc_driver(
+    cl_context context,
+    cl_device_id device,
+    cl_unified_shared_memory_type_intel type,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    switch (type) {
+    case CL_MEM_TYPE_HOST_INTEL:
+        return clHostMemAllocINTEL(
+            context, properties, size, alignment, errcode_ret);
+    case CL_MEM_TYPE_DEVICE_INTEL:
+        return clDeviceMemAllocINTEL(
+            context, device, properties, size, alignment, errcode_ret);
+    default:
+        return clSharedMemAllocINTEL(
+            context, device, properties, size, alignment, errcode_ret);
+    }
+}
+
+static void* _alloc_slab(
+    cl_context context,
+    cl_device_id device,
+    cl_ulong kind,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    return _alloc_driver(context, device,
+        (cl_unified_shared_memory_type_intel)kind, nullptr,
+        size, alignment, errcode_ret);
+}
+
+static cl_int _free_slab(
+    cl_context context,
+    void* ptr)
+{
+    return clMemFreeINTEL(context, ptr);
+}
+
+static openclext_slab_allocator* _allocator =
+    openclext_slab_allocator_create(_alloc_slab, _free_slab);
+
+static void* _alloc(
+    cl_context context,
+    cl_device_id device,
+    cl_unified_shared_memory_type_intel type,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    if (properties && properties[0] != 0) {
+        return _alloc_driver(
+            context, device, type, properties, size, alignment, errcode_ret);
+    }
+    return openclext_slab_alloc(
+        _allocator, context, device, type, size, alignment, errcode_ret);
+}
+
+void* CL_API_CALL clextHostMemAllocINTEL(
+    cl_context context,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    return _alloc(context, nullptr, CL_MEM_TYPE_HOST_INTEL,
+        properties, size, alignment, errcode_ret);
+}
+
+void* CL_API_CALL clextDeviceMemAllocINTEL(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    return _alloc(context, device, CL_MEM_TYPE_DEVICE_INTEL,
+        properties, size, alignment, errcode_ret);
+}
+
+void* CL_API_CALL clextSharedMemAllocINTEL(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    return _alloc(context, device, CL_MEM_TYPE_SHARED_INTEL,
+        properties, size, alignment, errcode_ret);
+}
+
+cl_int CL_API_CALL clextMemFreeINTEL(
+    cl_context context,
+    void* ptr)
+{
+    if (ptr == nullptr) {
+        return CL_SUCCESS;
+    }
+    return openclext_slab_free(_allocator, context, ptr);
+}
+
+bool openclext_usm_pool_get_chunk(
+    cl_context context,
+    const void* ptr,
+    void** base,
+    size_t* size)
+{
+    return openclext_slab_get_chunk(_allocator, context, ptr, base, size);
+}
+
+cl_int CL_API_CALL clextMemPoolTrimINTEL(
+    cl_context context)
+{
+    if (context == nullptr) {
+        return CL_INVALID_CONTEXT;
+    }
+    return openclext_slab_trim(_allocator, context);
+}
+
+#endif // defined(cl_intel_unified_shared_memory)
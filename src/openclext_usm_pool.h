@@ -0,0 +1,25 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_USM_POOL_H_
+#define OPENCLEXT_USM_POOL_H_
+
+#include <CL/cl.h>
+
+#include <stddef.h>
+
+// Pooled USM allocations are chunks of larger USM allocations, so queries for
+// the base pointer and size of a pooled allocation describe the whole pooled
+// allocation.  Returns true and gets the chunk that contains ptr if ptr is in
+// a pooled allocation for context.
+
+bool openclext_usm_pool_get_chunk(
+    cl_context context,
+    const void* ptr,
+    void** base,
+    size_t* size);
+
+#endif // OPENCLEXT_USM_POOL_H_
@@ -0,0 +1,188 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_export.h"
+
+#include <CL/cl_ext.h>
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "openclext.h"
+#include "openclext_usm_pool.h"
+#include "openclext_usm_prefetch.h"
+
+#if defined(cl_intel_unified_shared_memory)
+
+// The kernel arguments are intentionally never destroyed, since extension
+// functions may be called from other static destructors.
+static std::mutex* _lock = new std::mutex;
+static std::map<cl_kernel, std::map<cl_uint, const void*>>* _kernels =
+    new std::map<cl_kernel, std::map<cl_uint, const void*>>;
+
+void openclext_usm_prefetch_set_arg(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    const void* arg_value)
+{
+    std::lock_guard<std::mutex> guard(*_lock);
+
+    if (arg_value) {
+        (*_kernels)[kernel][arg_index] = arg_value;
+        return;
+    }
+
+    auto it = _kernels->find(kernel);
+    if (it != _kernels->end()) {
+        it->second.erase(arg_index);
+        if (it->second.empty()) {
+            _kernels->erase(it);
+        }
+    }
+}
+
+cl_int CL_API_CALL clextReleaseKernelArgs(
+    cl_kernel kernel)
+{
+    if (kernel == nullptr) {
+        return CL_INVALID_KERNEL;
+    }
+
+    std::lock_guard<std::mutex> guard(*_lock);
+    _kernels->erase(kernel);
+    return CL_SUCCESS;
+}
+
+// Returns the range of the shared allocation that contains ptr, or an empty
+// range if ptr is not in a shared allocation.  For pooled allocations, the
+// range is the chunk of the pooled allocation that contains ptr, rather than
+// the whole slab.
+static std::pair<uintptr_t, uintptr_t> _get_shared_range(
+    cl_context context,
+    const void* ptr)
+{
+    cl_unified_shared_memory_type_intel type = CL_MEM_TYPE_UNKNOWN_INTEL;
+    void* base = nullptr;
+    size_t size = 0;
+    if (clGetMemAllocInfoINTEL(context, ptr, CL_MEM_ALLOC_TYPE_INTEL,
+            sizeof(type), &type, nullptr) != CL_SUCCESS ||
+        type != CL_MEM_TYPE_SHARED_INTEL ||
+        clGetMemAllocInfoINTEL(context, ptr, CL_MEM_ALLOC_BASE_PTR_INTEL,
+            sizeof(base), &base, nullptr) != CL_SUCCESS ||
+        clGetMemAllocInfoINTEL(context, ptr, CL_MEM_ALLOC_SIZE_INTEL,
+            sizeof(size), &size, nullptr) != CL_SUCCESS) {
+        return std::make_pair(0, 0);
+    }
+    openclext_usm_pool_get_chunk(context, ptr, &base, &size);
+    return std::make_pair((uintptr_t)base, (uintptr_t)base + size);
+}
+
+cl_int CL_API_CALL clextEnqueuePrefetchKernelArgs(
+    cl_command_queue command_queue,
+    cl_kernel kernel,
+    cl_mem_advice_intel advice,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    if (command_queue == nullptr) {
+        return CL_INVALID_COMMAND_QUEUE;
+    }
+    if (kernel == nullptr) {
+        return CL_INVALID_KERNEL;
+    }
+    if ((num_events_in_wait_list == 0) != (event_wait_list == nullptr)) {
+        return CL_INVALID_EVENT_WAIT_LIST;
+    }
+
+    std::vector<const void*> args;
+    {
+        std::lock_guard<std::mutex> guard(*_lock);
+        auto it = _kernels->find(kernel);
+        if (it != _kernels->end()) {
+            for (auto& arg : it->second) {
+                args.push_back(arg.second);
+            }
+        }
+    }
+
+    cl_context context = nullptr;
+    cl_int errorCode = clGetCommandQueueInfo(command_queue, CL_QUEUE_CONTEXT,
+        sizeof(context), &context, nullptr);
+    if (errorCode != CL_SUCCESS) {
+        return errorCode;
+    }
+
+    // Migrate whole shared allocations, and migrate allocations that are used
+    // by more than one argument once.  Different allocations never overlap,
+    // so only ranges for the same allocation are coalesced; adjacent
+    // allocations are not, since the range would not be a single allocation.
+    std::vector<std::pair<uintptr_t, uintptr_t>> ranges;
+    for (auto arg : args) {
+        std::pair<uintptr_t, uintptr_t> range = _get_shared_range(context, arg);
+        if (range.first != range.second) {
+            ranges.push_back(range);
+        }
+    }
+    std::sort(ranges.begin(), ranges.end());
+
+    std::vector<std::pair<uintptr_t, uintptr_t>> coalesced;
+    for (auto& range : ranges) {
+        if (!coalesced.empty() && range.first < coalesced.back().second) {
+            coalesced.back().second =
+                std::max(coalesced.back().second, range.second);
+        } else {
+            coalesced.push_back(range);
+        }
+    }
+
+    // The advice for each range is applied before the range is migrated.
+    std::vector<cl_event> events;
+    for (auto& range : coalesced) {
+        const void* ptr = (const void*)range.first;
+        size_t size = range.second - range.first;
+        cl_event adviceEvent = nullptr;
+        if (advice != 0) {
+            errorCode = clEnqueueMemAdviseINTEL(command_queue, ptr, size,
+                advice, num_events_in_wait_list, event_wait_list, &adviceEvent);
+            if (errorCode != CL_SUCCESS) {
+                break;
+            }
+        }
+        cl_event migrateEvent = nullptr;
+        errorCode = clEnqueueMigrateMemINTEL(command_queue, ptr, size, 0,
+            adviceEvent ? 1 : num_events_in_wait_list,
+            adviceEvent ? &adviceEvent : event_wait_list,
+            &migrateEvent);
+        if (adviceEvent) {
+            clReleaseEvent(adviceEvent);
+        }
+        if (errorCode != CL_SUCCESS) {
+            break;
+        }
+        events.push_back(migrateEvent);
+    }
+
+    // If nothing was migrated, the event still waits for the wait list.
+    if (errorCode == CL_SUCCESS && event) {
+        errorCode = events.empty() ?
+            clEnqueueMarkerWithWaitList(command_queue,
+                num_events_in_wait_list, event_wait_list, event) :
+            clEnqueueMarkerWithWaitList(command_queue,
+                (cl_uint)events.size(), events.data(), event);
+    }
+    for (auto migrateEvent : events) {
+        clReleaseEvent(migrateEvent);
+    }
+    return errorCode;
+}
+
+#endif // defined(cl_intel_unified_shared_memory)
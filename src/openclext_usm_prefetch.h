@@ -0,0 +1,27 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_USM_PREFETCH_H_
+#define OPENCLEXT_USM_PREFETCH_H_
+
+#include <CL/cl.h>
+
+// Records the USM pointers that are set as kernel arguments by
+// clSetKernelArgMemPointerINTEL, so clextEnqueuePrefetchKernelArgs can
+// migrate the shared allocations that a kernel will use to the device before
+// the kernel is enqueued.
+//
+// Pointers are recorded for each kernel and argument index, and a null
+// pointer removes the argument.  There is no callback when a kernel is
+// released, so the arguments for a kernel are kept until they are removed by
+// clextReleaseKernelArgs.
+
+void openclext_usm_prefetch_set_arg(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    const void* arg_value);
+
+#endif // OPENCLEXT_USM_PREFETCH_H_
@@ -0,0 +1,157 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_usm_registry.h"
+#if defined(CLEXT_ENABLE_USM_STATS)
+#include "openclext_usm_stats.h"
+#endif
+
+#include <stdint.h>
+#include <string.h>
+
+#include <iterator>
+#include <map>
+#include <mutex>
+
+// The registry is intentionally never destroyed, since extension functions
+// may be called from other static destructors.
+static std::mutex* _lock = new std::mutex;
+static std::map<uintptr_t, openclext_usm_allocation>* _allocations =
+    new std::map<uintptr_t, openclext_usm_allocation>;
+
+template<typename T>
+static cl_int _return_info(
+    T value,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    if (param_value) {
+        if (param_value_size < sizeof(T)) {
+            return CL_INVALID_VALUE;
+        }
+        memcpy(param_value, &value, sizeof(T));
+    }
+    if (param_value_size_ret) {
+        *param_value_size_ret = sizeof(T);
+    }
+    return CL_SUCCESS;
+}
+
+void openclext_usm_registry_insert(
+    cl_context context,
+    cl_device_id device,
+    cl_unified_shared_memory_type_intel type,
+    const void* ptr,
+    size_t size)
+{
+    uintptr_t base = (uintptr_t)ptr;
+    openclext_usm_allocation allocation = { context, device, type, size };
+
+    std::lock_guard<std::mutex> guard(*_lock);
+
+    auto it = _allocations->upper_bound(base);
+    if (it != _allocations->begin()) {
+        auto prev = std::prev(it);
+        if (prev->first + prev->second.size > base) {
+            it = prev;
+        }
+    }
+    while (it != _allocations->end() && it->first < base + size) {
+#if defined(CLEXT_ENABLE_USM_STATS)
+        // The same allocation may be recorded twice, for example by USM
+        // emulation and then by the extension function that called it.
+        const openclext_usm_allocation& stale = it->second;
+        if (it->first != base || stale.context != context ||
+            stale.device != device || stale.type != type ||
+            stale.size != size) {
+            openclext_usm_stats_release(stale, false);
+        }
+#endif
+        it = _allocations->erase(it);
+    }
+
+    _allocations->insert(std::make_pair(base, allocation));
+}
+
+void openclext_usm_registry_erase(
+    cl_context context,
+    const void* ptr)
+{
+    openclext_usm_allocation allocation;
+    openclext_usm_registry_remove(context, ptr, &allocation);
+}
+
+bool openclext_usm_registry_remove(
+    cl_context context,
+    const void* ptr,
+    openclext_usm_allocation* allocation)
+{
+    std::lock_guard<std::mutex> guard(*_lock);
+
+    auto it = _allocations->find((uintptr_t)ptr);
+    if (it == _allocations->end() || it->second.context != context) {
+        return false;
+    }
+    *allocation = it->second;
+    _allocations->erase(it);
+    return true;
+}
+
+bool openclext_usm_registry_get_info(
+    cl_context context,
+    const void* ptr,
+    cl_mem_info_intel param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret,
+    cl_int* status)
+{
+    if (param_name != CL_MEM_ALLOC_TYPE_INTEL &&
+        param_name != CL_MEM_ALLOC_BASE_PTR_INTEL &&
+        param_name != CL_MEM_ALLOC_SIZE_INTEL &&
+        param_name != CL_MEM_ALLOC_DEVICE_INTEL) {
+        return false;
+    }
+
+    uintptr_t base = 0;
+    openclext_usm_allocation allocation;
+    {
+        std::lock_guard<std::mutex> guard(*_lock);
+
+        auto it = _allocations->upper_bound((uintptr_t)ptr);
+        if (it == _allocations->begin()) {
+            return false;
+        }
+        --it;
+        if ((uintptr_t)ptr >= it->first + it->second.size ||
+            it->second.context != context) {
+            return false;
+        }
+        base = it->first;
+        allocation = it->second;
+    }
+
+    switch (param_name) {
+    case CL_MEM_ALLOC_TYPE_INTEL:
+        *status = _return_info(allocation.type,
+            param_value_size, param_value, param_value_size_ret);
+        break;
+    case CL_MEM_ALLOC_BASE_PTR_INTEL:
+        *status = _return_info((void*)base,
+            param_value_size, param_value, param_value_size_ret);
+        break;
+    case CL_MEM_ALLOC_SIZE_INTEL:
+        *status = _return_info(allocation.size,
+            param_value_size, param_value, param_value_size_ret);
+        break;
+    default:
+        *status = _return_info(allocation.device,
+            param_value_size, param_value, param_value_size_ret);
+        break;
+    }
+    return true;
+}
@@ -0,0 +1,63 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_USM_REGISTRY_H_
+#define OPENCLEXT_USM_REGISTRY_H_
+
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+
+#include <stddef.h>
+
+// A registry of the unified shared memory allocated by the extension
+// functions, so clGetMemAllocInfoINTEL can find the type, base pointer, size,
+// and device for a pointer into an allocation without calling into the
+// OpenCL implementation.
+//
+// Allocations are recorded in a map ordered by base pointer.  Allocations
+// are removed before they are freed, and put back if the free fails.  Any
+// allocations that overlap a new allocation are removed when it is recorded,
+// in case an allocation was not freed before its context was destroyed.
+// Queries for pointers that are not in the registry, for other contexts, or
+// for other information are answered by the OpenCL implementation.
+//
+// The USM allocation statistics use the same allocation records, so the
+// registry is also built when only the statistics are enabled.
+
+struct openclext_usm_allocation {
+    cl_context context;
+    cl_device_id device;
+    cl_unified_shared_memory_type_intel type;
+    size_t size;
+};
+
+void openclext_usm_registry_insert(
+    cl_context context,
+    cl_device_id device,
+    cl_unified_shared_memory_type_intel type,
+    const void* ptr,
+    size_t size);
+void openclext_usm_registry_erase(
+    cl_context context,
+    const void* ptr);
+
+// Returns true and sets allocation if the allocation was removed.
+bool openclext_usm_registry_remove(
+    cl_context context,
+    const void* ptr,
+    openclext_usm_allocation* allocation);
+
+// Returns true and sets status if the query was answered by the registry.
+bool openclext_usm_registry_get_info(
+    cl_context context,
+    const void* ptr,
+    cl_mem_info_intel param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret,
+    cl_int* status);
+
+#endif // OPENCLEXT_USM_REGISTRY_H_
@@ -0,0 +1,164 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_export.h"
+
+#include <CL/cl_ext.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "openclext.h"
+
+#if defined(cl_intel_unified_shared_memory)
+
+// Transfers are split into one chunk per queue, but chunks are never smaller
+// than the minimum chunk size, so small transfers use fewer queues.  Chunks
+// are a multiple of the chunk alignment, which is also a multiple of every
+// valid fill pattern size.
+static const size_t kMinChunkSize = 1024 * 1024;    // 1 MB
+static const size_t kChunkAlignment = 4096;
+
+static cl_int _validate(
+    cl_uint num_queues,
+    const cl_command_queue* queues,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list)
+{
+    if (num_queues == 0 || queues == nullptr) {
+        return CL_INVALID_VALUE;
+    }
+    for (cl_uint i = 0; i < num_queues; i++) {
+        if (queues[i] == nullptr) {
+            return CL_INVALID_COMMAND_QUEUE;
+        }
+    }
+    if ((num_events_in_wait_list == 0) != (event_wait_list == nullptr)) {
+        return CL_INVALID_EVENT_WAIT_LIST;
+    }
+    return CL_SUCCESS;
+}
+
+static size_t _get_chunk_size(cl_uint num_queues, size_t size)
+{
+    size_t chunkSize = (size + num_queues - 1) / num_queues;
+    chunkSize = std::max(chunkSize, kMinChunkSize);
+    return (chunkSize + kChunkAlignment - 1) / kChunkAlignment * kChunkAlignment;
+}
+
+// Waits for or returns an event for all of the chunks, then releases the
+// events for the chunks.  The returned event is a marker on the first queue.
+// If a chunk could not be enqueued, waits for the chunks that were enqueued
+// before it, so no part of a failed transfer is still running when the error
+// is returned.
+static cl_int _finish(
+    cl_int errorCode,
+    const cl_command_queue* queues,
+    cl_bool blocking,
+    std::vector<cl_event>& events,
+    cl_event* event)
+{
+    if (errorCode != CL_SUCCESS) {
+        if (!events.empty()) {
+            clWaitForEvents((cl_uint)events.size(), events.data());
+        }
+    } else if (blocking) {
+        errorCode = clWaitForEvents((cl_uint)events.size(), events.data());
+    }
+    if (errorCode == CL_SUCCESS && event) {
+        errorCode = clEnqueueMarkerWithWaitList(
+            queues[0], (cl_uint)events.size(), events.data(), event);
+    }
+    for (auto chunkEvent : events) {
+        clReleaseEvent(chunkEvent);
+    }
+    return errorCode;
+}
+
+cl_int CL_API_CALL clextEnqueueMemcpySplit(
+    cl_uint num_queues,
+    const cl_command_queue* queues,
+    cl_bool blocking,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    cl_int errorCode = _validate(
+        num_queues, queues, num_events_in_wait_list, event_wait_list);
+    if (errorCode != CL_SUCCESS) {
+        return errorCode;
+    }
+
+    size_t chunkSize = _get_chunk_size(num_queues, size);
+    if (size <= chunkSize) {
+        return clEnqueueMemcpyINTEL(queues[0], blocking, dst_ptr, src_ptr,
+            size, num_events_in_wait_list, event_wait_list, event);
+    }
+
+    std::vector<cl_event> events;
+    for (size_t offset = 0, chunk = 0; offset < size; offset += chunkSize, chunk++) {
+        cl_command_queue queue = queues[chunk % num_queues];
+        cl_event chunkEvent = nullptr;
+        errorCode = clEnqueueMemcpyINTEL(queue, CL_FALSE,
+            (char*)dst_ptr + offset, (const char*)src_ptr + offset,
+            std::min(chunkSize, size - offset),
+            num_events_in_wait_list, event_wait_list, &chunkEvent);
+        if (errorCode != CL_SUCCESS) {
+            break;
+        }
+        events.push_back(chunkEvent);
+        clFlush(queue);
+    }
+
+    return _finish(errorCode, queues, blocking, events, event);
+}
+
+cl_int CL_API_CALL clextEnqueueMemFillSplit(
+    cl_uint num_queues,
+    const cl_command_queue* queues,
+    void* dst_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    cl_int errorCode = _validate(
+        num_queues, queues, num_events_in_wait_list, event_wait_list);
+    if (errorCode != CL_SUCCESS) {
+        return errorCode;
+    }
+
+    size_t chunkSize = _get_chunk_size(num_queues, size);
+    if (size <= chunkSize || pattern_size == 0 ||
+        kChunkAlignment % pattern_size != 0) {
+        return clEnqueueMemFillINTEL(queues[0], dst_ptr, pattern, pattern_size,
+            size, num_events_in_wait_list, event_wait_list, event);
+    }
+
+    std::vector<cl_event> events;
+    for (size_t offset = 0, chunk = 0; offset < size; offset += chunkSize, chunk++) {
+        cl_command_queue queue = queues[chunk % num_queues];
+        cl_event chunkEvent = nullptr;
+        errorCode = clEnqueueMemFillINTEL(queue,
+            (char*)dst_ptr + offset, pattern, pattern_size,
+            std::min(chunkSize, size - offset),
+            num_events_in_wait_list, event_wait_list, &chunkEvent);
+        if (errorCode != CL_SUCCESS) {
+            break;
+        }
+        events.push_back(chunkEvent);
+        clFlush(queue);
+    }
+
+    return _finish(errorCode, queues, CL_FALSE, events, event);
+}
+
+#endif // defined(cl_intel_unified_shared_memory)
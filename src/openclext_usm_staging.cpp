@@ -0,0 +1,327 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_usm_staging.h"
+#include "openclext_hooks.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <vector>
+
+// Copies smaller than the threshold are not staged, since they are not large
+// enough to overlap host and device copies.
+static const size_t kChunkSize = 1024 * 1024;          // 1 MB
+static const unsigned kSlotCount = 4;
+static const size_t kStagingThreshold = 2 * kChunkSize;
+
+struct openclext_staging_ring;
+
+struct openclext_staging_slot {
+    openclext_staging_ring* ring;
+    bool busy;
+    cl_int status;
+};
+
+// Each staged copy holds the ring lock for the whole copy.  A slot is busy
+// from when a chunk is copied to or from it until the event for the chunk
+// completes, which is tracked by an event callback, so the ring does not
+// hold any events between copies.  The callback also records whether the copy
+// failed, so data is never copied out of a slot that was not filled.
+struct openclext_staging_ring {
+    std::mutex lock;
+    char* base;
+    std::mutex slotLock;
+    std::condition_variable slotIdle;
+    openclext_staging_slot slots[kSlotCount];
+};
+
+// The rings for each context are destroyed when the context is destroyed.  If
+// a context destructor callback cannot be set, copies for the context are
+// never staged, since the ring could outlive its staging memory.  The map of rings is intentionally never destroyed, since extension
+// functions may be called from other static destructors.
+static std::mutex* _lock = new std::mutex;
+static std::map<cl_context, openclext_staging_ring*>* _rings =
+    new std::map<cl_context, openclext_staging_ring*>;
+
+static void CL_CALLBACK _context_destructor(cl_context context, void* user_data)
+{
+    {
+        std::lock_guard<std::mutex> guard(*_lock);
+        _rings->erase(context);
+    }
+
+    // The staging memory was freed with the context.
+    delete (openclext_staging_ring*)user_data;
+}
+
+// Returns the ring for the context, or nullptr if the staging memory for the
+// context could not be allocated.
+static openclext_staging_ring* _get_ring(cl_context context)
+{
+    std::lock_guard<std::mutex> guard(*_lock);
+
+    auto it = _rings->find(context);
+    if (it != _rings->end()) {
+        return it->second->base ? it->second : nullptr;
+    }
+
+    // If the staging memory cannot be allocated, copies for the context are
+    // never staged, rather than trying to allocate it for every copy.
+    openclext_staging_ring* ring = new openclext_staging_ring();
+    ring->base = nullptr;
+    for (auto& slot : ring->slots) {
+        slot.ring = ring;
+        slot.busy = false;
+        slot.status = CL_SUCCESS;
+    }
+    if (clSetContextDestructorCallback(
+            context, _context_destructor, ring) == CL_SUCCESS) {
+        ring->base = (char*)clHostMemAllocINTEL(
+            context, nullptr, kSlotCount * kChunkSize, 4096, nullptr);
+    }
+    _rings->insert(std::make_pair(context, ring));
+    return ring->base ? ring : nullptr;
+}
+
+static cl_unified_shared_memory_type_intel _get_type(
+    cl_context context,
+    const void* ptr)
+{
+    cl_unified_shared_memory_type_intel type = CL_MEM_TYPE_UNKNOWN_INTEL;
+    if (clGetMemAllocInfoINTEL(context, ptr, CL_MEM_ALLOC_TYPE_INTEL,
+            sizeof(type), &type, nullptr) != CL_SUCCESS) {
+        return CL_MEM_TYPE_UNKNOWN_INTEL;
+    }
+    return type;
+}
+
+static void CL_CALLBACK _slot_callback(
+    cl_event event,
+    cl_int event_command_status,
+    void* user_data)
+{
+    openclext_staging_slot* slot = (openclext_staging_slot*)user_data;
+    openclext_staging_ring* ring = slot->ring;
+    {
+        std::lock_guard<std::mutex> guard(ring->slotLock);
+        slot->busy = false;
+        if (event_command_status < 0) {
+            slot->status = event_command_status;
+        }
+    }
+    ring->slotIdle.notify_all();
+}
+
+// Waits for the copy to or from a slot to complete, and returns its status.
+static cl_int _wait_slot(openclext_staging_ring* ring, unsigned index)
+{
+    openclext_staging_slot* slot = &ring->slots[index];
+    std::unique_lock<std::mutex> guard(ring->slotLock);
+    ring->slotIdle.wait(guard, [slot]() { return !slot->busy; });
+    return slot->status;
+}
+
+// Enqueues a copy of one chunk to or from a slot, and marks the slot busy
+// until the copy completes.
+static cl_int _enqueue_chunk(
+    openclext_enqueue_memcpy_fn enqueueMemcpy,
+    openclext_staging_ring* ring,
+    unsigned index,
+    cl_command_queue command_queue,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    std::vector<cl_event>& events)
+{
+    cl_event event = nullptr;
+    cl_int errorCode = enqueueMemcpy(
+        command_queue, CL_FALSE, dst_ptr, src_ptr, size,
+        num_events_in_wait_list, event_wait_list, &event);
+    if (errorCode != CL_SUCCESS) {
+        return errorCode;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(ring->slotLock);
+        ring->slots[index].busy = true;
+        ring->slots[index].status = CL_SUCCESS;
+    }
+    errorCode = clSetEventCallback(
+        event, CL_COMPLETE, _slot_callback, &ring->slots[index]);
+    if (errorCode != CL_SUCCESS) {
+        // The slot cannot be reused until the copy completes.
+        errorCode = clWaitForEvents(1, &event);
+        _slot_callback(event, errorCode == CL_SUCCESS ? CL_COMPLETE : errorCode,
+            &ring->slots[index]);
+    }
+    events.push_back(event);
+
+    // Start the copy while the next chunk is copied on the host.
+    clFlush(command_queue);
+    return CL_SUCCESS;
+}
+
+static cl_int _stage_upload(
+    openclext_enqueue_memcpy_fn enqueueMemcpy,
+    openclext_staging_ring* ring,
+    cl_command_queue command_queue,
+    char* dst_ptr,
+    const char* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    std::vector<cl_event>& events)
+{
+    // The source may be written by the commands in the wait list or, for
+    // in-order queues, by earlier commands, so it is not read on the host
+    // until they complete.  A marker waits for both.  For out-of-order queues
+    // without a wait list, this also waits for earlier commands.
+    cl_event marker = nullptr;
+    cl_int errorCode = clEnqueueMarkerWithWaitList(command_queue,
+        num_events_in_wait_list, event_wait_list, &marker);
+    if (errorCode != CL_SUCCESS) {
+        return errorCode;
+    }
+    errorCode = clWaitForEvents(1, &marker);
+    clReleaseEvent(marker);
+    if (errorCode != CL_SUCCESS) {
+        return errorCode;
+    }
+
+    for (size_t offset = 0, chunk = 0; offset < size; offset += kChunkSize, chunk++) {
+        unsigned index = (unsigned)(chunk % kSlotCount);
+        size_t chunkSize = std::min(kChunkSize, size - offset);
+        char* staging = ring->base + index * kChunkSize;
+
+        _wait_slot(ring, index);
+        memcpy(staging, src_ptr + offset, chunkSize);
+        errorCode = _enqueue_chunk(
+            enqueueMemcpy, ring, index, command_queue,
+            dst_ptr + offset, staging, chunkSize, 0, nullptr, events);
+        if (errorCode != CL_SUCCESS) {
+            return errorCode;
+        }
+    }
+    return CL_SUCCESS;
+}
+
+static cl_int _stage_download(
+    openclext_enqueue_memcpy_fn enqueueMemcpy,
+    openclext_staging_ring* ring,
+    cl_command_queue command_queue,
+    char* dst_ptr,
+    const char* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    std::vector<cl_event>& events)
+{
+    size_t chunkCount = (size + kChunkSize - 1) / kChunkSize;
+    size_t enqueued = 0;
+    for (size_t chunk = 0; chunk < chunkCount; chunk++) {
+        // Keep every slot copying from the device.
+        while (enqueued < chunkCount && enqueued < chunk + kSlotCount) {
+            unsigned index = (unsigned)(enqueued % kSlotCount);
+            size_t offset = enqueued * kChunkSize;
+            _wait_slot(ring, index);
+            cl_int errorCode = _enqueue_chunk(
+                enqueueMemcpy, ring, index, command_queue,
+                ring->base + index * kChunkSize, src_ptr + offset,
+                std::min(kChunkSize, size - offset),
+                num_events_in_wait_list, event_wait_list, events);
+            if (errorCode != CL_SUCCESS) {
+                return errorCode;
+            }
+            enqueued++;
+        }
+
+        // A chunk that failed to copy from the device fails the whole copy.
+        unsigned index = (unsigned)(chunk % kSlotCount);
+        size_t offset = chunk * kChunkSize;
+        cl_int errorCode = _wait_slot(ring, index);
+        if (errorCode != CL_SUCCESS) {
+            return errorCode;
+        }
+        memcpy(dst_ptr + offset, ring->base + index * kChunkSize,
+            std::min(kChunkSize, size - offset));
+    }
+    return CL_SUCCESS;
+}
+
+bool openclext_usm_staging_memcpy(
+    openclext_enqueue_memcpy_fn enqueueMemcpy,
+    cl_command_queue command_queue,
+    cl_bool blocking,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event,
+    cl_int* status)
+{
+    if (size < kStagingThreshold || dst_ptr == nullptr || src_ptr == nullptr) {
+        return false;
+    }
+
+    cl_context context = nullptr;
+    CLEXT_COUNT_ICD_CALL();
+    if (clGetCommandQueueInfo(command_queue, CL_QUEUE_CONTEXT,
+            sizeof(context), &context, nullptr) != CL_SUCCESS) {
+        return false;
+    }
+
+    // Only copies between pageable memory and device memory are staged.
+    // Copies to pageable memory are only staged if they are blocking, since
+    // the data is copied out of the staging memory on the host.
+    bool upload = false;
+    cl_unified_shared_memory_type_intel srcType = _get_type(context, src_ptr);
+    if (srcType == CL_MEM_TYPE_UNKNOWN_INTEL) {
+        if (_get_type(context, dst_ptr) != CL_MEM_TYPE_DEVICE_INTEL) {
+            return false;
+        }
+        upload = true;
+    } else if (srcType != CL_MEM_TYPE_DEVICE_INTEL || !blocking ||
+        _get_type(context, dst_ptr) != CL_MEM_TYPE_UNKNOWN_INTEL) {
+        return false;
+    }
+
+    openclext_staging_ring* ring = _get_ring(context);
+    if (ring == nullptr) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(ring->lock);
+
+    std::vector<cl_event> events;
+    cl_int errorCode = upload ?
+        _stage_upload(enqueueMemcpy, ring, command_queue,
+            (char*)dst_ptr, (const char*)src_ptr, size,
+            num_events_in_wait_list, event_wait_list, events) :
+        _stage_download(enqueueMemcpy, ring, command_queue,
+            (char*)dst_ptr, (const char*)src_ptr, size,
+            num_events_in_wait_list, event_wait_list, events);
+
+    if (errorCode == CL_SUCCESS && blocking && upload) {
+        errorCode = clWaitForEvents((cl_uint)events.size(), events.data());
+    }
+    if (errorCode == CL_SUCCESS && event) {
+        errorCode = clEnqueueMarkerWithWaitList(command_queue,
+            (cl_uint)events.size(), events.data(), event);
+    }
+    for (auto chunkEvent : events) {
+        clReleaseEvent(chunkEvent);
+    }
+
+    *status = errorCode;
+    return true;
+}
@@ -0,0 +1,51 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_USM_STAGING_H_
+#define OPENCLEXT_USM_STAGING_H_
+
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+
+#include <stddef.h>
+
+// Copies between pageable host memory and device USM through a ring of host
+// USM staging chunks for each context.  Large copies are split into chunks:
+// for copies from pageable memory, each chunk is copied into the ring on the
+// host while the previous chunks are copied to the device, and for blocking
+// copies to pageable memory, each chunk is copied out of the ring on the host
+// while the next chunks are copied from the device.  Uploads wait on the host
+// for the wait list and earlier commands before the source is first read.
+//
+// Pointers are classified with clGetMemAllocInfoINTEL, which is answered by
+// the USM allocation registry for memory allocated through the extension
+// loader.  Memory that is not USM is pageable.
+
+typedef cl_int (CL_API_CALL* openclext_enqueue_memcpy_fn)(
+    cl_command_queue command_queue,
+    cl_bool blocking,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+
+// Returns true and sets status if the copy was staged.  enqueueMemcpy is the
+// clEnqueueMemcpyINTEL from the dispatch table for command_queue.
+bool openclext_usm_staging_memcpy(
+    openclext_enqueue_memcpy_fn enqueueMemcpy,
+    cl_command_queue command_queue,
+    cl_bool blocking,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event,
+    cl_int* status);
+
+#endif // OPENCLEXT_USM_STAGING_H_
@@ -0,0 +1,143 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#include "openclext_usm_stats.h"
+#include "openclext_stats.h"
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+typedef std::tuple<cl_context, cl_device_id, cl_unified_shared_memory_type_intel>
+    openclext_usm_stats_key;
+
+// The statistics are intentionally never destroyed, since extension
+// functions may be called from other static destructors, and the statistics
+// are written when the process exits.
+static std::mutex* _lock = new std::mutex;
+static std::map<openclext_usm_stats_key, clext_usm_stats>* _stats =
+    new std::map<openclext_usm_stats_key, clext_usm_stats>;
+
+static unsigned _get_size_bucket(size_t size)
+{
+    unsigned bucket = 0;
+    uint64_t limit = 64;
+    while (bucket < CLEXT_USM_STATS_SIZE_BUCKET_COUNT - 1 && size > limit) {
+        bucket++;
+        limit <<= 4;
+    }
+    return bucket;
+}
+
+static clext_usm_stats* _get_stats(const openclext_usm_stats_key& key)
+{
+    auto it = _stats->find(key);
+    if (it == _stats->end()) {
+        clext_usm_stats stats;
+        memset(&stats, 0, sizeof(stats));
+        it = _stats->insert(std::make_pair(key, stats)).first;
+    }
+    return &it->second;
+}
+
+void openclext_usm_stats_alloc(
+    const openclext_usm_allocation& allocation)
+{
+    openclext_stats_init();
+
+    std::lock_guard<std::mutex> guard(*_lock);
+
+    clext_usm_stats* stats = _get_stats(openclext_usm_stats_key(
+        allocation.context, allocation.device, allocation.type));
+    stats->live_bytes += allocation.size;
+    stats->high_water_bytes = std::max(stats->high_water_bytes, stats->live_bytes);
+    stats->live_allocations++;
+    stats->total_allocations++;
+    stats->size_buckets[_get_size_bucket(allocation.size)]++;
+}
+
+void openclext_usm_stats_release(
+    const openclext_usm_allocation& allocation,
+    bool freed)
+{
+    std::lock_guard<std::mutex> guard(*_lock);
+
+    clext_usm_stats* stats = _get_stats(openclext_usm_stats_key(
+        allocation.context, allocation.device, allocation.type));
+    stats->live_bytes -= allocation.size;
+    stats->live_allocations--;
+    if (freed) {
+        stats->total_frees++;
+    }
+}
+
+void openclext_usm_stats_get(
+    cl_context context,
+    cl_device_id device,
+    cl_unified_shared_memory_type_intel type,
+    clext_usm_stats* stats)
+{
+    std::lock_guard<std::mutex> guard(*_lock);
+
+    auto it = _stats->find(openclext_usm_stats_key(context, device, type));
+    if (it == _stats->end()) {
+        memset(stats, 0, sizeof(*stats));
+    } else {
+        *stats = it->second;
+    }
+}
+
+static const char* _get_type_name(cl_unified_shared_memory_type_intel type)
+{
+    switch (type) {
+    case CL_MEM_TYPE_HOST_INTEL: return "Host";
+    case CL_MEM_TYPE_DEVICE_INTEL: return "Device";
+    case CL_MEM_TYPE_SHARED_INTEL: return "Shared";
+    default: return "Unknown";
+    }
+}
+
+void openclext_usm_stats_dump(FILE* stream)
+{
+    std::map<openclext_usm_stats_key, clext_usm_stats> snapshot;
+    {
+        std::lock_guard<std::mutex> guard(*_lock);
+        snapshot = *_stats;
+    }
+    if (snapshot.empty()) {
+        return;
+    }
+
+    fprintf(stream, "USM Allocations by Context, Device, and Type:\n");
+    fprintf(stream,
+        "%-20s %-20s %-8s %10s %14s %14s %10s %10s %8s %8s %8s %8s %8s %8s %8s\n",
+        "Context", "Device", "Type", "Live", "Live Bytes", "High Water",
+        "Allocs", "Frees",
+        "<=64B", "<=1KB", "<=16KB", "<=256KB", "<=4MB", "<=64MB", ">64MB");
+    for (const auto& entry : snapshot) {
+        const clext_usm_stats& stats = entry.second;
+        fprintf(stream,
+            "0x%-18" PRIxPTR " 0x%-18" PRIxPTR " %-8s %10" PRIu64 " %14" PRIu64
+            " %14" PRIu64 " %10" PRIu64 " %10" PRIu64,
+            (uintptr_t)std::get<0>(entry.first),
+            (uintptr_t)std::get<1>(entry.first),
+            _get_type_name(std::get<2>(entry.first)),
+            (uint64_t)stats.live_allocations,
+            (uint64_t)stats.live_bytes,
+            (uint64_t)stats.high_water_bytes,
+            (uint64_t)stats.total_allocations,
+            (uint64_t)stats.total_frees);
+        for (unsigned b = 0; b < CLEXT_USM_STATS_SIZE_BUCKET_COUNT; b++) {
+            fprintf(stream, " %8" PRIu64, (uint64_t)stats.size_buckets[b]);
+        }
+        fprintf(stream, "\n");
+    }
+}
@@ -0,0 +1,44 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef OPENCLEXT_USM_STATS_H_
+#define OPENCLEXT_USM_STATS_H_
+
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include "openclext.h"
+#include "openclext_usm_registry.h"
+
+// Statistics for the unified shared memory allocated by the extension
+// functions, for each context, device, and type of USM.
+//
+// Allocations are recorded in the USM allocation registry, so the size of an
+// allocation is known when it is freed, and frees are only counted when they
+// succeed.  Statistics for a context are kept after the context is destroyed,
+// so allocations that were never freed are reported when the statistics are
+// written.  Memory allocated by the USM pool is accounted as the allocations
+// the pool makes, not the allocations carved from them.
+
+void openclext_usm_stats_alloc(
+    const openclext_usm_allocation& allocation);
+
+// Called when an allocation is freed, or with freed set to false when an
+// allocation is no longer live because it was never freed.
+void openclext_usm_stats_release(
+    const openclext_usm_allocation& allocation,
+    bool freed);
+void openclext_usm_stats_get(
+    cl_context context,
+    cl_device_id device,
+    cl_unified_shared_memory_type_intel type,
+    clext_usm_stats* stats);
+void openclext_usm_stats_dump(FILE* stream);
+
+#endif // OPENCLEXT_USM_STATS_H_
@@ -0,0 +1,547 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+/*
+// This file is generated from the Khronos OpenCL XML API Registry.
+//
+// It contains the cl_arm_shared_virtual_memory extension functions, for builds that split the
+// OpenCL Extension Loader into one translation unit per extension.
+*/
+
+// clang-format off
+
+
+#if defined _WIN32 || defined __CYGWIN__
+    #ifdef __GNUC__
+        #define CL_API_ENTRY __attribute__((dllexport))
+    #else
+        #define CL_API_ENTRY __declspec(dllexport)
+    #endif
+#else
+    #if __GNUC__ >= 4
+        #define CL_API_ENTRY __attribute__((visibility("default")))
+    #else
+        #define CL_API_ENTRY
+    #endif
+#endif
+
+#define CL_USE_DEPRECATED_OPENCL_1_0_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_1_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_2_0_APIS
+#define CL_USE_DEPRECATED_OPENCL_2_1_APIS
+#define CL_USE_DEPRECATED_OPENCL_2_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_3_0_APIS
+
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+#if defined(CLEXT_INCLUDE_GL)
+#include <CL/cl_gl.h>
+// Some versions of the headers to not define cl_khr_gl_event.
+#ifndef cl_khr_gl_event
+#define cl_khr_gl_event 1
+#endif
+#endif
+#if defined(CLEXT_INCLUDE_EGL)
+#include <CL/cl_egl.h>
+#endif
+#if defined(CLEXT_INCLUDE_DX9)
+#include <CL/cl_dx9_media_sharing.h>
+#endif
+// Note: If both D3D10 and D3D11 are supported, the D3D11 header must be
+// included first.
+#if defined(CLEXT_INCLUDE_D3D11)
+#include <CL/cl_d3d11.h>
+#endif
+#if defined(CLEXT_INCLUDE_D3D10)
+#include <CL/cl_d3d10.h>
+#endif
+#if defined(CLEXT_INCLUDE_VA_API)
+#include <CL/cl_va_api_media_sharing_intel.h>
+#endif
+
+#include <stdlib.h>
+
+#include <vector>
+
+#include "openclext_hooks.h"
+#include "openclext_platform.h"
+#include "openclext_resolution.h"
+#include "openclext_split.h"
+
+#if defined(cl_arm_shared_virtual_memory)
+
+/***************************************************************
+* Function Pointer Typedefs
+***************************************************************/
+
+typedef void* (CL_API_CALL* clSVMAllocARM_clextfn)(
+    cl_context context,
+    cl_svm_mem_flags_arm flags,
+    size_t size,
+    cl_uint alignment);
+
+typedef void (CL_API_CALL* clSVMFreeARM_clextfn)(
+    cl_context context,
+    void* svm_pointer);
+
+typedef cl_int (CL_API_CALL* clEnqueueSVMFreeARM_clextfn)(
+    cl_command_queue command_queue,
+    cl_uint num_svm_pointers,
+    void* svm_pointers[],
+    void (CL_CALLBACK* pfn_free_func)(cl_command_queue queue, cl_uint num_svm_pointers, void * svm_pointers[], void *user_data),
+    void* user_data,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+
+typedef cl_int (CL_API_CALL* clEnqueueSVMMemcpyARM_clextfn)(
+    cl_command_queue command_queue,
+    cl_bool blocking_copy,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+
+typedef cl_int (CL_API_CALL* clEnqueueSVMMemFillARM_clextfn)(
+    cl_command_queue command_queue,
+    void* svm_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+
+typedef cl_int (CL_API_CALL* clEnqueueSVMMapARM_clextfn)(
+    cl_command_queue command_queue,
+    cl_bool blocking_map,
+    cl_map_flags flags,
+    void* svm_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+
+typedef cl_int (CL_API_CALL* clEnqueueSVMUnmapARM_clextfn)(
+    cl_command_queue command_queue,
+    void* svm_ptr,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+
+typedef cl_int (CL_API_CALL* clSetKernelArgSVMPointerARM_clextfn)(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    const void* arg_value);
+
+typedef cl_int (CL_API_CALL* clSetKernelExecInfoARM_clextfn)(
+    cl_kernel kernel,
+    cl_kernel_exec_info_arm param_name,
+    size_t param_value_size,
+    const void* param_value);
+
+/***************************************************************
+* Extension Function Pointer Dispatch Table
+***************************************************************/
+
+// Each translation unit has its own dispatch table type.
+namespace {
+
+struct openclext_dispatch_table {
+    cl_platform_id platform;
+
+    clSVMAllocARM_clextfn clSVMAllocARM;
+    clSVMFreeARM_clextfn clSVMFreeARM;
+    clEnqueueSVMFreeARM_clextfn clEnqueueSVMFreeARM;
+    clEnqueueSVMMemcpyARM_clextfn clEnqueueSVMMemcpyARM;
+    clEnqueueSVMMemFillARM_clextfn clEnqueueSVMMemFillARM;
+    clEnqueueSVMMapARM_clextfn clEnqueueSVMMapARM;
+    clEnqueueSVMUnmapARM_clextfn clEnqueueSVMUnmapARM;
+    clSetKernelArgSVMPointerARM_clextfn clSetKernelArgSVMPointerARM;
+    clSetKernelExecInfoARM_clextfn clSetKernelExecInfoARM;
+};
+
+} // anonymous namespace
+
+/***************************************************************
+* Dispatch Table Initialization
+***************************************************************/
+
+static void _init(cl_platform_id platform, openclext_dispatch_table* dispatch_ptr)
+{
+    dispatch_ptr->platform = platform;
+
+    openclext_resolution* resolution = openclext_resolution_begin(platform);
+
+#define CLEXT_GET_EXTENSION(_funcname)                                         \
+    {                                                                          \
+        uint64_t start_ns = openclext_now_ns();                                \
+        CLEXT_COUNT_ICD_CALL();                                                \
+        dispatch_ptr->_funcname =                                              \
+            (_funcname##_clextfn)clGetExtensionFunctionAddressForPlatform(     \
+                platform, #_funcname);                                         \
+        openclext_resolution_record(                                           \
+            resolution, #_funcname, (void*)dispatch_ptr->_funcname, start_ns); \
+    }
+
+    CLEXT_GET_EXTENSION(clSVMAllocARM);
+    CLEXT_GET_EXTENSION(clSVMFreeARM);
+    CLEXT_GET_EXTENSION(clEnqueueSVMFreeARM);
+    CLEXT_GET_EXTENSION(clEnqueueSVMMemcpyARM);
+    CLEXT_GET_EXTENSION(clEnqueueSVMMemFillARM);
+    CLEXT_GET_EXTENSION(clEnqueueSVMMapARM);
+    CLEXT_GET_EXTENSION(clEnqueueSVMUnmapARM);
+    CLEXT_GET_EXTENSION(clSetKernelArgSVMPointerARM);
+    CLEXT_GET_EXTENSION(clSetKernelExecInfoARM);
+
+#undef CLEXT_GET_EXTENSION
+
+    openclext_resolution_end(resolution);
+}
+
+#if defined(CLEXT_SINGLE_PLATFORM_ONLY)
+
+static openclext_dispatch_table _dispatch = {};
+static openclext_dispatch_table* _dispatch_ptr = nullptr;
+
+// The platform is shared by all translation units, so the dispatch table may
+// be initialized even if the platform cannot be found from the object.
+static inline openclext_dispatch_table* _init_dispatch(cl_platform_id platform)
+{
+    if (_dispatch_ptr == nullptr) {
+        platform = openclext_split_get_single_platform(platform);
+        if (platform == nullptr) {
+            return nullptr;
+        }
+        _init(platform, &_dispatch);
+        _dispatch_ptr = &_dispatch;
+    }
+
+    return _dispatch_ptr;
+}
+
+template<typename T>
+static inline openclext_dispatch_table* _get_dispatch(T object)
+{
+    if (object == nullptr) return nullptr;
+
+    if (_dispatch_ptr == nullptr) {
+        return _init_dispatch(_get_platform(object));
+    }
+
+    return _dispatch_ptr;
+}
+
+#else // defined(CLEXT_SINGLE_PLATFORM_ONLY)
+
+static size_t _num_platforms = 0;
+static openclext_dispatch_table* _dispatch_array = nullptr;
+
+// The platforms are shared by all translation units, so the dispatch tables
+// may be initialized without an object.
+static inline void _init_dispatch(void)
+{
+    if (_num_platforms == 0 && _dispatch_array == nullptr) {
+        size_t numPlatforms = 0;
+        const cl_platform_id* platforms =
+            openclext_split_get_platforms(&numPlatforms);
+        if (numPlatforms == 0) {
+            return;
+        }
+
+        openclext_dispatch_table* dispatch =
+            (openclext_dispatch_table*)malloc(
+                numPlatforms * sizeof(openclext_dispatch_table));
+        if (dispatch == nullptr) {
+            return;
+        }
+
+        for (size_t i = 0; i < numPlatforms; i++) {
+            _init(platforms[i], dispatch + i);
+        }
+
+        _num_platforms = numPlatforms;
+        _dispatch_array = dispatch;
+    }
+}
+
+template<typename T>
+static inline openclext_dispatch_table* _get_dispatch(T object)
+{
+    _init_dispatch();
+
+    cl_platform_id platform = _get_platform(object);
+    for (size_t i = 0; i < _num_platforms; i++) {
+        openclext_dispatch_table* dispatch_ptr =
+            _dispatch_array + i;
+        if (dispatch_ptr->platform == platform) {
+            return dispatch_ptr;
+        }
+    }
+
+    return nullptr;
+}
+
+#endif // defined(CLEXT_SINGLE_PLATFORM_ONLY)
+
+static inline cl_platform_id _get_dispatch_platform(const openclext_dispatch_table* dispatch_ptr)
+{
+    return dispatch_ptr ? dispatch_ptr->platform : nullptr;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+* Extension Functions
+***************************************************************/
+
+CL_API_ENTRY void* CL_API_CALL clSVMAllocARM(
+    cl_context context,
+    cl_svm_mem_flags_arm flags,
+    size_t size,
+    cl_uint alignment)
+{
+    CLEXT_CALL_BEGIN(clSVMAllocARM, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_DISPATCH(clSVMAllocARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clSVMAllocARM == nullptr) {
+        CLEXT_CALL_MISSING(clSVMAllocARM, dispatch_ptr);
+        return nullptr;
+    }
+    void* retVal = dispatch_ptr->clSVMAllocARM(
+        context,
+        flags,
+        size,
+        alignment);
+    CLEXT_CALL_ARGS(clSVMAllocARM, retVal ? CL_SUCCESS : CL_OUT_OF_RESOURCES, size, context, flags, size, alignment);
+    CLEXT_CALL_END(clSVMAllocARM, retVal ? CL_SUCCESS : CL_OUT_OF_RESOURCES);
+    return retVal;
+}
+
+CL_API_ENTRY void CL_API_CALL clSVMFreeARM(
+    cl_context context,
+    void* svm_pointer)
+{
+    CLEXT_CALL_BEGIN(clSVMFreeARM, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_DISPATCH(clSVMFreeARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clSVMFreeARM == nullptr) {
+        CLEXT_CALL_MISSING(clSVMFreeARM, dispatch_ptr);
+        return;
+    }
+    dispatch_ptr->clSVMFreeARM(
+        context,
+        svm_pointer);
+    CLEXT_CALL_ARGS(clSVMFreeARM, CL_SUCCESS, 0, context, svm_pointer);
+    CLEXT_CALL_END(clSVMFreeARM, CL_SUCCESS);
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSVMFreeARM(
+    cl_command_queue command_queue,
+    cl_uint num_svm_pointers,
+    void* svm_pointers[],
+    void (CL_CALLBACK* pfn_free_func)(cl_command_queue queue, cl_uint num_svm_pointers, void * svm_pointers[], void *user_data),
+    void* user_data,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueSVMFreeARM, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueSVMFreeARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueSVMFreeARM == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueSVMFreeARM, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueSVMFreeARM(
+        command_queue,
+        num_svm_pointers,
+        svm_pointers,
+        pfn_free_func,
+        user_data,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueSVMFreeARM, retVal, 0, command_queue, num_svm_pointers, svm_pointers, pfn_free_func, user_data, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueSVMFreeARM, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSVMMemcpyARM(
+    cl_command_queue command_queue,
+    cl_bool blocking_copy,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueSVMMemcpyARM, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueSVMMemcpyARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueSVMMemcpyARM == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueSVMMemcpyARM, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueSVMMemcpyARM(
+        command_queue,
+        blocking_copy,
+        dst_ptr,
+        src_ptr,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueSVMMemcpyARM, retVal, size, command_queue, blocking_copy, dst_ptr, src_ptr, size, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_TRANSFER(clEnqueueSVMMemcpyARM, command_queue, dispatch_ptr, size, retVal);
+    CLEXT_CALL_END(clEnqueueSVMMemcpyARM, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSVMMemFillARM(
+    cl_command_queue command_queue,
+    void* svm_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueSVMMemFillARM, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueSVMMemFillARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueSVMMemFillARM == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueSVMMemFillARM, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueSVMMemFillARM(
+        command_queue,
+        svm_ptr,
+        pattern,
+        pattern_size,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueSVMMemFillARM, retVal, size, command_queue, svm_ptr, pattern, pattern_size, size, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueSVMMemFillARM, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSVMMapARM(
+    cl_command_queue command_queue,
+    cl_bool blocking_map,
+    cl_map_flags flags,
+    void* svm_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueSVMMapARM, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueSVMMapARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueSVMMapARM == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueSVMMapARM, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueSVMMapARM(
+        command_queue,
+        blocking_map,
+        flags,
+        svm_ptr,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueSVMMapARM, retVal, size, command_queue, blocking_map, flags, svm_ptr, size, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueSVMMapARM, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSVMUnmapARM(
+    cl_command_queue command_queue,
+    void* svm_ptr,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueSVMUnmapARM, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueSVMUnmapARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueSVMUnmapARM == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueSVMUnmapARM, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueSVMUnmapARM(
+        command_queue,
+        svm_ptr,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueSVMUnmapARM, retVal, 0, command_queue, svm_ptr, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueSVMUnmapARM, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clSetKernelArgSVMPointerARM(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    const void* arg_value)
+{
+    CLEXT_CALL_BEGIN(clSetKernelArgSVMPointerARM, kernel);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(kernel);
+    CLEXT_CALL_DISPATCH(clSetKernelArgSVMPointerARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clSetKernelArgSVMPointerARM == nullptr) {
+        CLEXT_CALL_MISSING(clSetKernelArgSVMPointerARM, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clSetKernelArgSVMPointerARM(
+        kernel,
+        arg_index,
+        arg_value);
+    CLEXT_CALL_ARGS(clSetKernelArgSVMPointerARM, retVal, 0, kernel, arg_index, arg_value);
+    CLEXT_CALL_END(clSetKernelArgSVMPointerARM, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clSetKernelExecInfoARM(
+    cl_kernel kernel,
+    cl_kernel_exec_info_arm param_name,
+    size_t param_value_size,
+    const void* param_value)
+{
+    CLEXT_CALL_BEGIN(clSetKernelExecInfoARM, kernel);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(kernel);
+    CLEXT_CALL_DISPATCH(clSetKernelExecInfoARM, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clSetKernelExecInfoARM == nullptr) {
+        CLEXT_CALL_MISSING(clSetKernelExecInfoARM, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clSetKernelExecInfoARM(
+        kernel,
+        param_name,
+        param_value_size,
+        param_value);
+    CLEXT_CALL_ARGS(clSetKernelExecInfoARM, retVal, param_value_size, kernel, param_name, param_value_size, param_value);
+    CLEXT_CALL_END(clSetKernelExecInfoARM, retVal);
+    return retVal;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#else
+#pragma message("Define for cl_arm_shared_virtual_memory was not found!  Please update your headers.")
+#endif // defined(cl_arm_shared_virtual_memory)
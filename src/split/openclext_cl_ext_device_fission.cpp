@@ -0,0 +1,304 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+/*
+// This file is generated from the Khronos OpenCL XML API Registry.
+//
+// It contains the cl_ext_device_fission extension functions, for builds that split the
+// OpenCL Extension Loader into one translation unit per extension.
+*/
+
+// clang-format off
+
+
+#if defined _WIN32 || defined __CYGWIN__
+    #ifdef __GNUC__
+        #define CL_API_ENTRY __attribute__((dllexport))
+    #else
+        #define CL_API_ENTRY __declspec(dllexport)
+    #endif
+#else
+    #if __GNUC__ >= 4
+        #define CL_API_ENTRY __attribute__((visibility("default")))
+    #else
+        #define CL_API_ENTRY
+    #endif
+#endif
+
+#define CL_USE_DEPRECATED_OPENCL_1_0_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_1_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_2_0_APIS
+#define CL_USE_DEPRECATED_OPENCL_2_1_APIS
+#define CL_USE_DEPRECATED_OPENCL_2_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_3_0_APIS
+
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+#if defined(CLEXT_INCLUDE_GL)
+#include <CL/cl_gl.h>
+// Some versions of the headers to not define cl_khr_gl_event.
+#ifndef cl_khr_gl_event
+#define cl_khr_gl_event 1
+#endif
+#endif
+#if defined(CLEXT_INCLUDE_EGL)
+#include <CL/cl_egl.h>
+#endif
+#if defined(CLEXT_INCLUDE_DX9)
+#include <CL/cl_dx9_media_sharing.h>
+#endif
+// Note: If both D3D10 and D3D11 are supported, the D3D11 header must be
+// included first.
+#if defined(CLEXT_INCLUDE_D3D11)
+#include <CL/cl_d3d11.h>
+#endif
+#if defined(CLEXT_INCLUDE_D3D10)
+#include <CL/cl_d3d10.h>
+#endif
+#if defined(CLEXT_INCLUDE_VA_API)
+#include <CL/cl_va_api_media_sharing_intel.h>
+#endif
+
+#include <stdlib.h>
+
+#include <vector>
+
+#include "openclext_hooks.h"
+#include "openclext_platform.h"
+#include "openclext_resolution.h"
+#include "openclext_split.h"
+
+#if defined(cl_ext_device_fission)
+
+/***************************************************************
+* Function Pointer Typedefs
+***************************************************************/
+
+typedef cl_int (CL_API_CALL* clReleaseDeviceEXT_clextfn)(
+    cl_device_id device);
+
+typedef cl_int (CL_API_CALL* clRetainDeviceEXT_clextfn)(
+    cl_device_id device);
+
+typedef cl_int (CL_API_CALL* clCreateSubDevicesEXT_clextfn)(
+    cl_device_id in_device,
+    const cl_device_partition_property_ext* properties,
+    cl_uint num_entries,
+    cl_device_id* out_devices,
+    cl_uint* num_devices);
+
+/***************************************************************
+* Extension Function Pointer Dispatch Table
+***************************************************************/
+
+// Each translation unit has its own dispatch table type.
+namespace {
+
+struct openclext_dispatch_table {
+    cl_platform_id platform;
+
+    clReleaseDeviceEXT_clextfn clReleaseDeviceEXT;
+    clRetainDeviceEXT_clextfn clRetainDeviceEXT;
+    clCreateSubDevicesEXT_clextfn clCreateSubDevicesEXT;
+};
+
+} // anonymous namespace
+
+/***************************************************************
+* Dispatch Table Initialization
+***************************************************************/
+
+static void _init(cl_platform_id platform, openclext_dispatch_table* dispatch_ptr)
+{
+    dispatch_ptr->platform = platform;
+
+    openclext_resolution* resolution = openclext_resolution_begin(platform);
+
+#define CLEXT_GET_EXTENSION(_funcname)                                         \
+    {                                                                          \
+        uint64_t start_ns = openclext_now_ns();                                \
+        CLEXT_COUNT_ICD_CALL();                                                \
+        dispatch_ptr->_funcname =                                              \
+            (_funcname##_clextfn)clGetExtensionFunctionAddressForPlatform(     \
+                platform, #_funcname);                                         \
+        openclext_resolution_record(                                           \
+            resolution, #_funcname, (void*)dispatch_ptr->_funcname, start_ns); \
+    }
+
+    CLEXT_GET_EXTENSION(clReleaseDeviceEXT);
+    CLEXT_GET_EXTENSION(clRetainDeviceEXT);
+    CLEXT_GET_EXTENSION(clCreateSubDevicesEXT);
+
+#undef CLEXT_GET_EXTENSION
+
+    openclext_resolution_end(resolution);
+}
+
+#if defined(CLEXT_SINGLE_PLATFORM_ONLY)
+
+static openclext_dispatch_table _dispatch = {};
+static openclext_dispatch_table* _dispatch_ptr = nullptr;
+
+// The platform is shared by all translation units, so the dispatch table may
+// be initialized even if the platform cannot be found from the object.
+static inline openclext_dispatch_table* _init_dispatch(cl_platform_id platform)
+{
+    if (_dispatch_ptr == nullptr) {
+        platform = openclext_split_get_single_platform(platform);
+        if (platform == nullptr) {
+            return nullptr;
+        }
+        _init(platform, &_dispatch);
+        _dispatch_ptr = &_dispatch;
+    }
+
+    return _dispatch_ptr;
+}
+
+template<typename T>
+static inline openclext_dispatch_table* _get_dispatch(T object)
+{
+    if (object == nullptr) return nullptr;
+
+    if (_dispatch_ptr == nullptr) {
+        return _init_dispatch(_get_platform(object));
+    }
+
+    return _dispatch_ptr;
+}
+
+#else // defined(CLEXT_SINGLE_PLATFORM_ONLY)
+
+static size_t _num_platforms = 0;
+static openclext_dispatch_table* _dispatch_array = nullptr;
+
+// The platforms are shared by all translation units, so the dispatch tables
+// may be initialized without an object.
+static inline void _init_dispatch(void)
+{
+    if (_num_platforms == 0 && _dispatch_array == nullptr) {
+        size_t numPlatforms = 0;
+        const cl_platform_id* platforms =
+            openclext_split_get_platforms(&numPlatforms);
+        if (numPlatforms == 0) {
+            return;
+        }
+
+        openclext_dispatch_table* dispatch =
+            (openclext_dispatch_table*)malloc(
+                numPlatforms * sizeof(openclext_dispatch_table));
+        if (dispatch == nullptr) {
+            return;
+        }
+
+        for (size_t i = 0; i < numPlatforms; i++) {
+            _init(platforms[i], dispatch + i);
+        }
+
+        _num_platforms = numPlatforms;
+        _dispatch_array = dispatch;
+    }
+}
+
+template<typename T>
+static inline openclext_dispatch_table* _get_dispatch(T object)
+{
+    _init_dispatch();
+
+    cl_platform_id platform = _get_platform(object);
+    for (size_t i = 0; i < _num_platforms; i++) {
+        openclext_dispatch_table* dispatch_ptr =
+            _dispatch_array + i;
+        if (dispatch_ptr->platform == platform) {
+            return dispatch_ptr;
+        }
+    }
+
+    return nullptr;
+}
+
+#endif // defined(CLEXT_SINGLE_PLATFORM_ONLY)
+
+static inline cl_platform_id _get_dispatch_platform(const openclext_dispatch_table* dispatch_ptr)
+{
+    return dispatch_ptr ? dispatch_ptr->platform : nullptr;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+* Extension Functions
+***************************************************************/
+
+CL_API_ENTRY cl_int CL_API_CALL clReleaseDeviceEXT(
+    cl_device_id device)
+{
+    CLEXT_CALL_BEGIN(clReleaseDeviceEXT, device);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(device);
+    CLEXT_CALL_DISPATCH(clReleaseDeviceEXT, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clReleaseDeviceEXT == nullptr) {
+        CLEXT_CALL_MISSING(clReleaseDeviceEXT, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clReleaseDeviceEXT(
+        device);
+    CLEXT_CALL_ARGS(clReleaseDeviceEXT, retVal, 0, device);
+    CLEXT_CALL_END(clReleaseDeviceEXT, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clRetainDeviceEXT(
+    cl_device_id device)
+{
+    CLEXT_CALL_BEGIN(clRetainDeviceEXT, device);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(device);
+    CLEXT_CALL_DISPATCH(clRetainDeviceEXT, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clRetainDeviceEXT == nullptr) {
+        CLEXT_CALL_MISSING(clRetainDeviceEXT, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clRetainDeviceEXT(
+        device);
+    CLEXT_CALL_ARGS(clRetainDeviceEXT, retVal, 0, device);
+    CLEXT_CALL_END(clRetainDeviceEXT, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clCreateSubDevicesEXT(
+    cl_device_id in_device,
+    const cl_device_partition_property_ext* properties,
+    cl_uint num_entries,
+    cl_device_id* out_devices,
+    cl_uint* num_devices)
+{
+    CLEXT_CALL_BEGIN(clCreateSubDevicesEXT, in_device);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(in_device);
+    CLEXT_CALL_DISPATCH(clCreateSubDevicesEXT, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateSubDevicesEXT == nullptr) {
+        CLEXT_CALL_MISSING(clCreateSubDevicesEXT, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clCreateSubDevicesEXT(
+        in_device,
+        properties,
+        num_entries,
+        out_devices,
+        num_devices);
+    CLEXT_CALL_ARGS(clCreateSubDevicesEXT, retVal, 0, in_device, properties, num_entries, out_devices, num_devices);
+    CLEXT_CALL_END(clCreateSubDevicesEXT, retVal);
+    return retVal;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#else
+#pragma message("Define for cl_ext_device_fission was not found!  Please update your headers.")
+#endif // defined(cl_ext_device_fission)
@@ -0,0 +1,716 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+/*
+// This file is generated from the Khronos OpenCL XML API Registry.
+//
+// It contains the cl_intel_unified_shared_memory extension functions, for builds that split the
+// OpenCL Extension Loader into one translation unit per extension.
+*/
+
+// clang-format off
+
+
+#if defined _WIN32 || defined __CYGWIN__
+    #ifdef __GNUC__
+        #define CL_API_ENTRY __attribute__((dllexport))
+    #else
+        #define CL_API_ENTRY __declspec(dllexport)
+    #endif
+#else
+    #if __GNUC__ >= 4
+        #define CL_API_ENTRY __attribute__((visibility("default")))
+    #else
+        #define CL_API_ENTRY
+    #endif
+#endif
+
+#define CL_USE_DEPRECATED_OPENCL_1_0_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_1_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_2_0_APIS
+#define CL_USE_DEPRECATED_OPENCL_2_1_APIS
+#define CL_USE_DEPRECATED_OPENCL_2_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_3_0_APIS
+
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+#if defined(CLEXT_INCLUDE_GL)
+#include <CL/cl_gl.h>
+// Some versions of the headers to not define cl_khr_gl_event.
+#ifndef cl_khr_gl_event
+#define cl_khr_gl_event 1
+#endif
+#endif
+#if defined(CLEXT_INCLUDE_EGL)
+#include <CL/cl_egl.h>
+#endif
+#if defined(CLEXT_INCLUDE_DX9)
+#include <CL/cl_dx9_media_sharing.h>
+#endif
+// Note: If both D3D10 and D3D11 are supported, the D3D11 header must be
+// included first.
+#if defined(CLEXT_INCLUDE_D3D11)
+#include <CL/cl_d3d11.h>
+#endif
+#if defined(CLEXT_INCLUDE_D3D10)
+#include <CL/cl_d3d10.h>
+#endif
+#if defined(CLEXT_INCLUDE_VA_API)
+#include <CL/cl_va_api_media_sharing_intel.h>
+#endif
+
+#include <stdlib.h>
+
+#include <vector>
+
+#include "openclext_hooks.h"
+#include "openclext_platform.h"
+#include "openclext_resolution.h"
+#include "openclext_split.h"
+
+#if defined(cl_intel_unified_shared_memory)
+
+/***************************************************************
+* Function Pointer Typedefs
+***************************************************************/
+
+typedef void* (CL_API_CALL* clHostMemAllocINTEL_clextfn)(
+    cl_context context,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret);
+
+typedef void* (CL_API_CALL* clDeviceMemAllocINTEL_clextfn)(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret);
+
+typedef void* (CL_API_CALL* clSharedMemAllocINTEL_clextfn)(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret);
+
+typedef cl_int (CL_API_CALL* clMemFreeINTEL_clextfn)(
+    cl_context context,
+    void* ptr);
+
+typedef cl_int (CL_API_CALL* clMemBlockingFreeINTEL_clextfn)(
+    cl_context context,
+    void* ptr);
+
+typedef cl_int (CL_API_CALL* clGetMemAllocInfoINTEL_clextfn)(
+    cl_context context,
+    const void* ptr,
+    cl_mem_info_intel param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret);
+
+typedef cl_int (CL_API_CALL* clSetKernelArgMemPointerINTEL_clextfn)(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    const void* arg_value);
+
+typedef cl_int (CL_API_CALL* clEnqueueMemFillINTEL_clextfn)(
+    cl_command_queue command_queue,
+    void* dst_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+
+typedef cl_int (CL_API_CALL* clEnqueueMemcpyINTEL_clextfn)(
+    cl_command_queue command_queue,
+    cl_bool blocking,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+
+typedef cl_int (CL_API_CALL* clEnqueueMemAdviseINTEL_clextfn)(
+    cl_command_queue command_queue,
+    const void* ptr,
+    size_t size,
+    cl_mem_advice_intel advice,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+
+#if defined(CL_VERSION_1_2)
+
+typedef cl_int (CL_API_CALL* clEnqueueMigrateMemINTEL_clextfn)(
+    cl_command_queue command_queue,
+    const void* ptr,
+    size_t size,
+    cl_mem_migration_flags flags,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+
+#endif // defined(CL_VERSION_1_2)
+
+typedef cl_int (CL_API_CALL* clEnqueueMemsetINTEL_clextfn)(
+    cl_command_queue command_queue,
+    void* dst_ptr,
+    cl_int value,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+
+/***************************************************************
+* Extension Function Pointer Dispatch Table
+***************************************************************/
+
+// Each translation unit has its own dispatch table type.
+namespace {
+
+struct openclext_dispatch_table {
+    cl_platform_id platform;
+
+    clHostMemAllocINTEL_clextfn clHostMemAllocINTEL;
+    clDeviceMemAllocINTEL_clextfn clDeviceMemAllocINTEL;
+    clSharedMemAllocINTEL_clextfn clSharedMemAllocINTEL;
+    clMemFreeINTEL_clextfn clMemFreeINTEL;
+    clMemBlockingFreeINTEL_clextfn clMemBlockingFreeINTEL;
+    clGetMemAllocInfoINTEL_clextfn clGetMemAllocInfoINTEL;
+    clSetKernelArgMemPointerINTEL_clextfn clSetKernelArgMemPointerINTEL;
+    clEnqueueMemFillINTEL_clextfn clEnqueueMemFillINTEL;
+    clEnqueueMemcpyINTEL_clextfn clEnqueueMemcpyINTEL;
+    clEnqueueMemAdviseINTEL_clextfn clEnqueueMemAdviseINTEL;
+#if defined(CL_VERSION_1_2)
+    clEnqueueMigrateMemINTEL_clextfn clEnqueueMigrateMemINTEL;
+#endif // defined(CL_VERSION_1_2)
+    clEnqueueMemsetINTEL_clextfn clEnqueueMemsetINTEL;
+};
+
+} // anonymous namespace
+
+/***************************************************************
+* Dispatch Table Initialization
+***************************************************************/
+
+static void _init(cl_platform_id platform, openclext_dispatch_table* dispatch_ptr)
+{
+    dispatch_ptr->platform = platform;
+
+    openclext_resolution* resolution = openclext_resolution_begin(platform);
+
+#define CLEXT_GET_EXTENSION(_funcname)                                         \
+    {                                                                          \
+        uint64_t start_ns = openclext_now_ns();                                \
+        CLEXT_COUNT_ICD_CALL();                                                \
+        dispatch_ptr->_funcname =                                              \
+            (_funcname##_clextfn)clGetExtensionFunctionAddressForPlatform(     \
+                platform, #_funcname);                                         \
+        openclext_resolution_record(                                           \
+            resolution, #_funcname, (void*)dispatch_ptr->_funcname, start_ns); \
+    }
+
+    CLEXT_GET_EXTENSION(clHostMemAllocINTEL);
+    CLEXT_GET_EXTENSION(clDeviceMemAllocINTEL);
+    CLEXT_GET_EXTENSION(clSharedMemAllocINTEL);
+    CLEXT_GET_EXTENSION(clMemFreeINTEL);
+    CLEXT_GET_EXTENSION(clMemBlockingFreeINTEL);
+    CLEXT_GET_EXTENSION(clGetMemAllocInfoINTEL);
+    CLEXT_GET_EXTENSION(clSetKernelArgMemPointerINTEL);
+    CLEXT_GET_EXTENSION(clEnqueueMemFillINTEL);
+    CLEXT_GET_EXTENSION(clEnqueueMemcpyINTEL);
+    CLEXT_GET_EXTENSION(clEnqueueMemAdviseINTEL);
+#if defined(CL_VERSION_1_2)
+    CLEXT_GET_EXTENSION(clEnqueueMigrateMemINTEL);
+#endif // defined(CL_VERSION_1_2)
+    CLEXT_GET_EXTENSION(clEnqueueMemsetINTEL);
+
+#undef CLEXT_GET_EXTENSION
+
+#if defined(CLEXT_ENABLE_USM_EMULATION)
+    // If the platform does not support unified shared memory, emulate it with
+    // SVM.  Either all of the functions are emulated or none of them are,
+    // except clMemBlockingFreeINTEL, which cannot wait for the commands that
+    // use SVM, so it is never emulated.
+    if (dispatch_ptr->clDeviceMemAllocINTEL == nullptr &&
+        openclext_usm_emulation_is_supported(platform)) {
+        dispatch_ptr->clHostMemAllocINTEL = openclext_usm_emulation_clHostMemAllocINTEL;
+        dispatch_ptr->clDeviceMemAllocINTEL = openclext_usm_emulation_clDeviceMemAllocINTEL;
+        dispatch_ptr->clSharedMemAllocINTEL = openclext_usm_emulation_clSharedMemAllocINTEL;
+        dispatch_ptr->clMemFreeINTEL = openclext_usm_emulation_clMemFreeINTEL;
+        dispatch_ptr->clGetMemAllocInfoINTEL = openclext_usm_emulation_clGetMemAllocInfoINTEL;
+        dispatch_ptr->clSetKernelArgMemPointerINTEL = openclext_usm_emulation_clSetKernelArgMemPointerINTEL;
+        dispatch_ptr->clEnqueueMemFillINTEL = openclext_usm_emulation_clEnqueueMemFillINTEL;
+        dispatch_ptr->clEnqueueMemcpyINTEL = openclext_usm_emulation_clEnqueueMemcpyINTEL;
+        dispatch_ptr->clEnqueueMemAdviseINTEL = openclext_usm_emulation_clEnqueueMemAdviseINTEL;
+#if defined(CL_VERSION_1_2)
+        dispatch_ptr->clEnqueueMigrateMemINTEL = openclext_usm_emulation_clEnqueueMigrateMemINTEL;
+#endif // defined(CL_VERSION_1_2)
+        dispatch_ptr->clEnqueueMemsetINTEL = openclext_usm_emulation_clEnqueueMemsetINTEL;
+    }
+#endif // defined(CLEXT_ENABLE_USM_EMULATION)
+
+    openclext_resolution_end(resolution);
+}
+
+#if defined(CLEXT_SINGLE_PLATFORM_ONLY)
+
+static openclext_dispatch_table _dispatch = {};
+static openclext_dispatch_table* _dispatch_ptr = nullptr;
+
+// The platform is shared by all translation units, so the dispatch table may
+// be initialized even if the platform cannot be found from the object.
+static inline openclext_dispatch_table* _init_dispatch(cl_platform_id platform)
+{
+    if (_dispatch_ptr == nullptr) {
+        platform = openclext_split_get_single_platform(platform);
+        if (platform == nullptr) {
+            return nullptr;
+        }
+        _init(platform, &_dispatch);
+        _dispatch_ptr = &_dispatch;
+    }
+
+    return _dispatch_ptr;
+}
+
+template<typename T>
+static inline openclext_dispatch_table* _get_dispatch(T object)
+{
+    if (object == nullptr) return nullptr;
+
+    if (_dispatch_ptr == nullptr) {
+        return _init_dispatch(_get_platform(object));
+    }
+
+    return _dispatch_ptr;
+}
+
+#else // defined(CLEXT_SINGLE_PLATFORM_ONLY)
+
+static size_t _num_platforms = 0;
+static openclext_dispatch_table* _dispatch_array = nullptr;
+
+// The platforms are shared by all translation units, so the dispatch tables
+// may be initialized without an object.
+static inline void _init_dispatch(void)
+{
+    if (_num_platforms == 0 && _dispatch_array == nullptr) {
+        size_t numPlatforms = 0;
+        const cl_platform_id* platforms =
+            openclext_split_get_platforms(&numPlatforms);
+        if (numPlatforms == 0) {
+            return;
+        }
+
+        openclext_dispatch_table* dispatch =
+            (openclext_dispatch_table*)malloc(
+                numPlatforms * sizeof(openclext_dispatch_table));
+        if (dispatch == nullptr) {
+            return;
+        }
+
+        for (size_t i = 0; i < numPlatforms; i++) {
+            _init(platforms[i], dispatch + i);
+        }
+
+        _num_platforms = numPlatforms;
+        _dispatch_array = dispatch;
+    }
+}
+
+template<typename T>
+static inline openclext_dispatch_table* _get_dispatch(T object)
+{
+    _init_dispatch();
+
+    cl_platform_id platform = _get_platform(object);
+    for (size_t i = 0; i < _num_platforms; i++) {
+        openclext_dispatch_table* dispatch_ptr =
+            _dispatch_array + i;
+        if (dispatch_ptr->platform == platform) {
+            return dispatch_ptr;
+        }
+    }
+
+    return nullptr;
+}
+
+#endif // defined(CLEXT_SINGLE_PLATFORM_ONLY)
+
+static inline cl_platform_id _get_dispatch_platform(const openclext_dispatch_table* dispatch_ptr)
+{
+    return dispatch_ptr ? dispatch_ptr->platform : nullptr;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+* Extension Functions
+***************************************************************/
+
+CL_API_ENTRY void* CL_API_CALL clHostMemAllocINTEL(
+    cl_context context,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    CLEXT_CALL_BEGIN(clHostMemAllocINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clHostMemAllocINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clHostMemAllocINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clHostMemAllocINTEL, dispatch_ptr);
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
+    }
+    void* retVal = dispatch_ptr->clHostMemAllocINTEL(
+        context,
+        properties,
+        size,
+        alignment,
+        errcode_ret);
+    CLEXT_CALL_ARGS(clHostMemAllocINTEL, *errcode_ret, size, context, properties, size, alignment, errcode_ret);
+    CLEXT_CALL_USM_ALLOC(context, nullptr, CL_MEM_TYPE_HOST_INTEL, retVal, size);
+    CLEXT_CALL_END(clHostMemAllocINTEL, *errcode_ret);
+    return retVal;
+}
+
+CL_API_ENTRY void* CL_API_CALL clDeviceMemAllocINTEL(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    CLEXT_CALL_BEGIN(clDeviceMemAllocINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clDeviceMemAllocINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clDeviceMemAllocINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clDeviceMemAllocINTEL, dispatch_ptr);
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
+    }
+    void* retVal = dispatch_ptr->clDeviceMemAllocINTEL(
+        context,
+        device,
+        properties,
+        size,
+        alignment,
+        errcode_ret);
+    CLEXT_CALL_ARGS(clDeviceMemAllocINTEL, *errcode_ret, size, context, device, properties, size, alignment, errcode_ret);
+    CLEXT_CALL_USM_ALLOC(context, device, CL_MEM_TYPE_DEVICE_INTEL, retVal, size);
+    CLEXT_CALL_END(clDeviceMemAllocINTEL, *errcode_ret);
+    return retVal;
+}
+
+CL_API_ENTRY void* CL_API_CALL clSharedMemAllocINTEL(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    CLEXT_CALL_BEGIN(clSharedMemAllocINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clSharedMemAllocINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clSharedMemAllocINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clSharedMemAllocINTEL, dispatch_ptr);
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
+    }
+    void* retVal = dispatch_ptr->clSharedMemAllocINTEL(
+        context,
+        device,
+        properties,
+        size,
+        alignment,
+        errcode_ret);
+    CLEXT_CALL_ARGS(clSharedMemAllocINTEL, *errcode_ret, size, context, device, properties, size, alignment, errcode_ret);
+    CLEXT_CALL_USM_ALLOC(context, device, CL_MEM_TYPE_SHARED_INTEL, retVal, size);
+    CLEXT_CALL_END(clSharedMemAllocINTEL, *errcode_ret);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clMemFreeINTEL(
+    cl_context context,
+    void* ptr)
+{
+    CLEXT_CALL_BEGIN(clMemFreeINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_DISPATCH(clMemFreeINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clMemFreeINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clMemFreeINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    CLEXT_CALL_USM_FREE(context, ptr);
+    cl_int retVal = dispatch_ptr->clMemFreeINTEL(
+        context,
+        ptr);
+    CLEXT_CALL_ARGS(clMemFreeINTEL, retVal, 0, context, ptr);
+    CLEXT_CALL_USM_FREE_END(context, ptr, retVal);
+    CLEXT_CALL_END(clMemFreeINTEL, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clMemBlockingFreeINTEL(
+    cl_context context,
+    void* ptr)
+{
+    CLEXT_CALL_BEGIN(clMemBlockingFreeINTEL, context);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_DISPATCH(clMemBlockingFreeINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clMemBlockingFreeINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clMemBlockingFreeINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    CLEXT_CALL_USM_FREE(context, ptr);
+    cl_int retVal = dispatch_ptr->clMemBlockingFreeINTEL(
+        context,
+        ptr);
+    CLEXT_CALL_ARGS(clMemBlockingFreeINTEL, retVal, 0, context, ptr);
+    CLEXT_CALL_USM_FREE_END(context, ptr, retVal);
+    CLEXT_CALL_END(clMemBlockingFreeINTEL, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clGetMemAllocInfoINTEL(
+    cl_context context,
+    const void* ptr,
+    cl_mem_info_intel param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    CLEXT_CALL_BEGIN(clGetMemAllocInfoINTEL, context);
+    // Queries answered by the USM allocation registry skip finding the
+    // dispatch table, but still reach the end-of-call hooks.
+    cl_int retVal = CL_SUCCESS;
+    struct openclext_dispatch_table* dispatch_ptr = nullptr;
+    if (CLEXT_CALL_USM_INFO(context, ptr, param_name, param_value_size, param_value, param_value_size_ret, &retVal)) goto call_end;
+    dispatch_ptr = _get_dispatch(context);
+    CLEXT_CALL_DISPATCH(clGetMemAllocInfoINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetMemAllocInfoINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clGetMemAllocInfoINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    retVal = dispatch_ptr->clGetMemAllocInfoINTEL(
+        context,
+        ptr,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+call_end:
+    CLEXT_CALL_ARGS(clGetMemAllocInfoINTEL, retVal, param_value_size, context, ptr, param_name, param_value_size, param_value, param_value_size_ret);
+    CLEXT_CALL_END(clGetMemAllocInfoINTEL, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clSetKernelArgMemPointerINTEL(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    const void* arg_value)
+{
+    CLEXT_CALL_BEGIN(clSetKernelArgMemPointerINTEL, kernel);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(kernel);
+    CLEXT_CALL_DISPATCH(clSetKernelArgMemPointerINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clSetKernelArgMemPointerINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clSetKernelArgMemPointerINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clSetKernelArgMemPointerINTEL(
+        kernel,
+        arg_index,
+        arg_value);
+    CLEXT_CALL_ARGS(clSetKernelArgMemPointerINTEL, retVal, 0, kernel, arg_index, arg_value);
+    CLEXT_CALL_USM_KERNEL_ARG(kernel, arg_index, arg_value, retVal);
+    CLEXT_CALL_END(clSetKernelArgMemPointerINTEL, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueMemFillINTEL(
+    cl_command_queue command_queue,
+    void* dst_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueMemFillINTEL, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueMemFillINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueMemFillINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueMemFillINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueMemFillINTEL(
+        command_queue,
+        dst_ptr,
+        pattern,
+        pattern_size,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueMemFillINTEL, retVal, size, command_queue, dst_ptr, pattern, pattern_size, size, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_TRANSFER(clEnqueueMemFillINTEL, command_queue, dispatch_ptr, size, retVal);
+    CLEXT_CALL_END(clEnqueueMemFillINTEL, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueMemcpyINTEL(
+    cl_command_queue command_queue,
+    cl_bool blocking,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueMemcpyINTEL, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueMemcpyINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueMemcpyINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueMemcpyINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = CL_SUCCESS;
+    if (!CLEXT_CALL_USM_STAGE(dispatch_ptr->clEnqueueMemcpyINTEL, command_queue, blocking, dst_ptr, src_ptr, size, num_events_in_wait_list, event_wait_list, event, &retVal)) {
+        retVal = dispatch_ptr->clEnqueueMemcpyINTEL(
+            command_queue,
+            blocking,
+            dst_ptr,
+            src_ptr,
+            size,
+            num_events_in_wait_list,
+            event_wait_list,
+            event);
+    }
+    CLEXT_CALL_ARGS(clEnqueueMemcpyINTEL, retVal, size, command_queue, blocking, dst_ptr, src_ptr, size, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_TRANSFER(clEnqueueMemcpyINTEL, command_queue, dispatch_ptr, size, retVal);
+    CLEXT_CALL_END(clEnqueueMemcpyINTEL, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueMemAdviseINTEL(
+    cl_command_queue command_queue,
+    const void* ptr,
+    size_t size,
+    cl_mem_advice_intel advice,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueMemAdviseINTEL, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueMemAdviseINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueMemAdviseINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueMemAdviseINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueMemAdviseINTEL(
+        command_queue,
+        ptr,
+        size,
+        advice,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueMemAdviseINTEL, retVal, size, command_queue, ptr, size, advice, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueMemAdviseINTEL, retVal);
+    return retVal;
+}
+
+#if defined(CL_VERSION_1_2)
+
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueMigrateMemINTEL(
+    cl_command_queue command_queue,
+    const void* ptr,
+    size_t size,
+    cl_mem_migration_flags flags,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueMigrateMemINTEL, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueMigrateMemINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueMigrateMemINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueMigrateMemINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueMigrateMemINTEL(
+        command_queue,
+        ptr,
+        size,
+        flags,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueMigrateMemINTEL, retVal, size, command_queue, ptr, size, flags, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_TRANSFER(clEnqueueMigrateMemINTEL, command_queue, dispatch_ptr, size, retVal);
+    CLEXT_CALL_END(clEnqueueMigrateMemINTEL, retVal);
+    return retVal;
+}
+
+#endif // defined(CL_VERSION_1_2)
+
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueMemsetINTEL(
+    cl_command_queue command_queue,
+    void* dst_ptr,
+    cl_int value,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueMemsetINTEL, command_queue);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_queue);
+    CLEXT_CALL_DISPATCH(clEnqueueMemsetINTEL, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueMemsetINTEL == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueMemsetINTEL, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueMemsetINTEL(
+        command_queue,
+        dst_ptr,
+        value,
+        size,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueMemsetINTEL, retVal, size, command_queue, dst_ptr, value, size, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueMemsetINTEL, retVal);
+    return retVal;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#else
+#pragma message("Define for cl_intel_unified_shared_memory was not found!  Please update your headers.")
+#endif // defined(cl_intel_unified_shared_memory)
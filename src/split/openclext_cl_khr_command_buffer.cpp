@@ -0,0 +1,1028 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+/*
+// This file is generated from the Khronos OpenCL XML API Registry.
+//
+// It contains the cl_khr_command_buffer extension functions, for builds that split the
+// OpenCL Extension Loader into one translation unit per extension.
+*/
+
+// clang-format off
+
+
+#if defined _WIN32 || defined __CYGWIN__
+    #ifdef __GNUC__
+        #define CL_API_ENTRY __attribute__((dllexport))
+    #else
+        #define CL_API_ENTRY __declspec(dllexport)
+    #endif
+#else
+    #if __GNUC__ >= 4
+        #define CL_API_ENTRY __attribute__((visibility("default")))
+    #else
+        #define CL_API_ENTRY
+    #endif
+#endif
+
+#define CL_USE_DEPRECATED_OPENCL_1_0_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_1_APIS
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_2_0_APIS
+#define CL_USE_DEPRECATED_OPENCL_2_1_APIS
+#define CL_USE_DEPRECATED_OPENCL_2_2_APIS
+#define CL_USE_DEPRECATED_OPENCL_3_0_APIS
+
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+#if defined(CLEXT_INCLUDE_GL)
+#include <CL/cl_gl.h>
+// Some versions of the headers to not define cl_khr_gl_event.
+#ifndef cl_khr_gl_event
+#define cl_khr_gl_event 1
+#endif
+#endif
+#if defined(CLEXT_INCLUDE_EGL)
+#include <CL/cl_egl.h>
+#endif
+#if defined(CLEXT_INCLUDE_DX9)
+#include <CL/cl_dx9_media_sharing.h>
+#endif
+// Note: If both D3D10 and D3D11 are supported, the D3D11 header must be
+// included first.
+#if defined(CLEXT_INCLUDE_D3D11)
+#include <CL/cl_d3d11.h>
+#endif
+#if defined(CLEXT_INCLUDE_D3D10)
+#include <CL/cl_d3d10.h>
+#endif
+#if defined(CLEXT_INCLUDE_VA_API)
+#include <CL/cl_va_api_media_sharing_intel.h>
+#endif
+
+#include <stdlib.h>
+
+#include <vector>
+
+#include "openclext_hooks.h"
+#include "openclext_platform.h"
+#include "openclext_resolution.h"
+#include "openclext_split.h"
+
+#if defined(cl_khr_command_buffer)
+
+/***************************************************************
+* Function Pointer Typedefs
+***************************************************************/
+
+typedef cl_command_buffer_khr (CL_API_CALL* clCreateCommandBufferKHR_clextfn)(
+    cl_uint num_queues,
+    const cl_command_queue* queues,
+    const cl_command_buffer_properties_khr* properties,
+    cl_int* errcode_ret);
+
+typedef cl_int (CL_API_CALL* clFinalizeCommandBufferKHR_clextfn)(
+    cl_command_buffer_khr command_buffer);
+
+typedef cl_int (CL_API_CALL* clRetainCommandBufferKHR_clextfn)(
+    cl_command_buffer_khr command_buffer);
+
+typedef cl_int (CL_API_CALL* clReleaseCommandBufferKHR_clextfn)(
+    cl_command_buffer_khr command_buffer);
+
+typedef cl_int (CL_API_CALL* clEnqueueCommandBufferKHR_clextfn)(
+    cl_uint num_queues,
+    cl_command_queue* queues,
+    cl_command_buffer_khr command_buffer,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event);
+
+typedef cl_int (CL_API_CALL* clCommandBarrierWithWaitListKHR_clextfn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+
+typedef cl_int (CL_API_CALL* clCommandCopyBufferKHR_clextfn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_buffer,
+    cl_mem dst_buffer,
+    size_t src_offset,
+    size_t dst_offset,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+
+typedef cl_int (CL_API_CALL* clCommandCopyBufferRectKHR_clextfn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_buffer,
+    cl_mem dst_buffer,
+    const size_t* src_origin,
+    const size_t* dst_origin,
+    const size_t* region,
+    size_t src_row_pitch,
+    size_t src_slice_pitch,
+    size_t dst_row_pitch,
+    size_t dst_slice_pitch,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+
+typedef cl_int (CL_API_CALL* clCommandCopyBufferToImageKHR_clextfn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_buffer,
+    cl_mem dst_image,
+    size_t src_offset,
+    const size_t* dst_origin,
+    const size_t* region,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+
+typedef cl_int (CL_API_CALL* clCommandCopyImageKHR_clextfn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_image,
+    cl_mem dst_image,
+    const size_t* src_origin,
+    const size_t* dst_origin,
+    const size_t* region,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+
+typedef cl_int (CL_API_CALL* clCommandCopyImageToBufferKHR_clextfn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_image,
+    cl_mem dst_buffer,
+    const size_t* src_origin,
+    const size_t* region,
+    size_t dst_offset,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+
+typedef cl_int (CL_API_CALL* clCommandFillBufferKHR_clextfn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem buffer,
+    const void* pattern,
+    size_t pattern_size,
+    size_t offset,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+
+typedef cl_int (CL_API_CALL* clCommandFillImageKHR_clextfn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem image,
+    const void* fill_color,
+    const size_t* origin,
+    const size_t* region,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+
+typedef cl_int (CL_API_CALL* clCommandNDRangeKernelKHR_clextfn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_kernel kernel,
+    cl_uint work_dim,
+    const size_t* global_work_offset,
+    const size_t* global_work_size,
+    const size_t* local_work_size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+
+typedef cl_int (CL_API_CALL* clGetCommandBufferInfoKHR_clextfn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_buffer_info_khr param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret);
+
+typedef cl_int (CL_API_CALL* clCommandSVMMemcpyKHR_clextfn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+
+typedef cl_int (CL_API_CALL* clCommandSVMMemFillKHR_clextfn)(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    void* svm_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle);
+
+/***************************************************************
+* Extension Function Pointer Dispatch Table
+***************************************************************/
+
+// Each translation unit has its own dispatch table type.
+namespace {
+
+struct openclext_dispatch_table {
+    cl_platform_id platform;
+
+    clCreateCommandBufferKHR_clextfn clCreateCommandBufferKHR;
+    clFinalizeCommandBufferKHR_clextfn clFinalizeCommandBufferKHR;
+    clRetainCommandBufferKHR_clextfn clRetainCommandBufferKHR;
+    clReleaseCommandBufferKHR_clextfn clReleaseCommandBufferKHR;
+    clEnqueueCommandBufferKHR_clextfn clEnqueueCommandBufferKHR;
+    clCommandBarrierWithWaitListKHR_clextfn clCommandBarrierWithWaitListKHR;
+    clCommandCopyBufferKHR_clextfn clCommandCopyBufferKHR;
+    clCommandCopyBufferRectKHR_clextfn clCommandCopyBufferRectKHR;
+    clCommandCopyBufferToImageKHR_clextfn clCommandCopyBufferToImageKHR;
+    clCommandCopyImageKHR_clextfn clCommandCopyImageKHR;
+    clCommandCopyImageToBufferKHR_clextfn clCommandCopyImageToBufferKHR;
+    clCommandFillBufferKHR_clextfn clCommandFillBufferKHR;
+    clCommandFillImageKHR_clextfn clCommandFillImageKHR;
+    clCommandNDRangeKernelKHR_clextfn clCommandNDRangeKernelKHR;
+    clGetCommandBufferInfoKHR_clextfn clGetCommandBufferInfoKHR;
+    clCommandSVMMemcpyKHR_clextfn clCommandSVMMemcpyKHR;
+    clCommandSVMMemFillKHR_clextfn clCommandSVMMemFillKHR;
+};
+
+} // anonymous namespace
+
+/***************************************************************
+* Dispatch Table Initialization
+***************************************************************/
+
+static void _init(cl_platform_id platform, openclext_dispatch_table* dispatch_ptr)
+{
+    dispatch_ptr->platform = platform;
+
+    openclext_resolution* resolution = openclext_resolution_begin(platform);
+
+#define CLEXT_GET_EXTENSION(_funcname)                                         \
+    {                                                                          \
+        uint64_t start_ns = openclext_now_ns();                                \
+        CLEXT_COUNT_ICD_CALL();                                                \
+        dispatch_ptr->_funcname =                                              \
+            (_funcname##_clextfn)clGetExtensionFunctionAddressForPlatform(     \
+                platform, #_funcname);                                         \
+        openclext_resolution_record(                                           \
+            resolution, #_funcname, (void*)dispatch_ptr->_funcname, start_ns); \
+    }
+
+    CLEXT_GET_EXTENSION(clCreateCommandBufferKHR);
+    CLEXT_GET_EXTENSION(clFinalizeCommandBufferKHR);
+    CLEXT_GET_EXTENSION(clRetainCommandBufferKHR);
+    CLEXT_GET_EXTENSION(clReleaseCommandBufferKHR);
+    CLEXT_GET_EXTENSION(clEnqueueCommandBufferKHR);
+    CLEXT_GET_EXTENSION(clCommandBarrierWithWaitListKHR);
+    CLEXT_GET_EXTENSION(clCommandCopyBufferKHR);
+    CLEXT_GET_EXTENSION(clCommandCopyBufferRectKHR);
+    CLEXT_GET_EXTENSION(clCommandCopyBufferToImageKHR);
+    CLEXT_GET_EXTENSION(clCommandCopyImageKHR);
+    CLEXT_GET_EXTENSION(clCommandCopyImageToBufferKHR);
+    CLEXT_GET_EXTENSION(clCommandFillBufferKHR);
+    CLEXT_GET_EXTENSION(clCommandFillImageKHR);
+    CLEXT_GET_EXTENSION(clCommandNDRangeKernelKHR);
+    CLEXT_GET_EXTENSION(clGetCommandBufferInfoKHR);
+    CLEXT_GET_EXTENSION(clCommandSVMMemcpyKHR);
+    CLEXT_GET_EXTENSION(clCommandSVMMemFillKHR);
+
+#undef CLEXT_GET_EXTENSION
+
+    openclext_resolution_end(resolution);
+}
+
+#if defined(CLEXT_SINGLE_PLATFORM_ONLY)
+
+static openclext_dispatch_table _dispatch = {};
+static openclext_dispatch_table* _dispatch_ptr = nullptr;
+
+// The platform is shared by all translation units, so the dispatch table may
+// be initialized even if the platform cannot be found from the object.
+static inline openclext_dispatch_table* _init_dispatch(cl_platform_id platform)
+{
+    if (_dispatch_ptr == nullptr) {
+        platform = openclext_split_get_single_platform(platform);
+        if (platform == nullptr) {
+            return nullptr;
+        }
+        _init(platform, &_dispatch);
+        _dispatch_ptr = &_dispatch;
+    }
+
+    return _dispatch_ptr;
+}
+
+template<typename T>
+static inline openclext_dispatch_table* _get_dispatch(T object)
+{
+    if (object == nullptr) return nullptr;
+
+    if (_dispatch_ptr == nullptr) {
+        return _init_dispatch(_get_platform(object));
+    }
+
+    return _dispatch_ptr;
+}
+
+#if defined(cl_khr_command_buffer)
+template<>
+inline openclext_dispatch_table* _get_dispatch<cl_command_buffer_khr>(cl_command_buffer_khr object)
+{
+    if (object == nullptr) return nullptr;
+
+    return _init_dispatch(nullptr);
+}
+#endif // defined(cl_khr_command_buffer)
+
+#else // defined(CLEXT_SINGLE_PLATFORM_ONLY)
+
+static size_t _num_platforms = 0;
+static openclext_dispatch_table* _dispatch_array = nullptr;
+
+// The platforms are shared by all translation units, so the dispatch tables
+// may be initialized without an object.
+static inline void _init_dispatch(void)
+{
+    if (_num_platforms == 0 && _dispatch_array == nullptr) {
+        size_t numPlatforms = 0;
+        const cl_platform_id* platforms =
+            openclext_split_get_platforms(&numPlatforms);
+        if (numPlatforms == 0) {
+            return;
+        }
+
+        openclext_dispatch_table* dispatch =
+            (openclext_dispatch_table*)malloc(
+                numPlatforms * sizeof(openclext_dispatch_table));
+        if (dispatch == nullptr) {
+            return;
+        }
+
+        for (size_t i = 0; i < numPlatforms; i++) {
+            _init(platforms[i], dispatch + i);
+        }
+
+        _num_platforms = numPlatforms;
+        _dispatch_array = dispatch;
+    }
+}
+
+template<typename T>
+static inline openclext_dispatch_table* _get_dispatch(T object)
+{
+    _init_dispatch();
+
+    cl_platform_id platform = _get_platform(object);
+    for (size_t i = 0; i < _num_platforms; i++) {
+        openclext_dispatch_table* dispatch_ptr =
+            _dispatch_array + i;
+        if (dispatch_ptr->platform == platform) {
+            return dispatch_ptr;
+        }
+    }
+
+    return nullptr;
+}
+
+#if defined(cl_khr_command_buffer)
+template<>
+inline openclext_dispatch_table* _get_dispatch<cl_command_buffer_khr>(cl_command_buffer_khr object)
+{
+    if (object == nullptr) return nullptr;
+
+    _init_dispatch();
+    if (_num_platforms <= 1) return _dispatch_array;
+
+    for (size_t i = 0; i < _num_platforms; i++) {
+        openclext_dispatch_table* dispatch_ptr =
+            _dispatch_array + i;
+        if (dispatch_ptr->clGetCommandBufferInfoKHR) {
+            cl_uint refCount = 0;
+            CLEXT_COUNT_ICD_CALL();
+            cl_int errorCode = dispatch_ptr->clGetCommandBufferInfoKHR(
+                object,
+                CL_COMMAND_BUFFER_REFERENCE_COUNT_KHR,
+                sizeof(refCount),
+                &refCount,
+                nullptr);
+            if (errorCode == CL_SUCCESS) {
+                return dispatch_ptr;
+            }
+        }
+    }
+
+    return nullptr;
+}
+#endif // defined(cl_khr_command_buffer)
+
+#endif // defined(CLEXT_SINGLE_PLATFORM_ONLY)
+
+static inline cl_platform_id _get_dispatch_platform(const openclext_dispatch_table* dispatch_ptr)
+{
+    return dispatch_ptr ? dispatch_ptr->platform : nullptr;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************
+* Extension Functions
+***************************************************************/
+
+CL_API_ENTRY cl_command_buffer_khr CL_API_CALL clCreateCommandBufferKHR(
+    cl_uint num_queues,
+    const cl_command_queue* queues,
+    const cl_command_buffer_properties_khr* properties,
+    cl_int* errcode_ret)
+{
+    CLEXT_CALL_BEGIN(clCreateCommandBufferKHR, num_queues > 0 && queues ? queues[0] : nullptr);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(num_queues > 0 && queues ? queues[0] : nullptr);
+    CLEXT_CALL_ERRCODE(errcode_ret);
+    CLEXT_CALL_DISPATCH(clCreateCommandBufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCreateCommandBufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCreateCommandBufferKHR, dispatch_ptr);
+        if (errcode_ret) *errcode_ret = CL_INVALID_OPERATION;
+        return nullptr;
+    }
+    cl_command_buffer_khr retVal = dispatch_ptr->clCreateCommandBufferKHR(
+        num_queues,
+        queues,
+        properties,
+        errcode_ret);
+    CLEXT_CALL_ARGS(clCreateCommandBufferKHR, *errcode_ret, 0, num_queues, queues, properties, errcode_ret);
+    CLEXT_CALL_END(clCreateCommandBufferKHR, *errcode_ret);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clFinalizeCommandBufferKHR(
+    cl_command_buffer_khr command_buffer)
+{
+    CLEXT_CALL_BEGIN(clFinalizeCommandBufferKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clFinalizeCommandBufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clFinalizeCommandBufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clFinalizeCommandBufferKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clFinalizeCommandBufferKHR(
+        command_buffer);
+    CLEXT_CALL_ARGS(clFinalizeCommandBufferKHR, retVal, 0, command_buffer);
+    CLEXT_CALL_END(clFinalizeCommandBufferKHR, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clRetainCommandBufferKHR(
+    cl_command_buffer_khr command_buffer)
+{
+    CLEXT_CALL_BEGIN(clRetainCommandBufferKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clRetainCommandBufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clRetainCommandBufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clRetainCommandBufferKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clRetainCommandBufferKHR(
+        command_buffer);
+    CLEXT_CALL_ARGS(clRetainCommandBufferKHR, retVal, 0, command_buffer);
+    CLEXT_CALL_END(clRetainCommandBufferKHR, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clReleaseCommandBufferKHR(
+    cl_command_buffer_khr command_buffer)
+{
+    CLEXT_CALL_BEGIN(clReleaseCommandBufferKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clReleaseCommandBufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clReleaseCommandBufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clReleaseCommandBufferKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clReleaseCommandBufferKHR(
+        command_buffer);
+    CLEXT_CALL_ARGS(clReleaseCommandBufferKHR, retVal, 0, command_buffer);
+    CLEXT_CALL_END(clReleaseCommandBufferKHR, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueCommandBufferKHR(
+    cl_uint num_queues,
+    cl_command_queue* queues,
+    cl_command_buffer_khr command_buffer,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    CLEXT_CALL_BEGIN(clEnqueueCommandBufferKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clEnqueueCommandBufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clEnqueueCommandBufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clEnqueueCommandBufferKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clEnqueueCommandBufferKHR(
+        num_queues,
+        queues,
+        command_buffer,
+        num_events_in_wait_list,
+        event_wait_list,
+        event);
+    CLEXT_CALL_ARGS(clEnqueueCommandBufferKHR, retVal, 0, num_queues, queues, command_buffer, num_events_in_wait_list, event_wait_list, event);
+    CLEXT_CALL_END(clEnqueueCommandBufferKHR, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clCommandBarrierWithWaitListKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    CLEXT_CALL_BEGIN(clCommandBarrierWithWaitListKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clCommandBarrierWithWaitListKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandBarrierWithWaitListKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandBarrierWithWaitListKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clCommandBarrierWithWaitListKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandBarrierWithWaitListKHR, retVal, 0, command_buffer, command_queue, properties, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandBarrierWithWaitListKHR, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clCommandCopyBufferKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_buffer,
+    cl_mem dst_buffer,
+    size_t src_offset,
+    size_t dst_offset,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    CLEXT_CALL_BEGIN(clCommandCopyBufferKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clCommandCopyBufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandCopyBufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandCopyBufferKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clCommandCopyBufferKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        src_buffer,
+        dst_buffer,
+        src_offset,
+        dst_offset,
+        size,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandCopyBufferKHR, retVal, size, command_buffer, command_queue, properties, src_buffer, dst_buffer, src_offset, dst_offset, size, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_TRANSFER(clCommandCopyBufferKHR, command_buffer, dispatch_ptr, size, retVal);
+    CLEXT_CALL_END(clCommandCopyBufferKHR, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clCommandCopyBufferRectKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_buffer,
+    cl_mem dst_buffer,
+    const size_t* src_origin,
+    const size_t* dst_origin,
+    const size_t* region,
+    size_t src_row_pitch,
+    size_t src_slice_pitch,
+    size_t dst_row_pitch,
+    size_t dst_slice_pitch,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    CLEXT_CALL_BEGIN(clCommandCopyBufferRectKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clCommandCopyBufferRectKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandCopyBufferRectKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandCopyBufferRectKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clCommandCopyBufferRectKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        src_buffer,
+        dst_buffer,
+        src_origin,
+        dst_origin,
+        region,
+        src_row_pitch,
+        src_slice_pitch,
+        dst_row_pitch,
+        dst_slice_pitch,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandCopyBufferRectKHR, retVal, 0, command_buffer, command_queue, properties, src_buffer, dst_buffer, src_origin, dst_origin, region, src_row_pitch, src_slice_pitch, dst_row_pitch, dst_slice_pitch, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandCopyBufferRectKHR, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clCommandCopyBufferToImageKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_buffer,
+    cl_mem dst_image,
+    size_t src_offset,
+    const size_t* dst_origin,
+    const size_t* region,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    CLEXT_CALL_BEGIN(clCommandCopyBufferToImageKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clCommandCopyBufferToImageKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandCopyBufferToImageKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandCopyBufferToImageKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clCommandCopyBufferToImageKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        src_buffer,
+        dst_image,
+        src_offset,
+        dst_origin,
+        region,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandCopyBufferToImageKHR, retVal, 0, command_buffer, command_queue, properties, src_buffer, dst_image, src_offset, dst_origin, region, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandCopyBufferToImageKHR, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clCommandCopyImageKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_image,
+    cl_mem dst_image,
+    const size_t* src_origin,
+    const size_t* dst_origin,
+    const size_t* region,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    CLEXT_CALL_BEGIN(clCommandCopyImageKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clCommandCopyImageKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandCopyImageKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandCopyImageKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clCommandCopyImageKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        src_image,
+        dst_image,
+        src_origin,
+        dst_origin,
+        region,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandCopyImageKHR, retVal, 0, command_buffer, command_queue, properties, src_image, dst_image, src_origin, dst_origin, region, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandCopyImageKHR, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clCommandCopyImageToBufferKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem src_image,
+    cl_mem dst_buffer,
+    const size_t* src_origin,
+    const size_t* region,
+    size_t dst_offset,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    CLEXT_CALL_BEGIN(clCommandCopyImageToBufferKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clCommandCopyImageToBufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandCopyImageToBufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandCopyImageToBufferKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clCommandCopyImageToBufferKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        src_image,
+        dst_buffer,
+        src_origin,
+        region,
+        dst_offset,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandCopyImageToBufferKHR, retVal, 0, command_buffer, command_queue, properties, src_image, dst_buffer, src_origin, region, dst_offset, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandCopyImageToBufferKHR, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clCommandFillBufferKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem buffer,
+    const void* pattern,
+    size_t pattern_size,
+    size_t offset,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    CLEXT_CALL_BEGIN(clCommandFillBufferKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clCommandFillBufferKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandFillBufferKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandFillBufferKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clCommandFillBufferKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        buffer,
+        pattern,
+        pattern_size,
+        offset,
+        size,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandFillBufferKHR, retVal, size, command_buffer, command_queue, properties, buffer, pattern, pattern_size, offset, size, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandFillBufferKHR, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clCommandFillImageKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_mem image,
+    const void* fill_color,
+    const size_t* origin,
+    const size_t* region,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    CLEXT_CALL_BEGIN(clCommandFillImageKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clCommandFillImageKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandFillImageKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandFillImageKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clCommandFillImageKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        image,
+        fill_color,
+        origin,
+        region,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandFillImageKHR, retVal, 0, command_buffer, command_queue, properties, image, fill_color, origin, region, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandFillImageKHR, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clCommandNDRangeKernelKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    cl_kernel kernel,
+    cl_uint work_dim,
+    const size_t* global_work_offset,
+    const size_t* global_work_size,
+    const size_t* local_work_size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    CLEXT_CALL_BEGIN(clCommandNDRangeKernelKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clCommandNDRangeKernelKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandNDRangeKernelKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandNDRangeKernelKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clCommandNDRangeKernelKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        kernel,
+        work_dim,
+        global_work_offset,
+        global_work_size,
+        local_work_size,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandNDRangeKernelKHR, retVal, 0, command_buffer, command_queue, properties, kernel, work_dim, global_work_offset, global_work_size, local_work_size, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandNDRangeKernelKHR, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clGetCommandBufferInfoKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_buffer_info_khr param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    CLEXT_CALL_BEGIN(clGetCommandBufferInfoKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clGetCommandBufferInfoKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clGetCommandBufferInfoKHR == nullptr) {
+        CLEXT_CALL_MISSING(clGetCommandBufferInfoKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clGetCommandBufferInfoKHR(
+        command_buffer,
+        param_name,
+        param_value_size,
+        param_value,
+        param_value_size_ret);
+    CLEXT_CALL_ARGS(clGetCommandBufferInfoKHR, retVal, param_value_size, command_buffer, param_name, param_value_size, param_value, param_value_size_ret);
+    CLEXT_CALL_END(clGetCommandBufferInfoKHR, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clCommandSVMMemcpyKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    CLEXT_CALL_BEGIN(clCommandSVMMemcpyKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clCommandSVMMemcpyKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandSVMMemcpyKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandSVMMemcpyKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clCommandSVMMemcpyKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        dst_ptr,
+        src_ptr,
+        size,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandSVMMemcpyKHR, retVal, size, command_buffer, command_queue, properties, dst_ptr, src_ptr, size, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandSVMMemcpyKHR, retVal);
+    return retVal;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clCommandSVMMemFillKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_queue command_queue,
+    const cl_command_properties_khr* properties,
+    void* svm_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr* sync_point_wait_list,
+    cl_sync_point_khr* sync_point,
+    cl_mutable_command_khr* mutable_handle)
+{
+    CLEXT_CALL_BEGIN(clCommandSVMMemFillKHR, command_buffer);
+    struct openclext_dispatch_table* dispatch_ptr = _get_dispatch(command_buffer);
+    CLEXT_CALL_DISPATCH(clCommandSVMMemFillKHR, dispatch_ptr);
+    if (dispatch_ptr == nullptr || dispatch_ptr->clCommandSVMMemFillKHR == nullptr) {
+        CLEXT_CALL_MISSING(clCommandSVMMemFillKHR, dispatch_ptr);
+        return CL_INVALID_OPERATION;
+    }
+    cl_int retVal = dispatch_ptr->clCommandSVMMemFillKHR(
+        command_buffer,
+        command_queue,
+        properties,
+        svm_ptr,
+        pattern,
+        pattern_size,
+        size,
+        num_sync_points_in_wait_list,
+        sync_point_wait_list,
+        sync_point,
+        mutable_handle);
+    CLEXT_CALL_ARGS(clCommandSVMMemFillKHR, retVal, size, command_buffer, command_queue, properties, svm_ptr, pattern, pattern_size, size, num_sync_points_in_wait_list, sync_point_wait_list, sync_point, mutable_handle);
+    CLEXT_CALL_END(clCommandSVMMemFillKHR, retVal);
+    return retVal;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#else
+#pragma message("Define for cl_khr_command_buffer was not found!  Please update your headers.")
+#endif // defined(cl_khr_command_buffer)
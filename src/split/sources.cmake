@@ -0,0 +1,45 @@
+# This file is generated from the Khronos OpenCL XML API Registry.
+
+set(OpenCLExtensionLoader_SPLIT_SOURCE_FILES
+    src/split/openclext_cl_arm_import_memory.cpp
+    src/split/openclext_cl_arm_shared_virtual_memory.cpp
+    src/split/openclext_cl_ext_buffer_device_address.cpp
+    src/split/openclext_cl_ext_device_fission.cpp
+    src/split/openclext_cl_ext_image_requirements_info.cpp
+    src/split/openclext_cl_ext_migrate_memobject.cpp
+    src/split/openclext_cl_img_cancel_command.cpp
+    src/split/openclext_cl_img_generate_mipmap.cpp
+    src/split/openclext_cl_img_use_gralloc_ptr.cpp
+    src/split/openclext_cl_intel_accelerator.cpp
+    src/split/openclext_cl_intel_create_buffer_with_properties.cpp
+    src/split/openclext_cl_intel_dx9_media_sharing.cpp
+    src/split/openclext_cl_intel_program_scope_host_pipe.cpp
+    src/split/openclext_cl_intel_sharing_format_query_d3d10.cpp
+    src/split/openclext_cl_intel_sharing_format_query_d3d11.cpp
+    src/split/openclext_cl_intel_sharing_format_query_dx9.cpp
+    src/split/openclext_cl_intel_sharing_format_query_gl.cpp
+    src/split/openclext_cl_intel_sharing_format_query_va_api.cpp
+    src/split/openclext_cl_intel_unified_shared_memory.cpp
+    src/split/openclext_cl_intel_va_api_media_sharing.cpp
+    src/split/openclext_cl_khr_command_buffer.cpp
+    src/split/openclext_cl_khr_command_buffer_multi_device.cpp
+    src/split/openclext_cl_khr_command_buffer_mutable_dispatch.cpp
+    src/split/openclext_cl_khr_create_command_queue.cpp
+    src/split/openclext_cl_khr_d3d10_sharing.cpp
+    src/split/openclext_cl_khr_d3d11_sharing.cpp
+    src/split/openclext_cl_khr_dx9_media_sharing.cpp
+    src/split/openclext_cl_khr_egl_event.cpp
+    src/split/openclext_cl_khr_egl_image.cpp
+    src/split/openclext_cl_khr_external_memory.cpp
+    src/split/openclext_cl_khr_external_semaphore.cpp
+    src/split/openclext_cl_khr_external_semaphore_sync_fd.cpp
+    src/split/openclext_cl_khr_gl_event.cpp
+    src/split/openclext_cl_khr_il_program.cpp
+    src/split/openclext_cl_khr_semaphore.cpp
+    src/split/openclext_cl_khr_subgroups.cpp
+    src/split/openclext_cl_khr_suggested_local_work_size.cpp
+    src/split/openclext_cl_khr_terminate_context.cpp
+    src/split/openclext_cl_loader_info.cpp
+    src/split/openclext_cl_pocl_content_size.cpp
+    src/split/openclext_cl_qcom_ext_host_ptr.cpp
+)
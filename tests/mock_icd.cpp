@@ -0,0 +1,899 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// A minimal mock OpenCL implementation with two platforms, used in place of
+// the real OpenCL library by tests that need to control exactly which calls
+// the extension loader makes.  Each mock object records the platform it
+// belongs to.
+
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <mutex>
+#include <vector>
+
+#include "mock_icd.h"
+
+static int _platform_storage[MOCK_PLATFORM_COUNT];
+
+std::atomic<int> mock_usm_allocation_count(0);
+std::atomic<int> mock_usm_live_allocation_count(0);
+int mock_usm_info_call_count = 0;
+std::atomic<int> mock_memcpy_call_count(0);
+std::atomic<int> mock_fill_call_count(0);
+std::atomic<int> mock_migrate_call_count(0);
+std::atomic<int> mock_advise_call_count(0);
+std::atomic<size_t> mock_migrate_size(0);
+bool mock_usm_unsupported = false;
+bool mock_context_destructor_unsupported = false;
+std::atomic<int> mock_svm_call_count(0);
+cl_svm_mem_flags mock_svm_flags = 0;
+std::atomic<int> mock_svm_free_call_count(0);
+bool mock_memcpy_fails = false;
+bool mock_usm_free_fails = false;
+std::atomic<int> mock_wait_call_count(0);
+
+cl_platform_id mock_get_platform(cl_uint index)
+{
+    return (cl_platform_id)&_platform_storage[index];
+}
+
+const mock_object mock_device = { mock_get_platform(0), nullptr, nullptr };
+const mock_object mock_context = {
+    mock_get_platform(0), &mock_device, nullptr };
+const mock_object mock_queue = {
+    mock_get_platform(0), &mock_device, &mock_context };
+
+static int _failures = 0;
+
+void check(const char* name, bool passed)
+{
+    if (passed) {
+        printf("%s\n", name);
+    } else {
+        printf("FAILED: %s\n", name);
+        _failures++;
+    }
+}
+
+int check_result(void)
+{
+    if (_failures) {
+        printf("%d failures.\n", _failures);
+        return 1;
+    }
+    printf("Success.\n");
+    return 0;
+}
+
+std::string mock_capture_dump(
+    cl_int (CL_API_CALL* dump)(FILE* stream),
+    cl_int* errorCode)
+{
+    std::string text;
+    FILE* stream = tmpfile();
+    if (stream == nullptr) {
+        *errorCode = CL_OUT_OF_HOST_MEMORY;
+        return text;
+    }
+
+    *errorCode = dump(stream);
+    rewind(stream);
+    char buffer[256];
+    while (fgets(buffer, sizeof(buffer), stream)) {
+        text += buffer;
+    }
+    fclose(stream);
+    return text;
+}
+
+std::string mock_find_line(const std::string& text, const char* find)
+{
+    size_t pos = text.find(find);
+    if (pos == std::string::npos) {
+        return std::string();
+    }
+    size_t begin = text.rfind('\n', pos);
+    size_t end = text.find('\n', pos);
+    begin = begin == std::string::npos ? 0 : begin + 1;
+    return text.substr(begin, end - begin);
+}
+
+static cl_platform_id _get_object_platform(const void* object)
+{
+    return ((const mock_object*)object)->platform;
+}
+
+struct mock_event_callback {
+    cl_event event;
+    void (CL_CALLBACK* pfn_notify)(cl_event event, cl_int status, void* user_data);
+    void* user_data;
+};
+
+// Enqueued commands are executed immediately, so they all return this event.
+static const mock_object _complete_event = { mock_get_platform(0), nullptr, nullptr };
+
+// Copies return this event when mock_memcpy_fails is set.
+static const mock_object _failed_event = { mock_get_platform(0), nullptr, nullptr };
+
+static const mock_object _devices[MOCK_PLATFORM_COUNT] = {
+    { mock_get_platform(0), nullptr, nullptr },
+    { mock_get_platform(1), nullptr, nullptr },
+};
+
+static std::mutex _event_callbacks_lock;
+static std::vector<mock_event_callback> _event_callbacks;
+
+void mock_complete_event(cl_event event)
+{
+    std::vector<mock_event_callback> callbacks;
+    {
+        std::lock_guard<std::mutex> guard(_event_callbacks_lock);
+        for (size_t i = 0; i < _event_callbacks.size(); ) {
+            if (_event_callbacks[i].event == event) {
+                callbacks.push_back(_event_callbacks[i]);
+                _event_callbacks.erase(_event_callbacks.begin() + i);
+            } else {
+                i++;
+            }
+        }
+    }
+    for (const auto& callback : callbacks) {
+        callback.pfn_notify(event, CL_COMPLETE, callback.user_data);
+    }
+}
+
+// There is only one pending event, which completes at most once.
+static const mock_object _pending_event = { mock_get_platform(0), nullptr, nullptr };
+static void (*_pending_on_complete)(void* user_data) = nullptr;
+static void* _pending_user_data = nullptr;
+
+cl_event mock_create_pending_event(
+    void (*on_complete)(void* user_data), void* user_data)
+{
+    _pending_on_complete = on_complete;
+    _pending_user_data = user_data;
+    return (cl_event)&_pending_event;
+}
+
+// Completes the pending event if it is in the wait list.
+static void _wait_for_pending_event(
+    cl_uint num_events, const cl_event* event_list)
+{
+    for (cl_uint i = 0; i < num_events; i++) {
+        if (event_list[i] == (cl_event)&_pending_event && _pending_on_complete) {
+            void (*on_complete)(void*) = _pending_on_complete;
+            _pending_on_complete = nullptr;
+            on_complete(_pending_user_data);
+            mock_complete_event(event_list[i]);
+        }
+    }
+}
+
+template<typename T>
+static cl_int _return_info(T value, size_t size, void* param_value, size_t* size_ret)
+{
+    if (param_value) {
+        if (size < sizeof(T)) return CL_INVALID_VALUE;
+        memcpy(param_value, &value, sizeof(T));
+    }
+    if (size_ret) *size_ret = sizeof(T);
+    return CL_SUCCESS;
+}
+
+extern "C" {
+
+CL_API_ENTRY cl_int CL_API_CALL clGetPlatformIDs(
+    cl_uint num_entries,
+    cl_platform_id* platforms,
+    cl_uint* num_platforms)
+{
+    for (cl_uint i = 0; platforms && i < num_entries && i < MOCK_PLATFORM_COUNT; i++) {
+        platforms[i] = mock_get_platform(i);
+    }
+    if (num_platforms) *num_platforms = MOCK_PLATFORM_COUNT;
+    return CL_SUCCESS;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clGetPlatformInfo(
+    cl_platform_id platform,
+    cl_platform_info param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    static const char name[] = "Mock Platform";
+    if (param_name == CL_PLATFORM_NAME) {
+        if (param_value) {
+            if (param_value_size < sizeof(name)) return CL_INVALID_VALUE;
+            memcpy(param_value, name, sizeof(name));
+        }
+        if (param_value_size_ret) *param_value_size_ret = sizeof(name);
+        return CL_SUCCESS;
+    }
+    return CL_INVALID_VALUE;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clGetDeviceIDs(
+    cl_platform_id platform,
+    cl_device_type device_type,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices)
+{
+    for (cl_uint i = 0; i < MOCK_PLATFORM_COUNT; i++) {
+        if (platform == mock_get_platform(i)) {
+            if (devices && num_entries > 0) devices[0] = (cl_device_id)&_devices[i];
+            if (num_devices) *num_devices = 1;
+            return CL_SUCCESS;
+        }
+    }
+    return CL_INVALID_PLATFORM;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clGetDeviceInfo(
+    cl_device_id device,
+    cl_device_info param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    if (param_name == CL_DEVICE_PLATFORM) {
+        return _return_info(_get_object_platform(device),
+            param_value_size, param_value, param_value_size_ret);
+    }
+    if (param_name == CL_DEVICE_SVM_CAPABILITIES) {
+        return _return_info((cl_device_svm_capabilities)(
+            CL_DEVICE_SVM_COARSE_GRAIN_BUFFER | CL_DEVICE_SVM_FINE_GRAIN_BUFFER),
+            param_value_size, param_value, param_value_size_ret);
+    }
+    return CL_INVALID_VALUE;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clGetContextInfo(
+    cl_context context,
+    cl_context_info param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    const mock_object* object = (const mock_object*)context;
+    if (param_name == CL_CONTEXT_NUM_DEVICES) {
+        return _return_info((cl_uint)1,
+            param_value_size, param_value, param_value_size_ret);
+    }
+    if (param_name == CL_CONTEXT_DEVICES) {
+        return _return_info((cl_device_id)object->device,
+            param_value_size, param_value, param_value_size_ret);
+    }
+    return CL_INVALID_VALUE;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clGetCommandQueueInfo(
+    cl_command_queue command_queue,
+    cl_command_queue_info param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    const mock_object* object = (const mock_object*)command_queue;
+    if (param_name == CL_QUEUE_DEVICE) {
+        return _return_info((cl_device_id)object->device,
+            param_value_size, param_value, param_value_size_ret);
+    }
+    if (param_name == CL_QUEUE_CONTEXT) {
+        return _return_info((cl_context)object->context,
+            param_value_size, param_value, param_value_size_ret);
+    }
+    return CL_INVALID_VALUE;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clGetKernelInfo(
+    cl_kernel kernel,
+    cl_kernel_info param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    const mock_object* object = (const mock_object*)kernel;
+    if (param_name == CL_KERNEL_CONTEXT) {
+        return _return_info((cl_context)object->context,
+            param_value_size, param_value, param_value_size_ret);
+    }
+    return CL_INVALID_VALUE;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clGetMemObjectInfo(
+    cl_mem memobj,
+    cl_mem_info param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    const mock_object* object = (const mock_object*)memobj;
+    if (param_name == CL_MEM_CONTEXT) {
+        return _return_info((cl_context)object->context,
+            param_value_size, param_value, param_value_size_ret);
+    }
+    return CL_INVALID_VALUE;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clGetEventInfo(
+    cl_event event,
+    cl_event_info param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    const mock_object* object = (const mock_object*)event;
+    if (param_name == CL_EVENT_CONTEXT) {
+        return _return_info((cl_context)object->context,
+            param_value_size, param_value, param_value_size_ret);
+    }
+    return CL_INVALID_VALUE;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clRetainContext(
+    cl_context context)
+{
+    return CL_SUCCESS;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clReleaseContext(
+    cl_context context)
+{
+    return CL_SUCCESS;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clSetEventCallback(
+    cl_event event,
+    cl_int command_exec_callback_type,
+    void (CL_CALLBACK* pfn_notify)(cl_event event, cl_int status, void* user_data),
+    void* user_data)
+{
+    if (command_exec_callback_type != CL_COMPLETE) return CL_INVALID_VALUE;
+    if (event == (cl_event)&_complete_event) {
+        pfn_notify(event, CL_COMPLETE, user_data);
+        return CL_SUCCESS;
+    }
+    if (event == (cl_event)&_failed_event) {
+        pfn_notify(event, CL_OUT_OF_RESOURCES, user_data);
+        return CL_SUCCESS;
+    }
+
+    mock_event_callback callback = { event, pfn_notify, user_data };
+    std::lock_guard<std::mutex> guard(_event_callbacks_lock);
+    _event_callbacks.push_back(callback);
+    return CL_SUCCESS;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clRetainEvent(
+    cl_event event)
+{
+    return CL_SUCCESS;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clReleaseEvent(
+    cl_event event)
+{
+    return CL_SUCCESS;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clWaitForEvents(
+    cl_uint num_events,
+    const cl_event* event_list)
+{
+    mock_wait_call_count++;
+    _wait_for_pending_event(num_events, event_list);
+    cl_int errorCode = CL_SUCCESS;
+    for (cl_uint i = 0; i < num_events; i++) {
+        if (event_list[i] == (cl_event)&_failed_event) {
+            errorCode = CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST;
+        } else if (event_list[i] != (cl_event)&_complete_event &&
+            event_list[i] != (cl_event)&_pending_event) {
+            return CL_INVALID_EVENT;
+        }
+    }
+    return errorCode;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clFlush(
+    cl_command_queue command_queue)
+{
+    return CL_SUCCESS;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueMarkerWithWaitList(
+    cl_command_queue command_queue,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    _wait_for_pending_event(num_events_in_wait_list, event_wait_list);
+    if (event) *event = (cl_event)&_complete_event;
+    return CL_SUCCESS;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clSetContextDestructorCallback(
+    cl_context context,
+    void (CL_CALLBACK* pfn_notify)(cl_context context, void* user_data),
+    void* user_data)
+{
+    // Mock contexts are never destroyed.
+    return mock_context_destructor_unsupported ?
+        CL_INVALID_OPERATION : CL_SUCCESS;
+}
+
+} // extern "C"
+
+// Mock extension functions.  Functions that query an object only succeed
+// for objects that belong to the platform that returned the function.
+
+static cl_int CL_API_CALL mock_clEnqueueMemcpyINTEL(
+    cl_command_queue command_queue,
+    cl_bool blocking,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    mock_memcpy_call_count++;
+    _wait_for_pending_event(num_events_in_wait_list, event_wait_list);
+    if (mock_memcpy_fails) {
+        if (event) *event = (cl_event)&_failed_event;
+        return CL_SUCCESS;
+    }
+    if (dst_ptr && src_ptr) memcpy(dst_ptr, src_ptr, size);
+    if (event) *event = (cl_event)&_complete_event;
+    return CL_SUCCESS;
+}
+
+static void* _usm_alloc(size_t size, cl_uint alignment, cl_int* errcode_ret)
+{
+    if (alignment < sizeof(void*)) alignment = sizeof(void*);
+
+    void* ptr = nullptr;
+#if defined(_WIN32)
+    ptr = _aligned_malloc(size, alignment);
+#else
+    if (posix_memalign(&ptr, alignment, size) != 0) ptr = nullptr;
+#endif
+    if (ptr) {
+        mock_usm_allocation_count++;
+        mock_usm_live_allocation_count++;
+    }
+    if (errcode_ret) *errcode_ret = ptr ? CL_SUCCESS : CL_OUT_OF_RESOURCES;
+    return ptr;
+}
+
+static cl_int CL_API_CALL mock_clEnqueueMemFillINTEL(
+    cl_command_queue command_queue,
+    void* dst_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    mock_fill_call_count++;
+    if (((const mock_object*)command_queue)->context == nullptr) {
+        return CL_INVALID_COMMAND_QUEUE;
+    }
+    for (size_t offset = 0; offset + pattern_size <= size; offset += pattern_size) {
+        memcpy((char*)dst_ptr + offset, pattern, pattern_size);
+    }
+    if (event) *event = (cl_event)&_complete_event;
+    return CL_SUCCESS;
+}
+
+static cl_int CL_API_CALL mock_clEnqueueMigrateMemINTEL(
+    cl_command_queue command_queue,
+    const void* ptr,
+    size_t size,
+    cl_mem_migration_flags flags,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    mock_migrate_call_count++;
+    mock_migrate_size += size;
+    if (event) *event = (cl_event)&_complete_event;
+    return CL_SUCCESS;
+}
+
+static cl_int CL_API_CALL mock_clEnqueueMemAdviseINTEL(
+    cl_command_queue command_queue,
+    const void* ptr,
+    size_t size,
+    cl_mem_advice_intel advice,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    mock_advise_call_count++;
+    if (event) *event = (cl_event)&_complete_event;
+    return CL_SUCCESS;
+}
+
+// Host USM allocations are only supported by the first platform.  This checks
+// the platform of the context rather than the platform that was called, since
+// every call goes to the first platform when only a single platform is
+// supported.
+static void* CL_API_CALL mock_clHostMemAllocINTEL(
+    cl_context context,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    if (_get_object_platform(context) != mock_get_platform(0)) {
+        if (errcode_ret) *errcode_ret = CL_INVALID_VALUE;
+        return nullptr;
+    }
+    return _usm_alloc(size, alignment, errcode_ret);
+}
+
+static void* CL_API_CALL mock_clDeviceMemAllocINTEL(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    return _usm_alloc(size, alignment, errcode_ret);
+}
+
+static void* CL_API_CALL mock_clSharedMemAllocINTEL(
+    cl_context context,
+    cl_device_id device,
+    const cl_mem_properties_intel* properties,
+    size_t size,
+    cl_uint alignment,
+    cl_int* errcode_ret)
+{
+    return _usm_alloc(size, alignment, errcode_ret);
+}
+
+static cl_int CL_API_CALL mock_clMemFreeINTEL(
+    cl_context context,
+    void* ptr)
+{
+    if (mock_usm_free_fails) {
+        return CL_INVALID_VALUE;
+    }
+    if (ptr) {
+#if defined(_WIN32)
+        _aligned_free(ptr);
+#else
+        free(ptr);
+#endif
+        mock_usm_live_allocation_count--;
+    }
+    return CL_SUCCESS;
+}
+
+static void* CL_API_CALL mock_clSVMAllocARM(
+    cl_context context,
+    cl_svm_mem_flags_arm flags,
+    size_t size,
+    cl_uint alignment)
+{
+    mock_svm_flags = flags;
+    return _usm_alloc(size, alignment, nullptr);
+}
+
+static void CL_API_CALL mock_clSVMFreeARM(
+    cl_context context,
+    void* svm_pointer)
+{
+    mock_clMemFreeINTEL(context, svm_pointer);
+}
+
+struct mock_svm_free {
+    cl_command_queue queue;
+    std::vector<void*> pointers;
+    void (CL_CALLBACK* pfn_free_func)(cl_command_queue, cl_uint, void*[], void*);
+    void* user_data;
+    cl_uint remaining;
+};
+
+static void _svm_free(mock_svm_free* svmFree)
+{
+    if (svmFree->pfn_free_func) {
+        svmFree->pfn_free_func(svmFree->queue, (cl_uint)svmFree->pointers.size(),
+            svmFree->pointers.data(), svmFree->user_data);
+    } else {
+        for (auto ptr : svmFree->pointers) {
+            mock_clMemFreeINTEL(nullptr, ptr);
+        }
+    }
+    delete svmFree;
+}
+
+static void CL_CALLBACK _svm_free_callback(
+    cl_event event,
+    cl_int event_command_status,
+    void* user_data)
+{
+    mock_svm_free* svmFree = (mock_svm_free*)user_data;
+    if (--svmFree->remaining == 0) {
+        _svm_free(svmFree);
+    }
+}
+
+// Unlike the other enqueue functions, SVM frees wait for the events in their
+// wait list, so the pointers are freed when the last event completes.
+static cl_int CL_API_CALL mock_clEnqueueSVMFreeARM(
+    cl_command_queue command_queue,
+    cl_uint num_svm_pointers,
+    void* svm_pointers[],
+    void (CL_CALLBACK* pfn_free_func)(cl_command_queue queue, cl_uint num_svm_pointers, void* svm_pointers[], void* user_data),
+    void* user_data,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    mock_svm_free_call_count++;
+
+    mock_svm_free* svmFree = new mock_svm_free();
+    svmFree->queue = command_queue;
+    svmFree->pointers.assign(svm_pointers, svm_pointers + num_svm_pointers);
+    svmFree->pfn_free_func = pfn_free_func;
+    svmFree->user_data = user_data;
+    svmFree->remaining = num_events_in_wait_list + 1;
+    for (cl_uint i = 0; i < num_events_in_wait_list; i++) {
+        clSetEventCallback(event_wait_list[i], CL_COMPLETE,
+            _svm_free_callback, svmFree);
+    }
+    _svm_free_callback(nullptr, CL_COMPLETE, svmFree);
+
+    if (event) *event = (cl_event)&_complete_event;
+    return CL_SUCCESS;
+}
+
+// Every mock command has completed when it returns, so blocking frees do not
+// need to wait.
+static cl_int CL_API_CALL mock_clMemBlockingFreeINTEL(
+    cl_context context,
+    void* ptr)
+{
+    return mock_clMemFreeINTEL(context, ptr);
+}
+
+extern "C" {
+
+CL_API_ENTRY void* CL_API_CALL clSVMAlloc(
+    cl_context context,
+    cl_svm_mem_flags flags,
+    size_t size,
+    cl_uint alignment)
+{
+    mock_svm_flags = flags;
+    return _usm_alloc(size, alignment, nullptr);
+}
+
+CL_API_ENTRY void CL_API_CALL clSVMFree(
+    cl_context context,
+    void* svm_pointer)
+{
+    mock_clMemFreeINTEL(context, svm_pointer);
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSVMMemcpy(
+    cl_command_queue command_queue,
+    cl_bool blocking_copy,
+    void* dst_ptr,
+    const void* src_ptr,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    mock_svm_call_count++;
+    memcpy(dst_ptr, src_ptr, size);
+    if (event) *event = (cl_event)&_complete_event;
+    return CL_SUCCESS;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSVMMemFill(
+    cl_command_queue command_queue,
+    void* svm_ptr,
+    const void* pattern,
+    size_t pattern_size,
+    size_t size,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    mock_svm_call_count++;
+    for (size_t offset = 0; offset + pattern_size <= size; offset += pattern_size) {
+        memcpy((char*)svm_ptr + offset, pattern, pattern_size);
+    }
+    if (event) *event = (cl_event)&_complete_event;
+    return CL_SUCCESS;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clEnqueueSVMMigrateMem(
+    cl_command_queue command_queue,
+    cl_uint num_svm_pointers,
+    const void** svm_pointers,
+    const size_t* sizes,
+    cl_mem_migration_flags flags,
+    cl_uint num_events_in_wait_list,
+    const cl_event* event_wait_list,
+    cl_event* event)
+{
+    mock_svm_call_count++;
+    if (event) *event = (cl_event)&_complete_event;
+    return CL_SUCCESS;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clSetKernelArgSVMPointer(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    const void* arg_value)
+{
+    mock_svm_call_count++;
+    return CL_SUCCESS;
+}
+
+} // extern "C"
+
+static cl_int CL_API_CALL mock_clGetMemAllocInfoINTEL(
+    cl_context context,
+    const void* ptr,
+    cl_mem_info_intel param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    mock_usm_info_call_count++;
+    if (param_name == CL_MEM_ALLOC_TYPE_INTEL) {
+        return _return_info((cl_unified_shared_memory_type_intel)CL_MEM_TYPE_UNKNOWN_INTEL,
+            param_value_size, param_value, param_value_size_ret);
+    }
+    return CL_INVALID_VALUE;
+}
+
+static cl_int CL_API_CALL mock_clSetKernelArgMemPointerINTEL(
+    cl_kernel kernel,
+    cl_uint arg_index,
+    const void* arg_value)
+{
+    return CL_SUCCESS;
+}
+
+static cl_int CL_API_CALL mock_clCreateSubDevicesEXT(
+    cl_device_id in_device,
+    const cl_device_partition_property_ext* properties,
+    cl_uint num_entries,
+    cl_device_id* out_devices,
+    cl_uint* num_devices)
+{
+    return CL_INVALID_VALUE;
+}
+
+template<cl_uint platformIndex>
+static cl_int CL_API_CALL mock_clGetCommandBufferInfoKHR(
+    cl_command_buffer_khr command_buffer,
+    cl_command_buffer_info_khr param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    if (_get_object_platform(command_buffer) != mock_get_platform(platformIndex)) {
+        return CL_INVALID_VALUE;
+    }
+    if (param_name == CL_COMMAND_BUFFER_REFERENCE_COUNT_KHR) {
+        return _return_info((cl_uint)1,
+            param_value_size, param_value, param_value_size_ret);
+    }
+    return CL_INVALID_VALUE;
+}
+
+static cl_int CL_API_CALL mock_clFinalizeCommandBufferKHR(
+    cl_command_buffer_khr command_buffer)
+{
+    return CL_SUCCESS;
+}
+
+template<cl_uint platformIndex>
+static cl_int CL_API_CALL mock_clGetSemaphoreInfoKHR(
+    cl_semaphore_khr semaphore,
+    cl_semaphore_info_khr param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    if (_get_object_platform(semaphore) != mock_get_platform(platformIndex)) {
+        return CL_INVALID_VALUE;
+    }
+    if (param_name == CL_SEMAPHORE_REFERENCE_COUNT_KHR) {
+        return _return_info((cl_uint)1,
+            param_value_size, param_value, param_value_size_ret);
+    }
+    return CL_INVALID_VALUE;
+}
+
+static cl_int CL_API_CALL mock_clRetainSemaphoreKHR(
+    cl_semaphore_khr semaphore)
+{
+    return CL_SUCCESS;
+}
+
+template<cl_uint platformIndex>
+static void* _get_extension_function(const char* func_name)
+{
+    // All of the mock extension functions that end with INTEL are unified
+    // shared memory functions.
+    size_t length = strlen(func_name);
+    if (mock_usm_unsupported && length > 5 &&
+        strcmp(func_name + length - 5, "INTEL") == 0) {
+        return nullptr;
+    }
+
+#define MOCK_FUNCTION(_funcname)                                               \
+    if (strcmp(func_name, #_funcname) == 0) return (void*)mock_##_funcname
+
+    MOCK_FUNCTION(clEnqueueMemcpyINTEL);
+    MOCK_FUNCTION(clEnqueueMemFillINTEL);
+    MOCK_FUNCTION(clEnqueueMigrateMemINTEL);
+    MOCK_FUNCTION(clEnqueueMemAdviseINTEL);
+    MOCK_FUNCTION(clHostMemAllocINTEL);
+    MOCK_FUNCTION(clDeviceMemAllocINTEL);
+    MOCK_FUNCTION(clSharedMemAllocINTEL);
+    MOCK_FUNCTION(clMemFreeINTEL);
+    MOCK_FUNCTION(clMemBlockingFreeINTEL);
+    MOCK_FUNCTION(clSVMAllocARM);
+    MOCK_FUNCTION(clSVMFreeARM);
+    MOCK_FUNCTION(clEnqueueSVMFreeARM);
+    MOCK_FUNCTION(clGetMemAllocInfoINTEL);
+    MOCK_FUNCTION(clSetKernelArgMemPointerINTEL);
+    MOCK_FUNCTION(clCreateSubDevicesEXT);
+    MOCK_FUNCTION(clFinalizeCommandBufferKHR);
+    MOCK_FUNCTION(clRetainSemaphoreKHR);
+
+#undef MOCK_FUNCTION
+
+    if (strcmp(func_name, "clGetCommandBufferInfoKHR") == 0) {
+        return (void*)mock_clGetCommandBufferInfoKHR<platformIndex>;
+    }
+    if (strcmp(func_name, "clGetSemaphoreInfoKHR") == 0) {
+        return (void*)mock_clGetSemaphoreInfoKHR<platformIndex>;
+    }
+    return nullptr;
+}
+
+extern "C" {
+
+CL_API_ENTRY void* CL_API_CALL clGetExtensionFunctionAddressForPlatform(
+    cl_platform_id platform,
+    const char* func_name)
+{
+    if (platform == mock_get_platform(0)) {
+        return _get_extension_function<0>(func_name);
+    }
+    if (platform == mock_get_platform(1)) {
+        return _get_extension_function<1>(func_name);
+    }
+    return nullptr;
+}
+
+CL_API_ENTRY void* CL_API_CALL clGetExtensionFunctionAddress(
+    const char* func_name)
+{
+    return _get_extension_function<0>(func_name);
+}
+
+} // extern "C"
@@ -0,0 +1,111 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+#ifndef MOCK_ICD_H_
+#define MOCK_ICD_H_
+
+#include <CL/cl.h>
+
+#include <stdio.h>
+
+#include <atomic>
+#include <string>
+
+#define MOCK_PLATFORM_COUNT 2
+
+// Every mock handle points to a mock_object.  Devices only need a platform;
+// the other objects also record the device and context they belong to.
+struct mock_object {
+    cl_platform_id platform;
+    const mock_object* device;
+    const mock_object* context;
+};
+
+cl_platform_id mock_get_platform(cl_uint index);
+
+// A device on the first platform, a context for the device, and a queue in
+// the context, for tests that only need one of each.
+extern const mock_object mock_device;
+extern const mock_object mock_context;
+extern const mock_object mock_queue;
+
+// The number of device and shared USM allocations that the mock has made and
+// that are currently allocated.
+extern std::atomic<int> mock_usm_allocation_count;
+extern std::atomic<int> mock_usm_live_allocation_count;
+
+// The number of calls to clEnqueueMemcpyINTEL and clEnqueueMemFillINTEL.
+// Fills fail with CL_INVALID_COMMAND_QUEUE for queues without a context.
+extern std::atomic<int> mock_memcpy_call_count;
+extern std::atomic<int> mock_fill_call_count;
+
+// When mock_memcpy_fails is set, clEnqueueMemcpyINTEL does not copy, and the
+// event that it returns completes with CL_OUT_OF_RESOURCES.
+extern bool mock_memcpy_fails;
+
+// When mock_usm_free_fails is set, clMemFreeINTEL and clMemBlockingFreeINTEL
+// do not free the memory and return CL_INVALID_VALUE.
+extern bool mock_usm_free_fails;
+
+// The number of calls to clEnqueueMigrateMemINTEL and clEnqueueMemAdviseINTEL,
+// and the total number of bytes migrated.
+extern std::atomic<int> mock_migrate_call_count;
+extern std::atomic<int> mock_advise_call_count;
+extern std::atomic<size_t> mock_migrate_size;
+
+// When mock_usm_unsupported is set before the first extension function is
+// called, the mock does not return any cl_intel_unified_shared_memory
+// extension functions, so USM may be emulated with SVM.  SVM allocations are
+// counted as USM allocations.  mock_svm_call_count is the number of calls to
+// the SVM enqueue functions and clSetKernelArgSVMPointer, and mock_svm_flags
+// is the flags for the most recent SVM allocation.
+extern bool mock_usm_unsupported;
+extern std::atomic<int> mock_svm_call_count;
+extern cl_svm_mem_flags mock_svm_flags;
+
+// The number of calls to clEnqueueSVMFreeARM.  ARM SVM allocations are also
+// counted as USM allocations, and clSVMAllocARM also sets mock_svm_flags.
+extern std::atomic<int> mock_svm_free_call_count;
+
+// When mock_context_destructor_unsupported is set, clSetContextDestructorCallback
+// fails, as it does on platforms before OpenCL 3.0.
+extern bool mock_context_destructor_unsupported;
+
+// The number of calls to clGetMemAllocInfoINTEL, which only knows that the
+// type of all memory is unknown.
+extern int mock_usm_info_call_count;
+
+// The number of calls to clWaitForEvents.
+extern std::atomic<int> mock_wait_call_count;
+
+// Calls the CL_COMPLETE callbacks that were set for event.  Mock events never
+// complete on their own, except for the events returned by enqueue functions,
+// which are already complete.
+void mock_complete_event(cl_event event);
+
+// Returns an event that completes the first time an enqueued command or
+// clWaitForEvents waits for it, like an earlier command that the mock
+// executes late.  on_complete is called with user_data when it completes.
+cl_event mock_create_pending_event(
+    void (*on_complete)(void* user_data), void* user_data);
+
+// Prints the name of each check and counts the checks that fail.
+void check(const char* name, bool passed);
+
+// Prints the number of checks that failed, if any, and returns the exit code
+// for the test.
+int check_result(void);
+
+// Returns everything that dump writes to a stream, and sets errorCode to the
+// error code that dump returns.
+std::string mock_capture_dump(
+    cl_int (CL_API_CALL* dump)(FILE* stream),
+    cl_int* errorCode);
+
+// Returns the line of text that contains find, or an empty string.
+std::string mock_find_line(const std::string& text, const char* find);
+
+#endif // MOCK_ICD_H_
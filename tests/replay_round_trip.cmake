@@ -0,0 +1,29 @@
+# Copyright (c) 2021-2026 Ben Ashbaugh
+#
+# SPDX-License-Identifier: MIT or Apache-2.0
+
+# Captures a log with CAPTURE_EXE, replays it with REPLAY_EXE, and checks the
+# number of calls, skipped calls, and mismatched statuses for each function.
+
+execute_process(COMMAND ${CAPTURE_EXE} ${LOG_FILE} RESULT_VARIABLE result)
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "${CAPTURE_EXE} failed: ${result}")
+endif()
+
+execute_process(COMMAND ${REPLAY_EXE} ${LOG_FILE}
+    OUTPUT_VARIABLE output RESULT_VARIABLE result)
+message("${output}")
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "${REPLAY_EXE} failed: ${result}")
+endif()
+
+foreach(EXPECTED
+        "clEnqueueMemcpyINTEL +3 +0 +0 "
+        "clDeviceMemAllocINTEL +1 +0 +0 "
+        "clGetMemAllocInfoINTEL +1 +0 +0 "
+        "clMemFreeINTEL +1 +1 +0 .*frees are not replayed"
+        "Replayed 5 calls")
+    if (NOT output MATCHES "${EXPECTED}")
+        message(FATAL_ERROR "Replay output does not match \"${EXPECTED}\"")
+    endif()
+endforeach()
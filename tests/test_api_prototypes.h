@@ -0,0 +1,29 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// clang-format off
+
+#ifndef TEST_API_PROTOTYPES_H_
+#define TEST_API_PROTOTYPES_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// These functions are only available when the OpenCL Extension Loader is
+// built with OPENCL_EXTENSION_LOADER_ENABLE_TEST_API.
+
+extern CL_API_ENTRY cl_ulong CL_API_CALL
+clextGetICDCallCount(void);
+
+extern CL_API_ENTRY void CL_API_CALL
+clextResetICDCallCount(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEST_API_PROTOTYPES_H_
@@ -0,0 +1,52 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Captures calls to a mock OpenCL implementation to the log named by the
+// first argument.  replay_round_trip.cmake then replays the log with
+// clext-replay-mock and checks the replayed calls.
+
+#include <CL/cl_ext.h>
+
+#include <stdlib.h>
+
+#include "mock_icd.h"
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        return 1;
+    }
+#if defined(_WIN32)
+    _putenv_s("CLEXT_CAPTURE_FILE", argv[1]);
+#else
+    setenv("CLEXT_CAPTURE_FILE", argv[1], 1);
+#endif
+
+    char src[16] = {}, dst[16] = {};
+    for (int i = 0; i < 3; i++) {
+        cl_event event = nullptr;
+        cl_int errorCode = clEnqueueMemcpyINTEL((cl_command_queue)&mock_queue,
+            CL_FALSE, dst, src, sizeof(src), 0, nullptr, &event);
+        check("copies are captured", errorCode == CL_SUCCESS && event);
+    }
+
+    cl_int errorCode = CL_SUCCESS;
+    void* ptr = clDeviceMemAllocINTEL((cl_context)&mock_context,
+        (cl_device_id)&mock_device, nullptr, 64, 0, &errorCode);
+    check("allocations are captured", errorCode == CL_SUCCESS && ptr);
+
+    cl_unified_shared_memory_type_intel type = 0;
+    size_t size = 0;
+    errorCode = clGetMemAllocInfoINTEL((cl_context)&mock_context, ptr,
+        CL_MEM_ALLOC_TYPE_INTEL, sizeof(type), &type, &size);
+    check("queries are captured", errorCode == CL_SUCCESS);
+
+    errorCode = clMemFreeINTEL((cl_context)&mock_context, ptr);
+    check("frees are captured", errorCode == CL_SUCCESS);
+
+    // The log is written when the process exits.
+    return check_result();
+}
@@ -0,0 +1,70 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Checks that each dispatch policy in the header-only C++ API finds the
+// dispatch table for the mock platform that owns each object.
+
+#include "openclext.hpp"
+
+#include <stdio.h>
+
+#include "mock_icd.h"
+
+static void check(const char* policy, const char* name, bool passed)
+{
+    char label[64];
+    snprintf(label, sizeof(label), "%s: %s", policy, name);
+    check(label, passed);
+}
+
+template<typename Policy>
+static void test(const char* policy, const clext::Dispatch<Policy>& ext)
+{
+    // All objects belong to the last platform, so a policy that uses the
+    // dispatch table for the wrong platform will fail to find the semaphore.
+    const mock_object device = {
+        mock_get_platform(MOCK_PLATFORM_COUNT - 1), nullptr, nullptr };
+    const mock_object context = { device.platform, &device, nullptr };
+    const mock_object object = { device.platform, &device, &context };
+
+    char src = 1, dst = 0;
+    cl_int errorCode = ext.clEnqueueMemcpyINTEL(
+        (cl_command_queue)&object, CL_TRUE, &dst, &src, 1, 0, nullptr, nullptr);
+    check(policy, "clEnqueueMemcpyINTEL", errorCode == CL_SUCCESS && dst == src);
+
+    errorCode = ext.clFinalizeCommandBufferKHR((cl_command_buffer_khr)&object);
+    check(policy, "clFinalizeCommandBufferKHR", errorCode == CL_SUCCESS);
+
+    errorCode = ext.clRetainSemaphoreKHR((cl_semaphore_khr)&object);
+    check(policy, "clRetainSemaphoreKHR", errorCode == CL_SUCCESS);
+
+    ext.clHostMemAllocINTEL((cl_context)&context, nullptr, 1, 0, &errorCode);
+    check(policy, "clHostMemAllocINTEL", errorCode == CL_INVALID_VALUE);
+
+    // The mock does not support this extension API.
+    errorCode = ext.clEnqueueMemsetINTEL(
+        (cl_command_queue)&object, &dst, 0, 1, 0, nullptr, nullptr);
+    check(policy, "clEnqueueMemsetINTEL", errorCode == CL_INVALID_OPERATION);
+}
+
+int main(void)
+{
+    test("SinglePlatform", clext::Dispatch<clext::SinglePlatform>());
+    test("MultiPlatformCached", clext::Dispatch<clext::MultiPlatformCached>());
+
+    clext::DispatchTable table(mock_get_platform(MOCK_PLATFORM_COUNT - 1));
+    test("ExplicitTable",
+        clext::Dispatch<clext::ExplicitTable>(clext::ExplicitTable(&table)));
+
+    // A null object has no dispatch table.
+    clext::Dispatch<clext::MultiPlatformCached> ext;
+    cl_int errorCode = ext.clEnqueueMemcpyINTEL(
+        nullptr, CL_TRUE, nullptr, nullptr, 0, 0, nullptr, nullptr);
+    check("MultiPlatformCached", "null object",
+        errorCode == CL_INVALID_OPERATION);
+
+    return check_result();
+}
@@ -0,0 +1,42 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Checks that clextDumpResolution writes each extension API that was looked
+// up for a platform, and whether it was found by the mock OpenCL
+// implementation.
+
+#include <CL/cl_ext.h>
+
+#include "openclext.h"
+
+#include "mock_icd.h"
+
+int main(void)
+{
+    check("null streams are invalid",
+        clextDumpResolution(nullptr) == CL_INVALID_VALUE);
+
+    // Initializes the dispatch table for the first platform.
+    char src = 1, dst = 0;
+    clEnqueueMemcpyINTEL((cl_command_queue)&mock_queue, CL_TRUE,
+        &dst, &src, 1, 0, nullptr, nullptr);
+
+    cl_int errorCode = CL_SUCCESS;
+    std::string dump = mock_capture_dump(clextDumpResolution, &errorCode);
+    check("the resolution is dumped", errorCode == CL_SUCCESS);
+
+    check("the platform is named",
+        mock_find_line(dump, "Mock Platform").find("Platform 0") == 0);
+    check("found extension APIs are resolved",
+        mock_find_line(dump, "clEnqueueMemcpyINTEL ").find("Resolved") !=
+            std::string::npos);
+    // The mock does not support this extension API.
+    check("missing extension APIs are null",
+        mock_find_line(dump, "clEnqueueMemsetINTEL ").find("Null") !=
+            std::string::npos);
+
+    return check_result();
+}
@@ -0,0 +1,41 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Checks that clextDumpStats writes the latency statistics for each extension
+// API that has been called, and only for those extension APIs.
+
+#include <CL/cl_ext.h>
+
+#include <stdio.h>
+
+#include "openclext.h"
+
+#include "mock_icd.h"
+
+int main(void)
+{
+    check("null streams are invalid",
+        clextDumpStats(nullptr) == CL_INVALID_VALUE);
+
+    char src = 1, dst = 0;
+    for (int i = 0; i < 3; i++) {
+        clEnqueueMemcpyINTEL((cl_command_queue)&mock_queue, CL_TRUE,
+            &dst, &src, 1, 0, nullptr, nullptr);
+    }
+
+    cl_int errorCode = CL_SUCCESS;
+    std::string dump = mock_capture_dump(clextDumpStats, &errorCode);
+    check("the statistics are dumped", errorCode == CL_SUCCESS);
+
+    unsigned calls = 0;
+    std::string line = mock_find_line(dump, "clEnqueueMemcpyINTEL ");
+    check("each call is counted",
+        sscanf(line.c_str(), "%*s %u", &calls) == 1 && calls == 3);
+    check("extension APIs that were not called are not dumped",
+        mock_find_line(dump, "clEnqueueMemFillINTEL ").empty());
+
+    return check_result();
+}
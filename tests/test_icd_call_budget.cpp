@@ -0,0 +1,140 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Checks how many calls into the ICD the extension loader makes for each
+// extension function call after the dispatch tables are initialized.  If a
+// change to the generator increases these numbers, the budgets below must be
+// updated deliberately.
+
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+
+#include <stdio.h>
+
+#include "mock_icd.h"
+#include "openclext.h"
+#include "test_api_prototypes.h"
+
+#if defined(CLEXT_SINGLE_PLATFORM_ONLY)
+// The single dispatch table is returned without any queries.
+static const cl_ulong queueBudget = 0;
+static const cl_ulong contextBudget = 0;
+static const cl_ulong deviceBudget = 0;
+static const cl_ulong kernelBudget = 0;
+static const cl_ulong commandBufferBudget = 0;
+static const cl_ulong semaphoreBudget = 0;
+#else
+// Queue: clGetCommandQueueInfo + clGetDeviceInfo.
+// Context: clGetContextInfo x2 + clGetDeviceInfo.
+// Device: clGetDeviceInfo.
+// Kernel: clGetKernelInfo + the context queries.
+// Command buffers and semaphores: one probe per platform until a match.
+static const cl_ulong queueBudget = 2;
+static const cl_ulong contextBudget = 3;
+static const cl_ulong deviceBudget = 1;
+static const cl_ulong kernelBudget = 4;
+static const cl_ulong commandBufferBudget = MOCK_PLATFORM_COUNT;
+static const cl_ulong semaphoreBudget = MOCK_PLATFORM_COUNT;
+#endif
+
+#if defined(CLEXT_SPLIT_TRANSLATION_UNITS)
+// clGetExtensionFunctionAddressForPlatform.
+static const cl_ulong lookupBudget = 1;
+#else
+// Found in the initialized dispatch tables.
+static const cl_ulong lookupBudget = 0;
+#endif
+
+// Checks the ICD calls made since the count was last reset, and prints the
+// count along with the name of the check.
+static void check_budget(const char* name, cl_int errorCode, cl_ulong budget)
+{
+    cl_ulong count = clextGetICDCallCount();
+    char description[128];
+    if (errorCode != CL_SUCCESS) {
+        snprintf(description, sizeof(description),
+            "%s returned %d", name, errorCode);
+    } else {
+        snprintf(description, sizeof(description),
+            "%s: %u ICD calls (budget %u)",
+            name, (unsigned)count, (unsigned)budget);
+    }
+    check(description, errorCode == CL_SUCCESS && count <= budget);
+    clextResetICDCallCount();
+}
+
+int main(void)
+{
+    // All objects belong to the last platform, so searches over the dispatch
+    // tables cannot stop early.
+    const mock_object device = {
+        mock_get_platform(MOCK_PLATFORM_COUNT - 1), nullptr, nullptr };
+    const mock_object context = { device.platform, &device, nullptr };
+    const mock_object object = { device.platform, &device, &context };
+
+    cl_command_queue queue = (cl_command_queue)&object;
+    cl_kernel kernel = (cl_kernel)&object;
+    cl_command_buffer_khr cmdbuf = (cl_command_buffer_khr)&object;
+    cl_semaphore_khr semaphore = (cl_semaphore_khr)&object;
+
+    // Initializes the dispatch tables.
+    char src = 0, dst = 0;
+    clextResetICDCallCount();
+    cl_int errorCode = clEnqueueMemcpyINTEL(
+        queue, CL_TRUE, &dst, &src, 1, 0, nullptr, nullptr);
+    check("initialization makes ICD calls",
+        errorCode == CL_SUCCESS && clextGetICDCallCount() != 0);
+    clextResetICDCallCount();
+
+#if defined(CLEXT_SPLIT_TRANSLATION_UNITS)
+    // Each extension has its own dispatch table, which is initialized the
+    // first time one of its functions is called.
+    clCreateSubDevicesEXT(
+        (cl_device_id)&device, nullptr, 0, nullptr, nullptr);
+    clFinalizeCommandBufferKHR(cmdbuf);
+    clRetainSemaphoreKHR(semaphore);
+    clextResetICDCallCount();
+#endif
+
+    errorCode = clEnqueueMemcpyINTEL(
+        queue, CL_TRUE, &dst, &src, 1, 0, nullptr, nullptr);
+    check_budget("clEnqueueMemcpyINTEL", errorCode, queueBudget);
+
+    clHostMemAllocINTEL(
+        (cl_context)&context, nullptr, 1, 0, &errorCode);
+    check_budget("clHostMemAllocINTEL",
+        errorCode == CL_INVALID_VALUE ? CL_SUCCESS : errorCode, contextBudget);
+
+    errorCode = clCreateSubDevicesEXT(
+        (cl_device_id)&device, nullptr, 0, nullptr, nullptr);
+    check_budget("clCreateSubDevicesEXT",
+        errorCode == CL_INVALID_VALUE ? CL_SUCCESS : errorCode, deviceBudget);
+
+    errorCode = clSetKernelArgMemPointerINTEL(kernel, 0, nullptr);
+    check_budget("clSetKernelArgMemPointerINTEL", errorCode, kernelBudget);
+
+    errorCode = clFinalizeCommandBufferKHR(cmdbuf);
+    check_budget("clFinalizeCommandBufferKHR", errorCode, commandBufferBudget);
+
+    errorCode = clRetainSemaphoreKHR(semaphore);
+    check_budget("clRetainSemaphoreKHR", errorCode, semaphoreBudget);
+
+    // The address is the mock's function, not the extension loader's.
+    void* function = clextGetFunctionAddress(
+        device.platform, "clEnqueueMemcpyINTEL");
+    void* mockFunction = clGetExtensionFunctionAddressForPlatform(
+        device.platform, "clEnqueueMemcpyINTEL");
+    check_budget("clextGetFunctionAddress",
+        function && function == mockFunction ? CL_SUCCESS : CL_INVALID_VALUE,
+        lookupBudget);
+
+    function = clextGetFunctionAddress(
+        device.platform, "clNotAnExtensionFunctionINTEL");
+    check_budget("clextGetFunctionAddress (unknown)",
+        function ? CL_INVALID_VALUE : CL_SUCCESS, lookupBudget);
+
+    return check_result();
+}
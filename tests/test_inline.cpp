@@ -0,0 +1,40 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Checks that extension APIs called after including openclext_inline.h call
+// the inline functions.  This test does not link against the OpenCL
+// Extension Loader library or an OpenCL implementation that exports the
+// extension APIs, so it only links if every call is inline.
+
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+
+#include "openclext_inline.h"
+
+#include "mock_icd.h"
+
+int main(void)
+{
+    const mock_object device = {
+        mock_get_platform(MOCK_PLATFORM_COUNT - 1), nullptr, nullptr };
+    const mock_object context = { device.platform, &device, nullptr };
+    const mock_object object = { device.platform, &device, &context };
+
+    char src = 1, dst = 0;
+    cl_int errorCode = clEnqueueMemcpyINTEL(
+        (cl_command_queue)&object, CL_TRUE, &dst, &src, 1, 0, nullptr, nullptr);
+    check("clEnqueueMemcpyINTEL", errorCode == CL_SUCCESS && dst == src);
+
+    errorCode = clRetainSemaphoreKHR((cl_semaphore_khr)&object);
+    check("clRetainSemaphoreKHR", errorCode == CL_SUCCESS);
+
+    // The mock does not support this extension API.
+    errorCode = clEnqueueMemsetINTEL(
+        (cl_command_queue)&object, &dst, 0, 1, 0, nullptr, nullptr);
+    check("clEnqueueMemsetINTEL", errorCode == CL_INVALID_OPERATION);
+
+    return check_result();
+}
@@ -0,0 +1,117 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Checks the live metrics shared memory segment, as it is read by clext-top,
+// after calling supported and unsupported extension APIs in a mock OpenCL
+// implementation, and that a child process created by fork() counts its
+// calls in its own segment.
+
+#include <CL/cl_ext.h>
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "openclext_metrics_layout.h"
+
+#include "mock_icd.h"
+
+static const openclext_metrics_segment* _map_segment(pid_t pid)
+{
+    char name[64];
+    snprintf(name, sizeof(name),
+        "/" OPENCLEXT_METRICS_PREFIX "%u", (unsigned)pid);
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0) {
+        return nullptr;
+    }
+    void* ptr = mmap(nullptr, sizeof(openclext_metrics_segment),
+        PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    return ptr == MAP_FAILED ? nullptr : (const openclext_metrics_segment*)ptr;
+}
+
+static const openclext_metrics_slot* _find_slot(
+    const openclext_metrics_segment* segment,
+    const char* name)
+{
+    uint32_t used = segment->header.slot_used.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < used && i < segment->header.slot_count; i++) {
+        const openclext_metrics_slot* slot = &segment->slots[i];
+        if (slot->ready.load(std::memory_order_acquire) &&
+            strcmp(slot->name, name) == 0) {
+            return slot;
+        }
+    }
+    return nullptr;
+}
+
+static bool _check_slot(
+    const openclext_metrics_segment* segment,
+    const char* name,
+    uint64_t calls,
+    uint64_t errors)
+{
+    const openclext_metrics_slot* slot = _find_slot(segment, name);
+    return slot &&
+        slot->calls.load(std::memory_order_relaxed) == calls &&
+        slot->errors.load(std::memory_order_relaxed) == errors;
+}
+
+int main(void)
+{
+    cl_command_queue queue = (cl_command_queue)&mock_queue;
+
+    char src[16] = {}, dst[16] = {};
+    for (int i = 0; i < 5; i++) {
+        clEnqueueMemcpyINTEL(
+            queue, CL_TRUE, dst, src, sizeof(src), 0, nullptr, nullptr);
+    }
+    for (int i = 0; i < 2; i++) {
+        clEnqueueMemsetINTEL(queue, dst, 0, sizeof(dst), 0, nullptr, nullptr);
+    }
+
+    const openclext_metrics_segment* segment = _map_segment(getpid());
+    check("the segment is created", segment != nullptr);
+    if (segment == nullptr) {
+        return check_result();
+    }
+    check("the segment header is written",
+        segment->header.magic.load(std::memory_order_acquire) ==
+            OPENCLEXT_METRICS_MAGIC &&
+        segment->header.version == OPENCLEXT_METRICS_VERSION &&
+        segment->header.pid == (uint32_t)getpid() &&
+        segment->header.slot_count == OPENCLEXT_METRICS_SLOTS);
+    check("calls are counted",
+        _check_slot(segment, "clEnqueueMemcpyINTEL", 5, 0));
+    check("calls to unsupported APIs are counted as errors",
+        _check_slot(segment, "clEnqueueMemsetINTEL", 2, 2));
+
+    // Output that is not flushed would be written again by the child.
+    fflush(stdout);
+    pid_t child = fork();
+    if (child == 0) {
+        clEnqueueMemcpyINTEL(
+            queue, CL_TRUE, dst, src, sizeof(src), 0, nullptr, nullptr);
+        const openclext_metrics_segment* childSegment = _map_segment(getpid());
+        bool counted = childSegment &&
+            _check_slot(childSegment, "clEnqueueMemcpyINTEL", 1, 0);
+        exit(counted ? 0 : 1);
+    }
+    int status = 0;
+    check("a child process counts calls in its own segment",
+        child > 0 && waitpid(child, &status, 0) == child &&
+        WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    check("a child process does not count calls in the parent's segment",
+        _check_slot(segment, "clEnqueueMemcpyINTEL", 5, 0));
+    check("a child process removes its segment when it exits",
+        _map_segment(child) == nullptr);
+
+    return check_result();
+}
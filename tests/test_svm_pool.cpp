@@ -0,0 +1,121 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Checks that the ARM SVM pool carves small allocations from pooled
+// allocations for each set of SVM flags, returns enqueued frees to the pool
+// after the events they wait for complete, and releases pooled memory when it
+// is trimmed, by counting the SVM allocations made by a mock OpenCL
+// implementation.
+
+#include <CL/cl_ext.h>
+
+#include <stdint.h>
+
+#include "openclext.h"
+
+#include "mock_icd.h"
+
+static int user_free_count = 0;
+
+static void CL_CALLBACK user_free_func(
+    cl_command_queue queue,
+    cl_uint num_svm_pointers,
+    void* svm_pointers[],
+    void* user_data)
+{
+    for (cl_uint i = 0; i < num_svm_pointers; i++) {
+        clextSVMFreeARM((cl_context)user_data, svm_pointers[i]);
+        user_free_count++;
+    }
+}
+
+int main(void)
+{
+    cl_context context = (cl_context)&mock_context;
+    cl_command_queue queue = (cl_command_queue)&mock_queue;
+
+    const cl_svm_mem_flags_arm flags = CL_MEM_READ_WRITE;
+    void* a = clextSVMAllocARM(context, flags, 100, 0);
+    void* b = clextSVMAllocARM(context, flags, 100, 0);
+    check("small allocations share a pooled allocation",
+        a && b && a != b && mock_usm_allocation_count == 1);
+    check("small allocations are aligned",
+        (uintptr_t)a % 128 == 0 && (uintptr_t)b % 128 == 0);
+
+    clextSVMFreeARM(context, b);
+    b = clextSVMAllocARM(context, flags, 100, 0);
+    check("freed memory is reused",
+        b && mock_usm_allocation_count == 1 &&
+        mock_usm_live_allocation_count == 1);
+
+    clextSVMFreeARM(context, b);
+    clextSVMFreeARM(context, b);
+    b = clextSVMAllocARM(context, flags, 100, 0);
+    void* other = clextSVMAllocARM(context, flags, 100, 0);
+    check("double frees do not corrupt the pool", b && other && b != other);
+    clextSVMFreeARM(context, other);
+
+    void* readOnly = clextSVMAllocARM(context, CL_MEM_READ_ONLY, 100, 0);
+    check("each set of flags has its own pool",
+        readOnly && mock_usm_allocation_count == 2 &&
+        mock_svm_flags == CL_MEM_READ_ONLY);
+
+    void* large = clextSVMAllocARM(context, flags, 1024 * 1024, 0);
+    check("large allocations are not pooled",
+        large && mock_usm_allocation_count == 3);
+    clextSVMFreeARM(context, large);
+    check("large allocations are freed directly",
+        mock_usm_live_allocation_count == 2);
+
+    // The free waits for an event that has not completed.
+    const mock_object pending = {
+        mock_device.platform, &mock_device, &mock_context };
+    cl_event event = (cl_event)&pending;
+    void* pointers[] = { a, b };
+    cl_int errorCode = clextEnqueueSVMFreeARM(
+        queue, 2, pointers, nullptr, nullptr, 1, &event, nullptr);
+    check("frees are enqueued",
+        errorCode == CL_SUCCESS && mock_svm_free_call_count == 1);
+    void* c = clextSVMAllocARM(context, flags, 100, 0);
+    check("enqueued frees are not reused before the events complete",
+        c && c != a && c != b);
+
+    mock_complete_event(event);
+    void* d = clextSVMAllocARM(context, flags, 100, 0);
+    check("enqueued frees are returned to the pool",
+        (d == a || d == b) && mock_usm_allocation_count == 3 &&
+        mock_usm_live_allocation_count == 2);
+
+    void* userPointers[] = { c, d };
+    errorCode = clextEnqueueSVMFreeARM(
+        queue, 2, userPointers, user_free_func, context, 0, nullptr, nullptr);
+    check("enqueued frees call the free function",
+        errorCode == CL_SUCCESS && user_free_count == 2);
+
+    // Memory for contexts that cannot be tracked is not pooled.
+    const mock_object untracked = {
+        mock_device.platform, &mock_device, nullptr };
+    mock_context_destructor_unsupported = true;
+    int allocations = mock_usm_allocation_count;
+    void* e = clextSVMAllocARM((cl_context)&untracked, flags, 100, 0);
+    void* f = clextSVMAllocARM((cl_context)&untracked, flags, 100, 0);
+    check("contexts without destructor callbacks are not pooled",
+        e && f && mock_usm_allocation_count == allocations + 2);
+    clextSVMFreeARM((cl_context)&untracked, e);
+    clextSVMFreeARM((cl_context)&untracked, f);
+    check("memory for contexts that are not pooled is freed directly",
+        mock_usm_live_allocation_count == 2);
+    mock_context_destructor_unsupported = false;
+
+    clextSVMFreeARM(context, readOnly);
+    check("pooled memory is kept after it is freed",
+        mock_usm_live_allocation_count == 2);
+    check("trim succeeds", clextSVMPoolTrimARM(context) == CL_SUCCESS);
+    check("trim releases pooled memory",
+        mock_usm_live_allocation_count == 0);
+
+    return check_result();
+}
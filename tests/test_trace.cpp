@@ -0,0 +1,48 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Traces calls to a mock OpenCL implementation from two threads to the trace
+// file named by the first argument.  trace_json.cmake then checks that the
+// trace file written when the process exits is well-formed JSON with a begin
+// and end event for each call.
+
+#include <CL/cl_ext.h>
+
+#include <stdlib.h>
+
+#include <thread>
+
+#include "mock_icd.h"
+
+static void _copy(int count)
+{
+    char src[16] = {}, dst[16] = {};
+    for (int i = 0; i < count; i++) {
+        cl_int errorCode = clEnqueueMemcpyINTEL((cl_command_queue)&mock_queue,
+            CL_TRUE, dst, src, sizeof(src), 0, nullptr, nullptr);
+        check("copies are traced", errorCode == CL_SUCCESS);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        return 1;
+    }
+#if defined(_WIN32)
+    _putenv_s("CLEXT_TRACE_FILE", argv[1]);
+#else
+    setenv("CLEXT_TRACE_FILE", argv[1], 1);
+#endif
+
+    // Each thread records events into its own ring buffer.
+    _copy(10);
+    std::thread thread(_copy, 10);
+    thread.join();
+
+    // The trace file is finished when the process exits.
+    return check_result();
+}
@@ -0,0 +1,72 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Checks that clextDumpStats writes the data volume statistics for copies to
+// a mock clEnqueueMemcpyINTEL for each queue and each platform, and that
+// copies to queues that do not fit in the statistics table are still
+// included in the platform totals.
+
+#include <CL/cl_ext.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "openclext.h"
+
+#include "mock_icd.h"
+
+// More queues than fit in the statistics table.
+static const int kQueueCount = 300;
+static mock_object _queues[kQueueCount];
+
+// Returns the calls and bytes in the statistics line for handle.
+static bool _get_totals(
+    const std::string& dump,
+    const void* handle,
+    unsigned* calls,
+    unsigned* bytes)
+{
+    char find[32];
+    snprintf(find, sizeof(find), "0x%" PRIxPTR " ", (uintptr_t)handle);
+    std::string line = mock_find_line(dump, find);
+    return sscanf(line.c_str(), "%*s %u %u", calls, bytes) == 2;
+}
+
+int main(void)
+{
+    char src[100] = {}, dst[100] = {};
+    for (int i = 0; i < 3; i++) {
+        clEnqueueMemcpyINTEL((cl_command_queue)&mock_queue, CL_TRUE,
+            dst, src, sizeof(src), 0, nullptr, nullptr);
+    }
+
+    cl_int errorCode = CL_SUCCESS;
+    std::string dump = mock_capture_dump(clextDumpStats, &errorCode);
+    check("the statistics are dumped", errorCode == CL_SUCCESS);
+
+    unsigned calls = 0, bytes = 0;
+    check("transfers are counted for each queue",
+        _get_totals(dump, &mock_queue, &calls, &bytes) &&
+        calls == 3 && bytes == 300);
+    check("transfers are counted for each platform",
+        _get_totals(dump, mock_device.platform, &calls, &bytes) &&
+        calls == 3 && bytes == 300);
+
+    for (int i = 0; i < kQueueCount; i++) {
+        _queues[i] = mock_queue;
+        clEnqueueMemcpyINTEL((cl_command_queue)&_queues[i], CL_TRUE,
+            dst, src, 10, 0, nullptr, nullptr);
+    }
+    dump = mock_capture_dump(clextDumpStats, &errorCode);
+    check("transfers to other queues are counted for each platform",
+        _get_totals(dump, mock_device.platform, &calls, &bytes) &&
+        calls == 3 + kQueueCount && bytes == 300 + 10 * kQueueCount);
+    check("transfers to other queues are not shown for each queue",
+        !mock_find_line(dump, " transfers of ").empty() &&
+        !mock_find_line(dump, "to other queues are not shown").empty());
+
+    return check_result();
+}
@@ -0,0 +1,57 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Checks that extension APIs with USDT probes return the same results, by
+// calling a mock OpenCL implementation through each probe: supported and
+// unsupported extension APIs, with and without errcode_ret.
+// usdt_probes.cmake checks that the probes are in the test executable.
+
+#include <CL/cl_ext.h>
+
+#include "mock_icd.h"
+
+int main(void)
+{
+    cl_context context = (cl_context)&mock_context;
+    cl_command_queue queue = (cl_command_queue)&mock_queue;
+
+    char src[16] = {}, dst[16] = {};
+    src[0] = 42;
+    cl_int errorCode = clEnqueueMemcpyINTEL(
+        queue, CL_TRUE, dst, src, sizeof(src), 0, nullptr, nullptr);
+    check("supported APIs are called", errorCode == CL_SUCCESS && dst[0] == 42);
+
+    errorCode = clEnqueueMemsetINTEL(
+        queue, dst, 0, sizeof(dst), 0, nullptr, nullptr);
+    check("unsupported APIs return an error",
+        errorCode == CL_INVALID_OPERATION);
+
+    // The status for call_return is read from errcode_ret, even when the
+    // application does not pass one.
+    void* ptr = clDeviceMemAllocINTEL(
+        context, (cl_device_id)&mock_device, nullptr, 64, 0, nullptr);
+    check("APIs without errcode_ret are called", ptr != nullptr);
+    clMemFreeINTEL(context, ptr);
+
+    errorCode = CL_SUCCESS;
+    ptr = clDeviceMemAllocINTEL(
+        context, (cl_device_id)&mock_device, nullptr, 64, 0, &errorCode);
+    check("APIs with errcode_ret are called",
+        ptr != nullptr && errorCode == CL_SUCCESS);
+    clMemFreeINTEL(context, ptr);
+
+    cl_command_buffer_khr cmdbuf =
+        clCreateCommandBufferKHR(1, &queue, nullptr, nullptr);
+    check("unsupported APIs without errcode_ret return null",
+        cmdbuf == nullptr);
+
+    errorCode = CL_SUCCESS;
+    cmdbuf = clCreateCommandBufferKHR(1, &queue, nullptr, &errorCode);
+    check("unsupported APIs with errcode_ret return an error",
+        cmdbuf == nullptr && errorCode == CL_INVALID_OPERATION);
+
+    return check_result();
+}
@@ -0,0 +1,114 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Checks that unified shared memory is emulated with SVM when a mock OpenCL
+// implementation supports SVM but not unified shared memory.
+
+#include <CL/cl_ext.h>
+
+#include <string.h>
+
+#include <vector>
+
+#include "mock_icd.h"
+
+int main(void)
+{
+    mock_usm_unsupported = true;
+
+    const mock_object kernelObject = {
+        mock_device.platform, &mock_device, &mock_context };
+    cl_context context = (cl_context)&mock_context;
+    cl_command_queue queue = (cl_command_queue)&mock_queue;
+
+    cl_int errorCode = CL_SUCCESS;
+    char* deviceMem = (char*)clDeviceMemAllocINTEL(
+        context, (cl_device_id)&mock_device, nullptr, 4096, 0, &errorCode);
+    check("device memory is coarse-grained SVM",
+        deviceMem && errorCode == CL_SUCCESS &&
+        mock_svm_flags == CL_MEM_READ_WRITE);
+
+    char* sharedMem = (char*)clSharedMemAllocINTEL(
+        context, (cl_device_id)&mock_device, nullptr, 4096, 0, &errorCode);
+    check("shared memory is fine-grained SVM",
+        sharedMem && errorCode == CL_SUCCESS &&
+        mock_svm_flags == (CL_MEM_READ_WRITE | CL_MEM_SVM_FINE_GRAIN_BUFFER));
+
+    char* hostMem = (char*)clHostMemAllocINTEL(
+        context, nullptr, 4096, 0, &errorCode);
+    check("host memory is fine-grained SVM",
+        hostMem && errorCode == CL_SUCCESS &&
+        mock_svm_flags == (CL_MEM_READ_WRITE | CL_MEM_SVM_FINE_GRAIN_BUFFER));
+
+    cl_unified_shared_memory_type_intel type = CL_MEM_TYPE_UNKNOWN_INTEL;
+    void* base = nullptr;
+    clGetMemAllocInfoINTEL(context, deviceMem + 100, CL_MEM_ALLOC_TYPE_INTEL,
+        sizeof(type), &type, nullptr);
+    clGetMemAllocInfoINTEL(context, deviceMem + 100, CL_MEM_ALLOC_BASE_PTR_INTEL,
+        sizeof(base), &base, nullptr);
+    check("emulated allocations can be queried",
+        type == CL_MEM_TYPE_DEVICE_INTEL && base == deviceMem);
+
+    int local = 0;
+    errorCode = clGetMemAllocInfoINTEL(context, &local, CL_MEM_ALLOC_TYPE_INTEL,
+        sizeof(type), &type, nullptr);
+    check("other memory is unknown",
+        errorCode == CL_SUCCESS && type == CL_MEM_TYPE_UNKNOWN_INTEL);
+
+    std::vector<char> src(4096, 42);
+    int calls = mock_svm_call_count;
+    errorCode = clEnqueueMemcpyINTEL(queue, CL_TRUE,
+        sharedMem, src.data(), src.size(), 0, nullptr, nullptr);
+    check("copies are SVM copies",
+        errorCode == CL_SUCCESS && mock_svm_call_count - calls == 1 &&
+        memcmp(sharedMem, src.data(), src.size()) == 0);
+
+    const cl_uint pattern = 0x01010101;
+    calls = mock_svm_call_count;
+    errorCode = clEnqueueMemFillINTEL(queue, sharedMem,
+        &pattern, sizeof(pattern), 4096, 0, nullptr, nullptr);
+    check("fills are SVM fills",
+        errorCode == CL_SUCCESS && mock_svm_call_count - calls == 1 &&
+        sharedMem[4095] == 1);
+
+    calls = mock_svm_call_count;
+    errorCode = clSetKernelArgMemPointerINTEL(
+        (cl_kernel)&kernelObject, 0, deviceMem);
+    check("kernel arguments are SVM pointers",
+        errorCode == CL_SUCCESS && mock_svm_call_count - calls == 1);
+
+    errorCode = clEnqueueMigrateMemINTEL(queue, sharedMem, 4096, 0,
+        0, nullptr, nullptr);
+    check("migrations succeed", errorCode == CL_SUCCESS);
+    errorCode = clEnqueueMemAdviseINTEL(queue, sharedMem, 4096, 0,
+        0, nullptr, nullptr);
+    check("advice succeeds", errorCode == CL_SUCCESS);
+
+    const cl_mem_properties_intel properties[] = { 0x1234, 0, 0 };
+    void* invalid = clDeviceMemAllocINTEL(
+        context, (cl_device_id)&mock_device, properties, 4096, 0, &errorCode);
+    check("errors are returned",
+        invalid == nullptr && errorCode == CL_INVALID_PROPERTY);
+
+    int live = mock_usm_live_allocation_count;
+    errorCode = clMemBlockingFreeINTEL(context, hostMem);
+    check("blocking frees are not emulated",
+        errorCode == CL_INVALID_OPERATION &&
+        mock_usm_live_allocation_count == live);
+    type = CL_MEM_TYPE_UNKNOWN_INTEL;
+    clGetMemAllocInfoINTEL(context, hostMem, CL_MEM_ALLOC_TYPE_INTEL,
+        sizeof(type), &type, nullptr);
+    check("allocations are still recorded after a blocking free",
+        type == CL_MEM_TYPE_HOST_INTEL);
+
+    clMemFreeINTEL(context, deviceMem);
+    clMemFreeINTEL(context, sharedMem);
+    clMemFreeINTEL(context, hostMem);
+    check("emulated allocations are freed",
+        mock_usm_live_allocation_count == live - 3);
+
+    return check_result();
+}
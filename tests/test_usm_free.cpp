@@ -0,0 +1,80 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Checks that clextMemFreeAfterEvents frees memory only after all of its
+// events complete, without waiting for the events, using mock events that
+// complete when the test completes them.
+
+#include <CL/cl_ext.h>
+
+#include <chrono>
+#include <thread>
+
+#include "openclext.h"
+
+#include "mock_icd.h"
+
+// The memory is freed by a background thread, so wait a while for it.
+static bool wait_for_live_allocations(int count)
+{
+    for (int i = 0; i < 5000; i++) {
+        if (mock_usm_live_allocation_count == count) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+int main(void)
+{
+    const mock_object first = {
+        mock_device.platform, &mock_device, &mock_context };
+    const mock_object second = {
+        mock_device.platform, &mock_device, &mock_context };
+    cl_context context = (cl_context)&mock_context;
+    const cl_event events[] = { (cl_event)&first, (cl_event)&second };
+
+    // Large allocations are not pooled, so they are freed by the mock.
+    const size_t size = 1024 * 1024;
+
+    cl_int errorCode = CL_SUCCESS;
+    void* ptr = clextDeviceMemAllocINTEL(
+        context, (cl_device_id)&mock_device, nullptr, size, 0, &errorCode);
+    errorCode = clextMemFreeAfterEvents(context, ptr, 2, events);
+    check("free is deferred",
+        errorCode == CL_SUCCESS && mock_usm_live_allocation_count == 1);
+
+    mock_complete_event(events[0]);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    check("memory is not freed until all events complete",
+        mock_usm_live_allocation_count == 1);
+
+    mock_complete_event(events[1]);
+    check("memory is freed after all events complete",
+        wait_for_live_allocations(0));
+
+    void* ptrs[8];
+    for (auto& p : ptrs) {
+        p = clextDeviceMemAllocINTEL(
+            context, (cl_device_id)&mock_device, nullptr, size, 0, &errorCode);
+        clextMemFreeAfterEvents(context, p, 1, events);
+    }
+    mock_complete_event(events[0]);
+    check("many deferred frees are freed", wait_for_live_allocations(0));
+
+    ptr = clextDeviceMemAllocINTEL(
+        context, (cl_device_id)&mock_device, nullptr, size, 0, &errorCode);
+    errorCode = clextMemFreeAfterEvents(context, ptr, 0, nullptr);
+    check("memory is freed immediately without events",
+        errorCode == CL_SUCCESS && mock_usm_live_allocation_count == 0);
+
+    check("a null event is an error",
+        clextMemFreeAfterEvents(context, ptr, 1, nullptr) ==
+            CL_INVALID_EVENT_WAIT_LIST);
+
+    return check_result();
+}
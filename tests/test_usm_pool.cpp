@@ -0,0 +1,121 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Checks that the USM pool carves small allocations from pooled allocations,
+// reuses freed memory, and releases pooled memory when it is trimmed, by
+// counting the USM allocations made by a mock OpenCL implementation.
+
+#include <CL/cl_ext.h>
+
+#include <stdint.h>
+
+#include "openclext.h"
+
+#include "mock_icd.h"
+
+int main(void)
+{
+    cl_context context = (cl_context)&mock_context;
+
+    cl_int errorCode = CL_SUCCESS;
+    void* a = clextDeviceMemAllocINTEL(
+        context, (cl_device_id)&mock_device, nullptr, 100, 0, &errorCode);
+    void* b = clextDeviceMemAllocINTEL(
+        context, (cl_device_id)&mock_device, nullptr, 100, 0, &errorCode);
+    check("small allocations share a pooled allocation",
+        a && b && a != b && errorCode == CL_SUCCESS &&
+        mock_usm_allocation_count == 1);
+    check("small allocations are aligned",
+        (uintptr_t)a % 128 == 0 && (uintptr_t)b % 128 == 0);
+
+    clextMemFreeINTEL(context, a);
+    clextMemFreeINTEL(context, b);
+    a = clextDeviceMemAllocINTEL(
+        context, (cl_device_id)&mock_device, nullptr, 100, 0, &errorCode);
+    check("freed memory is reused",
+        a && mock_usm_allocation_count == 1 &&
+        mock_usm_live_allocation_count == 1);
+
+    void* aligned = clextDeviceMemAllocINTEL(
+        context, (cl_device_id)&mock_device, nullptr, 16, 4096, &errorCode);
+    check("pooled allocations honor alignment",
+        aligned && (uintptr_t)aligned % 4096 == 0);
+
+    void* shared = clextSharedMemAllocINTEL(
+        context, (cl_device_id)&mock_device, nullptr, 100, 0, &errorCode);
+    check("each type of USM has its own pool",
+        shared && mock_usm_allocation_count == 3);
+
+    void* large = clextDeviceMemAllocINTEL(
+        context, (cl_device_id)&mock_device,
+        nullptr, 1024 * 1024, 0, &errorCode);
+    check("large allocations are not pooled",
+        large && mock_usm_allocation_count == 4);
+    clextMemFreeINTEL(context, large);
+    check("large allocations are freed directly",
+        mock_usm_live_allocation_count == 3);
+
+    const cl_mem_properties_intel properties[] = {
+        CL_MEM_ALLOC_FLAGS_INTEL, 0, 0 };
+    void* withProperties = clextDeviceMemAllocINTEL(
+        context, (cl_device_id)&mock_device, properties, 100, 0, &errorCode);
+    check("allocations with properties are not pooled",
+        withProperties && mock_usm_allocation_count == 5);
+    clextMemFreeINTEL(context, withProperties);
+
+    check("interior pointers are not freed",
+        clextMemFreeINTEL(context, (char*)a + 1) == CL_INVALID_VALUE);
+    check("chunks that were never allocated are not freed",
+        clextMemFreeINTEL(context, (char*)a + 64 * 1024) == CL_INVALID_VALUE);
+
+    b = clextDeviceMemAllocINTEL(
+        context, (cl_device_id)&mock_device, nullptr, 100, 0, &errorCode);
+    clextMemFreeINTEL(context, b);
+    check("double frees are not freed",
+        clextMemFreeINTEL(context, b) == CL_INVALID_VALUE);
+    void* c = clextDeviceMemAllocINTEL(
+        context, (cl_device_id)&mock_device, nullptr, 100, 0, &errorCode);
+    void* d = clextDeviceMemAllocINTEL(
+        context, (cl_device_id)&mock_device, nullptr, 100, 0, &errorCode);
+    check("double frees do not corrupt the pool", c && d && c != d);
+    clextMemFreeINTEL(context, c);
+    clextMemFreeINTEL(context, d);
+
+    clextMemFreeINTEL(context, a);
+    clextMemFreeINTEL(context, aligned);
+    clextMemFreeINTEL(context, shared);
+    check("pooled memory is kept after it is freed",
+        mock_usm_live_allocation_count == 3);
+    check("trim succeeds", clextMemPoolTrimINTEL(context) == CL_SUCCESS);
+    check("trim releases pooled memory",
+        mock_usm_live_allocation_count == 0);
+
+    // Memory for contexts that cannot be tracked is not pooled.
+    const mock_object untracked = {
+        mock_device.platform, &mock_device, nullptr };
+    mock_context_destructor_unsupported = true;
+    int allocations = mock_usm_allocation_count;
+    a = clextDeviceMemAllocINTEL(
+        (cl_context)&untracked, (cl_device_id)&mock_device, nullptr, 100, 0, &errorCode);
+    b = clextDeviceMemAllocINTEL(
+        (cl_context)&untracked, (cl_device_id)&mock_device, nullptr, 100, 0, &errorCode);
+    check("contexts without destructor callbacks are not pooled",
+        a && b && mock_usm_allocation_count == allocations + 2);
+    clextMemFreeINTEL((cl_context)&untracked, a);
+    clextMemFreeINTEL((cl_context)&untracked, b);
+    check("memory for contexts that are not pooled is freed directly",
+        mock_usm_live_allocation_count == 0);
+    mock_context_destructor_unsupported = false;
+
+    // The second mock platform does not support host USM allocations.
+    const mock_object otherDevice = { mock_get_platform(1), nullptr, nullptr };
+    const mock_object otherObject = { otherDevice.platform, &otherDevice, nullptr };
+    void* host = clextHostMemAllocINTEL(
+        (cl_context)&otherObject, nullptr, 100, 0, &errorCode);
+    check("errors are returned", host == nullptr && errorCode == CL_INVALID_VALUE);
+
+    return check_result();
+}
@@ -0,0 +1,100 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Checks that the shared USM set as kernel arguments is migrated by
+// clextEnqueuePrefetchKernelArgs, and that other USM is not, by counting the
+// calls to a mock clEnqueueMigrateMemINTEL and clEnqueueMemAdviseINTEL.
+
+#include <CL/cl_ext.h>
+
+#include "openclext.h"
+
+#include "mock_icd.h"
+
+int main(void)
+{
+    const mock_object kernelObject = {
+        mock_device.platform, &mock_device, &mock_context };
+    const mock_object otherKernelObject = {
+        mock_device.platform, &mock_device, &mock_context };
+    cl_command_queue queue = (cl_command_queue)&mock_queue;
+    cl_kernel kernel = (cl_kernel)&kernelObject;
+
+    cl_int errorCode = CL_SUCCESS;
+    char* a = (char*)clSharedMemAllocINTEL((cl_context)&mock_context,
+        (cl_device_id)&mock_device, nullptr, 4096, 4096, &errorCode);
+    char* b = (char*)clSharedMemAllocINTEL((cl_context)&mock_context,
+        (cl_device_id)&mock_device, nullptr, 8192, 4096, &errorCode);
+    void* d = clDeviceMemAllocINTEL((cl_context)&mock_context,
+        (cl_device_id)&mock_device, nullptr, 4096, 4096, &errorCode);
+
+    clSetKernelArgMemPointerINTEL(kernel, 0, a);
+    clSetKernelArgMemPointerINTEL(kernel, 1, a + 100);
+    clSetKernelArgMemPointerINTEL(kernel, 2, d);
+    clSetKernelArgMemPointerINTEL(kernel, 3, b);
+
+    cl_event event = nullptr;
+    int calls = mock_migrate_call_count;
+    size_t size = mock_migrate_size;
+    errorCode = clextEnqueuePrefetchKernelArgs(
+        queue, kernel, 0, 0, nullptr, &event);
+    check("shared kernel arguments are migrated once each",
+        errorCode == CL_SUCCESS && mock_migrate_call_count - calls == 2 &&
+        mock_migrate_size - size == 4096 + 8192);
+    check("an event is returned", event != nullptr);
+    check("no advice is applied by default", mock_advise_call_count == 0);
+
+    calls = mock_migrate_call_count;
+    errorCode = clextEnqueuePrefetchKernelArgs(
+        queue, kernel, 0x4208, 0, nullptr, nullptr);
+    check("advice is applied to each migrated range",
+        errorCode == CL_SUCCESS && mock_advise_call_count == 2 &&
+        mock_migrate_call_count - calls == 2);
+
+    clSetKernelArgMemPointerINTEL(kernel, 3, nullptr);
+    calls = mock_migrate_call_count;
+    size = mock_migrate_size;
+    clextEnqueuePrefetchKernelArgs(queue, kernel, 0, 0, nullptr, nullptr);
+    check("cleared kernel arguments are not migrated",
+        mock_migrate_call_count - calls == 1 &&
+        mock_migrate_size - size == 4096);
+
+    // Pooled allocations are adjacent chunks of a single shared allocation.
+    char* x = (char*)clextSharedMemAllocINTEL((cl_context)&mock_context,
+        (cl_device_id)&mock_device, nullptr, 100, 0, &errorCode);
+    char* y = (char*)clextSharedMemAllocINTEL((cl_context)&mock_context,
+        (cl_device_id)&mock_device, nullptr, 100, 0, &errorCode);
+    cl_kernel otherKernel = (cl_kernel)&otherKernelObject;
+    clSetKernelArgMemPointerINTEL(otherKernel, 0, x);
+    clSetKernelArgMemPointerINTEL(otherKernel, 1, y);
+    clSetKernelArgMemPointerINTEL(otherKernel, 2, x + 10);
+    calls = mock_migrate_call_count;
+    size = mock_migrate_size;
+    clextEnqueuePrefetchKernelArgs(queue, otherKernel, 0, 0, nullptr, nullptr);
+    check("arguments in the same pooled allocation are coalesced",
+        mock_migrate_call_count - calls == 2);
+    check("only the pooled allocations are migrated, not the whole pool",
+        mock_migrate_size - size == 2 * 128);
+
+    check("errors are returned",
+        clextEnqueuePrefetchKernelArgs(
+            nullptr, kernel, 0, 0, nullptr, nullptr) ==
+            CL_INVALID_COMMAND_QUEUE);
+
+    calls = mock_migrate_call_count;
+    errorCode = clextReleaseKernelArgs(otherKernel);
+    clextEnqueuePrefetchKernelArgs(queue, otherKernel, 0, 0, nullptr, nullptr);
+    check("released kernel arguments are not migrated",
+        errorCode == CL_SUCCESS && mock_migrate_call_count == calls);
+
+    clextMemFreeINTEL((cl_context)&mock_context, x);
+    clextMemFreeINTEL((cl_context)&mock_context, y);
+    clMemFreeINTEL((cl_context)&mock_context, a);
+    clMemFreeINTEL((cl_context)&mock_context, b);
+    clMemFreeINTEL((cl_context)&mock_context, d);
+
+    return check_result();
+}
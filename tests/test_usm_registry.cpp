@@ -0,0 +1,94 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Checks that clGetMemAllocInfoINTEL is answered by the USM allocation
+// registry for pointers into USM allocations made by the extension loader,
+// and by the OpenCL implementation otherwise, by counting the calls to a mock
+// clGetMemAllocInfoINTEL.  When the test API is enabled, also checks that
+// queries answered by the registry make no calls into the ICD.
+
+#include <CL/cl_ext.h>
+
+#include "mock_icd.h"
+#if defined(CLEXT_ENABLE_TEST_API)
+#include "test_api_prototypes.h"
+#endif
+
+int main(void)
+{
+    const mock_object otherObject = {
+        mock_device.platform, &mock_device, nullptr };
+    cl_context context = (cl_context)&mock_context;
+    cl_context otherContext = (cl_context)&otherObject;
+
+    cl_int errorCode = CL_SUCCESS;
+    char* ptr = (char*)clDeviceMemAllocINTEL(
+        context, (cl_device_id)&mock_device, nullptr, 1000, 0, &errorCode);
+    check("allocation succeeds", ptr && errorCode == CL_SUCCESS);
+
+    cl_unified_shared_memory_type_intel type = 0;
+    void* base = nullptr;
+    size_t size = 0;
+    cl_device_id queriedDevice = nullptr;
+    size_t sizeRet = 0;
+#if defined(CLEXT_ENABLE_TEST_API)
+    clextResetICDCallCount();
+#endif
+    clGetMemAllocInfoINTEL(context, ptr + 10, CL_MEM_ALLOC_TYPE_INTEL,
+        sizeof(type), &type, &sizeRet);
+    clGetMemAllocInfoINTEL(context, ptr + 10, CL_MEM_ALLOC_BASE_PTR_INTEL,
+        sizeof(base), &base, nullptr);
+    clGetMemAllocInfoINTEL(context, ptr + 10, CL_MEM_ALLOC_SIZE_INTEL,
+        sizeof(size), &size, nullptr);
+    clGetMemAllocInfoINTEL(context, ptr + 10, CL_MEM_ALLOC_DEVICE_INTEL,
+        sizeof(queriedDevice), &queriedDevice, nullptr);
+    check("queries are answered by the registry",
+        mock_usm_info_call_count == 0 &&
+        type == CL_MEM_TYPE_DEVICE_INTEL && sizeRet == sizeof(type) &&
+        base == ptr && size == 1000 &&
+        queriedDevice == (cl_device_id)&mock_device);
+#if defined(CLEXT_ENABLE_TEST_API)
+    check("queries answered by the registry make no ICD calls",
+        clextGetICDCallCount() == 0);
+#endif
+
+    errorCode = clGetMemAllocInfoINTEL(context, ptr, CL_MEM_ALLOC_SIZE_INTEL,
+        1, &size, nullptr);
+    check("small param_value_size is an error",
+        errorCode == CL_INVALID_VALUE && mock_usm_info_call_count == 0);
+
+    clGetMemAllocInfoINTEL(context, ptr, CL_MEM_ALLOC_FLAGS_INTEL,
+        0, nullptr, nullptr);
+    check("other queries are answered by the implementation",
+        mock_usm_info_call_count == 1);
+
+    clGetMemAllocInfoINTEL(context, ptr + 1000, CL_MEM_ALLOC_TYPE_INTEL,
+        sizeof(type), &type, nullptr);
+    check("pointers past the allocation are answered by the implementation",
+        mock_usm_info_call_count == 2 && type == CL_MEM_TYPE_UNKNOWN_INTEL);
+
+    clGetMemAllocInfoINTEL(otherContext, ptr, CL_MEM_ALLOC_TYPE_INTEL,
+        sizeof(type), &type, nullptr);
+    check("other contexts are answered by the implementation",
+        mock_usm_info_call_count == 3);
+
+    mock_usm_free_fails = true;
+    errorCode = clMemFreeINTEL(context, ptr);
+    mock_usm_free_fails = false;
+    clGetMemAllocInfoINTEL(context, ptr, CL_MEM_ALLOC_TYPE_INTEL,
+        sizeof(type), &type, nullptr);
+    check("allocations that fail to be freed are still answered",
+        errorCode == CL_INVALID_VALUE &&
+        mock_usm_info_call_count == 3 && type == CL_MEM_TYPE_DEVICE_INTEL);
+
+    clMemFreeINTEL(context, ptr);
+    clGetMemAllocInfoINTEL(context, ptr, CL_MEM_ALLOC_TYPE_INTEL,
+        sizeof(type), &type, nullptr);
+    check("freed allocations are answered by the implementation",
+        mock_usm_info_call_count == 4 && type == CL_MEM_TYPE_UNKNOWN_INTEL);
+
+    return check_result();
+}
@@ -0,0 +1,96 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Checks that clext::UsmRing pushes records into a USM allocation, returns
+// batches of records that wrap around the end of the ring, and reuses the
+// space for records after they are released.
+
+#include "openclext.hpp"
+
+#include <stdint.h>
+
+#include "mock_icd.h"
+
+static bool check_records(
+    const clext::UsmRing<>& ring,
+    cl_uint first,
+    cl_uint count,
+    cl_uint value)
+{
+    for (cl_uint i = 0; i < count; i++) {
+        if (*(const cl_uint*)ring.getRecord(first + i) != value + i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(void)
+{
+    cl_context context = (cl_context)&mock_context;
+    const mock_object kernel = {
+        mock_device.platform, &mock_device, &mock_context };
+
+    const cl_uint records[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+    {
+        cl_int errorCode = CL_SUCCESS;
+        clext::UsmRing<> ring(
+            context, (cl_device_id)&mock_device,
+            sizeof(cl_uint), 4, &errorCode);
+        check("the ring is allocated",
+            errorCode == CL_SUCCESS && ring.get() != nullptr &&
+            mock_usm_live_allocation_count == 1);
+        check("the ring records are aligned",
+            (uintptr_t)ring.getRecord(0) % clext::UsmRing<>::RecordOffset == 0);
+
+        cl_uint first = 0;
+        check("an empty ring has no records", ring.peek(4, &first) == 0);
+
+        check("pushes stop when the ring is full", ring.push(records, 5) == 4);
+        check("pushes to a full ring push nothing", ring.push(records, 1) == 0);
+
+        cl_uint count = ring.peek(8, &first);
+        check("peeked records are in order",
+            count == 4 && first == 0 && check_records(ring, first, count, 0));
+        check("peeks are limited to the requested count",
+            ring.peek(2, &first) == 2 && first == 0);
+
+        ring.release(3);
+        check("released space is reused", ring.push(records + 4, 3) == 3);
+
+        count = ring.peek(8, &first);
+        check("records wrap around the end of the ring",
+            count == 4 && first == 3 && check_records(ring, first, count, 3));
+        check("the indices are in the USM allocation",
+            *(const cl_uint*)((const char*)ring.get() +
+                clext::UsmRing<>::HeadOffset) == 7 &&
+            *(const cl_uint*)((const char*)ring.get() +
+                clext::UsmRing<>::TailOffset) == 3);
+
+        check("the ring is a kernel argument",
+            ring.setKernelArg((cl_kernel)&kernel, 0) == CL_SUCCESS);
+    }
+    check("the ring is freed", mock_usm_live_allocation_count == 0);
+
+    {
+        cl_int errorCode = CL_SUCCESS;
+        clext::UsmRing<> ring(context, nullptr, 16, 8, &errorCode);
+        check("rings without a device are host USM",
+            errorCode == CL_SUCCESS && ring.get() != nullptr);
+    }
+
+    {
+        cl_int errorCode = CL_SUCCESS;
+        clext::UsmRing<> ring(
+            context, (cl_device_id)&mock_device,
+            sizeof(cl_uint), 3, &errorCode);
+        check("the capacity must be a power of two",
+            errorCode == CL_INVALID_VALUE && ring.get() == nullptr);
+    }
+
+    return check_result();
+}
@@ -0,0 +1,95 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Checks that large copies and fills are split into chunks across queues and
+// that small copies and fills are not, by counting the calls to a mock
+// clEnqueueMemcpyINTEL and clEnqueueMemFillINTEL.
+
+#include <CL/cl_ext.h>
+
+#include <vector>
+
+#include "openclext.h"
+
+#include "mock_icd.h"
+
+int main(void)
+{
+    const mock_object queue0 = {
+        mock_device.platform, &mock_device, &mock_context };
+    const mock_object queue1 = {
+        mock_device.platform, &mock_device, &mock_context };
+    const cl_command_queue queues[] = {
+        (cl_command_queue)&queue0, (cl_command_queue)&queue1 };
+
+    // Large enough to split into one chunk for each queue.
+    const size_t size = 4 * 1024 * 1024 + 123;
+    std::vector<char> src(size);
+    std::vector<char> dst(size);
+    for (size_t i = 0; i < size; i++) {
+        src[i] = (char)(i * 7);
+    }
+
+    int calls = mock_memcpy_call_count;
+    cl_int errorCode = clextEnqueueMemcpySplit(2, queues, CL_TRUE,
+        dst.data(), src.data(), size, 0, nullptr, nullptr);
+    check("large copies are split across queues",
+        errorCode == CL_SUCCESS && mock_memcpy_call_count - calls == 2);
+    check("split data is copied", dst == src);
+
+    cl_event event = nullptr;
+    calls = mock_memcpy_call_count;
+    errorCode = clextEnqueueMemcpySplit(2, queues, CL_FALSE,
+        dst.data(), src.data(), size, 0, nullptr, &event);
+    check("split copies return an event",
+        errorCode == CL_SUCCESS && event != nullptr &&
+        mock_memcpy_call_count - calls == 2);
+
+    calls = mock_memcpy_call_count;
+    errorCode = clextEnqueueMemcpySplit(2, queues, CL_TRUE,
+        dst.data(), src.data(), 4096, 0, nullptr, nullptr);
+    check("small copies are not split",
+        errorCode == CL_SUCCESS && mock_memcpy_call_count - calls == 1);
+
+    const cl_uint pattern = 0x12345678;
+    calls = mock_fill_call_count;
+    errorCode = clextEnqueueMemFillSplit(2, queues, dst.data(),
+        &pattern, sizeof(pattern), size & ~(size_t)3, 0, nullptr, nullptr);
+    check("large fills are split across queues",
+        errorCode == CL_SUCCESS && mock_fill_call_count - calls == 2);
+    bool filled = true;
+    for (size_t i = 0; i + sizeof(pattern) <= size; i += sizeof(pattern)) {
+        filled = filled && ((const cl_uint*)(dst.data() + i))[0] == pattern;
+    }
+    check("split data is filled", filled);
+
+    calls = mock_fill_call_count;
+    errorCode = clextEnqueueMemFillSplit(2, queues, dst.data(),
+        &pattern, sizeof(pattern), 4096, 0, nullptr, nullptr);
+    check("small fills are not split",
+        errorCode == CL_SUCCESS && mock_fill_call_count - calls == 1);
+
+    check("errors are returned",
+        clextEnqueueMemcpySplit(0, nullptr, CL_TRUE,
+            dst.data(), src.data(), size, 0, nullptr, nullptr) ==
+            CL_INVALID_VALUE);
+
+    // The mock cannot fill with a queue that has no context, so the second
+    // chunk cannot be enqueued.
+    const mock_object invalidQueue = {
+        mock_device.platform, &mock_device, nullptr };
+    const cl_command_queue failingQueues[] = {
+        (cl_command_queue)&queue0, (cl_command_queue)&invalidQueue };
+    int waits = mock_wait_call_count;
+    errorCode = clextEnqueueMemFillSplit(2, failingQueues, dst.data(),
+        &pattern, sizeof(pattern), size, 0, nullptr, nullptr);
+    check("failed chunks return an error",
+        errorCode == CL_INVALID_COMMAND_QUEUE);
+    check("enqueued chunks are waited for after a failed chunk",
+        mock_wait_call_count - waits == 1);
+
+    return check_result();
+}
@@ -0,0 +1,114 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Checks that large copies between pageable memory and device USM are split
+// into chunks that are staged through host USM, and that other copies are
+// not, by counting the calls to a mock clEnqueueMemcpyINTEL.
+
+#include <CL/cl_ext.h>
+
+#include <vector>
+
+#include "mock_icd.h"
+
+// Writes the source of a copy, like an earlier command that the copy waits for.
+static void _fill_source(void* user_data)
+{
+    std::vector<char>* src = (std::vector<char>*)user_data;
+    for (size_t i = 0; i < src->size(); i++) {
+        (*src)[i] = (char)(i * 3);
+    }
+}
+
+int main(void)
+{
+    // Five full chunks and a partial chunk.
+    const size_t size = 5 * 1024 * 1024 + 123;
+    std::vector<char> src(size);
+    std::vector<char> dst(size);
+    for (size_t i = 0; i < size; i++) {
+        src[i] = (char)(i * 7);
+    }
+
+    cl_int errorCode = CL_SUCCESS;
+    void* deviceMem = clDeviceMemAllocINTEL((cl_context)&mock_context,
+        (cl_device_id)&mock_device, nullptr, size, 0, &errorCode);
+
+    int calls = mock_memcpy_call_count;
+    errorCode = clEnqueueMemcpyINTEL((cl_command_queue)&mock_queue, CL_TRUE,
+        deviceMem, src.data(), size, 0, nullptr, nullptr);
+    check("uploads are staged in chunks",
+        errorCode == CL_SUCCESS && mock_memcpy_call_count - calls == 6);
+
+    calls = mock_memcpy_call_count;
+    errorCode = clEnqueueMemcpyINTEL((cl_command_queue)&mock_queue, CL_TRUE,
+        dst.data(), deviceMem, size, 0, nullptr, nullptr);
+    check("blocking downloads are staged in chunks",
+        errorCode == CL_SUCCESS && mock_memcpy_call_count - calls == 6);
+    check("staged data is copied", dst == src);
+
+    cl_event event = nullptr;
+    calls = mock_memcpy_call_count;
+    errorCode = clEnqueueMemcpyINTEL((cl_command_queue)&mock_queue, CL_FALSE,
+        deviceMem, src.data(), size, 0, nullptr, &event);
+    check("non-blocking uploads are staged and return an event",
+        errorCode == CL_SUCCESS && event != nullptr &&
+        mock_memcpy_call_count - calls == 6);
+
+    // The source is written when the event in the wait list completes, which
+    // is not until the copy waits for it.
+    std::vector<char> lateSrc(size);
+    cl_event pending = mock_create_pending_event(_fill_source, &lateSrc);
+    errorCode = clEnqueueMemcpyINTEL((cl_command_queue)&mock_queue, CL_TRUE,
+        deviceMem, lateSrc.data(), size, 1, &pending, nullptr);
+    clEnqueueMemcpyINTEL((cl_command_queue)&mock_queue, CL_TRUE,
+        dst.data(), deviceMem, size, 0, nullptr, nullptr);
+    _fill_source(&src);
+    check("uploads wait for the wait list before reading the source",
+        errorCode == CL_SUCCESS && dst == src);
+
+    calls = mock_memcpy_call_count;
+    clEnqueueMemcpyINTEL((cl_command_queue)&mock_queue, CL_FALSE,
+        dst.data(), deviceMem, size, 0, nullptr, nullptr);
+    check("non-blocking downloads are not staged",
+        mock_memcpy_call_count - calls == 1);
+
+    calls = mock_memcpy_call_count;
+    clEnqueueMemcpyINTEL((cl_command_queue)&mock_queue, CL_TRUE,
+        deviceMem, src.data(), 4096, 0, nullptr, nullptr);
+    check("small copies are not staged", mock_memcpy_call_count - calls == 1);
+
+    calls = mock_memcpy_call_count;
+    clEnqueueMemcpyINTEL((cl_command_queue)&mock_queue, CL_TRUE,
+        dst.data(), src.data(), size, 0, nullptr, nullptr);
+    check("copies between pageable memory are not staged",
+        mock_memcpy_call_count - calls == 1);
+
+    mock_memcpy_fails = true;
+    errorCode = clEnqueueMemcpyINTEL((cl_command_queue)&mock_queue, CL_TRUE,
+        deviceMem, src.data(), size, 0, nullptr, nullptr);
+    check("failed blocking uploads return an error", errorCode != CL_SUCCESS);
+    errorCode = clEnqueueMemcpyINTEL((cl_command_queue)&mock_queue, CL_TRUE,
+        dst.data(), deviceMem, size, 0, nullptr, nullptr);
+    check("failed blocking downloads return an error",
+        errorCode == CL_OUT_OF_RESOURCES);
+    mock_memcpy_fails = false;
+
+    // Copies for contexts that cannot be tracked are not staged.
+    const mock_object untracked = {
+        mock_device.platform, &mock_device, nullptr };
+    const mock_object untrackedQueue = {
+        mock_device.platform, &mock_device, &untracked };
+    mock_context_destructor_unsupported = true;
+    calls = mock_memcpy_call_count;
+    clEnqueueMemcpyINTEL((cl_command_queue)&untrackedQueue, CL_TRUE,
+        deviceMem, src.data(), size, 0, nullptr, nullptr);
+    check("contexts without destructor callbacks are not staged",
+        mock_memcpy_call_count - calls == 1);
+    mock_context_destructor_unsupported = false;
+
+    return check_result();
+}
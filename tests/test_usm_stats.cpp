@@ -0,0 +1,85 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// Checks that the USM allocation statistics track live bytes, high-water
+// marks, and allocation counts for each context, device, and type of USM,
+// using a mock OpenCL implementation.
+
+#include <CL/cl_ext.h>
+
+#include <string.h>
+
+#include "openclext.h"
+
+#include "mock_icd.h"
+
+int main(void)
+{
+    cl_context context = (cl_context)&mock_context;
+
+    cl_int errorCode = CL_SUCCESS;
+    void* a = clDeviceMemAllocINTEL(
+        context, (cl_device_id)&mock_device, nullptr, 100, 0, &errorCode);
+    void* b = clDeviceMemAllocINTEL(
+        context, (cl_device_id)&mock_device, nullptr, 5000, 0, &errorCode);
+    void* host = clHostMemAllocINTEL(context, nullptr, 64, 0, &errorCode);
+
+    clext_usm_stats stats;
+    errorCode = clextGetUSMStats(
+        context, (cl_device_id)&mock_device, CL_MEM_TYPE_DEVICE_INTEL, &stats);
+    check("live bytes are tracked",
+        errorCode == CL_SUCCESS && stats.live_bytes == 5100 &&
+        stats.live_allocations == 2 && stats.total_allocations == 2);
+    check("allocation sizes are counted",
+        stats.size_buckets[1] == 1 && stats.size_buckets[2] == 1);
+
+    mock_usm_free_fails = true;
+    errorCode = clMemFreeINTEL(context, b);
+    mock_usm_free_fails = false;
+    clextGetUSMStats(
+        context, (cl_device_id)&mock_device, CL_MEM_TYPE_DEVICE_INTEL, &stats);
+    check("failed frees are not tracked",
+        errorCode == CL_INVALID_VALUE && stats.live_bytes == 5100 &&
+        stats.live_allocations == 2 && stats.total_frees == 0);
+
+    clMemFreeINTEL(context, b);
+    clextGetUSMStats(
+        context, (cl_device_id)&mock_device, CL_MEM_TYPE_DEVICE_INTEL, &stats);
+    check("frees are tracked",
+        stats.live_bytes == 100 && stats.live_allocations == 1 &&
+        stats.total_frees == 1);
+    check("the high-water mark is kept after a free",
+        stats.high_water_bytes == 5100);
+
+    clextGetUSMStats(context, nullptr, CL_MEM_TYPE_HOST_INTEL, &stats);
+    check("each type of USM is tracked separately",
+        stats.live_bytes == 64 && stats.size_buckets[0] == 1);
+
+    clextGetUSMStats(
+        context, (cl_device_id)&mock_device, CL_MEM_TYPE_SHARED_INTEL, &stats);
+    check("unused types of USM have no statistics",
+        stats.live_bytes == 0 && stats.total_allocations == 0);
+
+    FILE* stream = tmpfile();
+    clextDumpStats(stream);
+    rewind(stream);
+    char line[256] = "";
+    bool found = false;
+    while (fgets(line, sizeof(line), stream)) {
+        found = found || strstr(line, "USM Allocations") != nullptr;
+    }
+    fclose(stream);
+    check("statistics are dumped", found);
+
+    check("errors are returned",
+        clextGetUSMStats(context, nullptr, CL_MEM_TYPE_HOST_INTEL, nullptr) ==
+            CL_INVALID_VALUE);
+
+    clMemFreeINTEL(context, a);
+    clMemFreeINTEL(context, host);
+
+    return check_result();
+}
@@ -0,0 +1,50 @@
+# Copyright (c) 2021-2026 Ben Ashbaugh
+#
+# SPDX-License-Identifier: MIT or Apache-2.0
+
+# Writes a trace with TRACE_EXE and checks that the trace file is well-formed
+# JSON with a begin and end event for each of the 20 traced calls, from two
+# threads, and no dropped events.
+
+file(REMOVE ${TRACE_FILE})
+execute_process(COMMAND ${TRACE_EXE} ${TRACE_FILE} RESULT_VARIABLE result)
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "${TRACE_EXE} failed: ${result}")
+endif()
+
+file(READ ${TRACE_FILE} trace)
+string(JSON count ERROR_VARIABLE error LENGTH "${trace}" traceEvents)
+if (error)
+    message(FATAL_ERROR "The trace file is not well-formed: ${error}")
+endif()
+if (NOT count EQUAL 40)
+    message(FATAL_ERROR "The trace file has ${count} events, not 40")
+endif()
+
+set(threads)
+math(EXPR last "${count} - 1")
+foreach(index RANGE 0 ${last})
+    string(JSON name GET "${trace}" traceEvents ${index} name)
+    string(JSON phase GET "${trace}" traceEvents ${index} ph)
+    string(JSON tid GET "${trace}" traceEvents ${index} tid)
+    math(EXPR expected "${index} % 2")
+    if (expected EQUAL 0)
+        set(expected B)
+    else()
+        set(expected E)
+    endif()
+    if (NOT name STREQUAL "clEnqueueMemcpyINTEL" OR NOT phase STREQUAL expected)
+        message(FATAL_ERROR "Event ${index} is ${name} ${phase}, not clEnqueueMemcpyINTEL ${expected}")
+    endif()
+    list(APPEND threads ${tid})
+endforeach()
+list(REMOVE_DUPLICATES threads)
+list(LENGTH threads threadCount)
+if (NOT threadCount EQUAL 2)
+    message(FATAL_ERROR "The events are from ${threadCount} threads, not 2")
+endif()
+
+string(JSON dropped GET "${trace}" otherData dropped_events)
+if (NOT dropped EQUAL 0)
+    message(FATAL_ERROR "${dropped} events were dropped")
+endif()
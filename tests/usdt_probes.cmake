@@ -0,0 +1,18 @@
+# Copyright (c) 2021-2026 Ben Ashbaugh
+#
+# SPDX-License-Identifier: MIT or Apache-2.0
+
+# Checks that USDT_EXE contains each of the USDT probes from the openclext
+# provider, by listing its stapsdt notes with READELF.
+
+execute_process(COMMAND ${READELF} -n ${USDT_EXE}
+    OUTPUT_VARIABLE output RESULT_VARIABLE result)
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "${READELF} failed: ${result}")
+endif()
+
+foreach(PROBE call_entry call_dispatch call_missing call_return)
+    if (NOT output MATCHES "Provider: openclext[\r\n]+ *Name: ${PROBE}[\r\n]")
+        message(FATAL_ERROR "${USDT_EXE} does not contain the openclext:${PROBE} probe")
+    endif()
+endforeach()
@@ -0,0 +1,545 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// clext-replay: replays a log of extension function calls captured by an
+// OpenCL Extension Loader built with capture enabled.
+//
+// clext-replay replays against a real OpenCL platform.  Captured platforms,
+// devices, contexts, and command queues are replaced by a single context and
+// command queue created for the chosen device; calls with any other object
+// handles are skipped.  Non-null pointer arguments to memory point to a
+// zero-filled scratch buffer, which is shared USM if the platform supports it,
+// so it may also be used in place of device USM.  Calls that may access more
+// memory through a pointer than the size of the scratch buffer are skipped.
+// Output arguments, such as returned events, get their own zero-filled
+// memory, and the objects returned through them are released after each call.
+// Calls that free memory are never replayed, since they would free the
+// scratch buffer.
+//
+// clext-replay-mock replays against a mock OpenCL implementation where every
+// extension function does nothing, so it measures only the extension loader.
+
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "openclext_clock.h"
+#include "openclext_replay.h"
+
+#define CLEXT_REPLAY_MOCK_PLATFORM_NAME "clext-replay mock"
+
+struct Call {
+    uint32_t function;      // index into functions, or UINT32_MAX
+    uint64_t start_ns;
+    uint64_t duration_ns;
+    cl_int status;
+    size_t firstArg;
+    size_t argCount;
+};
+
+struct FunctionStats {
+    const openclext_replay_function* function = nullptr;
+    std::string name;
+    bool free = false;
+    uint64_t calls = 0;
+    uint64_t skipped = 0;
+    uint64_t mismatched = 0;
+    uint64_t recorded_ns = 0;
+    uint64_t replayed_ns = 0;
+};
+
+struct Log {
+    std::vector<FunctionStats> functions;
+    std::vector<Call> calls;
+    std::vector<openclext_replay_arg> args;
+    std::deque<std::string> strings;
+};
+
+class Reader {
+public:
+    Reader(const std::vector<uint8_t>& data_) : data(data_) {}
+
+    bool eof() const { return offset >= data.size(); }
+    bool error() const { return failed; }
+
+    uint8_t byte()
+    {
+        if (offset >= data.size()) {
+            failed = true;
+            return 0;
+        }
+        return data[offset++];
+    }
+
+    uint64_t varint()
+    {
+        uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            uint8_t b = byte();
+            value |= (uint64_t)(b & 0x7F) << shift;
+            if ((b & 0x80) == 0) break;
+        }
+        return value;
+    }
+
+    int64_t svarint()
+    {
+        uint64_t value = varint();
+        return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+    }
+
+    std::string string()
+    {
+        uint64_t length = varint();
+        if (length > data.size() - offset) {
+            failed = true;
+            return std::string();
+        }
+        std::string str((const char*)data.data() + offset, (size_t)length);
+        offset += (size_t)length;
+        return str;
+    }
+
+private:
+    const std::vector<uint8_t>& data;
+    size_t offset = 0;
+    bool failed = false;
+};
+
+static const openclext_replay_function* findFunction(const std::string& name)
+{
+    for (const openclext_replay_function* function = openclext_replay_functions;
+         function->name != nullptr;
+         function++) {
+        if (name == function->name) {
+            return function;
+        }
+    }
+    return nullptr;
+}
+
+// Functions that free the memory passed to them.
+static const char* const freeFunctions[] = {
+    "clEnqueueSVMFreeARM",
+    "clMemBlockingFreeINTEL",
+    "clMemFreeINTEL",
+    "clSVMFreeARM",
+};
+
+static bool isFreeFunction(const std::string& name)
+{
+    for (const char* freeFunction : freeFunctions) {
+        if (name == freeFunction) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool readLog(const char* filename, Log& log)
+{
+    FILE* file = fopen(filename, "rb");
+    if (file == nullptr) {
+        fprintf(stderr, "Couldn't open %s.\n", filename);
+        return false;
+    }
+    std::vector<uint8_t> data;
+    uint8_t buffer[65536];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        data.insert(data.end(), buffer, buffer + count);
+    }
+    fclose(file);
+
+    Reader reader(data);
+    for (const char* magic = OPENCLEXT_CAPTURE_MAGIC; ; magic++) {
+        if (reader.byte() != (uint8_t)*magic) {
+            fprintf(stderr, "%s is not a capture log.\n", filename);
+            return false;
+        }
+        if (*magic == '\0') break;
+    }
+    uint64_t version = reader.varint();
+    if (version != OPENCLEXT_CAPTURE_VERSION) {
+        fprintf(stderr, "%s has unsupported version %" PRIu64 ".\n",
+            filename, version);
+        return false;
+    }
+
+    // Maps function IDs in the log to indices into log.functions.
+    std::vector<uint32_t> functionIndices;
+
+    while (!reader.eof() && !reader.error()) {
+        uint8_t type = reader.byte();
+        if (type == OPENCLEXT_CAPTURE_RECORD_FUNCTION) {
+            uint64_t id = reader.varint();
+            std::string name = reader.string();
+            if (id >= functionIndices.size()) {
+                functionIndices.resize(id + 1, UINT32_MAX);
+            }
+            functionIndices[id] = (uint32_t)log.functions.size();
+            log.functions.push_back(FunctionStats());
+            log.functions.back().function = findFunction(name);
+            log.functions.back().name = name;
+            log.functions.back().free = isFreeFunction(name);
+        } else if (type == OPENCLEXT_CAPTURE_RECORD_CALL) {
+            Call call;
+            uint64_t id = reader.varint();
+            call.function = id < functionIndices.size() ?
+                functionIndices[id] : UINT32_MAX;
+            call.start_ns = reader.varint();
+            call.duration_ns = reader.varint();
+            call.status = (cl_int)reader.svarint();
+            call.argCount = (size_t)reader.varint();
+            call.firstArg = log.args.size();
+            for (size_t i = 0; i < call.argCount && !reader.error(); i++) {
+                openclext_replay_arg arg = {};
+                arg.kind = reader.byte();
+                switch (arg.kind) {
+                case OPENCLEXT_CAPTURE_ARG_SCALAR:
+                    arg.value = (uint64_t)reader.svarint();
+                    break;
+                case OPENCLEXT_CAPTURE_ARG_POINTER:
+                case OPENCLEXT_CAPTURE_ARG_FLOAT:
+                case OPENCLEXT_CAPTURE_ARG_HANDLE:
+                    arg.value = reader.varint();
+                    break;
+                case OPENCLEXT_CAPTURE_ARG_STRING:
+                    log.strings.push_back(reader.string());
+                    arg.string = log.strings.back().c_str();
+                    break;
+                default:
+                    break;
+                }
+                log.args.push_back(arg);
+            }
+            log.calls.push_back(call);
+        } else {
+            fprintf(stderr, "Unknown record type %u.\n", type);
+            return false;
+        }
+    }
+    if (reader.error()) {
+        // The log may have been truncated if the process did not exit
+        // normally.  Replay the complete records.
+        fprintf(stderr, "Warning: %s is truncated.\n", filename);
+        if (!log.calls.empty() &&
+            log.calls.back().firstArg + log.calls.back().argCount > log.args.size()) {
+            log.calls.pop_back();
+        }
+    }
+
+    // Calls are written in the order they return, but are replayed in the
+    // order they were called.
+    std::stable_sort(log.calls.begin(), log.calls.end(),
+        [](const Call& a, const Call& b) {
+            return a.start_ns < b.start_ns;
+        });
+    return true;
+}
+
+class Binder : public openclext_replay_binder {
+public:
+    cl_platform_id platform = nullptr;
+    cl_device_id device = nullptr;
+    cl_context context = nullptr;
+    cl_command_queue queue = nullptr;
+    bool mock = false;
+    void* scratch = nullptr;
+    uint64_t scratchSize = 0;
+    bool scratchUSM = false;
+
+    void* handle(cl_platform_id, uint64_t) override { return platform; }
+    void* handle(cl_device_id, uint64_t) override { return device; }
+    void* handle(cl_context, uint64_t) override { return context; }
+    void* handle(cl_command_queue, uint64_t) override { return queue; }
+
+    void* handle(const void*, uint64_t id) override
+    {
+        // The mock implementation never looks at other objects, so any
+        // unique non-null value will do.
+        return mock ? (void*)(uintptr_t)(0x10000 + id * 16) : nullptr;
+    }
+
+    void* pointer(uint64_t size) override
+    {
+        return size <= scratchSize ? scratch : nullptr;
+    }
+
+    void* output(
+        uint64_t size,
+        size_t elementSize,
+        void (*release)(const void* values, size_t count)) override
+    {
+        size = std::max<uint64_t>(size, elementSize);
+        if (size > scratchSize) {
+            return nullptr;
+        }
+        if (outputCount == outputs.size()) {
+            outputs.push_back(Output());
+        }
+        Output& output = outputs[outputCount++];
+        output.storage.assign(
+            (size_t)(size + sizeof(uint64_t) - 1) / sizeof(uint64_t), 0);
+        output.count = (size_t)size / elementSize;
+        output.release = release;
+        return output.storage.data();
+    }
+
+    // Releases the objects returned through the output arguments of the last
+    // call.
+    void releaseOutputs()
+    {
+        for (size_t i = 0; i < outputCount; i++) {
+            if (outputs[i].release) {
+                outputs[i].release(outputs[i].storage.data(), outputs[i].count);
+            }
+        }
+        outputCount = 0;
+    }
+
+private:
+    // The storage for outputs is reused by each call.
+    struct Output {
+        std::vector<uint64_t> storage;
+        size_t count = 0;
+        void (*release)(const void* values, size_t count) = nullptr;
+    };
+    std::vector<Output> outputs;
+    size_t outputCount = 0;
+};
+
+static bool createScratch(Binder& binder, size_t size)
+{
+    // The mock implementation never looks at the scratch buffer.
+    if (!binder.mock) {
+        binder.scratch = clSharedMemAllocINTEL(
+            binder.context, binder.device, nullptr, size, 0, nullptr);
+        binder.scratchUSM = binder.scratch != nullptr;
+    }
+    if (binder.scratch == nullptr) {
+        binder.scratch = calloc(1, size);
+    } else {
+        memset(binder.scratch, 0, size);
+    }
+    if (binder.scratch == nullptr) {
+        fprintf(stderr, "Couldn't allocate %zu bytes of scratch memory.\n", size);
+        return false;
+    }
+    binder.scratchSize = size;
+    return true;
+}
+
+static void releaseScratch(Binder& binder)
+{
+    if (binder.scratchUSM) {
+        // The queue is finished before the scratch memory is released, so it
+        // can be freed without blocking if there is no blocking free, e.g.
+        // because USM is emulated with SVM.
+        if (clMemBlockingFreeINTEL(binder.context, binder.scratch) != CL_SUCCESS) {
+            clMemFreeINTEL(binder.context, binder.scratch);
+        }
+    } else {
+        free(binder.scratch);
+    }
+}
+
+static bool createObjects(Binder& binder, cl_uint platformIndex, cl_uint deviceIndex)
+{
+    cl_uint numPlatforms = 0;
+    clGetPlatformIDs(0, nullptr, &numPlatforms);
+    if (platformIndex >= numPlatforms) {
+        fprintf(stderr, "Platform %u is not available.\n", platformIndex);
+        return false;
+    }
+    std::vector<cl_platform_id> platforms(numPlatforms);
+    clGetPlatformIDs(numPlatforms, platforms.data(), nullptr);
+    binder.platform = platforms[platformIndex];
+
+    char name[256] = "";
+    clGetPlatformInfo(binder.platform, CL_PLATFORM_NAME, sizeof(name), name, nullptr);
+    binder.mock = strcmp(name, CLEXT_REPLAY_MOCK_PLATFORM_NAME) == 0;
+
+    cl_uint numDevices = 0;
+    clGetDeviceIDs(binder.platform, CL_DEVICE_TYPE_ALL, 0, nullptr, &numDevices);
+    if (deviceIndex >= numDevices) {
+        fprintf(stderr, "Device %u is not available.\n", deviceIndex);
+        return false;
+    }
+    std::vector<cl_device_id> devices(numDevices);
+    clGetDeviceIDs(binder.platform, CL_DEVICE_TYPE_ALL, numDevices, devices.data(), nullptr);
+    binder.device = devices[deviceIndex];
+
+    cl_int errorCode = CL_SUCCESS;
+    binder.context = clCreateContext(
+        nullptr, 1, &binder.device, nullptr, nullptr, &errorCode);
+    if (binder.context != nullptr) {
+        binder.queue = clCreateCommandQueue(
+            binder.context, binder.device, 0, &errorCode);
+    }
+    if (binder.queue == nullptr) {
+        fprintf(stderr, "Couldn't create a command queue (%d).\n", errorCode);
+        return false;
+    }
+
+    printf("Replaying on %s.\n", name);
+    return true;
+}
+
+static void usage(const char* argv0)
+{
+    fprintf(stderr,
+        "Usage: %s [-p platform] [-d device] [-r repeat] [-m bytes] [-t] file\n"
+        "  -p platform  Index of the platform to replay on (default 0).\n"
+        "  -d device    Index of the device to replay on (default 0).\n"
+        "  -r repeat    Number of times to replay the log (default 1).\n"
+        "  -m bytes     Size of the scratch buffer for pointers (default 64MB).\n"
+        "               Calls that may access more memory are skipped.\n"
+        "  -t           Replay at the recorded speed, rather than maximum speed.\n",
+        argv0);
+}
+
+int main(int argc, char** argv)
+{
+    cl_uint platformIndex = 0;
+    cl_uint deviceIndex = 0;
+    unsigned repeat = 1;
+    size_t scratchSize = 64 * 1024 * 1024;
+    bool recordedSpeed = false;
+    const char* filename = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-p") && i + 1 < argc) {
+            platformIndex = (cl_uint)atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-d") && i + 1 < argc) {
+            deviceIndex = (cl_uint)atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-r") && i + 1 < argc) {
+            repeat = (unsigned)atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-m") && i + 1 < argc) {
+            scratchSize = (size_t)strtoull(argv[++i], nullptr, 0);
+        } else if (!strcmp(argv[i], "-t")) {
+            recordedSpeed = true;
+        } else if (argv[i][0] != '-' && filename == nullptr) {
+            filename = argv[i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (filename == nullptr) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // Don't capture the replay, which would overwrite the log.
+#if defined(_WIN32)
+    _putenv("CLEXT_CAPTURE_FILE=");
+#else
+    unsetenv("CLEXT_CAPTURE_FILE");
+#endif
+
+    Log log;
+    if (!readLog(filename, log)) {
+        return 1;
+    }
+    printf("Read %zu calls to %zu functions from %s.\n",
+        log.calls.size(), log.functions.size(), filename);
+
+    Binder binder;
+    if (!createObjects(binder, platformIndex, deviceIndex) ||
+        !createScratch(binder, scratchSize)) {
+        return 1;
+    }
+
+    uint64_t replayStart = openclext_now_ns();
+    for (unsigned r = 0; r < repeat; r++) {
+        uint64_t passStart = openclext_now_ns();
+        for (const auto& call : log.calls) {
+            if (call.function == UINT32_MAX) {
+                continue;
+            }
+            FunctionStats& stats = log.functions[call.function];
+            stats.calls++;
+            stats.recorded_ns += call.duration_ns;
+            if (stats.function == nullptr || stats.free) {
+                stats.skipped++;
+                continue;
+            }
+
+            if (recordedSpeed) {
+                uint64_t target = passStart + call.start_ns;
+                uint64_t now = openclext_now_ns();
+                if (target > now) {
+                    std::this_thread::sleep_for(
+                        std::chrono::nanoseconds(target - now));
+                }
+            }
+
+            binder.args = log.args.data() + call.firstArg;
+            binder.count = call.argCount;
+            binder.skipped = false;
+
+            uint64_t start = openclext_now_ns();
+            cl_int status = stats.function->invoke(binder);
+            stats.replayed_ns += openclext_now_ns() - start;
+            binder.releaseOutputs();
+
+            if (binder.skipped) {
+                stats.skipped++;
+            } else if (status != call.status) {
+                stats.mismatched++;
+            }
+        }
+        clFinish(binder.queue);
+    }
+    uint64_t replayEnd = openclext_now_ns();
+
+    std::sort(log.functions.begin(), log.functions.end(),
+        [](const FunctionStats& a, const FunctionStats& b) {
+            return a.calls > b.calls;
+        });
+
+    printf("%-48s %10s %10s %10s %14s %14s\n",
+        "Function", "Calls", "Skipped", "Mismatch", "Recorded (ns)", "Replayed (ns)");
+    uint64_t total = 0;
+    for (const auto& stats : log.functions) {
+        if (stats.calls == 0) {
+            continue;
+        }
+        uint64_t replayed = stats.calls - stats.skipped;
+        printf("%-48s %10" PRIu64 " %10" PRIu64 " %10" PRIu64 " %14" PRIu64 " %14" PRIu64 "%s\n",
+            stats.name.c_str(),
+            stats.calls,
+            stats.skipped,
+            stats.mismatched,
+            stats.recorded_ns / stats.calls,
+            replayed ? stats.replayed_ns / replayed : 0,
+            stats.function == nullptr ? " (unknown function)" :
+            stats.free ? " (frees are not replayed)" : "");
+        total += replayed;
+    }
+
+    double seconds = (replayEnd - replayStart) / 1e9;
+    printf("Replayed %" PRIu64 " calls in %.3f s (%.0f calls/s).\n",
+        total, seconds, seconds > 0.0 ? total / seconds : 0.0);
+
+    releaseScratch(binder);
+    clReleaseCommandQueue(binder.queue);
+    clReleaseContext(binder.context);
+    return 0;
+}
@@ -0,0 +1,230 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// A mock OpenCL implementation with a single platform and device, linked
+// into clext-replay-mock in place of the real OpenCL library.  Every
+// extension function is supported and does nothing, so a replay measures
+// only the overhead of the extension loader.
+
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+
+#include <string.h>
+
+#include "openclext_replay.h"
+
+#define CLEXT_REPLAY_MOCK_PLATFORM_NAME "clext-replay mock"
+
+static int _platform, _device, _context, _queue;
+
+template<typename T>
+static cl_int _return_info(T value, size_t size, void* param_value, size_t* size_ret)
+{
+    if (param_value) {
+        if (size < sizeof(T)) return CL_INVALID_VALUE;
+        memcpy(param_value, &value, sizeof(T));
+    }
+    if (size_ret) *size_ret = sizeof(T);
+    return CL_SUCCESS;
+}
+
+extern "C" {
+
+CL_API_ENTRY cl_int CL_API_CALL clGetPlatformIDs(
+    cl_uint num_entries,
+    cl_platform_id* platforms,
+    cl_uint* num_platforms)
+{
+    if (platforms && num_entries > 0) platforms[0] = (cl_platform_id)&_platform;
+    if (num_platforms) *num_platforms = 1;
+    return CL_SUCCESS;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clGetPlatformInfo(
+    cl_platform_id platform,
+    cl_platform_info param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    if (param_name == CL_PLATFORM_NAME) {
+        const char name[] = CLEXT_REPLAY_MOCK_PLATFORM_NAME;
+        if (param_value) {
+            if (param_value_size < sizeof(name)) return CL_INVALID_VALUE;
+            memcpy(param_value, name, sizeof(name));
+        }
+        if (param_value_size_ret) *param_value_size_ret = sizeof(name);
+        return CL_SUCCESS;
+    }
+    return CL_INVALID_VALUE;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clGetDeviceIDs(
+    cl_platform_id platform,
+    cl_device_type device_type,
+    cl_uint num_entries,
+    cl_device_id* devices,
+    cl_uint* num_devices)
+{
+    if (devices && num_entries > 0) devices[0] = (cl_device_id)&_device;
+    if (num_devices) *num_devices = 1;
+    return CL_SUCCESS;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clGetDeviceInfo(
+    cl_device_id device,
+    cl_device_info param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    if (param_name == CL_DEVICE_PLATFORM) {
+        return _return_info((cl_platform_id)&_platform,
+            param_value_size, param_value, param_value_size_ret);
+    }
+    return CL_INVALID_VALUE;
+}
+
+CL_API_ENTRY cl_context CL_API_CALL clCreateContext(
+    const cl_context_properties* properties,
+    cl_uint num_devices,
+    const cl_device_id* devices,
+    void (CL_CALLBACK* pfn_notify)(const char*, const void*, size_t, void*),
+    void* user_data,
+    cl_int* errcode_ret)
+{
+    if (errcode_ret) *errcode_ret = CL_SUCCESS;
+    return (cl_context)&_context;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clGetContextInfo(
+    cl_context context,
+    cl_context_info param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    if (param_name == CL_CONTEXT_NUM_DEVICES) {
+        return _return_info((cl_uint)1,
+            param_value_size, param_value, param_value_size_ret);
+    }
+    if (param_name == CL_CONTEXT_DEVICES) {
+        return _return_info((cl_device_id)&_device,
+            param_value_size, param_value, param_value_size_ret);
+    }
+    return CL_INVALID_VALUE;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clReleaseContext(
+    cl_context context)
+{
+    return CL_SUCCESS;
+}
+
+CL_API_ENTRY cl_command_queue CL_API_CALL clCreateCommandQueue(
+    cl_context context,
+    cl_device_id device,
+    cl_command_queue_properties properties,
+    cl_int* errcode_ret)
+{
+    if (errcode_ret) *errcode_ret = CL_SUCCESS;
+    return (cl_command_queue)&_queue;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clGetCommandQueueInfo(
+    cl_command_queue command_queue,
+    cl_command_queue_info param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    if (param_name == CL_QUEUE_DEVICE) {
+        return _return_info((cl_device_id)&_device,
+            param_value_size, param_value, param_value_size_ret);
+    }
+    if (param_name == CL_QUEUE_CONTEXT) {
+        return _return_info((cl_context)&_context,
+            param_value_size, param_value, param_value_size_ret);
+    }
+    return CL_INVALID_VALUE;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clFinish(
+    cl_command_queue command_queue)
+{
+    return CL_SUCCESS;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clReleaseCommandQueue(
+    cl_command_queue command_queue)
+{
+    return CL_SUCCESS;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clGetKernelInfo(
+    cl_kernel kernel,
+    cl_kernel_info param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    if (param_name == CL_KERNEL_CONTEXT) {
+        return _return_info((cl_context)&_context,
+            param_value_size, param_value, param_value_size_ret);
+    }
+    return CL_INVALID_VALUE;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clGetMemObjectInfo(
+    cl_mem memobj,
+    cl_mem_info param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    if (param_name == CL_MEM_CONTEXT) {
+        return _return_info((cl_context)&_context,
+            param_value_size, param_value, param_value_size_ret);
+    }
+    return CL_INVALID_VALUE;
+}
+
+CL_API_ENTRY cl_int CL_API_CALL clGetEventInfo(
+    cl_event event,
+    cl_event_info param_name,
+    size_t param_value_size,
+    void* param_value,
+    size_t* param_value_size_ret)
+{
+    if (param_name == CL_EVENT_CONTEXT) {
+        return _return_info((cl_context)&_context,
+            param_value_size, param_value, param_value_size_ret);
+    }
+    return CL_INVALID_VALUE;
+}
+
+CL_API_ENTRY void* CL_API_CALL clGetExtensionFunctionAddressForPlatform(
+    cl_platform_id platform,
+    const char* func_name)
+{
+    for (const openclext_replay_function* function = openclext_replay_functions;
+         function->name != nullptr;
+         function++) {
+        if (strcmp(function->name, func_name) == 0) {
+            return function->null_function;
+        }
+    }
+    return nullptr;
+}
+
+CL_API_ENTRY void* CL_API_CALL clGetExtensionFunctionAddress(
+    const char* func_name)
+{
+    return clGetExtensionFunctionAddressForPlatform(nullptr, func_name);
+}
+
+} // extern "C"
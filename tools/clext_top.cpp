@@ -0,0 +1,278 @@
+/*******************************************************************************
+// Copyright (c) 2021-2026 Ben Ashbaugh
+//
+// SPDX-License-Identifier: MIT or Apache-2.0
+*/
+
+// clext-top: displays live extension API metrics for all running processes
+// that use an OpenCL Extension Loader built with live metrics enabled.
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "openclext_clock.h"
+#include "openclext_metrics_layout.h"
+
+struct Process {
+    const openclext_metrics_segment* segment = nullptr;
+    ino_t inode = 0;
+    uint64_t startTime = 0;
+    std::vector<uint64_t> prevCalls;
+    std::vector<uint64_t> prevErrors;
+    bool seen = false;
+};
+
+struct Row {
+    const char* name;
+    double callRate;
+    double errorRate;
+    uint64_t calls;
+    uint64_t errors;
+    double overhead;
+};
+
+static const openclext_metrics_segment* mapSegment(
+    const std::string& name,
+    ino_t* inode)
+{
+    int fd = shm_open(("/" + name).c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return nullptr;
+    }
+    *inode = st.st_ino;
+
+    void* ptr = mmap(nullptr, sizeof(openclext_metrics_segment),
+        PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED) {
+        return nullptr;
+    }
+
+    const openclext_metrics_segment* segment =
+        (const openclext_metrics_segment*)ptr;
+    if (segment->header.magic.load(std::memory_order_acquire) !=
+            OPENCLEXT_METRICS_MAGIC ||
+        segment->header.version != OPENCLEXT_METRICS_VERSION ||
+        segment->header.slot_count != OPENCLEXT_METRICS_SLOTS) {
+        munmap(ptr, sizeof(openclext_metrics_segment));
+        return nullptr;
+    }
+
+    return segment;
+}
+
+static void updateProcesses(std::map<std::string, Process>& processes)
+{
+    for (auto& it : processes) {
+        it.second.seen = false;
+    }
+
+    DIR* dir = opendir("/dev/shm");
+    if (dir) {
+        const size_t prefixLength = strlen(OPENCLEXT_METRICS_PREFIX);
+        while (struct dirent* entry = readdir(dir)) {
+            if (strncmp(entry->d_name, OPENCLEXT_METRICS_PREFIX, prefixLength)) {
+                continue;
+            }
+            Process& process = processes[entry->d_name];
+
+            // A segment that was removed and created again by a process
+            // with the same process ID is a different shared memory object,
+            // so it must be mapped again.
+            struct stat st;
+            if (process.segment &&
+                (fstatat(dirfd(dir), entry->d_name, &st, 0) != 0 ||
+                 st.st_ino != process.inode)) {
+                munmap((void*)process.segment, sizeof(openclext_metrics_segment));
+                process.segment = nullptr;
+            }
+            if (process.segment == nullptr) {
+                process.segment = mapSegment(entry->d_name, &process.inode);
+            }
+            process.seen = process.segment != nullptr;
+        }
+        closedir(dir);
+    }
+
+    // Forget segments that have been removed, and segments left behind by
+    // processes that exited without removing them.
+    for (auto it = processes.begin(); it != processes.end(); ) {
+        const openclext_metrics_segment* segment = it->second.segment;
+        bool alive = it->second.seen &&
+            (kill((pid_t)segment->header.pid, 0) == 0 || errno == EPERM);
+        if (!alive) {
+            if (segment) {
+                munmap((void*)segment, sizeof(openclext_metrics_segment));
+            }
+            it = processes.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+// Counters that went backwards were reset, so their rate is not known.
+static double getRate(uint64_t current, uint64_t previous, double interval)
+{
+    return interval > 0.0 && current > previous ?
+        (current - previous) / interval : 0.0;
+}
+
+static void printProcess(Process& process, double interval, unsigned maxRows)
+{
+    const openclext_metrics_header& header = process.segment->header;
+    uint32_t used = std::min(
+        header.slot_used.load(std::memory_order_relaxed), header.slot_count);
+
+    // The counters start again from zero when the segment is created again,
+    // for example by a new process with the same process ID.
+    if (header.start_time != process.startTime ||
+        process.prevCalls.size() != header.slot_count) {
+        process.startTime = header.start_time;
+        process.prevCalls.assign(header.slot_count, 0);
+        process.prevErrors.assign(header.slot_count, 0);
+    }
+
+    std::vector<Row> rows;
+    double totalCallRate = 0.0;
+    double totalErrorRate = 0.0;
+    double totalOverhead = 0.0;
+    for (uint32_t i = 0; i < used; i++) {
+        const openclext_metrics_slot& slot = process.segment->slots[i];
+        if (slot.ready.load(std::memory_order_acquire) == 0) {
+            continue;
+        }
+
+        Row row;
+        row.name = slot.name;
+        row.calls = slot.calls.load(std::memory_order_relaxed);
+        row.errors = slot.errors.load(std::memory_order_relaxed);
+        row.callRate = getRate(row.calls, process.prevCalls[i], interval);
+        row.errorRate = getRate(row.errors, process.prevErrors[i], interval);
+
+        uint64_t samples = slot.overhead_samples.load(std::memory_order_relaxed);
+        uint64_t overhead = slot.overhead_ns.load(std::memory_order_relaxed);
+        row.overhead = samples ? (double)overhead / samples : 0.0;
+
+        process.prevCalls[i] = row.calls;
+        process.prevErrors[i] = row.errors;
+
+        totalCallRate += row.callRate;
+        totalErrorRate += row.errorRate;
+        totalOverhead += row.overhead * row.calls;
+        rows.push_back(row);
+    }
+
+    std::sort(rows.begin(), rows.end(),
+        [](const Row& a, const Row& b) {
+            if (a.callRate != b.callRate) return a.callRate > b.callRate;
+            return a.calls > b.calls;
+        });
+
+    printf("PID %u (%s): %.0f calls/s, %.0f errors/s, "
+        "est. loader overhead %.3f ms total, up %" PRIu64 "s\n",
+        header.pid, header.process_name,
+        totalCallRate, totalErrorRate, totalOverhead / 1e6,
+        (uint64_t)time(nullptr) - header.start_time);
+    printf("  %-48s %12s %10s %14s %10s %10s\n",
+        "Function", "Calls/s", "Errors/s", "Calls", "Errors", "Ovhd (ns)");
+    for (size_t i = 0; i < rows.size() && i < maxRows; i++) {
+        const Row& row = rows[i];
+        printf("  %-48s %12.0f %10.0f %14" PRIu64 " %10" PRIu64 " %10.0f\n",
+            row.name, row.callRate, row.errorRate,
+            row.calls, row.errors, row.overhead);
+    }
+    printf("\n");
+}
+
+static void usage(const char* argv0)
+{
+    fprintf(stderr,
+        "Usage: %s [-d seconds] [-n iterations] [-p pid] [-r rows] [-b]\n"
+        "  -d seconds     Delay between updates (default 1).\n"
+        "  -n iterations  Exit after this many updates (default: never).\n"
+        "  -p pid         Only show the process with this process ID.\n"
+        "  -r rows        Show at most this many functions per process (default 20).\n"
+        "  -b             Batch mode: do not clear the screen between updates.\n",
+        argv0);
+}
+
+int main(int argc, char** argv)
+{
+    double delay = 1.0;
+    unsigned iterations = 0;
+    unsigned maxRows = 20;
+    long pid = 0;
+    bool batch = false;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "d:n:p:r:bh")) != -1) {
+        switch (opt) {
+        case 'd': delay = atof(optarg); break;
+        case 'n': iterations = (unsigned)atoi(optarg); break;
+        case 'p': pid = atol(optarg); break;
+        case 'r': maxRows = (unsigned)atoi(optarg); break;
+        case 'b': batch = true; break;
+        default: usage(argv[0]); return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (delay <= 0.0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::map<std::string, Process> processes;
+    uint64_t lastNs = 0;
+    for (unsigned i = 0; iterations == 0 || i < iterations; i++) {
+        updateProcesses(processes);
+
+        // Rates are not known until the second update.
+        uint64_t nowNs = openclext_now_ns();
+        double interval = lastNs ? (nowNs - lastNs) / 1e9 : 0.0;
+        lastNs = nowNs;
+
+        if (!batch) {
+            printf("\033[H\033[2J");
+        }
+        time_t now = time(nullptr);
+        printf("clext-top - %s", ctime(&now));
+        printf("%zu processes\n\n", processes.size());
+        for (auto& it : processes) {
+            if (pid == 0 || pid == (long)it.second.segment->header.pid) {
+                printProcess(it.second, interval, maxRows);
+            }
+        }
+        fflush(stdout);
+
+        if (iterations != 0 && i + 1 == iterations) {
+            break;
+        }
+        struct timespec ts;
+        ts.tv_sec = (time_t)delay;
+        ts.tv_nsec = (long)((delay - ts.tv_sec) * 1e9);
+        nanosleep(&ts, nullptr);
+    }
+
+    return 0;
+}